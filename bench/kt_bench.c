@@ -0,0 +1,481 @@
+// K-Term throughput benchmark.
+//
+// Generates reproducible corpora (fixed-seed PRNG, no input files) and feeds
+// each one through a fresh terminal, timing the three host-side phases
+// separately: parsing (KTerm_ProcessChar), op flush (KTerm_FlushOps) and
+// render-buffer preparation (KTerm_PrepareRenderBuffer). Runs headless against
+// the mock Situation backend.
+//
+// Build: gcc -O2 -o kt_bench bench/kt_bench.c -I. -Itests -lm -lpthread
+// Usage: kt_bench [--json PATH|-] [--mb N] [--runs N] [--only NAME] [--dump DIR]
+
+#define KTERM_IMPLEMENTATION
+#define KTERM_TESTING
+#include "../kterm.h"
+#include "mock_situation.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_WIDTH 132
+#define BENCH_HEIGHT 50
+#define BENCH_CHUNK 4096 // Bytes parsed per frame before a flush and prepare
+#define BENCH_SEED 0x4B54524Du // "KTRM"
+
+typedef struct {
+    char* data;
+    size_t len;
+    size_t cap;
+    uint32_t rng;
+} Corpus;
+
+typedef struct {
+    const char* name;
+    const char* description;
+    void (*generate)(Corpus* c, size_t target);
+} CorpusDef;
+
+typedef struct {
+    double parse_ns;
+    double flush_ns;
+    double prepare_ns;
+    int frames;
+} PhaseTimes;
+
+// =============================================================================
+// CORPUS BUILDING
+// =============================================================================
+
+static uint32_t Rand(Corpus* c) {
+    // xorshift32: the same corpus on every machine and run
+    uint32_t x = c->rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return c->rng = x;
+}
+
+static int RandRange(Corpus* c, int lo, int hi) {
+    return lo + (int)(Rand(c) % (uint32_t)(hi - lo + 1));
+}
+
+static void Append(Corpus* c, const char* data, size_t len) {
+    if (c->len + len > c->cap) {
+        size_t cap = c->cap ? c->cap : 65536;
+        while (cap < c->len + len) cap *= 2;
+        c->data = realloc(c->data, cap);
+        if (!c->data) { fprintf(stderr, "kt_bench: out of memory\n"); exit(1); }
+        c->cap = cap;
+    }
+    memcpy(c->data + c->len, data, len);
+    c->len += len;
+}
+
+static void AppendStr(Corpus* c, const char* s) {
+    Append(c, s, strlen(s));
+}
+
+static void AppendFmt(Corpus* c, const char* fmt, ...) {
+    char buf[256];
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+    if (n > 0) Append(c, buf, (size_t)n < sizeof(buf) ? (size_t)n : sizeof(buf) - 1);
+}
+
+static void AppendUTF8(Corpus* c, uint32_t cp) {
+    char b[4];
+    if (cp < 0x80) { b[0] = (char)cp; Append(c, b, 1); }
+    else if (cp < 0x800) { b[0] = (char)(0xC0 | (cp >> 6)); b[1] = (char)(0x80 | (cp & 0x3F)); Append(c, b, 2); }
+    else if (cp < 0x10000) {
+        b[0] = (char)(0xE0 | (cp >> 12)); b[1] = (char)(0x80 | ((cp >> 6) & 0x3F)); b[2] = (char)(0x80 | (cp & 0x3F));
+        Append(c, b, 3);
+    } else {
+        b[0] = (char)(0xF0 | (cp >> 18)); b[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+        b[2] = (char)(0x80 | ((cp >> 6) & 0x3F)); b[3] = (char)(0x80 | (cp & 0x3F));
+        Append(c, b, 4);
+    }
+}
+
+static void AppendBase64(Corpus* c, const unsigned char* data, size_t len) {
+    static const char table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    char out[4];
+    for (size_t i = 0; i < len; i += 3) {
+        uint32_t v = (uint32_t)data[i] << 16;
+        if (i + 1 < len) v |= (uint32_t)data[i + 1] << 8;
+        if (i + 2 < len) v |= data[i + 2];
+        out[0] = table[(v >> 18) & 63];
+        out[1] = table[(v >> 12) & 63];
+        out[2] = i + 1 < len ? table[(v >> 6) & 63] : '=';
+        out[3] = i + 2 < len ? table[v & 63] : '=';
+        Append(c, out, 4);
+    }
+}
+
+static void AppendWord(Corpus* c) {
+    char word[16];
+    int n = RandRange(c, 2, 10);
+    for (int i = 0; i < n; i++) word[i] = (char)('a' + Rand(c) % 26);
+    Append(c, word, (size_t)n);
+}
+
+// =============================================================================
+// CORPORA
+// =============================================================================
+
+// Plain text lines, like `cat` of a log file
+static void GenAscii(Corpus* c, size_t target) {
+    while (c->len < target) {
+        int len = RandRange(c, 20, BENCH_WIDTH - 4);
+        for (int i = 0; i < len; i++) {
+            char ch = (char)(Rand(c) % 8 == 0 ? ' ' : 0x21 + Rand(c) % 94);
+            Append(c, &ch, 1);
+        }
+        AppendStr(c, "\r\n");
+    }
+}
+
+// Indexed-color SGR on nearly every word, like `ls --color` or compiler output
+static void GenSgr256(Corpus* c, size_t target) {
+    while (c->len < target) {
+        int words = RandRange(c, 4, 14);
+        for (int w = 0; w < words; w++) {
+            switch (Rand(c) % 4) {
+                case 0: AppendFmt(c, "\x1B[38;5;%dm", RandRange(c, 0, 255)); break;
+                case 1: AppendFmt(c, "\x1B[38;5;%d;48;5;%dm", RandRange(c, 0, 255), RandRange(c, 0, 255)); break;
+                case 2: AppendFmt(c, "\x1B[1;%dm", RandRange(c, 30, 37)); break;
+                default: AppendStr(c, "\x1B[m"); break;
+            }
+            AppendWord(c);
+            AppendStr(c, " ");
+        }
+        AppendStr(c, "\x1B[m\r\n");
+    }
+}
+
+// 24-bit color changing every few cells, like gradients and syntax themes
+static void GenTruecolor(Corpus* c, size_t target) {
+    while (c->len < target) {
+        int cells = RandRange(c, 40, BENCH_WIDTH - 2);
+        for (int x = 0; x < cells; x += 2) {
+            AppendFmt(c, "\x1B[38;2;%d;%d;%d;48;2;%d;%d;%dm", RandRange(c, 0, 255), RandRange(c, 0, 255),
+                      RandRange(c, 0, 255), RandRange(c, 0, 255), RandRange(c, 0, 255), RandRange(c, 0, 255));
+            AppendStr(c, Rand(c) & 1 ? "\xE2\x96\x80\xE2\x96\x80" : "##");
+        }
+        AppendStr(c, "\x1B[m\r\n");
+    }
+}
+
+// Scrolling inside a margin with insert/delete line and reverse index, like vim or less
+static void GenScrollRegion(Corpus* c, size_t target) {
+    while (c->len < target) {
+        int top = RandRange(c, 1, 4);
+        int bottom = BENCH_HEIGHT - RandRange(c, 0, 3);
+        AppendFmt(c, "\x1B[%d;%dr", top, bottom);
+        for (int i = 0; i < 40 && c->len < target; i++) {
+            switch (Rand(c) % 6) {
+                case 0: AppendFmt(c, "\x1B[%dH\x1BM", top); break;        // Scroll back one line
+                case 1: AppendFmt(c, "\x1B[%dH\x1B[%dL", RandRange(c, top, bottom), RandRange(c, 1, 3)); break;
+                case 2: AppendFmt(c, "\x1B[%dH\x1B[%dM", RandRange(c, top, bottom), RandRange(c, 1, 3)); break;
+                case 3: AppendFmt(c, "\x1B[%dS", RandRange(c, 1, 5)); break;
+                default: AppendFmt(c, "\x1B[%dH\n", bottom); break;          // Scroll forward one line
+            }
+            AppendFmt(c, "\x1B[%d;1H\x1B[K%4d ", bottom, i);
+            int words = RandRange(c, 3, 12);
+            for (int w = 0; w < words; w++) { AppendWord(c); AppendStr(c, " "); }
+        }
+        // Status line outside the margins
+        AppendFmt(c, "\x1B[r\x1B[%d;1H\x1B[7m-- INSERT --\x1B[m\x1B[K", BENCH_HEIGHT);
+    }
+}
+
+// CJK (wide), accented Latin with combining marks, Cyrillic, Greek and emoji
+static void GenUnicode(Corpus* c, size_t target) {
+    AppendStr(c, "\x1B%G");
+    while (c->len < target) {
+        int glyphs = RandRange(c, 10, 50);
+        for (int i = 0; i < glyphs; i++) {
+            switch (Rand(c) % 6) {
+                case 0: case 1: AppendUTF8(c, 0x4E00 + Rand(c) % 2000); break;
+                case 2: AppendUTF8(c, 'a' + Rand(c) % 26); AppendUTF8(c, 0x0300 + Rand(c) % 0x10); break;
+                case 3: AppendUTF8(c, 0x0410 + Rand(c) % 64); break;
+                case 4: AppendUTF8(c, 0x03B1 + Rand(c) % 24); break;
+                default: AppendUTF8(c, 0x1F600 + Rand(c) % 64); break;
+            }
+            if (Rand(c) % 5 == 0) AppendStr(c, " ");
+        }
+        AppendStr(c, "\r\n");
+    }
+}
+
+// Full-screen redraws through absolute cursor motion, like htop or a TUI framework
+static void GenTuiRedraw(Corpus* c, size_t target) {
+    while (c->len < target) {
+        AppendStr(c, "\x1B[?25l\x1B[H");
+        AppendFmt(c, "\x1B[1;44;37m%-*s\x1B[m", BENCH_WIDTH, " Tasks: 213 total, 1 running");
+        for (int y = 2; y < BENCH_HEIGHT && c->len < target; y++) {
+            // A few fields per row, each placed with CUP and padded with ECH
+            for (int f = 0; f < 5; f++) {
+                int x = 1 + f * (BENCH_WIDTH / 5);
+                AppendFmt(c, "\x1B[%d;%dH\x1B[%dm%6d\x1B[%dX", y, x, 31 + (int)(Rand(c) % 7),
+                          RandRange(c, 0, 999999), BENCH_WIDTH / 5 - 6);
+            }
+            if (Rand(c) % 4 == 0) AppendFmt(c, "\x1B[%d;%dH\x1B[7m\xE2\x94\x82\x1B[m", y, BENCH_WIDTH);
+        }
+        AppendFmt(c, "\x1B[%d;1H\x1B[m\x1B[2KF1Help F2Setup F3Search F9Kill F10Quit\x1B[?25h", BENCH_HEIGHT);
+    }
+}
+
+// Sixel images with a small palette and run-length encoded bands
+static void GenSixel(Corpus* c, size_t target) {
+    while (c->len < target) {
+        int width = RandRange(c, 64, 256);
+        int bands = RandRange(c, 4, 16);
+        AppendFmt(c, "\x1B[%d;%dH\x1BPq\"1;1;%d;%d", RandRange(c, 1, BENCH_HEIGHT / 2), RandRange(c, 1, BENCH_WIDTH / 2),
+                  width, bands * 6);
+        for (int p = 0; p < 8; p++) {
+            AppendFmt(c, "#%d;2;%d;%d;%d", p, RandRange(c, 0, 100), RandRange(c, 0, 100), RandRange(c, 0, 100));
+        }
+        for (int b = 0; b < bands; b++) {
+            for (int p = 0; p < 3; p++) {
+                AppendFmt(c, "#%d", (int)(Rand(c) % 8));
+                for (int x = 0; x < width;) {
+                    int run = RandRange(c, 1, 12);
+                    if (x + run > width) run = width - x;
+                    char sixel = (char)('?' + Rand(c) % 64);
+                    if (run > 3) AppendFmt(c, "!%d%c", run, sixel);
+                    else for (int r = 0; r < run; r++) Append(c, &sixel, 1);
+                    x += run;
+                }
+                AppendStr(c, "$");
+            }
+            AppendStr(c, "-");
+        }
+        AppendStr(c, "\x1B\\");
+    }
+}
+
+// Kitty graphics: direct RGBA uploads placed at the cursor, deleted in batches
+static void GenKitty(Corpus* c, size_t target) {
+    unsigned char pixels[48 * 48 * 4];
+    int id = 1;
+    while (c->len < target) {
+        for (size_t i = 0; i < sizeof(pixels); i++) pixels[i] = (unsigned char)Rand(c);
+        AppendFmt(c, "\x1B[%d;%dH\x1B_Ga=T,q=2,i=%d,f=32,s=48,v=48;", RandRange(c, 1, BENCH_HEIGHT - 4),
+                  RandRange(c, 1, BENCH_WIDTH - 8), id++);
+        AppendBase64(c, pixels, sizeof(pixels));
+        AppendStr(c, "\x1B\\");
+        if (id % 16 == 0) AppendStr(c, "\x1B_Ga=d,d=a,q=2;\x1B\\");
+    }
+    AppendStr(c, "\x1B_Ga=d,d=a,q=2;\x1B\\");
+}
+
+// Large clipboard writes (OSC 52), like tmux or vim yanking a buffer
+static void GenOsc52(Corpus* c, size_t target) {
+    unsigned char payload[48 * 1024];
+    while (c->len < target) {
+        size_t len = (size_t)RandRange(c, 4 * 1024, (int)sizeof(payload));
+        for (size_t i = 0; i < len; i++) payload[i] = (unsigned char)(0x20 + Rand(c) % 95);
+        AppendStr(c, "\x1B]52;c;");
+        AppendBase64(c, payload, len);
+        AppendStr(c, "\x07");
+        AppendStr(c, "yanked\r\n");
+    }
+}
+
+// ReGIS dashboards: erase, filled bar charts, gauges and a line chart per frame
+static void GenRegis(Corpus* c, size_t target) {
+    while (c->len < target) {
+        AppendStr(c, "\x1BPpS(E)");
+        for (int bar = 0; bar < 12; bar++) {
+            int x = 40 + bar * 60, h = RandRange(c, 20, 400);
+            AppendFmt(c, "W(I%d)P[%d,460]F(V[%d,460][%d,%d][%d,%d])", 1 + bar % 7, x, x + 40, x + 40, 460 - h, x, 460 - h);
+        }
+        for (int g = 0; g < 4; g++) {
+            AppendFmt(c, "P[%d,60]C[+%d]P[%d,60]C(A%d)[+30,+0]", 100 + g * 200, RandRange(c, 20, 50), 100 + g * 200,
+                      RandRange(c, -270, 270));
+        }
+        AppendFmt(c, "P[0,%d]V", RandRange(c, 100, 300));
+        for (int x = 0; x < 800; x += 16) AppendFmt(c, "[%d,%d]", x, RandRange(c, 100, 300));
+        AppendStr(c, "\x1B\\");
+    }
+}
+
+static const CorpusDef corpora[] = {
+    { "ascii", "Dense printable ASCII lines", GenAscii },
+    { "sgr256", "256-color and bold SGR on every word", GenSgr256 },
+    { "truecolor", "24-bit foreground and background every two cells", GenTruecolor },
+    { "scroll_region", "DECSTBM margins with IL/DL/RI/SU, vim/less style", GenScrollRegion },
+    { "unicode", "CJK, combining marks, Cyrillic, Greek and emoji", GenUnicode },
+    { "tui_redraw", "Full-screen CUP/ECH redraws, htop style", GenTuiRedraw },
+    { "sixel", "Sixel images with palettes and repeat runs", GenSixel },
+    { "kitty", "Kitty graphics RGBA uploads and deletes", GenKitty },
+    { "osc52", "Large OSC 52 clipboard payloads", GenOsc52 },
+    { "regis", "ReGIS dashboards: bar fills, gauges and line charts", GenRegis },
+};
+
+#define CORPUS_COUNT ((int)(sizeof(corpora) / sizeof(corpora[0])))
+
+// =============================================================================
+// MEASUREMENT
+// =============================================================================
+
+static double NowNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static PhaseTimes RunCorpus(const Corpus* corpus) {
+    KTermConfig config = {0};
+    config.width = BENCH_WIDTH;
+    config.height = BENCH_HEIGHT;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    KTermSession* session = GET_SESSION(term);
+
+    PhaseTimes t = {0};
+    for (size_t pos = 0; pos < corpus->len; pos += BENCH_CHUNK) {
+        size_t end = pos + BENCH_CHUNK < corpus->len ? pos + BENCH_CHUNK : corpus->len;
+
+        double start = NowNs();
+        for (size_t i = pos; i < end; i++) KTerm_ProcessChar(term, session, (unsigned char)corpus->data[i]);
+        double parsed = NowNs();
+        KTerm_FlushOps(term, session);
+        double flushed = NowNs();
+        KTerm_PrepareRenderBuffer(term);
+        double prepared = NowNs();
+
+        t.parse_ns += parsed - start;
+        t.flush_ns += flushed - parsed;
+        t.prepare_ns += prepared - flushed;
+        t.frames++;
+    }
+    KTerm_Destroy(term);
+    return t;
+}
+
+static double MBps(size_t bytes, double ns) {
+    return ns > 0 ? (double)bytes / (ns / 1e9) / (1024.0 * 1024.0) : 0.0;
+}
+
+static void WriteJsonPhase(FILE* f, const char* name, size_t bytes, double ns, bool last) {
+    fprintf(f, "      \"%s\": { \"ns\": %.0f, \"ns_per_byte\": %.3f, \"mb_per_s\": %.2f }%s\n",
+            name, ns, ns / (double)bytes, MBps(bytes, ns), last ? "" : ",");
+}
+
+static void Usage(void) {
+    printf("Usage: kt_bench [--json PATH|-] [--mb N] [--runs N] [--only NAME] [--dump DIR]\n");
+    printf("  --json PATH  Write results as JSON (\"-\" for stdout)\n");
+    printf("  --mb N       Corpus size in MiB (default 2)\n");
+    printf("  --runs N     Runs per corpus, best total kept (default 3)\n");
+    printf("  --only NAME  Run a single corpus\n");
+    printf("  --dump DIR   Write the generated corpora to DIR/<name>.vt and exit\n");
+    printf("Corpora:\n");
+    for (int i = 0; i < CORPUS_COUNT; i++) printf("  %-14s %s\n", corpora[i].name, corpora[i].description);
+}
+
+int main(int argc, char** argv) {
+    const char* json_path = NULL;
+    const char* only = NULL;
+    const char* dump_dir = NULL;
+    double mb = 2.0;
+    int runs = 3;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--json") == 0 && i + 1 < argc) json_path = argv[++i];
+        else if (strcmp(argv[i], "--mb") == 0 && i + 1 < argc) mb = atof(argv[++i]);
+        else if (strcmp(argv[i], "--runs") == 0 && i + 1 < argc) runs = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--only") == 0 && i + 1 < argc) only = argv[++i];
+        else if (strcmp(argv[i], "--dump") == 0 && i + 1 < argc) dump_dir = argv[++i];
+        else { Usage(); return strcmp(argv[i], "--help") == 0 ? 0 : 2; }
+    }
+    if (mb <= 0) mb = 2.0;
+    if (runs < 1) runs = 1;
+    size_t target = (size_t)(mb * 1024 * 1024);
+
+    bool json_stdout = json_path && strcmp(json_path, "-") == 0;
+    FILE* json = NULL;
+    if (json_path) {
+        json = json_stdout ? stdout : fopen(json_path, "w");
+        if (!json) { fprintf(stderr, "kt_bench: cannot open %s\n", json_path); return 1; }
+        fprintf(json, "{\n  \"kterm_version\": \"%d.%d.%d\",\n", KTERM_VERSION_MAJOR, KTERM_VERSION_MINOR,
+                KTERM_VERSION_PATCH);
+        fprintf(json, "  \"width\": %d, \"height\": %d, \"chunk_bytes\": %d, \"runs\": %d, \"seed\": %u,\n",
+                BENCH_WIDTH, BENCH_HEIGHT, BENCH_CHUNK, runs, BENCH_SEED);
+        fprintf(json, "  \"corpora\": [");
+    }
+    if (!json_stdout && !dump_dir) {
+        printf("K-Term %d.%d.%d throughput, %dx%d, %d-byte frames, best of %d\n", KTERM_VERSION_MAJOR,
+               KTERM_VERSION_MINOR, KTERM_VERSION_PATCH, BENCH_WIDTH, BENCH_HEIGHT, BENCH_CHUNK, runs);
+        printf("%-14s %9s %12s %12s %12s %12s\n", "corpus", "KiB", "parse", "flush", "prepare", "total");
+        printf("%-14s %9s %12s %12s %12s %12s\n", "", "", "ns/B  MB/s", "ns/B  MB/s", "ns/B  MB/s", "MB/s");
+    }
+
+    bool first = true;
+    int matched = 0;
+    for (int ci = 0; ci < CORPUS_COUNT; ci++) {
+        const CorpusDef* def = &corpora[ci];
+        if (only && strcmp(only, def->name) != 0) continue;
+        matched++;
+
+        Corpus corpus = {0};
+        corpus.rng = BENCH_SEED + (uint32_t)ci;
+        def->generate(&corpus, target);
+
+        if (dump_dir) {
+            char path[1024];
+            snprintf(path, sizeof(path), "%s/%s.vt", dump_dir, def->name);
+            FILE* f = fopen(path, "wb");
+            if (!f || fwrite(corpus.data, 1, corpus.len, f) != corpus.len) {
+                fprintf(stderr, "kt_bench: cannot write %s\n", path);
+                if (f) fclose(f);
+                free(corpus.data);
+                return 1;
+            }
+            fclose(f);
+            printf("%s (%zu bytes)\n", path, corpus.len);
+            free(corpus.data);
+            continue;
+        }
+
+        PhaseTimes best = {0};
+        for (int r = 0; r < runs; r++) {
+            PhaseTimes t = RunCorpus(&corpus);
+            double total = t.parse_ns + t.flush_ns + t.prepare_ns;
+            if (r == 0 || total < best.parse_ns + best.flush_ns + best.prepare_ns) best = t;
+        }
+        double total = best.parse_ns + best.flush_ns + best.prepare_ns;
+        size_t bytes = corpus.len;
+
+        if (!json_stdout) {
+            printf("%-14s %9zu %5.1f %6.1f %5.1f %6.1f %5.1f %6.1f %12.1f\n", def->name, bytes / 1024,
+                   best.parse_ns / bytes, MBps(bytes, best.parse_ns), best.flush_ns / bytes, MBps(bytes, best.flush_ns),
+                   best.prepare_ns / bytes, MBps(bytes, best.prepare_ns), MBps(bytes, total));
+        }
+        if (json) {
+            fprintf(json, "%s\n    {\n      \"name\": \"%s\",\n      \"bytes\": %zu,\n      \"frames\": %d,\n",
+                    first ? "" : ",", def->name, bytes, best.frames);
+            WriteJsonPhase(json, "parse", bytes, best.parse_ns, false);
+            WriteJsonPhase(json, "flush", bytes, best.flush_ns, false);
+            WriteJsonPhase(json, "prepare", bytes, best.prepare_ns, false);
+            WriteJsonPhase(json, "total", bytes, total, true);
+            fprintf(json, "    }");
+        }
+        first = false;
+        free(corpus.data);
+    }
+
+    if (json) {
+        fprintf(json, "\n  ]\n}\n");
+        if (!json_stdout) fclose(json);
+    }
+    if (only && matched == 0) {
+        fprintf(stderr, "kt_bench: unknown corpus '%s'\n", only);
+        return 2;
+    }
+    return 0;
+}
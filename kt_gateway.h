@@ -118,13 +118,7 @@ static bool KTerm_Gateway_DecodePipePayload(KTerm* term, KTermSession* session,
 
     const char* payload = payload_start + 1;
 
-    int session_idx = -1;
-    for (int i = 0; i < MAX_SESSIONS; i++) {
-        if (&term->sessions[i] == session) {
-            session_idx = i;
-            break;
-        }
-    }
+    int session_idx = session ? KTerm_GetSessionHandle(term, session->index) : -1;
 
     if (session_idx != -1) {
         if (KTerm_Strcasecmp(encoding, "B64") == 0) {
@@ -133,9 +127,7 @@ static bool KTerm_Gateway_DecodePipePayload(KTerm* term, KTermSession* session,
             KTerm_HexStreamDecode(term, session_idx, payload);
         } else if (KTerm_Strcasecmp(encoding, "RAW") == 0) {
             // RAW is simple injection
-            for (size_t i = 0; payload[i] != '\0'; i++) {
-                KTerm_WriteCharToSession(term, session_idx, (unsigned char)payload[i]);
-            }
+            KTerm_WriteData(term, session_idx, payload, strlen(payload));
         }
     }
 
@@ -532,8 +524,8 @@ typedef struct {
 
 // Helpers
 static KTermSession* KTerm_GetTargetSession(KTerm* term, KTermSession* session) {
-    if (term->gateway_target_session >= 0 && term->gateway_target_session < MAX_SESSIONS) {
-        return &term->sessions[term->gateway_target_session];
+    if (term->gateway_target_session >= 0 && term->gateway_target_session < term->session_count) {
+        return term->sessions[term->gateway_target_session];
     }
     return session;
 }
@@ -572,35 +564,35 @@ static void KTerm_Gateway_HandleSet(KTerm* term, KTermSession* session, const ch
         if (Stream_Expect(scanner, ';')) {
             int s_idx;
             if (Stream_ReadInt(scanner, &s_idx)) {
-                if (s_idx >= 0 && s_idx < MAX_SESSIONS) term->gateway_target_session = s_idx;
+                if (s_idx >= 0 && s_idx < term->session_count) term->gateway_target_session = s_idx;
             }
         }
     } else if (strcmp(subcmd, "REGIS_SESSION") == 0) {
         if (Stream_Expect(scanner, ';')) {
              int s_idx;
              if (Stream_ReadInt(scanner, &s_idx)) {
-                 if (s_idx >= 0 && s_idx < MAX_SESSIONS) term->regis_target_session = s_idx;
+                 if (s_idx >= 0 && s_idx < term->session_count) term->regis_target_session = s_idx;
              }
         }
     } else if (strcmp(subcmd, "TEKTRONIX_SESSION") == 0) {
         if (Stream_Expect(scanner, ';')) {
              int s_idx;
              if (Stream_ReadInt(scanner, &s_idx)) {
-                 if (s_idx >= 0 && s_idx < MAX_SESSIONS) term->tektronix_target_session = s_idx;
+                 if (s_idx >= 0 && s_idx < term->session_count) term->tektronix_target_session = s_idx;
              }
         }
     } else if (strcmp(subcmd, "KITTY_SESSION") == 0) {
         if (Stream_Expect(scanner, ';')) {
              int s_idx;
              if (Stream_ReadInt(scanner, &s_idx)) {
-                 if (s_idx >= 0 && s_idx < MAX_SESSIONS) term->kitty_target_session = s_idx;
+                 if (s_idx >= 0 && s_idx < term->session_count) term->kitty_target_session = s_idx;
              }
         }
     } else if (strcmp(subcmd, "SIXEL_SESSION") == 0) {
         if (Stream_Expect(scanner, ';')) {
              int s_idx;
              if (Stream_ReadInt(scanner, &s_idx)) {
-                 if (s_idx >= 0 && s_idx < MAX_SESSIONS) term->sixel_target_session = s_idx;
+                 if (s_idx >= 0 && s_idx < term->session_count) term->sixel_target_session = s_idx;
              }
         }
     } else if (strcmp(subcmd, "ATTR") == 0) {
@@ -784,6 +776,11 @@ static void KTerm_Gateway_HandleSet(KTerm* term, KTermSession* session, const ch
                 if (token.type == KT_TOK_SEMICOLON) token = KTerm_LexerNext(&lexer);
             }
         }
+    } else if (strcmp(subcmd, "STATS") == 0) {
+        if (Stream_Expect(scanner, ';')) {
+            int v;
+            if (Stream_ReadInt(scanner, &v)) KTerm_SetStatsEnabled(term, v != 0);
+        }
     } else if (strcmp(subcmd, "CONCEAL") == 0) {
         if (Stream_Expect(scanner, ';')) {
             int v;
@@ -927,8 +924,7 @@ static void KTerm_Gateway_HandleInit(KTerm* term, KTermSession* session, const c
     if (!Stream_ReadIdentifier(scanner, subcmd, sizeof(subcmd))) return;
 
     // session finding logic
-    int s_idx = -1;
-    for(int i=0; i<MAX_SESSIONS; i++) if(&term->sessions[i] == session) { s_idx = i; break; }
+    int s_idx = session ? session->index : -1;
 
     if (s_idx != -1) {
         if (strcmp(subcmd, "REGIS_SESSION") == 0) {
@@ -978,6 +974,8 @@ static void KTerm_Gateway_HandleReset(KTerm* term, KTermSession* session, const
          target_session->current_fg.value.index = COLOR_WHITE;
          target_session->current_bg.color_mode = 0;
          target_session->current_bg.value.index = COLOR_BLACK;
+    } else if (strcmp(subcmd, "STATS") == 0) {
+         KTerm_ResetStats(term);
     } else if (strcmp(subcmd, "BLINK") == 0) {
          target_session->fast_blink_rate = 255;
          target_session->slow_blink_rate = 500;
@@ -1050,6 +1048,34 @@ static void KTerm_Gateway_HandleGet(KTerm* term, KTermSession* session, const ch
             snprintf(response, sizeof(response), "\x1BPGATE;KTERM;%s;REPORT;UNDERLINE_COLOR=%d\x1B\\", id, session->current_ul_color.value.index);
         }
         KTerm_QueueResponse(term, response);
+    } else if (strcmp(subcmd, "STATS") == 0) {
+        KTermStats stats = KTerm_GetStats(term);
+        KTermSessionStats session_stats;
+        if (!KTerm_GetSessionStats(term, KTerm_GetSessionHandle(term, target_session->index), &session_stats)) session_stats = stats.sessions[0];
+        const KTermSessionStats* s = &session_stats;
+        uint64_t sequences = 0, queued = 0, applied = 0;
+        for (int i = 0; i < KTERM_STAT_SEQ_COUNT; i++) sequences += s->sequences[i];
+        for (int i = 0; i < KTERM_OP_INVALID; i++) { queued += s->ops_queued[i]; applied += s->ops_applied[i]; }
+        const KTermLatencyHistogram* h[4] = { &s->parse, &s->flush, &stats.prepare, &stats.draw };
+        unsigned long long avg_us[4], max_us[4];
+        for (int i = 0; i < 4; i++) {
+            avg_us[i] = h[i]->count ? (unsigned long long)(h[i]->total_ns / h[i]->count / 1000) : 0;
+            max_us[i] = (unsigned long long)(h[i]->max_ns / 1000);
+        }
+        char response[1024];
+        snprintf(response, sizeof(response),
+                 "\x1BPGATE;KTERM;%s;REPORT;STATS=ENABLED:%d,FRAMES:%llu,BYTES:%llu,SEQ:%llu,CSI:%llu,ESC:%llu,OSC:%llu,DCS:%llu,C0:%llu,"
+                 "OPS:%llu,APPLIED:%llu,DROPPED:%llu,ROWS:%llu,UPLOAD:%llu,MISSES:%llu,EVICTED:%llu,"
+                 "PARSE_US:%llu/%llu,FLUSH_US:%llu/%llu,PREPARE_US:%llu/%llu,DRAW_US:%llu/%llu\x1B\\",
+                 id, stats.enabled ? 1 : 0, (unsigned long long)stats.frames, (unsigned long long)s->bytes_parsed,
+                 (unsigned long long)sequences, (unsigned long long)s->sequences[KTERM_STAT_SEQ_CSI],
+                 (unsigned long long)s->sequences[KTERM_STAT_SEQ_ESC], (unsigned long long)s->sequences[KTERM_STAT_SEQ_OSC],
+                 (unsigned long long)s->sequences[KTERM_STAT_SEQ_DCS], (unsigned long long)s->sequences[KTERM_STAT_SEQ_C0],
+                 (unsigned long long)queued, (unsigned long long)applied, (unsigned long long)s->ops_dropped,
+                 (unsigned long long)stats.rows_converted, (unsigned long long)stats.bytes_uploaded,
+                 (unsigned long long)stats.atlas_misses, (unsigned long long)stats.atlas_glyphs_evicted,
+                 avg_us[0], max_us[0], avg_us[1], max_us[1], avg_us[2], max_us[2], avg_us[3], max_us[3]);
+        KTerm_QueueResponse(term, response);
     } else if (strcmp(subcmd, "STRIKE_COLOR") == 0) {
         char response[256];
         if (session->current_st_color.color_mode == 1) {
@@ -29,7 +29,7 @@ void KTermSit_ProcessInput(KTerm* term);
 
 // Helper macro to access active session
 #ifndef GET_SESSION
-#define GET_SESSION(term) (&(term)->sessions[(term)->active_session])
+#define GET_SESSION(term) ((term)->sessions[(term)->active_session])
 #endif
 
 // Use Core Key Event Structure
@@ -339,14 +339,14 @@ static void KTermSit_UpdateMouse(KTerm* term) {
 
     if (SituationIsMouseButtonPressed(GLFW_MOUSE_BUTTON_LEFT)) {
         if (term->active_session != target_session_idx) {
-            KTerm_SetActiveSession(term, target_session_idx);
+            KTerm_SetActiveSession(term, KTerm_GetSessionHandle(term, target_session_idx));
         }
     }
 
     // Temporarily switch to target session for correct context (QueueResponse, State Access)
     int saved_session_idx = term->active_session;
     term->active_session = target_session_idx;
-    KTermSession* session = &term->sessions[target_session_idx];
+    KTermSession* session = term->sessions[target_session_idx];
 
     // Clamp coordinates to valid range
     if (global_cell_x < 0) global_cell_x = 0;
@@ -381,7 +381,7 @@ static void KTermSit_UpdateMouse(KTerm* term) {
                 int cb = 32 + btn; // 32 + 64/65
                 snprintf(report, sizeof(report), "\x1B[M%c%c%c", (char)cb, (char)(32 + global_cell_x + 1), (char)(32 + local_cell_y + 1));
             }
-            if (report[0]) KTerm_QueueResponse(term, report);
+            if (report[0]) KTerm_QueueMouseReport(term, report, false);
         }
         else {
             // Normal Terminal Scrolling
@@ -389,7 +389,7 @@ static void KTermSit_UpdateMouse(KTerm* term) {
                 int lines = 3;
                 const char* seq = (wheel > 0) ? ((session->dec_modes & KTERM_MODE_DECCKM) ? "\x1BOA" : "\x1B[A")
                                               : ((session->dec_modes & KTERM_MODE_DECCKM) ? "\x1BOB" : "\x1B[B");
-                for(int i=0; i<lines; i++) KTerm_QueueResponse(term, seq);
+                for(int i=0; i<lines; i++) KTerm_QueueMouseReport(term, seq, false);
             } else {
                 int scroll_amount = (int)(wheel * 3.0f);
                 session->view_offset += scroll_amount;
@@ -422,7 +422,7 @@ static void KTermSit_UpdateMouse(KTerm* term) {
     if (current_focus != session->mouse.focused) {
         session->mouse.focused = current_focus;
         if (session->mouse.focus_tracking) {
-            KTerm_QueueResponse(term, current_focus ? "\x1B[I" : "\x1B[O");
+            KTerm_QueueMouseReport(term, current_focus ? "\x1B[I" : "\x1B[O", false);
         }
     }
 
@@ -472,7 +472,7 @@ static void KTermSit_UpdateMouse(KTerm* term) {
                         int cb = 32 + i;
                         snprintf(report, sizeof(report), "\x1B[M%c%c%c", (char)cb, (char)(32 + global_cell_x + 1), (char)(32 + local_cell_y + 1));
                     }
-                    if (report[0]) KTerm_QueueResponse(term, report);
+                    if (report[0]) KTerm_QueueMouseReport(term, report, false);
                 }
             }
 
@@ -507,7 +507,7 @@ static void KTermSit_UpdateMouse(KTerm* term) {
                     } else {
                          snprintf(report, sizeof(report), "\x1B[M%c%c%c", (char)btn_code, (char)(32 + global_cell_x + 1), (char)(32 + local_cell_y + 1));
                     }
-                    if (report[0]) KTerm_QueueResponse(term, report);
+                    if (report[0]) KTerm_QueueMouseReport(term, report, true);
                 }
             }
         }
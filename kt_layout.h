@@ -6,6 +6,7 @@ extern "C" {
 #endif
 
 #include <stdlib.h>
+#include <stdbool.h>
 
 typedef enum {
     PANE_SPLIT_VERTICAL,   // Top/Bottom split
@@ -36,6 +37,15 @@ typedef struct {
     KTermPane* focused;
     int width;
     int height;
+    unsigned int generation; // Bumped on every tree/geometry change (for cached pane lookups)
+
+    // Leaf index, rebuilt on the first lookup after the generation changes
+    KTermPane** leaves;      // Leaves in depth-first order (child_a before child_b)
+    int leaf_count;
+    int leaf_capacity;
+    int* session_leaf;       // Session index -> position in leaves, -1 if not shown
+    int session_leaf_capacity;
+    unsigned int indexed_generation;
 } KTermLayout;
 
 // Callback for session resize events
@@ -52,6 +62,12 @@ void KTermLayout_Close(KTermLayout* layout, KTermPane* pane, KTermLayout_ResizeC
 void KTermLayout_SetRoot(KTermLayout* layout, KTermPane* root);
 KTermPane* KTermLayout_GetRoot(KTermLayout* layout);
 
+// Leaf lookups (O(1) once indexed; the index is rebuilt after any change to the tree)
+int KTermLayout_GetLeafCount(KTermLayout* layout);
+KTermPane* KTermLayout_GetLeaf(KTermLayout* layout, int index);
+KTermPane* KTermLayout_FindSessionPane(KTermLayout* layout, int session_index); // NULL if the session is not shown
+KTermPane* KTermLayout_NextLeaf(KTermLayout* layout, KTermPane* pane);            // Wraps around; first leaf if pane is not a leaf
+
 #ifdef __cplusplus
 }
 #endif
@@ -68,8 +84,13 @@ static void KL_Free(void* ptr) {
     free(ptr);
 }
 
+static void* KL_Realloc(void* ptr, size_t size) {
+    return realloc(ptr, size);
+}
+
 static void KTermLayout_Recalculate(KTermLayout* layout, KTermPane* pane, int x, int y, int w, int h, KTermLayout_ResizeCallback callback, void* user_data) {
     if (!pane) return;
+    if (pane == layout->root) layout->generation++;
 
     pane->x = x;
     pane->y = y;
@@ -108,6 +129,7 @@ KTermLayout* KTermLayout_Create(int width, int height) {
     if (!layout) return NULL;
     layout->width = width;
     layout->height = height;
+    layout->generation = 1;
 
     // Create default root pane
     layout->root = (KTermPane*)KL_Calloc(1, sizeof(KTermPane));
@@ -137,6 +159,8 @@ void KTermLayout_Destroy(KTermLayout* layout) {
     if (layout->root) {
         KTermLayout_DestroyPane(layout->root);
     }
+    if (layout->leaves) KL_Free(layout->leaves);
+    if (layout->session_leaf) KL_Free(layout->session_leaf);
     KL_Free(layout);
 }
 
@@ -226,11 +250,87 @@ void KTermLayout_Close(KTermLayout* layout, KTermPane* pane, KTermLayout_ResizeC
 }
 
 void KTermLayout_SetRoot(KTermLayout* layout, KTermPane* root) {
-    if (layout) layout->root = root;
+    if (layout) {
+        layout->root = root;
+        layout->generation++;
+    }
 }
 
 KTermPane* KTermLayout_GetRoot(KTermLayout* layout) {
     return layout ? layout->root : NULL;
 }
 
+static bool KTermLayout_CollectLeaves(KTermLayout* layout, KTermPane* pane, int* max_session) {
+    if (!pane) return true;
+    if (pane->type != PANE_LEAF) {
+        return KTermLayout_CollectLeaves(layout, pane->child_a, max_session) &&
+               KTermLayout_CollectLeaves(layout, pane->child_b, max_session);
+    }
+    if (layout->leaf_count >= layout->leaf_capacity) {
+        int new_cap = (layout->leaf_capacity == 0) ? 16 : layout->leaf_capacity * 2;
+        KTermPane** leaves = (KTermPane**)KL_Realloc(layout->leaves, (size_t)new_cap * sizeof(KTermPane*));
+        if (!leaves) return false;
+        layout->leaves = leaves;
+        layout->leaf_capacity = new_cap;
+    }
+    layout->leaves[layout->leaf_count++] = pane;
+    if (pane->session_index > *max_session) *max_session = pane->session_index;
+    return true;
+}
+
+// Rebuild the leaf list and the session -> leaf map if the tree changed since the last lookup
+static bool KTermLayout_Index(KTermLayout* layout) {
+    if (layout->indexed_generation == layout->generation && layout->leaves) return true;
+
+    int max_session = -1;
+    layout->leaf_count = 0;
+    if (!KTermLayout_CollectLeaves(layout, layout->root, &max_session)) return false;
+
+    if (max_session >= layout->session_leaf_capacity) {
+        int new_cap = (layout->session_leaf_capacity == 0) ? 16 : layout->session_leaf_capacity;
+        while (new_cap <= max_session) new_cap *= 2;
+        int* map = (int*)KL_Realloc(layout->session_leaf, (size_t)new_cap * sizeof(int));
+        if (!map) return false;
+        layout->session_leaf = map;
+        layout->session_leaf_capacity = new_cap;
+    }
+    for (int i = 0; i < layout->session_leaf_capacity; i++) layout->session_leaf[i] = -1;
+    // A session shown twice maps to its first leaf, as the depth-first search did
+    for (int i = layout->leaf_count - 1; i >= 0; i--) {
+        int s = layout->leaves[i]->session_index;
+        if (s >= 0) layout->session_leaf[s] = i;
+    }
+    layout->indexed_generation = layout->generation;
+    return true;
+}
+
+int KTermLayout_GetLeafCount(KTermLayout* layout) {
+    if (!layout || !KTermLayout_Index(layout)) return 0;
+    return layout->leaf_count;
+}
+
+KTermPane* KTermLayout_GetLeaf(KTermLayout* layout, int index) {
+    if (!layout || !KTermLayout_Index(layout)) return NULL;
+    return (index >= 0 && index < layout->leaf_count) ? layout->leaves[index] : NULL;
+}
+
+KTermPane* KTermLayout_FindSessionPane(KTermLayout* layout, int session_index) {
+    if (!layout || session_index < 0 || !KTermLayout_Index(layout)) return NULL;
+    if (session_index >= layout->session_leaf_capacity) return NULL;
+    int leaf = layout->session_leaf[session_index];
+    return (leaf >= 0) ? layout->leaves[leaf] : NULL;
+}
+
+KTermPane* KTermLayout_NextLeaf(KTermLayout* layout, KTermPane* pane) {
+    if (!layout || !KTermLayout_Index(layout) || layout->leaf_count == 0) return NULL;
+    if (pane && pane->session_index >= 0 && pane->session_index < layout->session_leaf_capacity) {
+        int leaf = layout->session_leaf[pane->session_index];
+        if (leaf >= 0 && layout->leaves[leaf] == pane) return layout->leaves[(leaf + 1) % layout->leaf_count];
+    }
+    for (int i = 0; i < layout->leaf_count; i++) {
+        if (layout->leaves[i] == pane) return layout->leaves[(i + 1) % layout->leaf_count];
+    }
+    return layout->leaves[0];
+}
+
 #endif // KTERM_LAYOUT_IMPLEMENTATION
@@ -70,13 +70,17 @@ typedef struct {
 } KTermOp;
 
 // Operation Queue (Ring Buffer)
-#define KTERM_OP_QUEUE_SIZE 16384
+#define KTERM_OP_QUEUE_SIZE 16384 // Default capacity (power of two, KTermConfig.op_queue_size)
+
+struct KTermSessionStats_T;
 
 typedef struct {
-    KTermOp ops[KTERM_OP_QUEUE_SIZE];
+    KTermOp* ops;     // capacity entries, allocated on first use
+    int capacity;     // Power of two; KTERM_OP_QUEUE_SIZE when 0
     int head;
     int tail;
     int count;
+    struct KTermSessionStats_T* stats; // Counts queued and dropped ops while stats are enabled
 } KTermOpQueue;
 
 // Forward declaration of session
@@ -87,6 +91,7 @@ typedef struct KTermSession_T KTermSession; // Assuming struct name match
 void KTerm_InitOpQueue(KTermOpQueue* queue);
 bool KTerm_QueueOp(KTermOpQueue* queue, KTermOp op);
 bool KTerm_IsOpQueueFull(KTermOpQueue* queue);
+void KTerm_FreeOpQueue(KTermOpQueue* queue);
 // FlushOps will be declared in kterm.h to avoid circular dependency issues with KTermSession definition
 
 #endif // KT_OPS_H
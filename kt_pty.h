@@ -0,0 +1,469 @@
+#ifndef KT_PTY_H
+#define KT_PTY_H
+
+#include "kterm.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// =============================================================================
+// PTY HOST (child process <-> KTerm sessions)
+// =============================================================================
+// Optional POSIX host for embedders that run local programs: spawns a child per
+// session on a pseudo-terminal with forkpty() and drives all of them from one
+// epoll loop (Linux). Child output is read with readv() straight into the free
+// spans of the session's input ring (KTerm_PipelineReserve), without a copy. Replies and key sequences
+// leave through KTerm_SetSessionSink as one writev() per session and frame; a
+// short write keeps the rest queued and waits for EPOLLOUT. Session resizes
+// from the layout reach the child as TIOCSWINSZ (and SIGWINCH).
+//
+// Call KTermPty_Poll and KTerm_Update from the same thread. When a session's
+// pipeline is full its pty is not read until KTerm_Update has made room, so a
+// fast child is throttled by the kernel instead of losing output. A throttled
+// pty does not wake KTermPty_Poll, so poll with a timeout while pipelines hold data.
+//
+// Build: link with -lutil on glibc before 2.34.
+
+#ifndef KTERM_PTY_READ_BUDGET
+#define KTERM_PTY_READ_BUDGET (256 * 1024) // Bytes read per session and KTermPty_Poll, so one busy child cannot starve the others
+#endif
+
+#ifndef KTERM_PTY_EVENT_BATCH
+#define KTERM_PTY_EVENT_BATCH 64 // epoll events handled per KTermPty_Poll; the rest stay ready for the next call
+#endif
+
+#include <sys/types.h>
+
+typedef struct {
+    int fd;              // Master side, -1 when no child
+    int session;         // Handle of the session the child was spawned on
+    pid_t pid;
+    bool alive;          // Still running (or not yet reaped)
+    int exit_status;     // waitpid status once the child has exited
+    bool throttled;      // Not read while the session pipeline is full
+    bool want_write;     // EPOLLOUT armed for queued output
+    bool watched;        // In the epoll set; left while throttled
+    uint64_t bytes_read;
+    uint64_t bytes_written;
+    uint64_t reads;
+    uint64_t writes;
+} KTermPtyChild;
+
+typedef struct KTermPty_T KTermPty;
+
+struct KTermPty_T {
+    KTerm* term;
+    int epoll_fd;
+    KTermPtyChild* children;              // Indexed by session slot, grown by KTermPty_Spawn
+    int child_count;
+    SessionResizeCallback chained_resize; // Callback installed before KTermPty_Init
+    KTermSessionSink chained_sink;        // Sink installed before KTermPty_Init, for sessions without a child
+    void* chained_sink_ctx;
+    KTermPty* next;                       // Instances, for the context-free resize callback
+};
+
+// Attach to `term`: installs the session sink and the session resize callback.
+// Output of sessions without a child goes to the sink installed before, else to
+// the terminal's output sink or response callback, else stays queued.
+bool KTermPty_Init(KTermPty* pty, KTerm* term);
+// Hang up all children, reap them and detach from the terminal.
+void KTermPty_Destroy(KTermPty* pty);
+// Run `path` with `argv` (NULL-terminated) on a new pty sized like the session
+// `handle` (from KTerm_CreateSession).
+// `path` without a slash is searched in PATH. `envp` NULL inherits the
+// environment with TERM set to xterm-256color. Both are resolved before the fork.
+bool KTermPty_Spawn(KTermPty* pty, int handle, const char* path, char* const argv[], char* const envp[]);
+// Wait up to `timeout_ms` (0 = poll, -1 = block) for pty activity, read child
+// output into the pipelines and send queued output. Returns the number of ptys
+// that had activity, or -1 on error.
+int KTermPty_Poll(KTermPty* pty, int timeout_ms);
+// True while the child of the session `handle` (from KTerm_CreateSession) runs
+// or has output left to read.
+bool KTermPty_IsAlive(KTermPty* pty, int handle);
+
+#ifdef KTERM_PTY_IMPLEMENTATION
+
+#if !defined(__linux__)
+#error "kt_pty.h needs epoll (Linux)"
+#endif
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/ioctl.h>
+#include <sys/uio.h>
+#include <sys/wait.h>
+#include <termios.h>
+#include <unistd.h>
+#include <pty.h>
+
+extern char** environ;
+
+static KTermPty* kterm_pty_instances = NULL;
+
+// A throttled pty leaves the epoll set: epoll reports a hangup whatever events are
+// asked for, and the hangup cannot be handled until the pipeline has room again.
+// Queued output waits for the resume with it.
+static void KTermPty_Watch(KTermPty* pty, int index) {
+    KTermPtyChild* child = &pty->children[index];
+    if (child->throttled) {
+        if (child->watched) epoll_ctl(pty->epoll_fd, EPOLL_CTL_DEL, child->fd, NULL);
+        child->watched = false;
+        return;
+    }
+    struct epoll_event ev = {0};
+    ev.events = EPOLLIN | (child->want_write ? EPOLLOUT : 0);
+    ev.data.u32 = (uint32_t)index;
+    epoll_ctl(pty->epoll_fd, child->watched ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, child->fd, &ev);
+    child->watched = true;
+}
+
+static void KTermPty_Close(KTermPty* pty, int index) {
+    KTermPtyChild* child = &pty->children[index];
+    if (child->fd < 0) return;
+    if (child->watched) epoll_ctl(pty->epoll_fd, EPOLL_CTL_DEL, child->fd, NULL);
+    child->watched = false;
+    close(child->fd);
+    child->fd = -1;
+    if (child->alive && waitpid(child->pid, &child->exit_status, WNOHANG) == child->pid) child->alive = false;
+}
+
+// Output of a session with no child to read it
+static size_t KTermPty_Fallback(KTermPty* pty, int session, const KTermIOVec* iov, int iovcnt) {
+    if (pty->chained_sink) return pty->chained_sink(pty->chained_sink_ctx, session, iov, iovcnt);
+    KTerm* term = pty->term;
+    if (!term->output_sink && !term->response_callback) return 0; // Stays queued, reported as pending
+    size_t total = 0;
+    for (int i = 0; i < iovcnt; i++) {
+        if (term->output_sink) {
+            term->output_sink(term->output_sink_ctx, (const char*)iov[i].iov_base, iov[i].iov_len);
+        } else {
+            term->response_callback(term, (const char*)iov[i].iov_base, (int)iov[i].iov_len);
+        }
+        total += iov[i].iov_len;
+    }
+    return total;
+}
+
+// Replies and keys: one writev per session and frame
+static size_t KTermPty_Sink(void* ctx, int session, const KTermIOVec* iov, int iovcnt) {
+    KTermPty* pty = (KTermPty*)ctx;
+    int session_index = KTERM_SESSION_INDEX(session);
+    size_t total = 0;
+    struct iovec vec[2];
+    for (int i = 0; i < iovcnt && i < 2; i++) {
+        vec[i].iov_base = (void*)iov[i].iov_base;
+        vec[i].iov_len = iov[i].iov_len;
+        total += iov[i].iov_len;
+    }
+    if (session_index >= pty->child_count || pty->children[session_index].fd < 0 ||
+        pty->children[session_index].session != session) {
+        return KTermPty_Fallback(pty, session, iov, iovcnt); // Nobody here to read it
+    }
+    KTermPtyChild* child = &pty->children[session_index];
+
+    ssize_t n = writev(child->fd, vec, iovcnt < 2 ? iovcnt : 2);
+    if (n < 0) {
+        if (errno != EAGAIN && errno != EINTR) return total; // Child gone: its pty is closed on the next read
+        n = 0;
+    }
+    child->writes++;
+    child->bytes_written += (uint64_t)n;
+
+    bool want_write = (size_t)n < total;
+    if (want_write != child->want_write) {
+        child->want_write = want_write;
+        KTermPty_Watch(pty, session_index);
+    }
+    return (size_t)n;
+}
+
+static void KTermPty_OnResize(KTerm* term, int session, int cols, int rows) {
+    int session_index = KTERM_SESSION_INDEX(session);
+    for (KTermPty* pty = kterm_pty_instances; pty; pty = pty->next) {
+        if (pty->term != term) continue;
+        if (session_index < pty->child_count && pty->children[session_index].fd >= 0 &&
+            pty->children[session_index].session == session) {
+            KTermPtyChild* child = &pty->children[session_index];
+            struct winsize ws = {0};
+            ws.ws_col = (unsigned short)cols;
+            ws.ws_row = (unsigned short)rows;
+            ioctl(child->fd, TIOCSWINSZ, &ws);
+        }
+        if (pty->chained_resize) pty->chained_resize(term, session, cols, rows);
+    }
+}
+
+// Room for a child on every session up to `count`
+static bool KTermPty_Reserve(KTermPty* pty, int count) {
+    if (count <= pty->child_count) return true;
+    int new_count = (pty->child_count == 0) ? MAX_SESSIONS : pty->child_count;
+    while (new_count < count) new_count *= 2;
+    KTermPtyChild* children = (KTermPtyChild*)KTerm_Realloc(pty->children, (size_t)new_count * sizeof(KTermPtyChild));
+    if (!children) return false;
+    memset(children + pty->child_count, 0, (size_t)(new_count - pty->child_count) * sizeof(KTermPtyChild));
+    for (int i = pty->child_count; i < new_count; i++) children[i].fd = -1;
+    pty->children = children;
+    pty->child_count = new_count;
+    return true;
+}
+
+bool KTermPty_Init(KTermPty* pty, KTerm* term) {
+    if (!pty || !term) return false;
+    memset(pty, 0, sizeof(*pty));
+    pty->term = term;
+    pty->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (pty->epoll_fd < 0) {
+        KTerm_ReportError(term, KTERM_LOG_ERROR, KTERM_SOURCE_SYSTEM, "epoll_create1 failed: %s", strerror(errno));
+        return false;
+    }
+
+    pty->chained_resize = term->session_resize_callback;
+    pty->chained_sink = term->session_sink;
+    pty->chained_sink_ctx = term->session_sink_ctx;
+    KTerm_SetSessionResizeCallback(term, KTermPty_OnResize);
+    KTerm_SetSessionSink(term, KTermPty_Sink, pty);
+    pty->next = kterm_pty_instances;
+    kterm_pty_instances = pty;
+    return true;
+}
+
+void KTermPty_Destroy(KTermPty* pty) {
+    if (!pty || !pty->term) return;
+    for (int i = 0; i < pty->child_count; i++) {
+        KTermPtyChild* child = &pty->children[i];
+        if (child->alive) kill(child->pid, SIGHUP);
+        KTermPty_Close(pty, i);
+        if (child->alive) {
+            waitpid(child->pid, &child->exit_status, 0);
+            child->alive = false;
+        }
+    }
+    close(pty->epoll_fd);
+    KTerm_Free(pty->children);
+    pty->children = NULL;
+    pty->child_count = 0;
+
+    KTerm_SetSessionSink(pty->term, pty->chained_sink, pty->chained_sink_ctx);
+    KTerm_SetSessionResizeCallback(pty->term, pty->chained_resize);
+    for (KTermPty** link = &kterm_pty_instances; *link; link = &(*link)->next) {
+        if (*link == pty) {
+            *link = pty->next;
+            break;
+        }
+    }
+    pty->term = NULL;
+}
+
+// The parent's environment with TERM replaced. Built before forkpty, since the
+// child of a threaded host may only make async-signal-safe calls before exec.
+static char** KTermPty_BuildEnv(void) {
+    static char term_entry[] = "TERM=xterm-256color";
+    size_t count = 0;
+    for (char** e = environ; e && *e; e++) count++;
+    char** envp = (char**)KTerm_Malloc((count + 2) * sizeof(char*));
+    if (!envp) return NULL;
+    size_t n = 0;
+    for (char** e = environ; e && *e; e++) {
+        if (strncmp(*e, "TERM=", 5) != 0) envp[n++] = *e;
+    }
+    envp[n++] = term_entry;
+    envp[n] = NULL;
+    return envp;
+}
+
+// Resolve `path` against PATH in the parent, so the child only needs execve
+static bool KTermPty_FindProgram(const char* path, char* out, size_t size) {
+    if (strchr(path, '/')) return snprintf(out, size, "%s", path) < (int)size;
+    const char* dirs = getenv("PATH");
+    if (!dirs || !*dirs) dirs = "/usr/bin:/bin";
+    while (*dirs) {
+        const char* end = strchr(dirs, ':');
+        size_t len = end ? (size_t)(end - dirs) : strlen(dirs);
+        // An empty entry is the current directory
+        int n = (len == 0) ? snprintf(out, size, "%s", path) : snprintf(out, size, "%.*s/%s", (int)len, dirs, path);
+        if (n > 0 && (size_t)n < size && access(out, X_OK) == 0) return true;
+        if (!end) break;
+        dirs = end + 1;
+    }
+    return false;
+}
+
+bool KTermPty_Spawn(KTermPty* pty, int handle, const char* path, char* const argv[], char* const envp[]) {
+    if (!pty || !pty->term || handle < 0 || !path) return false;
+    int session_index = KTERM_SESSION_INDEX(handle);
+    if (KTerm_GetSessionHandle(pty->term, session_index) != handle) return false; // Closed or stale handle
+    if (!KTermPty_Reserve(pty, session_index + 1)) {
+        KTerm_ReportError(pty->term, KTERM_LOG_ERROR, KTERM_SOURCE_SYSTEM, "Failed to grow the pty table to %d", session_index + 1);
+        return false;
+    }
+    KTermPtyChild* child = &pty->children[session_index];
+    if (child->fd >= 0) {
+        KTerm_ReportError(pty->term, KTERM_LOG_ERROR, KTERM_SOURCE_API, "Session %d already has a child", session_index);
+        return false;
+    }
+
+    KTermSession* session = pty->term->sessions[session_index];
+    struct winsize ws = {0};
+    ws.ws_col = (unsigned short)session->cols;
+    ws.ws_row = (unsigned short)session->rows;
+
+    char program[4096];
+    if (!KTermPty_FindProgram(path, program, sizeof(program))) {
+        KTerm_ReportError(pty->term, KTERM_LOG_ERROR, KTERM_SOURCE_API, "Program not found: %s", path);
+        return false;
+    }
+    char** env = envp ? NULL : KTermPty_BuildEnv();
+    if (!envp && !env) {
+        KTerm_ReportError(pty->term, KTERM_LOG_ERROR, KTERM_SOURCE_SYSTEM, "Failed to allocate the child environment");
+        return false;
+    }
+
+    int fd = -1;
+    pid_t pid = forkpty(&fd, NULL, NULL, &ws);
+    if (pid == 0) {
+        execve(program, argv, envp ? envp : env);
+        _exit(127);
+    }
+    KTerm_Free(env);
+    if (pid < 0) {
+        KTerm_ReportError(pty->term, KTERM_LOG_ERROR, KTERM_SOURCE_SYSTEM, "forkpty failed: %s", strerror(errno));
+        return false;
+    }
+
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+    memset(child, 0, sizeof(*child));
+    child->fd = fd;
+    child->session = handle;
+    child->pid = pid;
+    child->alive = true;
+
+    struct epoll_event ev = {0};
+    ev.events = EPOLLIN;
+    ev.data.u32 = (uint32_t)session_index;
+    child->watched = epoll_ctl(pty->epoll_fd, EPOLL_CTL_ADD, fd, &ev) == 0;
+    if (!child->watched) {
+        KTerm_ReportError(pty->term, KTERM_LOG_ERROR, KTERM_SOURCE_SYSTEM, "epoll_ctl failed: %s", strerror(errno));
+        kill(pid, SIGHUP);
+        KTermPty_Close(pty, session_index);
+        return false;
+    }
+    return true;
+}
+
+static void KTermPty_Read(KTermPty* pty, int index) {
+    KTermPtyChild* child = &pty->children[index];
+    int budget = KTERM_PTY_READ_BUDGET;
+
+    if (KTerm_GetSessionHandle(pty->term, index) != child->session) {
+        // The session was closed under the child: nothing will ever drain its output
+        kill(child->pid, SIGHUP);
+        KTermPty_Close(pty, index);
+        return;
+    }
+
+    while (budget > 0) {
+        struct iovec iov[2];
+        size_t len1, len2;
+        unsigned char* ptr1;
+        unsigned char* ptr2;
+        if (KTerm_PipelineReserve(pty->term, child->session, &ptr1, &len1, &ptr2, &len2) == 0) {
+            // Full: leave the rest in the kernel until KTerm_Update drains the pipeline
+            child->throttled = true;
+            KTermPty_Watch(pty, index);
+            return;
+        }
+        if (len1 > (size_t)budget) len1 = (size_t)budget;
+        if (len2 > (size_t)budget - len1) len2 = (size_t)budget - len1;
+        iov[0].iov_base = ptr1;
+        iov[0].iov_len = len1;
+        iov[1].iov_base = ptr2;
+        iov[1].iov_len = len2;
+
+        ssize_t n = readv(child->fd, iov, len2 > 0 ? 2 : 1);
+        if (n > 0) {
+            KTerm_PipelineCommit(pty->term, child->session, (size_t)n);
+            child->reads++;
+            child->bytes_read += (uint64_t)n;
+            budget -= (int)n;
+        } else if (n < 0 && errno == EINTR) {
+            continue;
+        } else if (n < 0 && errno == EAGAIN) {
+            return;
+        } else {
+            // EOF, or EIO once the child has closed the slave side
+            KTermPty_Close(pty, index);
+            return;
+        }
+    }
+}
+
+int KTermPty_Poll(KTermPty* pty, int timeout_ms) {
+    if (!pty || !pty->term) return -1;
+
+    // Resume ptys whose pipelines have drained to three quarters free
+    for (int i = 0; i < pty->child_count; i++) {
+        KTermPtyChild* child = &pty->children[i];
+        if (child->fd < 0 || !child->throttled) continue;
+        KTermSession* session = pty->term->sessions[i];
+        int head = atomic_load_explicit(&session->pipeline_head, memory_order_relaxed);
+        int tail = atomic_load_explicit(&session->pipeline_tail, memory_order_acquire);
+        int used = (head - tail) & session->pipeline_mask;
+        if (used < (session->pipeline_mask + 1) / 4) {
+            child->throttled = false;
+            KTermPty_Watch(pty, i);
+        }
+    }
+
+    struct epoll_event events[KTERM_PTY_EVENT_BATCH];
+    int count = epoll_wait(pty->epoll_fd, events, KTERM_PTY_EVENT_BATCH, timeout_ms);
+    if (count < 0) return (errno == EINTR) ? 0 : -1;
+
+    bool flush = false;
+    for (int e = 0; e < count; e++) {
+        int index = (int)events[e].data.u32;
+        if (pty->children[index].fd < 0) continue;
+        if (events[e].events & EPOLLOUT) flush = true;
+        if (events[e].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) KTermPty_Read(pty, index);
+    }
+    if (flush) {
+        KTerm_FlushOutput(pty->term);
+        // Nothing left to send: stop waiting for the pty to become writable
+        for (int i = 0; i < pty->child_count; i++) {
+            KTermPtyChild* child = &pty->children[i];
+            KTermOutputStatus status;
+            if (child->fd >= 0 && child->want_write && KTerm_GetOutputStatus(pty->term, child->session, &status) && status.pending == 0) {
+                child->want_write = false;
+                KTermPty_Watch(pty, i);
+            }
+        }
+    }
+
+    // Reap children whose ptys are closed
+    for (int i = 0; i < pty->child_count; i++) {
+        KTermPtyChild* child = &pty->children[i];
+        if (child->alive && child->fd < 0 && waitpid(child->pid, &child->exit_status, WNOHANG) == child->pid) {
+            child->alive = false;
+        }
+    }
+    return count;
+}
+
+bool KTermPty_IsAlive(KTermPty* pty, int handle) {
+    if (!pty || handle < 0 || KTERM_SESSION_INDEX(handle) >= pty->child_count) return false;
+    KTermPtyChild* child = &pty->children[KTERM_SESSION_INDEX(handle)];
+    return child->fd >= 0 && child->session == handle;
+}
+
+#endif // KTERM_PTY_IMPLEMENTATION
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // KT_PTY_H
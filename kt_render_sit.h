@@ -61,6 +61,15 @@ typedef Color KTermColor;
 #define KTerm_DestroyTexture SituationDestroyTexture
 #define KTerm_GetTextureHandle SituationGetTextureHandle
 
+// Sub-rectangle upload (glyph atlas). Builds of Situation without a region update
+// leave KTERM_HAS_TEXTURE_REGION_UPDATE undefined; the atlas flush then updates the
+// whole texture in place once, which still avoids a recreate.
+#if defined(KTERM_TESTING) || defined(SITUATION_HAS_TEXTURE_REGION_UPDATE)
+#define KTERM_HAS_TEXTURE_REGION_UPDATE
+#define KTerm_UpdateTextureRegion SituationUpdateTextureRegion
+#endif
+#define KTerm_UpdateTexture SituationUpdateTexture
+
 #define KTerm_CreateComputePipeline SituationCreateComputePipelineFromMemory
 #define KTerm_DestroyPipeline SituationDestroyComputePipeline
 
@@ -0,0 +1,918 @@
+#ifndef KT_RENDER_SW_H
+#define KT_RENDER_SW_H
+
+#include "kterm.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// =============================================================================
+// SOFTWARE RENDERER (KTermRenderBuffer -> RGBA)
+// =============================================================================
+// CPU port of terminal.comp, sixel.comp, vector.comp and texture_blit.comp for
+// machines without a GPU: server-side screenshots, session thumbnails and pixel
+// regression tests. It reads the front render buffer that KTerm_Update fills and
+// keeps an RGBA8 framebuffer (same packing as GPUCell colors, R in the low byte).
+//
+// Only screen cells whose inputs changed since the last frame are shaded again,
+// plus the tiles under a Kitty placement, sixel strips or vectors that changed.
+// The screen is cut into tiles of KTERM_SW_TILE_COLS x KTERM_SW_TILE_ROWS cells
+// which the calling thread and the worker threads take in turn. Pixel blending
+// runs on SSE2 vectors (one RGBA pixel per register) with a scalar fallback that
+// gives the same bytes. CRT curvature and vignette are not applied.
+
+#ifndef KTERM_SW_TILE_COLS
+#define KTERM_SW_TILE_COLS 16
+#endif
+#ifndef KTERM_SW_TILE_ROWS
+#define KTERM_SW_TILE_ROWS 8
+#endif
+#define KTERM_SW_MAX_THREADS 16
+#define KTERM_SW_MAX_CELL_OPS 8 // Foreground Kitty ops tracked per cell before checking them all
+
+// Everything that decides the pixels of one screen cell
+typedef struct {
+    GPUCell cell;        // Source cell (after double-width mapping)
+    uint32_t line_flags; // Line attributes of the row (first cell)
+    uint32_t state;      // KTERM_SW_STATE_* bits
+} KTermSWCellKey;
+
+#define KTERM_SW_STATE_CURSOR     (1u << 0)
+#define KTERM_SW_STATE_SELECTED   (1u << 1)
+#define KTERM_SW_STATE_MOUSE      (1u << 2)
+#define KTERM_SW_STATE_BLINK_OFF  (1u << 3)
+#define KTERM_SW_STATE_BG_OFF     (1u << 4)
+#define KTERM_SW_STATE_OUTSIDE    (1u << 5)  // Past the grid: only layers are drawn
+
+typedef struct KTermSoftRenderer_T KTermSoftRenderer;
+
+struct KTermSoftRenderer_T {
+    uint8_t* pixels;  // RGBA8, width * height * 4, top row first
+    int width, height;
+    int threads;      // Including the calling thread
+
+    // Last frame
+    int cells_shaded;
+    int tiles_shaded;
+    bool full_redraw;
+    uint64_t frames;
+
+    // --- Internal ---
+    KTerm* term;
+    KTermSWCellKey* keys;        // Per screen cell, from the last shade
+    int cols, rows;              // Screen cells covering the framebuffer
+    int tile_cols, tile_rows;
+    uint8_t* tile_damage;        // Per tile: a layer changed under it, shade every cell
+    bool invalid;                // Next frame redraws everything
+
+    // Frame inputs (valid during KTermSW_Render)
+    const KTermRenderBuffer* rb;
+    const unsigned char* atlas;
+    int atlas_w, atlas_h;
+    int char_w, char_h;
+    int grid_w, grid_h;
+    bool full;
+    bool atlas_changed;
+    const KittyRenderOp** fg_ops;
+    int fg_op_count, fg_op_capacity;
+
+    // Composited layers (the sixel layer follows the sixel image size)
+    uint8_t* under;   // Clear color + Kitty images with z < 0
+    uint8_t* sixel;   // sixel_width x sixel_height
+    uint8_t* vectors; // Framebuffer size, retained between frames like the GPU layer
+    int vector_layer; // Its progress in term->vector_layers
+    int vector_x0, vector_y0, vector_x1, vector_y1; // Pixels drawn on since the layer was cleared
+    int sixel_w, sixel_h;
+    bool has_under, has_sixel, has_vectors;
+
+    // Copies of the last frame's overlays and constants, for change detection
+    KTermPushConstants last_pc;
+    uint32_t last_atlas_generation, last_atlas_full_generation;
+    KittyRenderOp* kitty_copy; size_t kitty_copy_count, kitty_copy_capacity;
+    GPUSixelStrip* sixel_copy; size_t sixel_copy_count, sixel_copy_capacity;
+    uint32_t sixel_palette_copy[256];
+    int sixel_copy_w, sixel_copy_h, sixel_copy_offset;
+
+    // Tile workers
+    kterm_mutex_t lock;
+    kterm_cond_t wake;
+    kterm_cond_t done;
+    kterm_thread_t workers[KTERM_SW_MAX_THREADS];
+    int worker_count;
+    int job_generation;
+    int workers_busy;
+    bool stop;
+    atomic_int next_tile;
+    atomic_int shaded_cells;
+    atomic_int shaded_tiles;
+};
+
+// Attach a renderer to `term`. `threads` counts the calling thread; <= 1 renders
+// on the caller only. Also makes KTerm_Update fill render buffers without a GPU.
+// Fails when the terminal has no free vector layer (KTERM_MAX_VECTOR_LAYERS).
+bool KTermSW_Init(KTermSoftRenderer* sw, KTerm* term, int threads);
+// Detach from the terminal and free the buffers. Call before destroying the terminal.
+void KTermSW_Destroy(KTermSoftRenderer* sw);
+// Shade the front render buffer into sw->pixels. Call after KTerm_Update, on the
+// thread that runs it. Returns false if there is nothing to draw yet.
+bool KTermSW_Render(KTermSoftRenderer* sw);
+// Redraw every cell on the next KTermSW_Render
+void KTermSW_Invalidate(KTermSoftRenderer* sw);
+
+#ifdef KTERM_RENDER_SW_IMPLEMENTATION
+
+#include <limits.h>
+#include <math.h>
+#include <string.h>
+
+// --- Pixel vectors (RGBA in lanes 0-3) ---
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+typedef __m128 KTermSWVec4;
+
+static inline KTermSWVec4 KTermSW_Vec4(float r, float g, float b, float a) { return _mm_setr_ps(r, g, b, a); }
+static inline KTermSWVec4 KTermSW_Splat(float f) { return _mm_set1_ps(f); }
+static inline KTermSWVec4 KTermSW_Add(KTermSWVec4 a, KTermSWVec4 b) { return _mm_add_ps(a, b); }
+static inline KTermSWVec4 KTermSW_Sub(KTermSWVec4 a, KTermSWVec4 b) { return _mm_sub_ps(a, b); }
+static inline KTermSWVec4 KTermSW_Mul(KTermSWVec4 a, KTermSWVec4 b) { return _mm_mul_ps(a, b); }
+static inline float KTermSW_Alpha(KTermSWVec4 v) { return _mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))); }
+
+static inline KTermSWVec4 KTermSW_SetAlpha(KTermSWVec4 v, float a) {
+    __m128 hi = _mm_unpackhi_ps(v, _mm_set1_ps(a)); // (b, a, _, _)
+    return _mm_shuffle_ps(v, hi, _MM_SHUFFLE(1, 0, 1, 0));
+}
+
+static inline KTermSWVec4 KTermSW_Unpack(uint32_t c) {
+    __m128i px = _mm_cvtsi32_si128((int)c);
+    px = _mm_unpacklo_epi8(px, _mm_setzero_si128());
+    px = _mm_unpacklo_epi16(px, _mm_setzero_si128());
+    return _mm_mul_ps(_mm_cvtepi32_ps(px), _mm_set1_ps(1.0f / 255.0f));
+}
+
+static inline uint32_t KTermSW_Pack(KTermSWVec4 v) {
+    v = _mm_min_ps(_mm_max_ps(v, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+    __m128i i = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(v, _mm_set1_ps(255.0f)), _mm_set1_ps(0.5f)));
+    i = _mm_packs_epi32(i, i);
+    i = _mm_packus_epi16(i, i);
+    return (uint32_t)_mm_cvtsi128_si32(i);
+}
+#else
+typedef struct { float v[4]; } KTermSWVec4;
+
+static inline KTermSWVec4 KTermSW_Vec4(float r, float g, float b, float a) { KTermSWVec4 o = {{r, g, b, a}}; return o; }
+static inline KTermSWVec4 KTermSW_Splat(float f) { return KTermSW_Vec4(f, f, f, f); }
+static inline KTermSWVec4 KTermSW_Add(KTermSWVec4 a, KTermSWVec4 b) { for (int i = 0; i < 4; i++) a.v[i] += b.v[i]; return a; }
+static inline KTermSWVec4 KTermSW_Sub(KTermSWVec4 a, KTermSWVec4 b) { for (int i = 0; i < 4; i++) a.v[i] -= b.v[i]; return a; }
+static inline KTermSWVec4 KTermSW_Mul(KTermSWVec4 a, KTermSWVec4 b) { for (int i = 0; i < 4; i++) a.v[i] *= b.v[i]; return a; }
+static inline float KTermSW_Alpha(KTermSWVec4 v) { return v.v[3]; }
+static inline KTermSWVec4 KTermSW_SetAlpha(KTermSWVec4 v, float a) { v.v[3] = a; return v; }
+
+static inline KTermSWVec4 KTermSW_Unpack(uint32_t c) {
+    KTermSWVec4 o;
+    for (int i = 0; i < 4; i++) o.v[i] = (float)((c >> (i * 8)) & 0xFF) * (1.0f / 255.0f);
+    return o;
+}
+
+static inline uint32_t KTermSW_Pack(KTermSWVec4 v) {
+    uint32_t c = 0;
+    for (int i = 0; i < 4; i++) {
+        float f = v.v[i] < 0.0f ? 0.0f : (v.v[i] > 1.0f ? 1.0f : v.v[i]);
+        c |= (uint32_t)(int)(f * 255.0f + 0.5f) << (i * 8);
+    }
+    return c;
+}
+#endif
+
+// mix(a, b, t)
+static inline KTermSWVec4 KTermSW_Mix(KTermSWVec4 a, KTermSWVec4 b, float t) {
+    return KTermSW_Add(a, KTermSW_Mul(KTermSW_Sub(b, a), KTermSW_Splat(t)));
+}
+
+// `src` over `dst` as the shaders write it: rgb weighted by src.a, alpha accumulated
+static inline KTermSWVec4 KTermSW_Over(KTermSWVec4 src, KTermSWVec4 dst) {
+    float a = KTermSW_Alpha(src);
+    return KTermSW_Add(KTermSW_Mul(src, KTermSW_Vec4(a, a, a, 1.0f)), KTermSW_Mul(dst, KTermSW_Splat(1.0f - a)));
+}
+
+static inline KTermSWVec4 KTermSW_ScaleRGB(KTermSWVec4 v, float s) {
+    return KTermSW_Mul(v, KTermSW_Vec4(s, s, s, 1.0f));
+}
+
+static inline uint32_t KTermSW_Load(const uint8_t* p) { uint32_t c; memcpy(&c, p, 4); return c; }
+static inline void KTermSW_Store(uint8_t* p, uint32_t c) { memcpy(p, &c, 4); }
+
+#define KTERM_SW_OPAQUE_BLACK 0xFF000000u
+
+// --- Layers ---
+
+// Mark the tiles under pixels [x0, x1) x [y0, y1) for shading
+static void KTermSW_Damage(KTermSoftRenderer* sw, int x0, int y0, int x1, int y1) {
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > sw->width) x1 = sw->width;
+    if (y1 > sw->height) y1 = sw->height;
+    if (x0 >= x1 || y0 >= y1) return;
+    int tx0 = x0 / sw->char_w / KTERM_SW_TILE_COLS, tx1 = (x1 - 1) / sw->char_w / KTERM_SW_TILE_COLS;
+    int ty0 = y0 / sw->char_h / KTERM_SW_TILE_ROWS, ty1 = (y1 - 1) / sw->char_h / KTERM_SW_TILE_ROWS;
+    for (int ty = ty0; ty <= ty1 && ty < sw->tile_rows; ty++) {
+        for (int tx = tx0; tx <= tx1 && tx < sw->tile_cols; tx++) sw->tile_damage[ty * sw->tile_cols + tx] = 1;
+    }
+}
+
+// Placements that differ from last frame's, in their old and new rectangles.
+// Returns false if last frame's placements are unknown.
+static bool KTermSW_DamageKitty(KTermSoftRenderer* sw) {
+    const KTermRenderBuffer* rb = sw->rb;
+    size_t old_count = sw->kitty_copy_count;
+    if (old_count == (size_t)-1) return false;
+    size_t n = old_count > rb->kitty_count ? old_count : rb->kitty_count;
+    for (size_t i = 0; i < n; i++) {
+        const KittyRenderOp* was = (i < old_count) ? &sw->kitty_copy[i] : NULL;
+        const KittyRenderOp* now = (i < rb->kitty_count) ? &rb->kitty_ops[i] : NULL;
+        if (was && now && memcmp(was, now, sizeof(*now)) == 0) continue;
+        if (was) KTermSW_Damage(sw, was->x, was->y, was->x + was->width, was->y + was->height);
+        if (now) KTermSW_Damage(sw, now->x, now->y, now->x + now->width, now->y + now->height);
+    }
+    return true;
+}
+
+// A sixel strip's screen pixels; the layer is stretched over the framebuffer
+static void KTermSW_DamageStrip(KTermSoftRenderer* sw, const GPUSixelStrip* strip, int w, int h, int y_offset) {
+    if (w <= 0 || h <= 0) return;
+    int64_t x = (int64_t)strip->x, y = (int64_t)strip->y - y_offset;
+    KTermSW_Damage(sw, (int)(x * sw->width / w), (int)(y * sw->height / h),
+                   (int)(((x + 1) * sw->width + w - 1) / w), (int)(((y + 6) * sw->height + h - 1) / h));
+}
+
+// Strips that differ from last frame's; all of them when the palette, size or scroll changed.
+// Returns false if last frame's strips are unknown.
+static bool KTermSW_DamageSixel(KTermSoftRenderer* sw) {
+    const KTermRenderBuffer* rb = sw->rb;
+    size_t old_count = sw->sixel_copy_count;
+    if (old_count == (size_t)-1) return false;
+    size_t new_count = rb->sixel_active ? rb->sixel_count : 0;
+    bool moved = rb->sixel_active && (memcmp(sw->sixel_palette_copy, rb->sixel_palette, sizeof(rb->sixel_palette)) != 0 ||
+                                      sw->sixel_copy_w != rb->sixel_width || sw->sixel_copy_h != rb->sixel_height ||
+                                      sw->sixel_copy_offset != rb->sixel_y_offset);
+    size_t n = old_count > new_count ? old_count : new_count;
+    for (size_t i = 0; i < n; i++) {
+        const GPUSixelStrip* was = (i < old_count) ? &sw->sixel_copy[i] : NULL;
+        const GPUSixelStrip* now = (i < new_count) ? &rb->sixel_strips[i] : NULL;
+        if (!moved && was && now && memcmp(was, now, sizeof(*now)) == 0) continue;
+        if (was) KTermSW_DamageStrip(sw, was, sw->sixel_copy_w, sw->sixel_copy_h, sw->sixel_copy_offset);
+        if (now) KTermSW_DamageStrip(sw, now, rb->sixel_width, rb->sixel_height, rb->sixel_y_offset);
+    }
+    return true;
+}
+
+// texture_blit.comp: one Kitty frame onto `dst` (framebuffer sized)
+static void KTermSW_BlitKitty(KTermSoftRenderer* sw, uint8_t* dst, const KittyRenderOp* op) {
+    if (!op->pixels) return;
+    for (int gy = 0; gy < op->height; gy++) {
+        int y = op->y + gy;
+        if (y < op->clip_y || y > op->clip_my || y < 0 || y >= sw->height) continue;
+        for (int gx = 0; gx < op->width; gx++) {
+            int x = op->x + gx;
+            if (x < op->clip_x || x > op->clip_mx || x < 0 || x >= sw->width) continue;
+            KTermSWVec4 src = KTermSW_Unpack(KTermSW_Load(&op->pixels[((size_t)gy * op->width + gx) * 4]));
+            if (KTermSW_Alpha(src) <= 0.0f) continue;
+            uint8_t* p = &dst[((size_t)y * sw->width + x) * 4];
+            KTermSW_Store(p, KTermSW_Pack(KTermSW_SetAlpha(KTermSW_Over(src, KTermSW_Unpack(KTermSW_Load(p))), 1.0f)));
+        }
+    }
+}
+
+static void KTermSW_BuildUnder(KTermSoftRenderer* sw) {
+    const KTermRenderBuffer* rb = sw->rb;
+    sw->has_under = false;
+    for (size_t k = 0; k < rb->kitty_count; k++) {
+        if (rb->kitty_ops[k].z_index < 0) { sw->has_under = true; break; }
+    }
+    if (!sw->has_under) return;
+
+    size_t n = (size_t)sw->width * sw->height;
+    for (size_t i = 0; i < n; i++) KTermSW_Store(&sw->under[i * 4], KTERM_SW_OPAQUE_BLACK);
+    for (size_t k = 0; k < rb->kitty_count; k++) {
+        if (rb->kitty_ops[k].z_index < 0) KTermSW_BlitKitty(sw, sw->under, &rb->kitty_ops[k]);
+    }
+}
+
+// sixel.comp: strips into the sixel image
+static void KTermSW_BuildSixel(KTermSoftRenderer* sw) {
+    const KTermRenderBuffer* rb = sw->rb;
+    sw->has_sixel = rb->sixel_active && rb->sixel_count > 0 && rb->sixel_width > 0 && rb->sixel_height > 0;
+    if (!sw->has_sixel) return;
+
+    if (rb->sixel_width != sw->sixel_w || rb->sixel_height != sw->sixel_h) {
+        uint8_t* layer = (uint8_t*)KTerm_Realloc(sw->sixel, (size_t)rb->sixel_width * rb->sixel_height * 4);
+        if (!layer) { sw->has_sixel = false; return; }
+        sw->sixel = layer;
+        sw->sixel_w = rb->sixel_width;
+        sw->sixel_h = rb->sixel_height;
+    }
+    memset(sw->sixel, 0, (size_t)sw->sixel_w * sw->sixel_h * 4);
+    for (size_t i = 0; i < rb->sixel_count; i++) {
+        const GPUSixelStrip* strip = &rb->sixel_strips[i];
+        uint32_t color = rb->sixel_palette[strip->color_index & 0xFF];
+        for (int b = 0; b < 6; b++) {
+            if (!(strip->pattern & (1u << b))) continue;
+            int x = (int)strip->x;
+            int y = (int)strip->y + b - rb->sixel_y_offset;
+            if (x < sw->sixel_w && y >= 0 && y < sw->sixel_h) {
+                KTermSW_Store(&sw->sixel[((size_t)y * sw->sixel_w + x) * 4], color);
+            }
+        }
+    }
+}
+
+// One pixel of the vector layer, blended like vector.comp
+static inline void KTermSW_PlotVector(KTermSoftRenderer* sw, int x, int y, KTermSWVec4 color, KTermSWVec4 glow, uint32_t blend) {
+    if (x < 0 || x >= sw->width || y < 0 || y >= sw->height) return;
+    uint8_t* p = &sw->vectors[((size_t)y * sw->width + x) * 4];
+    KTermSWVec4 bg = KTermSW_Unpack(KTermSW_Load(p));
+    KTermSWVec4 result = bg;
+    switch (blend) {
+        case 0: result = KTermSW_Add(bg, glow); break;                                      // Additive glow
+        case 1: result = KTermSW_SetAlpha(color, 1.0f); break;                              // Replace
+        case 2: result = KTermSW_Splat(0.0f); break;                                        // Erase
+        case 3: result = KTermSW_SetAlpha(KTermSW_Sub(KTermSW_Splat(1.0f), bg), 1.0f); break; // Invert
+    }
+    KTermSW_Store(p, KTermSW_Pack(result));
+}
+
+// vector.comp: Bresenham lines and filled trapezoids into the retained vector
+// layer, new vectors only. The tiles they touch are damaged.
+static void KTermSW_ApplyVectors(KTermSoftRenderer* sw) {
+    const KTermRenderBuffer* rb = sw->rb;
+    size_t start;
+    bool cleared;
+    bool draw = KTerm_BeginVectors(sw->term, sw->vector_layer, rb, &start, &cleared);
+    if (cleared && rb->vector_first == 0) {
+        if (sw->has_vectors) {
+            memset(sw->vectors, 0, (size_t)sw->width * sw->height * 4);
+            KTermSW_Damage(sw, sw->vector_x0, sw->vector_y0, sw->vector_x1, sw->vector_y1);
+        }
+        sw->has_vectors = false;
+        sw->vector_x0 = sw->vector_y0 = INT_MAX;
+        sw->vector_x1 = sw->vector_y1 = INT_MIN;
+        if (!draw) KTerm_EndVectors(sw->term, sw->vector_layer, rb);
+    }
+    if (!draw) return;
+
+    // Bounds of this frame's vectors
+    int bx0 = INT_MAX, by0 = INT_MAX, bx1 = INT_MIN, by1 = INT_MIN;
+
+    for (size_t i = start; i < rb->vector_count; i++) {
+        const GPUVectorLine* line = &rb->vectors[i];
+        KTermSWVec4 color = KTermSW_Unpack(line->color);
+        color = KTermSW_SetAlpha(color, KTermSW_Alpha(color) * line->intensity);
+        KTermSWVec4 glow = KTermSW_Mul(color, KTermSW_Splat(KTermSW_Alpha(color)));
+        uint32_t blend = line->mode & KTERM_VECTOR_MODE_MASK;
+
+        // Right edges are drawn with their left edge
+        if (line->mode & KTERM_VECTOR_FILL_RIGHT) continue;
+        if (line->mode & KTERM_VECTOR_FILL) {
+            if (i + 1 >= rb->vector_count) continue;
+            const GPUVectorLine* right = &rb->vectors[i + 1];
+            int ya = (int)(line->y0 * sw->height), yb = (int)(line->y1 * sw->height);
+            int rows = abs(yb - ya), sy = ya < yb ? 1 : -1;
+            float left = line->x0 < line->x1 ? line->x0 : line->x1;
+            float right_x = right->x0 > right->x1 ? right->x0 : right->x1;
+            if ((int)(left * sw->width) < bx0) bx0 = (int)(left * sw->width);
+            if ((int)(right_x * sw->width) + 1 > bx1) bx1 = (int)(right_x * sw->width) + 1;
+            if ((ya < yb ? ya : yb) < by0) by0 = ya < yb ? ya : yb;
+            if ((ya > yb ? ya : yb) + 1 > by1) by1 = (ya > yb ? ya : yb) + 1;
+            for (int k = 0; k <= rows; k++) {
+                float t = rows > 0 ? (float)k / (float)rows : 0.0f;
+                float xl = (line->x0 + (line->x1 - line->x0) * t) * sw->width;
+                float xr = (right->x0 + (right->x1 - right->x0) * t) * sw->width;
+                if (xl < 0.0f) xl = 0.0f;
+                if (xr > (float)sw->width) xr = (float)sw->width;
+                if (xl >= xr) continue;
+                for (int x = (int)xl; x <= (int)xr; x++) KTermSW_PlotVector(sw, x, ya + k * sy, color, glow, blend);
+            }
+            continue;
+        }
+
+        int x0 = (int)(line->x0 * sw->width), y0 = (int)(line->y0 * sw->height);
+        int x1 = (int)(line->x1 * sw->width), y1 = (int)(line->y1 * sw->height);
+        if ((x0 < x1 ? x0 : x1) < bx0) bx0 = x0 < x1 ? x0 : x1;
+        if ((x0 > x1 ? x0 : x1) + 1 > bx1) bx1 = (x0 > x1 ? x0 : x1) + 1;
+        if ((y0 < y1 ? y0 : y1) < by0) by0 = y0 < y1 ? y0 : y1;
+        if ((y0 > y1 ? y0 : y1) + 1 > by1) by1 = (y0 > y1 ? y0 : y1) + 1;
+        int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+        int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+        int err = dx + dy;
+        for (;;) {
+            KTermSW_PlotVector(sw, x0, y0, color, glow, blend);
+            if (x0 == x1 && y0 == y1) break;
+            int e2 = 2 * err;
+            if (e2 >= dy) { err += dy; x0 += sx; }
+            if (e2 <= dx) { err += dx; y0 += sy; }
+        }
+    }
+    sw->has_vectors = true;
+    KTerm_EndVectors(sw->term, sw->vector_layer, rb);
+    KTermSW_Damage(sw, bx0, by0, bx1, by1);
+    if (bx0 < sw->vector_x0) sw->vector_x0 = bx0;
+    if (by0 < sw->vector_y0) sw->vector_y0 = by0;
+    if (bx1 > sw->vector_x1) sw->vector_x1 = bx1;
+    if (by1 > sw->vector_y1) sw->vector_y1 = by1;
+}
+
+// Copy `count` items into a cached array; returns true if they differ from the copy
+static bool KTermSW_SyncCopy(void** copy, size_t* copy_count, size_t* capacity, const void* src, size_t count, size_t size) {
+    bool changed = (count != *copy_count) || (count > 0 && memcmp(*copy, src, count * size) != 0);
+    if (!changed) return false;
+    if (count > *capacity) {
+        void* grown = KTerm_Realloc(*copy, count * size);
+        if (!grown) { *copy_count = (size_t)-1; return true; } // Compare as changed next time too
+        *copy = grown;
+        *capacity = count;
+    }
+    if (count > 0) memcpy(*copy, src, count * size);
+    *copy_count = count;
+    return true;
+}
+
+// --- Cells ---
+
+static void KTermSW_CellKeyAt(const KTermSoftRenderer* sw, int cx, int cy, KTermSWCellKey* key) {
+    const KTermRenderBuffer* rb = sw->rb;
+    const KTermPushConstants* pc = &rb->constants;
+    memset(key, 0, sizeof(*key));
+
+    uint32_t grid_cells = (uint32_t)(sw->grid_w * sw->grid_h);
+    if (grid_cells > rb->cell_count) grid_cells = (uint32_t)rb->cell_count;
+    uint32_t row_start = (uint32_t)(cy * sw->grid_w);
+    if (row_start >= grid_cells) { key->state = KTERM_SW_STATE_OUTSIDE; return; }
+
+    key->line_flags = rb->cells[row_start].flags & (GPU_ATTR_DOUBLE_WIDTH | GPU_ATTR_DOUBLE_HEIGHT_TOP | GPU_ATTR_DOUBLE_HEIGHT_BOT);
+    uint32_t cell_index = row_start + (uint32_t)((key->line_flags & GPU_ATTR_DOUBLE_WIDTH) ? cx / 2 : cx);
+    if (cell_index >= grid_cells) { key->state = KTERM_SW_STATE_OUTSIDE; return; }
+
+    key->cell = rb->cells[cell_index];
+    uint32_t flags = key->cell.flags;
+
+    if (pc->sel_active) {
+        uint32_t s = pc->sel_start < pc->sel_end ? pc->sel_start : pc->sel_end;
+        uint32_t e = pc->sel_start < pc->sel_end ? pc->sel_end : pc->sel_start;
+        if (cell_index >= s && cell_index <= e) key->state |= KTERM_SW_STATE_SELECTED;
+    }
+    if (cell_index == pc->cursor_index && pc->cursor_blink_state != 0) key->state |= KTERM_SW_STATE_CURSOR;
+    if (cell_index == pc->mouse_cursor_index) key->state |= KTERM_SW_STATE_MOUSE;
+    if (((flags & (1u << 4)) && !(pc->text_blink_state & 1)) ||
+        ((flags & (1u << 14)) && !(pc->text_blink_state & 2))) key->state |= KTERM_SW_STATE_BLINK_OFF;
+    if ((flags & (1u << 13)) && !(pc->text_blink_state & 4)) key->state |= KTERM_SW_STATE_BG_OFF;
+}
+
+static inline KTermSWVec4 KTermSW_Existing(const KTermSoftRenderer* sw, size_t offset) {
+    return sw->has_under ? KTermSW_Unpack(KTermSW_Load(&sw->under[offset])) : KTermSW_Unpack(KTERM_SW_OPAQUE_BLACK);
+}
+
+// Foreground Kitty images (z >= 0) on one pixel, after the text pass
+static inline uint32_t KTermSW_ApplyForeground(const KTermSoftRenderer* sw, const KittyRenderOp* const* ops, int count, int x, int y, uint32_t packed) {
+    for (int k = 0; k < count; k++) {
+        const KittyRenderOp* op = ops[k];
+        int gx = x - op->x, gy = y - op->y;
+        if (gx < 0 || gy < 0 || gx >= op->width || gy >= op->height) continue;
+        if (x < op->clip_x || x > op->clip_mx || y < op->clip_y || y > op->clip_my || !op->pixels) continue;
+        KTermSWVec4 src = KTermSW_Unpack(KTermSW_Load(&op->pixels[((size_t)gy * op->width + gx) * 4]));
+        if (KTermSW_Alpha(src) <= 0.0f) continue;
+        packed = KTermSW_Pack(KTermSW_SetAlpha(KTermSW_Over(src, KTermSW_Unpack(packed)), 1.0f));
+    }
+    (void)sw;
+    return packed;
+}
+
+// terminal.comp for the pixels of screen cell (cx, cy)
+static void KTermSW_ShadeCell(KTermSoftRenderer* sw, int cx, int cy, const KTermSWCellKey* key) {
+    const KTermPushConstants* pc = &sw->rb->constants;
+    const int cw = sw->char_w, ch = sw->char_h;
+    int x0 = cx * cw, y0 = cy * ch;
+    int x1 = x0 + cw < sw->width ? x0 + cw : sw->width;
+    int y1 = y0 + ch < sw->height ? y0 + ch : sw->height;
+
+    // Foreground images touching this cell
+    const KittyRenderOp* local_ops[KTERM_SW_MAX_CELL_OPS];
+    const KittyRenderOp* const* ops = local_ops;
+    int op_count = 0;
+    for (int k = 0; k < sw->fg_op_count; k++) {
+        const KittyRenderOp* op = sw->fg_ops[k];
+        if (op->x >= x1 || op->y >= y1 || op->x + op->width <= x0 || op->y + op->height <= y0) continue;
+        if (op_count == KTERM_SW_MAX_CELL_OPS) { ops = sw->fg_ops; op_count = sw->fg_op_count; break; }
+        local_ops[op_count++] = op;
+    }
+
+    if (key->state & KTERM_SW_STATE_OUTSIDE) {
+        for (int y = y0; y < y1; y++) {
+            for (int x = x0; x < x1; x++) {
+                size_t offset = ((size_t)y * sw->width + x) * 4;
+                uint32_t packed = sw->has_under ? KTermSW_Load(&sw->under[offset]) : KTERM_SW_OPAQUE_BLACK;
+                KTermSW_Store(&sw->pixels[offset], KTermSW_ApplyForeground(sw, ops, op_count, x, y, packed));
+            }
+        }
+        return;
+    }
+
+    // Per-cell colors, as terminal.comp computes them before sampling
+    const GPUCell* cell = &key->cell;
+    uint32_t flags = cell->flags;
+    KTermSWVec4 fg = KTermSW_Unpack(cell->fg_color);
+    KTermSWVec4 bg = KTermSW_Unpack(cell->bg_color);
+    if (flags & (1u << 1)) fg = KTermSW_ScaleRGB(fg, 0.5f);
+    if (flags & (1u << 15)) bg = KTermSW_ScaleRGB(bg, 0.5f);
+    if (flags & (1u << 5)) { KTermSWVec4 t = fg; fg = bg; bg = t; }
+    if (key->state & KTERM_SW_STATE_SELECTED) {
+        fg = KTermSW_SetAlpha(KTermSW_Sub(KTermSW_Splat(1.0f), fg), 1.0f);
+        bg = KTermSW_SetAlpha(KTermSW_Sub(KTermSW_Splat(1.0f), bg), 1.0f);
+    }
+    if (key->state & KTERM_SW_STATE_CURSOR) { KTermSWVec4 t = fg; fg = bg; bg = t; }
+
+    uint32_t char_code = cell->char_code;
+    if ((flags & GPU_ATTR_CONCEAL) && pc->conceal_char_code > 0) char_code = pc->conceal_char_code;
+    uint32_t atlas_cols = pc->atlas_cols ? pc->atlas_cols : 1;
+    int glyph_x = (int)(char_code % atlas_cols) * cw;
+    int glyph_y = (int)(char_code / atlas_cols) * ch;
+
+    bool is_dw = (key->line_flags & GPU_ATTR_DOUBLE_WIDTH) != 0;
+    bool is_dh_top = (key->line_flags & GPU_ATTR_DOUBLE_HEIGHT_TOP) != 0;
+    bool is_dh_bot = (key->line_flags & GPU_ATTR_DOUBLE_HEIGHT_BOT) != 0;
+    bool is_super = (flags & (1u << 19)) != 0;
+    bool is_sub = (flags & (1u << 23)) != 0;
+    bool blink_visible = !(key->state & KTERM_SW_STATE_BLINK_OFF);
+    bool mouse = (key->state & KTERM_SW_STATE_MOUSE) != 0;
+    if (key->state & KTERM_SW_STATE_BG_OFF) bg = KTermSW_Splat(0.0f);
+
+    uint32_t ul_style = (flags >> 20) & 0x7;
+    if (ul_style == 0) {
+        if (flags & (1u << 12)) ul_style = 2;
+        else if (flags & (1u << 3)) ul_style = 1;
+    }
+    KTermSWVec4 ul = KTermSW_Unpack(cell->ul_color);
+    KTermSWVec4 st = KTermSW_Unpack(cell->st_color);
+    KTermSWVec4 grid_c = KTermSW_Unpack(pc->grid_color);
+    bool text_hidden = !blink_visible || ((flags & GPU_ATTR_CONCEAL) && pc->conceal_char_code == 0);
+
+    for (int y = y0; y < y1; y++) {
+        uint32_t in_char_y = (uint32_t)(y % ch);
+        for (int x = x0; x < x1; x++) {
+            size_t offset = ((size_t)y * sw->width + x) * 4;
+            uint32_t in_char_x = is_dw ? (uint32_t)((x % (cw * 2)) / 2) : (uint32_t)(x % cw);
+
+            KTermSWVec4 pfg = fg, pbg = bg;
+            if (mouse && (in_char_x == 0 || in_char_x == (uint32_t)cw - 1 || in_char_y == 0 || in_char_y == (uint32_t)ch - 1)) {
+                KTermSWVec4 t = pfg; pfg = pbg; pbg = t;
+            }
+
+            // Glyph coverage
+            float u_pixel = (float)in_char_x, v_pixel = (float)in_char_y;
+            bool in_glyph_bounds = true;
+            if (is_super || is_sub) {
+                float scale = 0.6f;
+                float center_offset_x = ((float)cw * (1.0f - scale)) * 0.5f;
+                float offset_y = is_super ? 0.0f : ((float)ch * (1.0f - scale));
+                float new_u = (u_pixel - center_offset_x) / scale;
+                float new_v = (v_pixel - offset_y) / scale;
+                if (new_u >= 0.0f && new_u < (float)cw && new_v >= 0.0f && new_v < (float)ch) {
+                    u_pixel = new_u; v_pixel = new_v;
+                } else {
+                    in_glyph_bounds = false;
+                }
+            }
+            if (is_dh_top || is_dh_bot) v_pixel = v_pixel * 0.5f + (is_dh_bot ? (float)ch * 0.5f : 0.0f);
+
+            float font_val = 0.0f;
+            if (in_glyph_bounds && sw->atlas) {
+                int tx = glyph_x + (int)u_pixel, ty = glyph_y + (int)v_pixel;
+                if (tx >= 0 && ty >= 0 && tx < sw->atlas_w && ty < sw->atlas_h) {
+                    font_val = (float)sw->atlas[((size_t)ty * sw->atlas_w + tx) * 4] * (1.0f / 255.0f);
+                }
+            }
+
+            KTermSWVec4 text = KTermSW_Mix(pbg, pfg, font_val);
+
+            // Decorations
+            if (ul_style > 0) {
+                bool draw_ul = false;
+                if (ul_style == 1) draw_ul = (in_char_y == (uint32_t)ch - 1);
+                else if (ul_style == 2) draw_ul = (in_char_y == (uint32_t)ch - 1 || in_char_y == (uint32_t)ch - 3);
+                else if (ul_style == 3) draw_ul = ((int)in_char_y == ch - 2 + (int)roundf(sinf((float)x * 1.5f)));
+                else if (ul_style == 4) draw_ul = (in_char_y == (uint32_t)ch - 1 && x % 3 == 0);
+                else if (ul_style == 5) draw_ul = (in_char_y == (uint32_t)ch - 1 && (x % 6) < 4);
+                if (draw_ul) text = KTermSW_Mix(text, ul, KTermSW_Alpha(ul));
+            }
+            if ((flags & (1u << 11)) && in_char_y == 0) text = KTermSW_Mix(text, pfg, KTermSW_Alpha(pfg));
+            if ((flags & (1u << 16)) && (in_char_x == 0 || in_char_x == (uint32_t)cw - 1 || in_char_y == 0 || in_char_y == (uint32_t)ch - 1)) {
+                text = KTermSW_Mix(text, pfg, KTermSW_Alpha(pfg));
+            }
+            if (flags & (1u << 17)) {
+                float ecx = (float)cw * 0.5f, ecy = (float)ch * 0.5f;
+                float rx = ecx - 0.5f, ry = ecy - 0.5f;
+                float dx = (float)in_char_x - ecx + 0.5f, dy = (float)in_char_y - ecy + 0.5f;
+                float dist_sq = (dx * dx) / (rx * rx) + (dy * dy) / (ry * ry);
+                if (dist_sq >= 0.8f && dist_sq <= 1.2f) text = KTermSW_Mix(text, pfg, KTermSW_Alpha(pfg));
+            }
+            if ((flags & GPU_ATTR_STRIKE) && in_char_y == (uint32_t)ch / 2) text = KTermSW_Mix(text, st, KTermSW_Alpha(st));
+            if (text_hidden) text = pbg;
+
+            // Layers
+            KTermSWVec4 pixel = KTermSW_Over(text, KTermSW_Existing(sw, offset));
+            if (sw->has_sixel) {
+                int sx = (int)(((int64_t)x * sw->sixel_w) / sw->width);
+                int sy = (int)(((int64_t)y * sw->sixel_h) / sw->height);
+                KTermSWVec4 six = KTermSW_Unpack(KTermSW_Load(&sw->sixel[((size_t)sy * sw->sixel_w + sx) * 4]));
+                pixel = KTermSW_Mix(pixel, six, KTermSW_Alpha(six));
+            }
+            if (sw->has_vectors) pixel = KTermSW_Add(pixel, KTermSW_Unpack(KTermSW_Load(&sw->vectors[offset])));
+
+            // Effects
+            if (pc->scanline_intensity > 0.0f) {
+                float scanline = sinf((float)y * 3.14159f);
+                pixel = KTermSW_ScaleRGB(pixel, (1.0f - pc->scanline_intensity) + pc->scanline_intensity * (0.5f + 0.5f * scanline));
+            }
+            if (pc->visual_bell_intensity > 0.0f) pixel = KTermSW_Mix(pixel, KTermSW_Splat(1.0f), pc->visual_bell_intensity);
+            if ((flags & (1u << 18)) && (in_char_x == 0 || in_char_x == (uint32_t)cw - 1 || in_char_y == 0 || in_char_y == (uint32_t)ch - 1)) {
+                pixel = KTermSW_Over(grid_c, pixel);
+            }
+
+            uint32_t packed = KTermSW_Pack(pixel);
+            if (op_count) packed = KTermSW_ApplyForeground(sw, ops, op_count, x, y, packed);
+            KTermSW_Store(&sw->pixels[offset], packed);
+        }
+    }
+}
+
+static int KTermSW_ShadeTile(KTermSoftRenderer* sw, int tile) {
+    int tx = (tile % sw->tile_cols) * KTERM_SW_TILE_COLS;
+    int ty = (tile / sw->tile_cols) * KTERM_SW_TILE_ROWS;
+    int shaded = 0;
+    bool damaged = sw->tile_damage[tile] != 0;
+    sw->tile_damage[tile] = 0;
+    for (int cy = ty; cy < ty + KTERM_SW_TILE_ROWS && cy < sw->rows; cy++) {
+        for (int cx = tx; cx < tx + KTERM_SW_TILE_COLS && cx < sw->cols; cx++) {
+            KTermSWCellKey key;
+            KTermSW_CellKeyAt(sw, cx, cy, &key);
+            KTermSWCellKey* old = &sw->keys[cy * sw->cols + cx];
+            bool dirty = sw->full || damaged || memcmp(old, &key, sizeof(key)) != 0;
+            // New glyph pixels in the dynamic part of the atlas
+            if (!dirty && sw->atlas_changed && !(key.state & KTERM_SW_STATE_OUTSIDE) &&
+                (key.cell.char_code >= 256 || (key.cell.flags & GPU_ATTR_CONCEAL))) dirty = true;
+            if (!dirty) continue;
+            KTermSW_ShadeCell(sw, cx, cy, &key);
+            *old = key;
+            shaded++;
+        }
+    }
+    return shaded;
+}
+
+static void KTermSW_RunTiles(KTermSoftRenderer* sw) {
+    int tile_count = sw->tile_cols * sw->tile_rows;
+    int cells = 0, tiles = 0;
+    int t;
+    while ((t = atomic_fetch_add(&sw->next_tile, 1)) < tile_count) {
+        int n = KTermSW_ShadeTile(sw, t);
+        if (n > 0) { cells += n; tiles++; }
+    }
+    atomic_fetch_add(&sw->shaded_cells, cells);
+    atomic_fetch_add(&sw->shaded_tiles, tiles);
+}
+
+static kterm_thread_result_t KTermSW_Worker(void* arg) {
+    KTermSoftRenderer* sw = (KTermSoftRenderer*)arg;
+    int seen = 0;
+    KTERM_MUTEX_LOCK(sw->lock);
+    while (true) {
+        while (!sw->stop && sw->job_generation == seen) KTERM_COND_WAIT(sw->wake, sw->lock);
+        if (sw->stop) break;
+        seen = sw->job_generation;
+        KTERM_MUTEX_UNLOCK(sw->lock);
+
+        KTermSW_RunTiles(sw);
+
+        KTERM_MUTEX_LOCK(sw->lock);
+        if (--sw->workers_busy == 0) KTERM_COND_SIGNAL(sw->done);
+    }
+    KTERM_MUTEX_UNLOCK(sw->lock);
+    return KTERM_THREAD_RESULT_OK;
+}
+
+// --- Frame setup ---
+
+static bool KTermSW_Resize(KTermSoftRenderer* sw, int width, int height, int char_w, int char_h) {
+    int cols = (width + char_w - 1) / char_w;
+    int rows = (height + char_h - 1) / char_h;
+    size_t pixels = (size_t)width * height * 4;
+
+    uint8_t* fb = (uint8_t*)KTerm_Realloc(sw->pixels, pixels);
+    if (!fb) return false;
+    sw->pixels = fb;
+    uint8_t* under = (uint8_t*)KTerm_Realloc(sw->under, pixels);
+    if (!under) return false;
+    sw->under = under;
+    uint8_t* vectors = (uint8_t*)KTerm_Realloc(sw->vectors, pixels);
+    if (!vectors) return false;
+    sw->vectors = vectors;
+    // The new layer starts empty: have every staged vector sent again
+    memset(sw->vectors, 0, pixels);
+    sw->has_vectors = false;
+    KTerm_ResetVectorLayer(sw->term, sw->vector_layer);
+    KTermSWCellKey* keys = (KTermSWCellKey*)KTerm_Realloc(sw->keys, (size_t)cols * rows * sizeof(KTermSWCellKey));
+    if (!keys) return false;
+    sw->keys = keys;
+
+    int tile_cols = (cols + KTERM_SW_TILE_COLS - 1) / KTERM_SW_TILE_COLS;
+    int tile_rows = (rows + KTERM_SW_TILE_ROWS - 1) / KTERM_SW_TILE_ROWS;
+    uint8_t* damage = (uint8_t*)KTerm_Realloc(sw->tile_damage, (size_t)tile_cols * tile_rows);
+    if (!damage) return false;
+    sw->tile_damage = damage;
+    memset(sw->tile_damage, 0, (size_t)tile_cols * tile_rows);
+
+    sw->width = width;
+    sw->height = height;
+    sw->cols = cols;
+    sw->rows = rows;
+    sw->tile_cols = tile_cols;
+    sw->tile_rows = tile_rows;
+    sw->vector_x0 = sw->vector_y0 = INT_MAX;
+    sw->vector_x1 = sw->vector_y1 = INT_MIN;
+    sw->invalid = true;
+    return true;
+}
+
+bool KTermSW_Init(KTermSoftRenderer* sw, KTerm* term, int threads) {
+    memset(sw, 0, sizeof(*sw));
+    sw->invalid = true;
+    KTERM_MUTEX_LOCK(term->render_lock);
+    sw->vector_layer = KTerm_AddVectorLayer(term);
+    if (sw->vector_layer >= 0) term->software_renderers++;
+    KTERM_MUTEX_UNLOCK(term->render_lock);
+    if (sw->vector_layer < 0) return false;
+    sw->term = term;
+
+    KTERM_MUTEX_INIT(sw->lock);
+    KTERM_COND_INIT(sw->wake);
+    KTERM_COND_INIT(sw->done);
+    atomic_init(&sw->next_tile, 0);
+    atomic_init(&sw->shaded_cells, 0);
+    atomic_init(&sw->shaded_tiles, 0);
+
+    if (threads > KTERM_SW_MAX_THREADS) threads = KTERM_SW_MAX_THREADS;
+    for (int i = 0; i < threads - 1; i++) {
+        if (!KTERM_THREAD_CREATE(sw->workers[sw->worker_count], KTermSW_Worker, sw)) break;
+        sw->worker_count++;
+    }
+    sw->threads = sw->worker_count + 1;
+    return true;
+}
+
+void KTermSW_Destroy(KTermSoftRenderer* sw) {
+    if (!sw->term) return;
+    KTERM_MUTEX_LOCK(sw->lock);
+    sw->stop = true;
+    KTERM_COND_BROADCAST(sw->wake);
+    KTERM_MUTEX_UNLOCK(sw->lock);
+    for (int i = 0; i < sw->worker_count; i++) KTERM_THREAD_JOIN(sw->workers[i]);
+    KTERM_COND_DESTROY(sw->wake);
+    KTERM_COND_DESTROY(sw->done);
+    KTERM_MUTEX_DESTROY(sw->lock);
+
+    KTerm_Free(sw->pixels);
+    KTerm_Free(sw->keys);
+    KTerm_Free(sw->tile_damage);
+    KTerm_Free(sw->under);
+    KTerm_Free(sw->sixel);
+    KTerm_Free(sw->vectors);
+    KTerm_Free(sw->fg_ops);
+    KTerm_Free(sw->kitty_copy);
+    KTerm_Free(sw->sixel_copy);
+
+    // Detach: the terminal stops waiting for this layer, and without a renderer left
+    // it needs a GPU again to fill render buffers
+    KTerm* term = sw->term;
+    KTERM_MUTEX_LOCK(term->render_lock);
+    KTerm_RemoveVectorLayer(term, sw->vector_layer);
+    term->software_renderers--;
+    KTERM_MUTEX_UNLOCK(term->render_lock);
+    memset(sw, 0, sizeof(*sw));
+}
+
+void KTermSW_Invalidate(KTermSoftRenderer* sw) {
+    sw->invalid = true;
+}
+
+bool KTermSW_Render(KTermSoftRenderer* sw) {
+    KTerm* term = sw->term;
+    if (!term) return false;
+
+    KTERM_MUTEX_LOCK(term->render_lock);
+    const KTermRenderBuffer* rb = &term->render_buffers[term->rb_front];
+    const KTermPushConstants* pc = &rb->constants;
+    int width = (int)pc->screen_size.x, height = (int)pc->screen_size.y;
+    int char_w = (int)pc->char_size.x, char_h = (int)pc->char_size.y;
+    if (width <= 0 || height <= 0 || char_w <= 0 || char_h <= 0 || !rb->cells) {
+        KTERM_MUTEX_UNLOCK(term->render_lock);
+        return false;
+    }
+
+    if (width != sw->width || height != sw->height || char_w != sw->char_w || char_h != sw->char_h) {
+        if (!KTermSW_Resize(sw, width, height, char_w, char_h)) {
+            KTERM_MUTEX_UNLOCK(term->render_lock);
+            return false;
+        }
+    }
+
+    sw->rb = rb;
+    sw->char_w = char_w;
+    sw->char_h = char_h;
+    sw->grid_w = (int)pc->grid_size.x;
+    sw->grid_h = (int)pc->grid_size.y;
+    sw->atlas = term->font_atlas_pixels;
+    sw->atlas_w = (int)term->atlas_width;
+    sw->atlas_h = (int)term->atlas_height;
+
+    // Anything that touches every pixel forces a full redraw; layer changes
+    // only damage the tiles under them
+    const KTermPushConstants* last = &sw->last_pc;
+    bool full = sw->invalid ||
+                term->atlas_full_generation != sw->last_atlas_full_generation ||
+                pc->grid_size.x != last->grid_size.x || pc->grid_size.y != last->grid_size.y ||
+                pc->atlas_cols != last->atlas_cols ||
+                pc->scanline_intensity != last->scanline_intensity ||
+                pc->visual_bell_intensity != last->visual_bell_intensity ||
+                pc->grid_color != last->grid_color ||
+                pc->conceal_char_code != last->conceal_char_code;
+
+    // Overlays: rebuild the layer when their contents change
+    if (!full && !KTermSW_DamageKitty(sw)) full = true;
+    if (KTermSW_SyncCopy((void**)&sw->kitty_copy, &sw->kitty_copy_count, &sw->kitty_copy_capacity,
+                         rb->kitty_ops, rb->kitty_count, sizeof(KittyRenderOp)) || full) {
+        KTermSW_BuildUnder(sw);
+    }
+    if (!full && !KTermSW_DamageSixel(sw)) full = true;
+    bool sixel_changed = KTermSW_SyncCopy((void**)&sw->sixel_copy, &sw->sixel_copy_count, &sw->sixel_copy_capacity,
+                                          rb->sixel_strips, rb->sixel_active ? rb->sixel_count : 0, sizeof(GPUSixelStrip));
+    if (rb->sixel_active && (memcmp(sw->sixel_palette_copy, rb->sixel_palette, sizeof(rb->sixel_palette)) != 0 ||
+                             sw->sixel_copy_w != rb->sixel_width || sw->sixel_copy_h != rb->sixel_height ||
+                             sw->sixel_copy_offset != rb->sixel_y_offset)) {
+        memcpy(sw->sixel_palette_copy, rb->sixel_palette, sizeof(rb->sixel_palette));
+        sw->sixel_copy_w = rb->sixel_width;
+        sw->sixel_copy_h = rb->sixel_height;
+        sw->sixel_copy_offset = rb->sixel_y_offset;
+        sixel_changed = true;
+    }
+    if (sixel_changed || full) KTermSW_BuildSixel(sw);
+    KTermSW_ApplyVectors(sw);
+
+    sw->fg_op_count = 0;
+    if ((int)rb->kitty_count > sw->fg_op_capacity) {
+        const KittyRenderOp** ops = (const KittyRenderOp**)KTerm_Realloc((void*)sw->fg_ops, rb->kitty_count * sizeof(KittyRenderOp*));
+        if (ops) { sw->fg_ops = ops; sw->fg_op_capacity = (int)rb->kitty_count; }
+    }
+    for (size_t k = 0; k < rb->kitty_count && (int)k < sw->fg_op_capacity; k++) {
+        if (rb->kitty_ops[k].z_index >= 0) sw->fg_ops[sw->fg_op_count++] = &rb->kitty_ops[k];
+    }
+
+    sw->full = full;
+    sw->atlas_changed = term->atlas_generation != sw->last_atlas_generation;
+
+    // Shade: the caller takes tiles alongside the workers
+    atomic_store(&sw->next_tile, 0);
+    atomic_store(&sw->shaded_cells, 0);
+    atomic_store(&sw->shaded_tiles, 0);
+    if (sw->worker_count > 0) {
+        KTERM_MUTEX_LOCK(sw->lock);
+        sw->workers_busy = sw->worker_count;
+        sw->job_generation++;
+        KTERM_COND_BROADCAST(sw->wake);
+        KTERM_MUTEX_UNLOCK(sw->lock);
+    }
+    KTermSW_RunTiles(sw);
+    if (sw->worker_count > 0) {
+        KTERM_MUTEX_LOCK(sw->lock);
+        while (sw->workers_busy > 0) KTERM_COND_WAIT(sw->done, sw->lock);
+        KTERM_MUTEX_UNLOCK(sw->lock);
+    }
+
+    sw->cells_shaded = atomic_load(&sw->shaded_cells);
+    sw->tiles_shaded = atomic_load(&sw->shaded_tiles);
+    sw->full_redraw = full;
+    sw->frames++;
+    sw->last_pc = *pc;
+    sw->last_atlas_generation = term->atlas_generation;
+    sw->last_atlas_full_generation = term->atlas_full_generation;
+    sw->invalid = false;
+    sw->rb = NULL;
+    KTERM_MUTEX_UNLOCK(term->render_lock);
+    return true;
+}
+
+#endif // KTERM_RENDER_SW_IMPLEMENTATION
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // KT_RENDER_SW_H
@@ -46,7 +46,7 @@
 // --- Version Macros ---
 #define KTERM_VERSION_MAJOR 2
 #define KTERM_VERSION_MINOR 3
-#define KTERM_VERSION_PATCH 43
+#define KTERM_VERSION_PATCH 68
 #define KTERM_VERSION_REVISION "PRE-RELEASE"
 
 // Default to enabling Gateway Protocol unless explicitly disabled
@@ -102,6 +102,17 @@ void KTerm_Free(void* ptr);
     #define KTERM_MUTEX_DESTROY(m) mtx_destroy(&(m))
     #define KTERM_THREAD_CURRENT() thrd_current()
     #define KTERM_THREAD_EQUAL(a, b) thrd_equal(a, b)
+    typedef cnd_t kterm_cond_t;
+    typedef int kterm_thread_result_t;
+    #define KTERM_THREAD_RESULT_OK 0
+    #define KTERM_THREAD_CREATE(t, fn, arg) (thrd_create(&(t), (fn), (arg)) == thrd_success)
+    #define KTERM_THREAD_JOIN(t) thrd_join((t), NULL)
+    #define KTERM_COND_INIT(c) cnd_init(&(c))
+    #define KTERM_COND_WAIT(c, m) cnd_wait(&(c), &(m))
+    #define KTERM_COND_SIGNAL(c) cnd_signal(&(c))
+    #define KTERM_COND_BROADCAST(c) cnd_broadcast(&(c))
+    #define KTERM_COND_DESTROY(c) cnd_destroy(&(c))
+    #define KTERM_THREAD_SLEEP(ts) thrd_sleep(&(ts), NULL)
 #else
     #include <pthread.h>
     #include <stdatomic.h>
@@ -113,6 +124,17 @@ void KTerm_Free(void* ptr);
     #define KTERM_MUTEX_DESTROY(m) pthread_mutex_destroy(&(m))
     #define KTERM_THREAD_CURRENT() pthread_self()
     #define KTERM_THREAD_EQUAL(a, b) pthread_equal(a, b)
+    typedef pthread_cond_t kterm_cond_t;
+    typedef void* kterm_thread_result_t;
+    #define KTERM_THREAD_RESULT_OK NULL
+    #define KTERM_THREAD_CREATE(t, fn, arg) (pthread_create(&(t), NULL, (fn), (arg)) == 0)
+    #define KTERM_THREAD_JOIN(t) pthread_join((t), NULL)
+    #define KTERM_COND_INIT(c) pthread_cond_init(&(c), NULL)
+    #define KTERM_COND_WAIT(c, m) pthread_cond_wait(&(c), &(m))
+    #define KTERM_COND_SIGNAL(c) pthread_cond_signal(&(c))
+    #define KTERM_COND_BROADCAST(c) pthread_cond_broadcast(&(c))
+    #define KTERM_COND_DESTROY(c) pthread_cond_destroy(&(c))
+    #define KTERM_THREAD_SLEEP(ts) nanosleep(&(ts), NULL)
 #endif
 
 // Enable runtime main-thread asserts (debug only)
@@ -122,6 +144,22 @@ void KTerm_Free(void* ptr);
     #define KTERM_ASSERT_MAIN_THREAD(term) do {} while(0)
 #endif
 
+#ifndef KTERM_DISABLE_STATS
+    #define KTERM_STATS_ENABLED(term) ((term)->stats.enabled)
+#else
+    #define KTERM_STATS_ENABLED(term) (false)
+#endif
+
+// Trace spans: KTERM_TRACE_BEGIN declares the start timestamp, KTERM_TRACE_END emits
+// the span. Both compile to nothing without KTERM_ENABLE_TRACE.
+#ifdef KTERM_ENABLE_TRACE
+    #define KTERM_TRACE_BEGIN(term, var) uint64_t var = KTerm_TraceClock(term)
+    #define KTERM_TRACE_END(term, var, name) KTerm_TraceSpan((term), (name), (var))
+#else
+    #define KTERM_TRACE_BEGIN(term, var) (void)0
+    #define KTERM_TRACE_END(term, var, name) (void)0
+#endif
+
 // =============================================================================
 // TERMINAL CONFIGURATION CONSTANTS
 // =============================================================================
@@ -135,17 +173,31 @@ void KTerm_Free(void* ptr);
 #define DEFAULT_CHAR_HEIGHT 10
 #define DEFAULT_WINDOW_SCALE 1 // Scale factor for the window and font rendering
 #define DEFAULT_WINDOW_WIDTH (DEFAULT_TERM_WIDTH * DEFAULT_CHAR_WIDTH * DEFAULT_WINDOW_SCALE)
-#define MAX_SESSIONS 4
+#define MAX_SESSIONS 4 // Sessions created by KTerm_Init; KTerm_CreateSession adds more
 #define DEFAULT_WINDOW_HEIGHT (DEFAULT_TERM_HEIGHT * DEFAULT_CHAR_HEIGHT * DEFAULT_WINDOW_SCALE)
 #define MAX_ESCAPE_PARAMS 32
 #define MAX_COMMAND_BUFFER 512 // General purpose buffer for commands, OSC, DCS etc.
 #define MAX_TAB_STOPS 256 // Max columns for tab stops, ensure it's >= DEFAULT_TERM_WIDTH
 #define MAX_TITLE_LENGTH 256
 #define MAX_RECT_OPERATIONS 16
-#define KEY_EVENT_BUFFER_SIZE 65536
-#define KTERM_OUTPUT_PIPELINE_SIZE 16384
-#define KTERM_INPUT_PIPELINE_SIZE (1024 * 1024) // 1MB buffer for high-throughput graphics
+#define KEY_EVENT_BUFFER_SIZE 65536 // Default queued input events per session (power of two, KTermConfig.key_event_buffer_size)
+#define KTERM_OUTPUT_PIPELINE_SIZE 16384 // Default legacy reply buffer per session (KTermConfig.response_buffer_size)
+#define KTERM_OUTPUT_RING_SIZE 65536 // Per-session host-bound ring used with KTerm_SetSessionSink (power of two)
+#define KTERM_INPUT_PIPELINE_SIZE (1024 * 1024) // Default 1MB per-session input ring for high-throughput graphics (power of two, KTermConfig.input_pipeline_size)
 #define MAX_SCROLLBACK_LINES 1000
+#define KTERM_ATLAS_DIRTY_SLOTS 256 // Glyph slots tracked for partial atlas uploads before falling back to a full upload
+#define KTERM_GLYPH_CACHE_VERSION 2
+#define KTERM_CLUSTER_MAX 8 // Codepoints per grapheme cluster (matches KTermTextRun)
+#define KTERM_CLUSTER_TABLE_SIZE 4096 // Cluster cache entries (power of two)
+#define KTERM_CLUSTER_SLOT_FLAG 0x80000000u // atlas_to_codepoint marker: slot holds cluster entry N
+#define KTERM_GLYPH_RASTER_QUEUE 256 // Glyphs in flight on the background rasterizer before falling back to inline rendering
+#define KTERM_ATLAS_MAX_PAGES 8 // Atlas pages (1024x1020 RGBA each, stacked in one texture) before whole pages are evicted
+#define KTERM_ATLAS_PAGE_ROWS (1024 / DEFAULT_CHAR_HEIGHT) // Glyph slot rows per atlas page
+#define KTERM_GLYPH_MAX_CELLS 2 // Widest glyph size class, in cells
+#define KTERM_GLYPH_NARROW 0x110000u // Glyph key offset: a wide codepoint drawn in one cell (session without wide chars)
+#define KTERM_GLYPH_MAP_BLOCKS ((2 * KTERM_GLYPH_NARROW) >> 8) // Sparse glyph key map: 256-key blocks allocated on first use
+#define KTERM_VECTOR_BATCH 65536 // New vectors rasterized per frame; a larger backlog drains over the following frames
+#define KTERM_MAX_VECTOR_LAYERS 8 // Retained vector layers (the GPU texture and software renderers) per terminal
 
 // =============================================================================
 // GLOBAL VARIABLES DECLARATIONS
@@ -178,6 +230,8 @@ typedef void (*TitleCallback)(KTerm* term, const char* title, bool is_icon);
 typedef void (*BellCallback)(KTerm* term);                                 // For audible bell
 typedef void (*NotificationCallback)(KTerm* term, const char* message);          // For sending notifications (OSC 9)
 typedef void (*KTermOutputSink)(void* user_data, const char* data, size_t len); // Direct Output Sink
+typedef struct { const void* iov_base; size_t iov_len; } KTermIOVec; // Same layout as POSIX struct iovec
+typedef size_t (*KTermSessionSink)(void* user_data, int session_index, const KTermIOVec* iov, int iovcnt); // Batched per-session output, returns bytes accepted
 #ifdef KTERM_ENABLE_GATEWAY
 typedef void (*GatewayCallback)(KTerm* term, const char* class_id, const char* id, const char* command, const char* params); // Gateway Protocol
 #endif
@@ -310,6 +364,12 @@ typedef struct {
 
 typedef uint32_t DECModes;
 
+// BDSM visual order cache: per-row state and map flag
+#define KTERM_BIDI_ROW_STALE        0       // Map must be rebuilt before use
+#define KTERM_BIDI_ROW_LTR          1       // No RTL text: visual order == logical order
+#define KTERM_BIDI_ROW_MAPPED       2       // bidi_map holds the visual order
+#define KTERM_BIDI_MIRROR           0x8000  // bidi_map entry: draw the mirrored character
+
 // ANSI Modes
 typedef struct {
     // bool keyboard_action;           // KAM - Keyboard Action Mode (typically locked)
@@ -574,6 +634,9 @@ typedef struct {
     bool transparent_bg; // From DECGRA (P2)
     int logical_start_row; // Row index where the image starts (relative to screen_head)
     int last_y_shift; // Track last shift to optimize redraws
+#ifdef KTERM_ENABLE_TRACE
+    uint64_t trace_start; // Start of the SixelDecode span
+#endif
 } SixelGraphics;
 
 #define SIXEL_STATE_NORMAL 0
@@ -616,8 +679,43 @@ typedef struct {
     int start_row; // Logical row index (screen_head) when image was placed
     bool visible;
     bool complete; // Is the image upload complete?
+
+    int placement_count; // Number of extra placements (p=) referencing this image
+    uint64_t last_used;  // LRU stamp (KittyGraphics.lru_clock) of last upload or placement
+
+    // Animation Scheduling
+    bool anim_scheduled;    // Has a pending entry in KittyGraphics.anim_heap
+    double next_frame_time; // Deadline (KittyGraphics.anim_clock_ms) of the pending entry
 } KittyImageBuffer;
 
+// Additional placement of an uploaded image (a=p/a=T with p=<id>).
+// Placements share the image's frames, so showing an image N times costs no extra pixels.
+typedef struct {
+    uint32_t image_id;
+    uint32_t placement_id;
+    int x; // Screen coordinates (relative to session)
+    int y;
+    int z_index;
+    int start_row; // Logical row index (screen_head) when placed
+} KittyPlacement;
+
+#define KTERM_KITTY_ID_TABLE_MIN 64 // Initial size of the id -> image hash table (power of two)
+
+// Min-heap entry for the animation scheduler (one per animating image)
+typedef struct {
+    double deadline; // KittyGraphics.anim_clock_ms at which the next frame is due
+    uint32_t image_id;
+} KittyAnimTimer;
+
+typedef struct {
+    // Basic info for blit
+    int x, y, width, height;
+    int z_index;
+    int clip_x, clip_y, clip_mx, clip_my;
+    KTermTexture texture;
+    const unsigned char* pixels; // RGBA frame data behind `texture` (software renderer)
+} KittyRenderOp;
+
 typedef struct {
     // Parsing state
     int state; // 0=KEY, 1=VALUE, 2=PAYLOAD
@@ -653,13 +751,41 @@ typedef struct {
     // Active upload buffer
     KittyImageBuffer* active_upload;
 
-    // Storage for images (Simple array for Phase 3.1)
-    // We will use a dynamic list later, or just a few slots for testing
+    // Storage for images (Dense array, indexed by id_table)
     KittyImageBuffer* images; // Array of stored images
     int image_count;
     int image_capacity;
     size_t current_memory_usage; // Bytes used by image data
 
+    // Id -> index into images[] (open addressing, linear probing, -1 = empty)
+    int* id_table;
+    int id_table_capacity; // Power of two, kept >= 2 * image_count
+
+    // Extra placements (p=<id>)
+    KittyPlacement* placements;
+    int placement_count;
+    int placement_capacity;
+
+    uint64_t lru_clock;    // Logical clock for image LRU eviction
+    int evicted_images;    // Images evicted to stay under KTERM_KITTY_MEMORY_LIMIT (diagnostics)
+
+    // Animation Scheduler (min-heap keyed on next frame deadline)
+    KittyAnimTimer* anim_heap;
+    int anim_count;
+    int anim_capacity;
+    double anim_clock_ms;  // Session animation clock (advanced by KTerm_Update)
+
+    // Cached render ops, rebuilt only when placements, visibility, frames or geometry change
+    KittyRenderOp* render_ops;
+    int render_op_count;
+    int render_op_capacity;
+    bool render_ops_dirty;
+    int render_op_rebuilds;          // Diagnostics
+    int render_screen_head;          // Geometry the cache was built for
+    int render_view_offset;
+    int render_char_width;
+    int render_char_height;
+    unsigned int render_layout_generation;
 } KittyGraphics;
 
 // =============================================================================
@@ -763,7 +889,8 @@ typedef struct {
     bool auto_process;
 
     // Event Buffer
-    KTermEvent buffer[KEY_EVENT_BUFFER_SIZE];
+    KTermEvent* buffer; // buffer_mask + 1 events, allocated when the session opens or first gets input
+    int buffer_mask;
     atomic_int buffer_head;
     atomic_int buffer_tail;
 
@@ -835,6 +962,150 @@ typedef struct {
     double avg_process_time;    // Average time to process one char from pipeline (diagnostics)
 } KTermStatus;
 
+// =============================================================================
+// PERFORMANCE COUNTERS
+// =============================================================================
+// Collected only while enabled (KTerm_SetStatsEnabled); define KTERM_DISABLE_STATS
+// to compile collection out. Most counters are written only by the logic thread
+// and never locked, so a read from another thread may lag by a frame. Uploads come
+// from both threads and are added atomically; the draw histogram is kept under
+// render_lock.
+#define KTERM_STATS_HIST_BUCKETS 16 // Bucket 0: < 1 us, bucket b: [2^(b-1), 2^b) us, last bucket open
+
+typedef enum {
+    KTERM_STAT_SEQ_C0,      // C0 control characters
+    KTERM_STAT_SEQ_ESC,     // ESC sequences not leading into a CSI or string
+    KTERM_STAT_SEQ_CSI,
+    KTERM_STAT_SEQ_OSC,
+    KTERM_STAT_SEQ_DCS,
+    KTERM_STAT_SEQ_APC,
+    KTERM_STAT_SEQ_PM,
+    KTERM_STAT_SEQ_SOS,
+    KTERM_STAT_SEQ_KITTY,
+    KTERM_STAT_SEQ_COUNT
+} KTermStatSeqType;
+
+typedef struct {
+    uint64_t count;
+    uint64_t total_ns;
+    uint64_t max_ns;
+    uint32_t buckets[KTERM_STATS_HIST_BUCKETS];
+} KTermLatencyHistogram;
+
+typedef struct KTermSessionStats_T {
+    uint64_t bytes_parsed;                      // Bytes taken from the input pipeline
+    uint64_t sequences[KTERM_STAT_SEQ_COUNT];   // Dispatched sequences by type
+    uint64_t ops_queued[KTERM_OP_INVALID];      // Grid ops queued by type
+    uint64_t ops_applied[KTERM_OP_INVALID];     // Grid ops applied by KTerm_FlushOps
+    uint64_t ops_dropped;                       // Ops lost to a full queue
+    KTermLatencyHistogram parse;                // Per-frame pipeline processing time
+    KTermLatencyHistogram flush;                // Per-frame KTerm_FlushOps time
+} KTermSessionStats;
+
+typedef struct {
+    uint64_t bytes_parsed;
+    uint64_t sequences;
+    uint64_t ops_applied;
+    uint64_t rows_converted;
+    uint64_t bytes_uploaded;
+    uint64_t atlas_misses;
+    uint64_t parse_ns, flush_ns, prepare_ns, draw_ns;
+} KTermFrameStats;
+
+typedef struct {
+    bool enabled;
+    uint64_t frames;                 // KTerm_Update calls while enabled
+    uint64_t rows_converted;         // Rows converted by KTerm_UpdatePaneRow
+    uint64_t bytes_uploaded;         // Cell, Sixel, vector and atlas bytes sent to the GPU
+    uint64_t atlas_misses;           // Glyphs and clusters not yet in the atlas
+    uint64_t atlas_page_evictions;
+    uint64_t atlas_glyphs_evicted;
+    KTermLatencyHistogram prepare;   // KTerm_PrepareRenderBuffer
+    KTermLatencyHistogram draw;      // KTerm_Draw
+    KTermFrameStats last_frame;      // Totals of the most recent KTerm_Update (and KTerm_Draw)
+    KTermSessionStats sessions[MAX_SESSIONS]; // The first MAX_SESSIONS sessions (KTerm_GetSessionStats for any)
+} KTermStats;
+
+typedef struct {
+    size_t pending;            // Bytes waiting for the next delivery
+    size_t capacity;           // Size of the session's output buffer
+    uint64_t writes;           // Replies queued
+    uint64_t deliveries;       // Sink or callback invocations
+    uint64_t bytes_delivered;  // Bytes the host accepted
+    uint64_t bytes_dropped;    // Bytes lost to a full buffer
+    uint64_t stalls;           // Deliveries the host accepted only in part
+    bool backpressure;         // Data was left behind or dropped since the buffer last drained
+} KTermOutputStatus;
+
+// Heap memory held by one session (KTerm_GetSessionFootprint), in bytes. Buffers that
+// have not been allocated yet count as 0.
+typedef struct {
+    size_t session_struct;  // sizeof(KTermSession), allocated for every session handle
+    size_t screen;          // Primary grid with scrollback, alternate grid, dirty rows
+    size_t input_pipeline;  // Host input ring
+    size_t key_events;      // Queued input events
+    size_t op_queue;        // Pending grid operations
+    size_t responses;       // Legacy reply buffer
+    size_t output_ring;     // Session sink ring
+    size_t caches;          // Tab stops, BiDi and row checksum caches
+    size_t total;
+} KTermSessionFootprint;
+
+#ifdef KTERM_ENABLE_TRACE
+// Frame phase tracer: Chrome trace-event JSON (chrome://tracing, ui.perfetto.dev).
+// Each thread writes complete ("X") events into its own ring; the thread calling
+// KTerm_Update drains the rings into the file once per frame.
+#define KTERM_TRACE_MAX_THREADS 8
+#define KTERM_TRACE_RING_SIZE 16384 // Events per thread, power of two
+
+typedef struct {
+    const char* name; // Static string
+    uint64_t start_ns;
+    uint64_t dur_ns;
+} KTermTraceEvent;
+
+typedef struct {
+    KTermTraceEvent* events;
+    kterm_thread_t thread;
+    atomic_bool ready;   // Slot claimed and `thread`/`events` published
+    atomic_uint head;    // Written by the owning thread only
+    atomic_uint tail;    // Written by the draining thread only
+    atomic_uint dropped; // Events lost to a full ring
+} KTermTraceRing;
+
+typedef struct {
+    atomic_bool active;
+    FILE* file;
+    uint64_t origin_ns;  // Timestamps are written relative to KTerm_TraceStart
+    bool wrote_event;
+    atomic_int ring_count;
+    KTermTraceRing rings[KTERM_TRACE_MAX_THREADS];
+} KTermTracer;
+#endif
+
+// =============================================================================
+// RECORD AND REPLAY
+// =============================================================================
+typedef enum {
+    KTERM_RECORD_BINARY = 0, // Compact KTRC stream: every session, exact bytes
+    KTERM_RECORD_ASCIICAST   // asciicast v2 (asciinema): the active session, text as UTF-8
+} KTermRecordFormat;
+
+typedef struct {
+    uint64_t bytes;           // Host bytes fed to the sessions
+    int chunks;               // Data records
+    int resizes;
+    int frames;               // KTerm_Update calls made by the replay
+    double recorded_seconds;  // Time span stored in the file
+    double elapsed_seconds;   // Wall-clock time of the replay
+    bool has_expected_hash;   // The file ends with a screen hash
+    uint64_t expected_hash;
+    uint64_t screen_hash;     // KTerm_GetScreenHash after the replay
+    bool hash_match;          // Also true when there was no hash to compare
+} KTermReplayResult;
+
+struct KTermRecorder_T;
+
 // =============================================================================
 // TERMINAL COMPUTE SHADER & GPU STRUCTURES
 // =============================================================================
@@ -853,10 +1124,19 @@ typedef struct {
     float x1, y1; // Normalized Device Coordinates
     uint32_t color; // Packed RGBA
     float intensity; // 1.0 = fresh beam, < 1.0 = decaying
-    uint32_t mode;   // 0=Additive, 1=Replace, 2=Erase, 3=XOR
+    uint32_t mode;   // 0=Additive, 1=Replace, 2=Erase, 3=XOR (low byte), plus KTERM_VECTOR_FILL* flags
     float padding;   // Align to 16 bytes for std430
 } GPUVectorLine;
 
+// Filled trapezoid, for ReGIS polygon fill: a KTERM_VECTOR_FILL entry is the left edge
+// from the first covered pixel row center (x0, y0) to the last (x1, y1), and the entry
+// after it, flagged KTERM_VECTOR_FILL_RIGHT, the right edge over the same rows. Every
+// row between them is filled, so a polygon costs a few entries instead of one per row.
+// Render buffers never split a pair.
+#define KTERM_VECTOR_MODE_MASK  0xFFu
+#define KTERM_VECTOR_FILL       0x100u
+#define KTERM_VECTOR_FILL_RIGHT 0x200u
+
 // --- Shader Code ---
 #ifndef KTERM_TERMINAL_SHADER_PATH
 #define KTERM_TERMINAL_SHADER_PATH "shaders/terminal.comp"
@@ -1201,11 +1481,20 @@ typedef struct {
     uint32_t attributes;
 } SavedSGRState;
 
+// Cached checksums of one viewport row
+typedef struct {
+    uint64_t hash;    // FNV-1a of the cells (KTerm_GetScreenHash)
+    uint64_t dsr_sum; // Codepoints plus colors (DSR 63 memory checksum)
+    uint32_t ch_sum;  // Codepoints (DECRQCRA)
+    bool valid;
+} KTermRowChecksum;
+
 typedef struct KTermSession_T {
 
     // Operation Queue for Grid Mutations
     KTermOpQueue op_queue;
     KTermRect dirty_rect;
+    KTermSessionStats stats; // Performance counters (see KTerm_GetStats)
 
     // Screen management
     EnhancedTermChar* screen_buffer;       // Primary screen ring buffer
@@ -1227,6 +1516,18 @@ typedef struct KTermSession_T {
     int lines_per_page; // DECSLPP (Logical Page Height)
 
     uint8_t* row_dirty; // Tracks dirty state of the VIEWPORT rows (0..rows-1)
+
+    // BDSM visual order cache, allocated on first reordered render
+    uint16_t* bidi_map;             // rows * cols: visual column -> logical column (| KTERM_BIDI_MIRROR)
+    uint8_t* bidi_row_state;        // KTERM_BIDI_ROW_* per viewport row
+    EnhancedTermChar* bidi_scratch; // One reordered row for the renderer
+    int bidi_rows, bidi_cols;       // Dimensions the cache was built for
+    int bidi_map_builds;            // Number of row maps computed (diagnostics)
+
+    // Per-row checksum cache for DECRQCRA, DSR 63 and KTerm_GetScreenHash, allocated on first query
+    KTermRowChecksum* row_checksums; // One per viewport row, invalidated by KTerm_MarkRowDirty
+    int checksum_rows, checksum_cols; // Dimensions the cache was built for
+    int checksum_row_builds;          // Number of rows summed (diagnostics)
     // EnhancedTermChar saved_screen[term->height][term->width]; // For DECSEL/DECSED if implemented
 
     // Enhanced cursor
@@ -1291,10 +1592,14 @@ typedef struct KTermSession_T {
         bool sgr_mode; // Enables SGR mouse reporting
         int cursor_x; // Current mouse cursor X cell position
         int cursor_y; // Current mouse cursor Y cell position
+        bool coalesce_motion; // Keep only the latest motion report per frame
+        char pending_motion[32]; // Latest coalesced motion report, empty when none
+        uint64_t motion_coalesced; // Motion reports replaced by a later one
     } mouse;
 
     // Input/Output pipeline (enhanced)
-    unsigned char input_pipeline[KTERM_INPUT_PIPELINE_SIZE]; // Buffer for incoming data from host (Increased to 1MB)
+    unsigned char* input_pipeline; // Ring for incoming data from host, pipeline_mask + 1 bytes (a power of two)
+    int pipeline_mask; // Ring size - 1; indices wrap with & instead of %
     int input_pipeline_length; // Input pipeline length0
     atomic_int pipeline_head;
     atomic_int pipeline_tail;
@@ -1317,9 +1622,15 @@ typedef struct KTermSession_T {
     } VTperformance;
 
     // Response system (data to send back to host)
-    char answerback_buffer[KTERM_OUTPUT_PIPELINE_SIZE]; // Buffer for responses to host
+    char* answerback_buffer; // Buffer for responses to host, response_capacity bytes, allocated when the session opens
     int response_length; // Response buffer length
-    bool response_enabled; // Master switch for output (response transmission) - Legacy only
+    size_t response_capacity;
+    bool response_enabled; // Master switch for output (response transmission) - Legacy buffer and session sink
+    char* output_ring;     // KTERM_OUTPUT_RING_SIZE bytes for the session sink, allocated on first reply
+    uint32_t output_head;  // Free-running write position
+    uint32_t output_tail;  // Free-running delivery position
+    KTermOutputStatus output_status; // Counters; pending and capacity are filled in by KTerm_GetOutputStatus
+    bool output_drop_reported; // A drop was reported since the buffer last drained
 
     // ANSI parsing state (enhanced)
     VTParseState parse_state;
@@ -1353,6 +1664,7 @@ typedef struct KTermSession_T {
 
     // Fields for console.c
     bool session_open; // Session open status
+    uint16_t generation; // Bumped by KTerm_CloseSession; the high bits of the session's handle
     int active_display; // 0=Main Display, 1=Status Line (DECSASD)
     bool echo_enabled;
     bool input_enabled;
@@ -1418,6 +1730,18 @@ typedef struct KTermSession_T {
 
     bool enable_wide_chars;      // Enable wide character support (wcwidth) - Default FALSE
 
+    int index;                 // Slot in KTerm.sessions, fixed for the session's lifetime
+    atomic_int wake_next;      // Next session on KTerm.wake_head (-1 ends the list)
+    atomic_bool wake_queued;   // On the wake list: fed since KTerm_Update last looked
+    bool update_listed;        // On KTerm.update_list (update thread only)
+
+    // Fast-forward (KTerm_SetSessionFastForward): while hidden, plain text goes straight to the grid
+    bool fast_forward;         // Requested by the host
+    bool fast_forwarding;      // Requested and hidden this frame: no dirty tracking, no animation ticks
+    bool fast_forward_stale;   // Cells changed without dirty marks; redrawn in full when shown
+    int fast_forward_scroll;   // Margin region rows rotated but not yet moved into place
+    bool protection_used;      // DECSCA has protected cells: the fast path stays off
+
     kterm_mutex_t lock; // Session Lock (Phase 3)
 
 } KTermSession;
@@ -1488,13 +1812,12 @@ static inline EnhancedTermChar* GetActiveScreenCell(KTermSession* session, int y
     return &GetActiveScreenRow(session, y)[x];
 }
 
-typedef struct {
-    // Basic info for blit
-    int x, y, width, height;
-    int z_index;
-    int clip_x, clip_y, clip_mx, clip_my;
-    KTermTexture texture;
-} KittyRenderOp;
+// Every change to a viewport row goes through here: the renderer redraws it
+// and its cached checksums are summed again on the next query.
+static inline void KTerm_MarkRowDirty(KTermSession* session, int y) {
+    session->row_dirty[y] = KTERM_DIRTY_FRAMES;
+    if (session->row_checksums && y < session->checksum_rows) session->row_checksums[y].valid = false;
+}
 
 typedef struct {
     GPUCell* cells;
@@ -1513,10 +1836,12 @@ typedef struct {
     int sixel_height;
     int sixel_y_offset;
 
-    // Vector Data
+    // Vector Data: staged vectors [vector_first, vector_first + vector_count) not yet in the layer
     GPUVectorLine* vectors;
     size_t vector_count;
     size_t vector_capacity;
+    size_t vector_first;
+    uint32_t vector_epoch;
 
     // Kitty Graphics
     KittyRenderOp* kitty_ops;
@@ -1529,8 +1854,77 @@ typedef struct {
 
 } KTermRenderBuffer;
 
+// Progress of one retained vector layer (the GPU texture or a software renderer)
+typedef struct {
+    bool active;
+    size_t drawn;   // Staged vectors already rasterized into the layer
+    uint32_t epoch; // Epoch `drawn` refers to
+} KTermVectorLayer;
+
+// Grapheme cluster cache entry: composed glyph for a base + combining marks
+typedef struct {
+    uint32_t hash;
+    uint32_t slot;  // Glyph id, 0 = evicted
+    uint8_t count;  // Codepoints in the cluster, 0 = empty entry
+    uint32_t codepoints[KTERM_CLUSTER_MAX];
+} KTermClusterEntry;
+
+// Background glyph rasterization (KTerm_SetAsyncGlyphRaster). A job with count > 1 is a
+// grapheme cluster: codepoint holds its atlas_to_codepoint tag and codepoints the cluster.
+typedef struct {
+    uint32_t codepoint;
+    uint32_t slot;
+    int cells;
+    uint8_t count;
+    bool merge;     // Cluster on a bitmap base already in the slot: only the marks are drawn
+    uint32_t hash;  // Cluster entry hash, to drop results for a reused entry
+    uint32_t codepoints[KTERM_CLUSTER_MAX];
+} KTermGlyphJob;
+
+typedef struct {
+    KTermGlyphJob job;
+    unsigned char pixels[KTERM_GLYPH_MAX_CELLS * DEFAULT_CHAR_WIDTH * DEFAULT_CHAR_HEIGHT * 4];
+} KTermGlyphResult;
+
+typedef struct {
+    bool running;
+    bool stop;
+    kterm_thread_t thread;
+    kterm_mutex_t lock;      // Guards the rings and counters below
+    kterm_cond_t wake;       // Worker: new job or stop request
+    kterm_cond_t idle;       // KTerm_FlushGlyphRaster: queue drained
+    kterm_mutex_t font_lock; // Held while rasterizing and while KTerm_LoadFont swaps the font
+    KTermGlyphJob* jobs;     // Ring, KTERM_GLYPH_RASTER_QUEUE entries
+    int job_head;
+    int job_count;
+    int busy;                // Jobs taken by the worker, result not posted yet
+    KTermGlyphResult* results;
+    int result_count;
+} KTermGlyphRaster;
+
+// Glyph atlas page: KTERM_ATLAS_PAGE_ROWS rows of slots. All glyphs on a page
+// share one size class; a 2-cell glyph takes two adjacent slots (id, id + 1).
+typedef struct {
+    uint8_t cells;          // Size class: slots per glyph (1 or 2)
+    uint32_t used;          // Slots handed out, page-relative (page 0 starts at 256)
+    uint32_t glyphs;        // Glyphs placed since the page was last emptied
+    uint64_t last_used;     // frame_count of the latest lookup hitting this page
+} KTermAtlasPage;
+
 typedef struct KTerm_T {
-    KTermSession sessions[MAX_SESSIONS];
+    // Session table: handles are indices into it and sessions never move. A table that
+    // grows is retired rather than freed, so a producer thread still reading it stays safe.
+    KTermSession** sessions;
+    int session_count;
+    int session_capacity;
+    KTermSession** retired_session_tables[32];
+    int retired_session_table_count;
+    // Sessions KTerm_Update visits: visible ones, ones fed since the last frame (pushed on
+    // wake_head by any thread) and ones left with work from the previous frame
+    atomic_int wake_head;
+    int* update_list;
+    int update_count;
+    int update_capacity;
     KTermLayout* layout;
     int width; // Global Width (Columns)
     int height; // Global Height (Rows)
@@ -1563,8 +1957,13 @@ typedef struct KTerm_T {
     KTermTexture vector_layer_texture;
     KTermPipeline vector_pipeline;
     uint32_t vector_count;
-    GPUVectorLine* vector_staging_buffer;
+    GPUVectorLine* vector_staging_buffer; // Every vector since the last clear, grown on demand
     size_t vector_capacity;
+    uint32_t vector_epoch;       // Incremented by KTerm_ClearVectors
+    size_t vector_drawn;         // Lowest mark of the active layers: render buffers send from here (render_lock)
+    uint32_t vector_drawn_epoch; // Epoch vector_drawn refers to (render_lock)
+    KTermVectorLayer vector_layers[KTERM_MAX_VECTOR_LAYERS]; // One per renderer (render_lock)
+    int gpu_vector_layer;        // KTerm_Draw's layer, -1 until the first draw
 
     // Sixel Engine (Compute Shader)
     KTermBuffer sixel_buffer;
@@ -1616,6 +2015,14 @@ typedef struct KTerm_T {
         int point_count;
         char curve_mode; // 'C'ircle, 'A'rc, 'B'spline (Interpolated), 'O'pen (Unclosed)
 
+        // Logical-to-pixel transform, recomputed when the extents or the grid size change
+        struct {
+            int min_x, min_y, max_x, max_y, cols, rows; // Key
+            float scale, x_margin, y_margin;
+            float screen_w, screen_h;
+            float inv_w, inv_h;
+        } xform;
+
         // Extended Text Attributes
         float text_size;
         float text_angle; // Radians
@@ -1647,11 +2054,24 @@ typedef struct KTerm_T {
     bool vector_clear_request; // Request to clear the persistent vector layer
 
     // Dynamic Glyph Cache
-    uint16_t* glyph_map; // Map Unicode Codepoint to Atlas Index
-    uint32_t next_atlas_index;
-    uint32_t atlas_clock_hand; // For Clock eviction algorithm
+    uint32_t** glyph_map; // Sparse Unicode Codepoint -> Glyph id (KTERM_GLYPH_MAP_BLOCKS blocks of 256)
+    KTermClusterEntry* cluster_map; // Open-addressed cluster hash -> Glyph id
+    int cluster_count;
+    KTermAtlasPage atlas_pages[KTERM_ATLAS_MAX_PAGES];
+    int atlas_page_count;
+    int atlas_max_pages;           // Runtime cap, at most KTERM_ATLAS_MAX_PAGES
+    int atlas_fill_page[KTERM_GLYPH_MAX_CELLS]; // Page receiving new glyphs per size class, -1 = none
+    uint32_t atlas_slots_per_page;
+    uint64_t atlas_page_evictions;  // Pages emptied to make room
+    uint64_t atlas_glyphs_evicted;  // Glyphs dropped by those evictions
     unsigned char* font_atlas_pixels; // persistent CPU copy
-    bool font_atlas_dirty;
+    bool font_atlas_dirty; // Whole atlas must be re-uploaded (font change, soft font, session switch)
+    uint32_t atlas_dirty_slots[KTERM_ATLAS_DIRTY_SLOTS]; // Slots rasterized since the last upload
+    int atlas_dirty_count;
+    uint32_t atlas_generation;      // Bumped on every atlas upload, partial or full
+    uint32_t atlas_full_generation; // Bumped on full atlas uploads only
+    int software_renderers;         // Attached CPU consumers of the render buffers (kt_render_sw.h)
+    KTermGlyphRaster glyph_raster;
     uint32_t atlas_width;
     uint32_t atlas_height;
     uint32_t atlas_cols;
@@ -1668,11 +2088,11 @@ typedef struct KTerm_T {
         int descent;
         int line_gap;
         int baseline;
+        unsigned int file_size; // For the glyph cache key
     } ttf;
 
-    // LRU Cache for Dynamic Atlas
-    uint64_t* glyph_last_used;   // Timestamp (frame count) of last usage
-    uint32_t* atlas_to_codepoint;// Reverse mapping for eviction
+    // LRU Cache for Dynamic Atlas (per page, see KTermAtlasPage)
+    uint32_t* atlas_to_codepoint;// Reverse mapping for eviction, one entry per slot
     uint64_t frame_count;        // Logical clock for LRU
 
     // Font State
@@ -1717,6 +2137,27 @@ typedef struct KTerm_T {
 
     KTermOutputSink output_sink;
     void* output_sink_ctx;
+    KTermSessionSink session_sink;
+    void* session_sink_ctx;
+    int output_session; // Session whose input is being parsed, owner of its replies (-1 = active session)
+    struct {
+        size_t input_pipeline; // Bytes, power of two
+        int key_events;        // Events, power of two
+        int op_queue;          // Ops, power of two
+        size_t responses;      // Bytes
+        int scrollback;        // Lines of history
+    } session_buffer_sizes;    // From KTermConfig, applied as each session's buffers are allocated
+
+    KTermStats stats;            // Terminal-wide counters; KTerm_GetStats fills in the sessions
+    KTermFrameStats stats_frame; // Counters of the frame in progress (logic thread)
+    atomic_uint_fast64_t stats_uploaded;       // stats.bytes_uploaded, added from both threads
+    atomic_uint_fast64_t stats_frame_uploaded; // stats_frame.bytes_uploaded, taken by KTerm_Update
+    atomic_uint_fast64_t stats_frame_draw_ns;  // stats_frame.draw_ns, added by KTerm_Draw
+    struct KTermRecorder_T* recorder; // Host input recording state, kept until KTerm_Cleanup once allocated
+    atomic_bool recording;            // Between KTerm_RecordStart and KTerm_RecordStop; gates the producers
+#ifdef KTERM_ENABLE_TRACE
+    KTermTracer tracer;
+#endif
 } KTerm;
 
 // =============================================================================
@@ -1733,15 +2174,51 @@ typedef struct {
     int width;
     int height;
     ResponseCallback response_callback;
+    // Per-session buffers, 0 for the default. They are allocated when a session is opened
+    // (or first fed while closed), so unused sessions cost only sizeof(KTermSession).
+    size_t input_pipeline_size;  // Host input ring in bytes, rounded up to a power of two (KTERM_INPUT_PIPELINE_SIZE)
+    int key_event_buffer_size;   // Queued input events, rounded up to a power of two (KEY_EVENT_BUFFER_SIZE)
+    int op_queue_size;           // Pending grid operations, rounded up to a power of two (KTERM_OP_QUEUE_SIZE)
+    size_t response_buffer_size; // Legacy reply buffer in bytes (KTERM_OUTPUT_PIPELINE_SIZE)
+    int scrollback_lines;        // History kept by each session's screen (MAX_SCROLLBACK_LINES)
 } KTermConfig;
 
 KTerm* KTerm_Create(KTermConfig config);
 void KTerm_Destroy(KTerm* term);
 
 // Session Management
+// Sessions are numbered by handles: the slot index in the low KTERM_SESSION_INDEX_BITS bits and
+// the slot's generation above them. KTerm_Init creates MAX_SESSIONS slots and the table grows as
+// more are created. Closing a session frees its buffers (except the input ring, which a producer
+// thread may still be writing) and bumps the generation, so a handle kept past the close
+// resolves to nothing, even after the next create reuses the slot.
+// A slot that was never closed has generation 0, so its handle is the plain index.
+#define KTERM_SESSION_INDEX_BITS 16
+#define KTERM_SESSION_INDEX(handle) ((handle) & ((1 << KTERM_SESSION_INDEX_BITS) - 1))
+#define KTERM_MAX_SESSION_SLOTS (1 << KTERM_SESSION_INDEX_BITS)
+int KTerm_CreateSession(KTerm* term);                  // Opened session's handle, -1 on failure
+void KTerm_CloseSession(KTerm* term, int session_index); // Not the active session or one on screen
+int KTerm_GetSessionCount(KTerm* term);                // Slots in use, open or closed
+int KTerm_GetSessionHandle(KTerm* term, int index);    // Current handle of a slot (e.g. a pane's session_index), -1 if none
+// While no pane shows the session, text is parsed straight into the grid without dirty
+// tracking or animation ticks; the session is redrawn in full once it is shown again.
+void KTerm_SetSessionFastForward(KTerm* term, int session_index, bool enable);
+// Snapshots (see SESSION SNAPSHOTS) hold a session's screens, scrollback and state in a versioned
+// binary blob, to keep on disk or hand to another process. Free *data with KTerm_Free.
+#define KTERM_SNAPSHOT_COMPRESS (1U << 0) // LZ77-code the blob (stored plain when that does not pay)
+bool KTerm_SerializeSession(KTerm* term, int session_index, unsigned int flags, unsigned char** data, size_t* size);
+bool KTerm_RestoreSession(KTerm* term, int session_index, const unsigned char* data, size_t size); // Left unchanged on failure
 void KTerm_SetActiveSession(KTerm* term, int index);
 void KTerm_SetSplitScreen(KTerm* term, bool active, int row, int top_idx, int bot_idx);
 void KTerm_WriteCharToSession(KTerm* term, int session_index, unsigned char ch);
+// Bulk write to a session's input ring, published once. Returns the bytes that fit.
+size_t KTerm_WriteData(KTerm* term, int session_index, const void* data, size_t len);
+// Zero-copy host input: the free space of a session's input ring as one or two spans,
+// filled by the caller (e.g. with readv) and published with KTerm_PipelineCommit.
+// Single producer only; returns the total free bytes (*len1 + *len2).
+size_t KTerm_PipelineReserve(KTerm* term, int session_index, unsigned char** ptr1, size_t* len1,
+                             unsigned char** ptr2, size_t* len2);
+size_t KTerm_PipelineCommit(KTerm* term, int session_index, size_t n);
 void KTerm_SetResponseEnabled(KTerm* term, int session_index, bool enable);
 bool KTerm_InitSession(KTerm* term, int index);
 
@@ -1776,7 +2253,8 @@ void KTerm_SetPipelineTimeBudget(KTerm* term, double pct); // Percentage of fram
 
 // Mouse support (enhanced)
 void KTerm_SetMouseTracking(KTerm* term, MouseTrackingMode mode); // Explicitly set a mouse mode
-void KTerm_EnableMouseFeature(KTerm* term, const char* feature, bool enable); // e.g., "focus", "sgr"
+void KTerm_EnableMouseFeature(KTerm* term, const char* feature, bool enable); // e.g., "focus", "sgr", "coalesce"
+void KTerm_QueueMouseReport(KTerm* term, const char* report, bool motion); // Queue a mouse report for the active session, coalescing motion
 // void KTerm_UpdateMouse(KTerm* term); // Removed in v2.1
 // void KTerm_UpdateKeyboard(KTerm* term); // Removed in v2.1
 // void UpdateKeyboard(KTerm* term);  // Removed in v2.1
@@ -1831,6 +2309,10 @@ const char* KTerm_GetIconTitle(KTerm* term);
 // Callbacks
 void KTerm_SetResponseCallback(KTerm* term, ResponseCallback callback);
 void KTerm_SetOutputSink(KTerm* term, KTermOutputSink sink, void* ctx);
+void KTerm_SetSessionSink(KTerm* term, KTermSessionSink sink, void* ctx); // Replies per session, delivered once per frame
+void KTerm_FlushOutput(KTerm* term); // Deliver queued session sink output now
+bool KTerm_GetOutputStatus(KTerm* term, int session_index, KTermOutputStatus* status);
+bool KTerm_GetSessionFootprint(KTerm* term, int session_index, KTermSessionFootprint* footprint);
 void KTerm_SetPrinterCallback(KTerm* term, PrinterCallback callback);
 void KTerm_SetTitleCallback(KTerm* term, TitleCallback callback);
 void KTerm_SetBellCallback(KTerm* term, BellCallback callback);
@@ -1848,6 +2330,21 @@ void KTerm_EnableDebug(KTerm* term, bool enable);     // Toggle verbose debug lo
 void KTerm_LogUnsupportedSequence(KTerm* term, const char* sequence); // Log an unsupported sequence
 void KTerm_ReportError(KTerm* term, KTermErrorLevel level, KTermErrorSource source, const char* format, ...);
 KTermStatus KTerm_GetStatus(KTerm* term);
+void KTerm_SetStatsEnabled(KTerm* term, bool enable); // Start/stop collecting performance counters
+void KTerm_ResetStats(KTerm* term);
+KTermStats KTerm_GetStats(KTerm* term);               // Snapshot of all counters and histograms
+bool KTerm_GetSessionStats(KTerm* term, int session_index, KTermSessionStats* stats); // Any session, not only the first MAX_SESSIONS
+#ifdef KTERM_ENABLE_TRACE
+bool KTerm_TraceStart(KTerm* term, const char* path); // Begin writing a Chrome trace-event JSON file
+void KTerm_TraceFlush(KTerm* term);                   // Drain thread rings into the file (done by KTerm_Update)
+void KTerm_TraceStop(KTerm* term);                    // Drain, close the JSON array and the file
+uint64_t KTerm_TraceClock(KTerm* term);               // Span start timestamp, 0 when not tracing
+void KTerm_TraceSpan(KTerm* term, const char* name, uint64_t start); // Record [start, now] on this thread
+#endif
+bool KTerm_RecordStart(KTerm* term, const char* path, KTermRecordFormat format); // Tee host input to a file
+void KTerm_RecordStop(KTerm* term);                   // Append the final screen hash and close
+bool KTerm_Replay(KTerm* term, const char* path, double speed, KTermReplayResult* result); // speed 0: as fast as possible
+uint64_t KTerm_GetScreenHash(KTerm* term);            // Hash of the active session's visible cells
 void KTerm_ShowDiagnostics(KTerm* term);      // Display buffer usage info
 
 // Screen buffer management
@@ -1861,6 +2358,22 @@ void KTerm_CopySelectionToClipboard(KTerm* term);
 
 // Helper to allocate a glyph index in the dynamic atlas for any Unicode codepoint
 uint32_t KTerm_AllocateGlyph(KTerm* term, uint32_t codepoint);
+// Glyph id of a codepoint already in the atlas, 0 if it has none (never allocates)
+uint32_t KTerm_GetGlyphId(KTerm* term, uint32_t codepoint);
+// Atlas index for a base codepoint plus combining marks, composed once and cached
+uint32_t KTerm_AllocateCluster(KTerm* term, const uint32_t* codepoints, int count);
+
+// Background glyph rasterization. New glyphs get their atlas slot immediately and
+// render blank until the worker fills them in (committed on KTerm_Update).
+bool KTerm_SetAsyncGlyphRaster(KTerm* term, bool enable);
+void KTerm_FlushGlyphRaster(KTerm* term); // Wait for queued glyphs and commit them
+int KTerm_PrewarmGlyphs(KTerm* term, uint32_t first, uint32_t last); // Reserve slots for a codepoint range
+
+// Persistent glyph atlas cache. The file is keyed by a hash of the font (TrueType
+// file or built-in bitmap font) and the cell/atlas geometry; a mismatching or
+// damaged file is rejected and the atlas is left untouched.
+bool KTerm_SaveGlyphCache(KTerm* term, const char* path);
+bool KTerm_LoadGlyphCache(KTerm* term, const char* path);
 
 // Forward declaration for SGR helper
 int ProcessExtendedKTermColor(KTerm* term, ExtendedKTermColor* color, int param_index);
@@ -1879,6 +2392,17 @@ void KTerm_CreateFontTexture(KTerm* term);
 void KTerm_InitCompute(KTerm* term);
 void KTerm_PrepareRenderBuffer(KTerm* term);
 
+// Retained vector layers, for renderers consuming the front render buffer (under render_lock).
+// Each renderer adds a layer with its own progress; render buffers carry what the layer
+// furthest behind still needs. Begin yields the first vector of rb the layer has not
+// rasterized; cleared is set when it was erased since its last draw. End records rb's
+// vectors as rasterized. Reset marks the layer empty, e.g. after reallocating it.
+int KTerm_AddVectorLayer(KTerm* term); // -1 when all KTERM_MAX_VECTOR_LAYERS are taken
+void KTerm_RemoveVectorLayer(KTerm* term, int layer);
+void KTerm_ResetVectorLayer(KTerm* term, int layer);
+bool KTerm_BeginVectors(KTerm* term, int layer, const KTermRenderBuffer* rb, size_t* start, bool* cleared);
+void KTerm_EndVectors(KTerm* term, int layer, const KTermRenderBuffer* rb);
+
 // Low-level char processing (called by KTerm_ProcessEvents via KTerm_ProcessChar)
 void KTerm_ProcessChar(KTerm* term, KTermSession* session, unsigned char ch); // Main dispatcher for character processing
 void KTerm_ProcessPrinterControllerChar(KTerm* term, KTermSession* session, unsigned char ch); // Handle Printer Controller Mode
@@ -1957,7 +2481,28 @@ void KTerm_Script_Cls(KTerm* term);
 void KTerm_Script_SetKTermColor(KTerm* term, int fg, int bg);
 
 #ifdef KTERM_IMPLEMENTATION
-#define GET_SESSION(term) (&(term)->sessions[(term)->active_session])
+#define GET_SESSION(term) ((term)->sessions[(term)->active_session])
+
+static inline int KTerm_SessionHandle(const KTermSession* session) {
+    return session->index | ((int)session->generation << KTERM_SESSION_INDEX_BITS);
+}
+
+// The session a handle names, or NULL if it is out of range or its slot was closed since
+static inline KTermSession* KTerm_LookupSession(KTerm* term, int handle) {
+    if (!term || handle < 0 || KTERM_SESSION_INDEX(handle) >= term->session_count) return NULL;
+    KTermSession* session = term->sessions[KTERM_SESSION_INDEX(handle)];
+    if ((handle >> KTERM_SESSION_INDEX_BITS) != session->generation || !session->screen_buffer) return NULL;
+    return session;
+}
+
+// Memory-mapped loading for the glyph cache (stdio fallback elsewhere)
+#if defined(__unix__) || defined(__APPLE__)
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+    #define KTERM_HAS_MMAP
+#endif
 
 // =============================================================================
 // IMPLEMENTATION BEGINS HERE
@@ -1975,7 +2520,7 @@ void KTerm_QueueResize(KTermSession* session, int cols, int rows, bool reflow);
 // Internal Forward Declarations
 void KTerm_CopyRectangle(KTerm* term, VTRectangle src, int dest_x, int dest_y);
 void KTerm_ExecuteRectangularOps2(KTerm* term, KTermSession* session);
-static unsigned int KTerm_CalculateRectChecksum(KTerm* term, int top, int left, int bottom, int right);
+static unsigned int KTerm_CalculateRectChecksum(KTermSession* session, int top, int left, int bottom, int right);
 void KTerm_InitSixelGraphics(KTerm* term, KTermSession* session);
 static void KTerm_ScrollUpRegion_Internal(KTerm* term, KTermSession* session, int top, int bottom, int lines);
 static void KTerm_ScrollDownRegion_Internal(KTerm* term, KTermSession* session, int top, int bottom, int lines);
@@ -2074,6 +2619,14 @@ void KTerm_InitFontData(KTerm* term); // In case it's used elsewhere, though fon
 // Forward declarations of internal helpers
 static void KTerm_ResizeSession_Internal(KTerm* term, KTermSession* session, int cols, int rows);
 static void KTerm_ResizeSession(KTerm* term, int session_index, int cols, int rows);
+static void KTerm_ResolveBufferSizes(KTerm* term);
+static void KTerm_FreeSessionBuffers(KTermSession* session);
+static bool KTerm_OpenSessionBuffers(KTerm* term, KTermSession* session);
+static void KTerm_SetLevelAnswerback(KTermSession* session);
+static void KTerm_FastForwardSettle(KTermSession* session);
+static void KTerm_FreeBiDiCache(KTermSession* session);
+static void KTerm_SetActiveSessionIndex(KTerm* term, int index);
+static void KTerm_SetSplitScreenIndices(KTerm* term, bool active, int row, int top_idx, int bot_idx);
 
 static void KTerm_LayoutResizeCallback(void* user_data, int session_index, int cols, int rows) {
     KTerm* term = (KTerm*)user_data;
@@ -2275,12 +2828,39 @@ static const uint16_t kCp437ToUnicode[256] = {
     0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0
 };
 
+// Sparse codepoint -> glyph id map: KTERM_GLYPH_MAP_BLOCKS pointers, each to a
+// block of 256 ids allocated the first time a codepoint in it gets a glyph.
+static inline uint32_t KTerm_GlyphMapGet(const KTerm* term, uint32_t codepoint) {
+    const uint32_t* block = term->glyph_map[codepoint >> 8];
+    return block ? block[codepoint & 0xFF] : 0;
+}
+
+static bool KTerm_GlyphMapSet(KTerm* term, uint32_t codepoint, uint32_t id) {
+    uint32_t** block = &term->glyph_map[codepoint >> 8];
+    if (!*block) {
+        if (id == 0) return true;
+        *block = (uint32_t*)KTerm_Calloc(256, sizeof(uint32_t));
+        if (!*block) return false;
+    }
+    (*block)[codepoint & 0xFF] = id;
+    return true;
+}
+
+static void KTerm_FreeGlyphMap(KTerm* term) {
+    if (!term->glyph_map) return;
+    for (uint32_t i = 0; i < KTERM_GLYPH_MAP_BLOCKS; i++) {
+        if (term->glyph_map[i]) KTerm_Free(term->glyph_map[i]);
+    }
+    KTerm_Free(term->glyph_map);
+    term->glyph_map = NULL;
+}
+
 static void KTerm_InitCP437Map(KTerm* term) {
     if (!term->glyph_map) return;
     for (int i = 0; i < 256; i++) {
         uint16_t u = kCp437ToUnicode[i];
         if (u != 0) {
-            term->glyph_map[u] = (uint16_t)i;
+            KTerm_GlyphMapSet(term, u, (uint32_t)i);
         }
     }
 }
@@ -2327,341 +2907,14 @@ struct KTermInterval {
   int last;
 };
 
-/* sorted list of non-overlapping intervals of non-spacing characters */
-/* generated by "uniset +cat=Me +cat=Mn +cat=Cf -00AD +1160-11FF +200B c" */
-// Replaced by the combining table from Vim.
-static const struct KTermInterval kterm_combining_table[] = {
-	{0X0300, 0X036F},
-	{0X0483, 0X0489},
-	{0X0591, 0X05BD},
-	{0X05BF, 0X05BF},
-	{0X05C1, 0X05C2},
-	{0X05C4, 0X05C5},
-	{0X05C7, 0X05C7},
-	{0X0610, 0X061A},
-	{0X064B, 0X065F},
-	{0X0670, 0X0670},
-	{0X06D6, 0X06DC},
-	{0X06DF, 0X06E4},
-	{0X06E7, 0X06E8},
-	{0X06EA, 0X06ED},
-	{0X0711, 0X0711},
-	{0X0730, 0X074A},
-	{0X07A6, 0X07B0},
-	{0X07EB, 0X07F3},
-	{0X07FD, 0X07FD},
-	{0X0816, 0X0819},
-	{0X081B, 0X0823},
-	{0X0825, 0X0827},
-	{0X0829, 0X082D},
-	{0X0859, 0X085B},
-	{0X08D3, 0X08E1},
-	{0X08E3, 0X0903},
-	{0X093A, 0X093C},
-	{0X093E, 0X094F},
-	{0X0951, 0X0957},
-	{0X0962, 0X0963},
-	{0X0981, 0X0983},
-	{0X09BC, 0X09BC},
-	{0X09BE, 0X09C4},
-	{0X09C7, 0X09C8},
-	{0X09CB, 0X09CD},
-	{0X09D7, 0X09D7},
-	{0X09E2, 0X09E3},
-	{0X09FE, 0X09FE},
-	{0X0A01, 0X0A03},
-	{0X0A3C, 0X0A3C},
-	{0X0A3E, 0X0A42},
-	{0X0A47, 0X0A48},
-	{0X0A4B, 0X0A4D},
-	{0X0A51, 0X0A51},
-	{0X0A70, 0X0A71},
-	{0X0A75, 0X0A75},
-	{0X0A81, 0X0A83},
-	{0X0ABC, 0X0ABC},
-	{0X0ABE, 0X0AC5},
-	{0X0AC7, 0X0AC9},
-	{0X0ACB, 0X0ACD},
-	{0X0AE2, 0X0AE3},
-	{0X0AFA, 0X0AFF},
-	{0X0B01, 0X0B03},
-	{0X0B3C, 0X0B3C},
-	{0X0B3E, 0X0B44},
-	{0X0B47, 0X0B48},
-	{0X0B4B, 0X0B4D},
-	{0X0B56, 0X0B57},
-	{0X0B62, 0X0B63},
-	{0X0B82, 0X0B82},
-	{0X0BBE, 0X0BC2},
-	{0X0BC6, 0X0BC8},
-	{0X0BCA, 0X0BCD},
-	{0X0BD7, 0X0BD7},
-	{0X0C00, 0X0C04},
-	{0X0C3E, 0X0C44},
-	{0X0C46, 0X0C48},
-	{0X0C4A, 0X0C4D},
-	{0X0C55, 0X0C56},
-	{0X0C62, 0X0C63},
-	{0X0C81, 0X0C83},
-	{0X0CBC, 0X0CBC},
-	{0X0CBE, 0X0CC4},
-	{0X0CC6, 0X0CC8},
-	{0X0CCA, 0X0CCD},
-	{0X0CD5, 0X0CD6},
-	{0X0CE2, 0X0CE3},
-	{0X0D00, 0X0D03},
-	{0X0D3B, 0X0D3C},
-	{0X0D3E, 0X0D44},
-	{0X0D46, 0X0D48},
-	{0X0D4A, 0X0D4D},
-	{0X0D57, 0X0D57},
-	{0X0D62, 0X0D63},
-	{0X0D82, 0X0D83},
-	{0X0DCA, 0X0DCA},
-	{0X0DCF, 0X0DD4},
-	{0X0DD6, 0X0DD6},
-	{0X0DD8, 0X0DDF},
-	{0X0DF2, 0X0DF3},
-	{0X0E31, 0X0E31},
-	{0X0E34, 0X0E3A},
-	{0X0E47, 0X0E4E},
-	{0X0EB1, 0X0EB1},
-	{0X0EB4, 0X0EBC},
-	{0X0EC8, 0X0ECD},
-	{0X0F18, 0X0F19},
-	{0X0F35, 0X0F35},
-	{0X0F37, 0X0F37},
-	{0X0F39, 0X0F39},
-	{0X0F3E, 0X0F3F},
-	{0X0F71, 0X0F84},
-	{0X0F86, 0X0F87},
-	{0X0F8D, 0X0F97},
-	{0X0F99, 0X0FBC},
-	{0X0FC6, 0X0FC6},
-	{0X102B, 0X103E},
-	{0X1056, 0X1059},
-	{0X105E, 0X1060},
-	{0X1062, 0X1064},
-	{0X1067, 0X106D},
-	{0X1071, 0X1074},
-	{0X1082, 0X108D},
-	{0X108F, 0X108F},
-	{0X109A, 0X109D},
-	{0X135D, 0X135F},
-	{0X1712, 0X1714},
-	{0X1732, 0X1734},
-	{0X1752, 0X1753},
-	{0X1772, 0X1773},
-	{0X17B4, 0X17D3},
-	{0X17DD, 0X17DD},
-	{0X180B, 0X180D},
-	{0X1885, 0X1886},
-	{0X18A9, 0X18A9},
-	{0X1920, 0X192B},
-	{0X1930, 0X193B},
-	{0X1A17, 0X1A1B},
-	{0X1A55, 0X1A5E},
-	{0X1A60, 0X1A7C},
-	{0X1A7F, 0X1A7F},
-	{0X1AB0, 0X1ABE},
-	{0X1B00, 0X1B04},
-	{0X1B34, 0X1B44},
-	{0X1B6B, 0X1B73},
-	{0X1B80, 0X1B82},
-	{0X1BA1, 0X1BAD},
-	{0X1BE6, 0X1BF3},
-	{0X1C24, 0X1C37},
-	{0X1CD0, 0X1CD2},
-	{0X1CD4, 0X1CE8},
-	{0X1CED, 0X1CED},
-	{0X1CF4, 0X1CF4},
-	{0X1CF7, 0X1CF9},
-	{0X1DC0, 0X1DF9},
-	{0X1DFB, 0X1DFF},
-	{0X20D0, 0X20F0},
-	{0X2CEF, 0X2CF1},
-	{0X2D7F, 0X2D7F},
-	{0X2DE0, 0X2DFF},
-	{0X302A, 0X302F},
-	{0X3099, 0X309A},
-	{0XA66F, 0XA672},
-	{0XA674, 0XA67D},
-	{0XA69E, 0XA69F},
-	{0XA6F0, 0XA6F1},
-	{0XA802, 0XA802},
-	{0XA806, 0XA806},
-	{0XA80B, 0XA80B},
-	{0XA823, 0XA827},
-	{0XA880, 0XA881},
-	{0XA8B4, 0XA8C5},
-	{0XA8E0, 0XA8F1},
-	{0XA8FF, 0XA8FF},
-	{0XA926, 0XA92D},
-	{0XA947, 0XA953},
-	{0XA980, 0XA983},
-	{0XA9B3, 0XA9C0},
-	{0XA9E5, 0XA9E5},
-	{0XAA29, 0XAA36},
-	{0XAA43, 0XAA43},
-	{0XAA4C, 0XAA4D},
-	{0XAA7B, 0XAA7D},
-	{0XAAB0, 0XAAB0},
-	{0XAAB2, 0XAAB4},
-	{0XAAB7, 0XAAB8},
-	{0XAABE, 0XAABF},
-	{0XAAC1, 0XAAC1},
-	{0XAAEB, 0XAAEF},
-	{0XAAF5, 0XAAF6},
-	{0XABE3, 0XABEA},
-	{0XABEC, 0XABED},
-	{0XFB1E, 0XFB1E},
-	{0XFE00, 0XFE0F},
-	{0XFE20, 0XFE2F},
-	{0X101FD, 0X101FD},
-	{0X102E0, 0X102E0},
-	{0X10376, 0X1037A},
-	{0X10A01, 0X10A03},
-	{0X10A05, 0X10A06},
-	{0X10A0C, 0X10A0F},
-	{0X10A38, 0X10A3A},
-	{0X10A3F, 0X10A3F},
-	{0X10AE5, 0X10AE6},
-	{0X10D24, 0X10D27},
-	{0X10F46, 0X10F50},
-	{0X11000, 0X11002},
-	{0X11038, 0X11046},
-	{0X1107F, 0X11082},
-	{0X110B0, 0X110BA},
-	{0X11100, 0X11102},
-	{0X11127, 0X11134},
-	{0X11145, 0X11146},
-	{0X11173, 0X11173},
-	{0X11180, 0X11182},
-	{0X111B3, 0X111C0},
-	{0X111C9, 0X111CC},
-	{0X1122C, 0X11237},
-	{0X1123E, 0X1123E},
-	{0X112DF, 0X112EA},
-	{0X11300, 0X11303},
-	{0X1133B, 0X1133C},
-	{0X1133E, 0X11344},
-	{0X11347, 0X11348},
-	{0X1134B, 0X1134D},
-	{0X11357, 0X11357},
-	{0X11362, 0X11363},
-	{0X11366, 0X1136C},
-	{0X11370, 0X11374},
-	{0X11435, 0X11446},
-	{0X1145E, 0X1145E},
-	{0X114B0, 0X114C3},
-	{0X115AF, 0X115B5},
-	{0X115B8, 0X115C0},
-	{0X115DC, 0X115DD},
-	{0X11630, 0X11640},
-	{0X116AB, 0X116B7},
-	{0X1171D, 0X1172B},
-	{0X1182C, 0X1183A},
-	{0X119D1, 0X119D7},
-	{0X119DA, 0X119E0},
-	{0X119E4, 0X119E4},
-	{0X11A01, 0X11A0A},
-	{0X11A33, 0X11A39},
-	{0X11A3B, 0X11A3E},
-	{0X11A47, 0X11A47},
-	{0X11A51, 0X11A5B},
-	{0X11A8A, 0X11A99},
-	{0X11C2F, 0X11C36},
-	{0X11C38, 0X11C3F},
-	{0X11C92, 0X11CA7},
-	{0X11CA9, 0X11CB6},
-	{0X11D31, 0X11D36},
-	{0X11D3A, 0X11D3A},
-	{0X11D3C, 0X11D3D},
-	{0X11D3F, 0X11D45},
-	{0X11D47, 0X11D47},
-	{0X11D8A, 0X11D8E},
-	{0X11D90, 0X11D91},
-	{0X11D93, 0X11D97},
-	{0X11EF3, 0X11EF6},
-	{0X16AF0, 0X16AF4},
-	{0X16B30, 0X16B36},
-	{0X16F4F, 0X16F4F},
-	{0X16F51, 0X16F87},
-	{0X16F8F, 0X16F92},
-	{0X1BC9D, 0X1BC9E},
-	{0X1D165, 0X1D169},
-	{0X1D16D, 0X1D172},
-	{0X1D17B, 0X1D182},
-	{0X1D185, 0X1D18B},
-	{0X1D1AA, 0X1D1AD},
-	{0X1D242, 0X1D244},
-	{0X1DA00, 0X1DA36},
-	{0X1DA3B, 0X1DA6C},
-	{0X1DA75, 0X1DA75},
-	{0X1DA84, 0X1DA84},
-	{0X1DA9B, 0X1DA9F},
-	{0X1DAA1, 0X1DAAF},
-	{0X1E000, 0X1E006},
-	{0X1E008, 0X1E018},
-	{0X1E01B, 0X1E021},
-	{0X1E023, 0X1E024},
-	{0X1E026, 0X1E02A},
-	{0X1E130, 0X1E136},
-	{0X1E2EC, 0X1E2EF},
-	{0X1E8D0, 0X1E8D6},
-	{0X1E944, 0X1E94A},
-	{0XE0100, 0XE01EF}
-};
-
-/* auxiliary function for binary search in interval table */
-static int KTerm_Bisearch(uint32_t ucs, const struct KTermInterval *table, int max) {
-  int min = 0;
-  int mid;
-
-  if ((int)ucs < table[0].first || (int)ucs > table[max].last)
-    return 0;
-  while (max >= min) {
-    mid = (min + max) / 2;
-    if ((int)ucs > table[mid].last)
-      min = mid + 1;
-    else if ((int)ucs < table[mid].first)
-      max = mid - 1;
-    else
-      return 1;
-  }
-
-  return 0;
-}
+// Width, combining flag, CP437 alias, BiDi class and mirror pair for every
+// codepoint live in one two-stage table generated by tools/gen_unicode_props.py
+// (combining ranges from Vim, wide ranges per Markus Kuhn's wcwidth).
+#include "kt_unicode_props.h"
 
-static int KTerm_wcwidth(uint32_t ucs)
+static inline int KTerm_wcwidth(uint32_t ucs)
 {
-  /* test for 8-bit control characters */
-  if (ucs == 0)
-    return 0;
-  if (ucs < 32 || (ucs >= 0x7f && ucs < 0xa0))
-    return -1;
-
-  /* binary search in table of non-spacing characters */
-  if (KTerm_Bisearch(ucs, kterm_combining_table,
-               sizeof(kterm_combining_table) / sizeof(struct KTermInterval) - 1))
-    return 0;
-
-  /* if we arrive here, ucs is not a combining or C0/C1 control character */
-
-  return 1 +
-    (ucs >= 0x1100 &&
-     (ucs <= 0x115f ||                    /* Hangul Jamo init. consonants */
-      ucs == 0x2329 || ucs == 0x232a ||
-      (ucs >= 0x2e80 && ucs <= 0xa4cf &&
-       ucs != 0x303f) ||                  /* CJK ... Yi */
-      (ucs >= 0xac00 && ucs <= 0xd7a3) || /* Hangul Syllables */
-      (ucs >= 0xf900 && ucs <= 0xfaff) || /* CJK Compatibility Ideographs */
-      (ucs >= 0xfe10 && ucs <= 0xfe19) || /* Vertical forms */
-      (ucs >= 0xfe30 && ucs <= 0xfe6f) || /* CJK Compatibility Forms */
-      (ucs >= 0xff00 && ucs <= 0xff60) || /* Fullwidth Forms */
-      (ucs >= 0xffe0 && ucs <= 0xffe6) ||
-      (ucs >= 0x20000 && ucs <= 0x2fffd) ||
-      (ucs >= 0x30000 && ucs <= 0x3fffd)));
+  return KT_UPROPS_WIDTH(KTerm_CodepointProps(ucs));
 }
 
 #if 0
@@ -2805,6 +3058,11 @@ KTerm* KTerm_Create(KTermConfig config) {
     else term->height = DEFAULT_TERM_HEIGHT;
 
     term->response_callback = config.response_callback;
+    term->session_buffer_sizes.input_pipeline = config.input_pipeline_size;
+    term->session_buffer_sizes.key_events = config.key_event_buffer_size;
+    term->session_buffer_sizes.op_queue = config.op_queue_size;
+    term->session_buffer_sizes.responses = config.response_buffer_size;
+    term->session_buffer_sizes.scrollback = config.scrollback_lines;
 
     if (!KTerm_Init(term)) {
         KTerm_Cleanup(term);
@@ -2867,6 +3125,7 @@ static bool KTerm_InitRenderBuffers(KTerm* term) {
     term->rb_front = 0;
     term->rb_back = 1;
     KTERM_MUTEX_INIT(term->render_lock);
+    term->gpu_vector_layer = -1;
 
     for (int i = 0; i < 2; i++) {
         // Cells
@@ -2911,6 +3170,105 @@ static void KTerm_CleanupRenderBuffers(KTerm* term) {
     }
 }
 
+// =============================================================================
+// VECTOR LAYER
+// =============================================================================
+// ReGIS and Tektronix vectors are staged until the next clear. Renderers keep
+// the rasterized layer and draw only the vectors past their own mark, so a
+// long plot costs the same per frame as a short one.
+
+static void KTerm_ClearVectors(KTerm* term) {
+    term->vector_count = 0;
+    term->vector_epoch++;
+    term->vector_clear_request = true;
+}
+
+// Next staging slot, growing the buffer as needed
+static GPUVectorLine* KTerm_AllocVector(KTerm* term) {
+    if (term->vector_count >= term->vector_capacity || !term->vector_staging_buffer) {
+        size_t capacity = term->vector_capacity ? term->vector_capacity * 2 : 1024;
+        GPUVectorLine* grown = (GPUVectorLine*)KTerm_Realloc(term->vector_staging_buffer, capacity * sizeof(GPUVectorLine));
+        if (!grown) {
+            KTerm_ReportError(term, KTERM_LOG_WARNING, KTERM_SOURCE_SYSTEM, "Vector buffer full at %u lines", (unsigned)term->vector_count);
+            return NULL;
+        }
+        term->vector_staging_buffer = grown;
+        term->vector_capacity = capacity;
+    }
+    return &term->vector_staging_buffer[term->vector_count++];
+}
+
+// term->vector_drawn follows the layer furthest behind in `epoch`
+static void KTerm_UpdateVectorDrawn(KTerm* term, uint32_t epoch) {
+    bool any = false;
+    size_t lowest = 0;
+    for (int i = 0; i < KTERM_MAX_VECTOR_LAYERS; i++) {
+        const KTermVectorLayer* layer = &term->vector_layers[i];
+        if (!layer->active) continue;
+        size_t drawn = (layer->epoch == epoch) ? layer->drawn : 0;
+        if (!any || drawn < lowest) lowest = drawn;
+        any = true;
+    }
+    if (!any) return;
+    term->vector_drawn = lowest;
+    term->vector_drawn_epoch = epoch;
+}
+
+// First staged vector the layer furthest behind still needs. Caller holds render_lock:
+// the render thread moves vector_drawn and vector_drawn_epoch together in KTerm_EndVectors.
+static size_t KTerm_VectorSendStart(KTerm* term) {
+    size_t first = (term->vector_drawn_epoch == term->vector_epoch) ? term->vector_drawn : 0;
+    return (first > term->vector_count) ? 0 : first;
+}
+
+int KTerm_AddVectorLayer(KTerm* term) {
+    for (int i = 0; i < KTERM_MAX_VECTOR_LAYERS; i++) {
+        KTermVectorLayer* layer = &term->vector_layers[i];
+        if (layer->active) continue;
+        layer->active = true;
+        layer->drawn = 0;
+        layer->epoch = term->vector_drawn_epoch;
+        KTerm_UpdateVectorDrawn(term, term->vector_drawn_epoch);
+        return i;
+    }
+    KTerm_ReportError(term, KTERM_LOG_WARNING, KTERM_SOURCE_SYSTEM, "No free vector layer (%d in use)", KTERM_MAX_VECTOR_LAYERS);
+    return -1;
+}
+
+void KTerm_RemoveVectorLayer(KTerm* term, int layer) {
+    if (layer < 0 || layer >= KTERM_MAX_VECTOR_LAYERS) return;
+    term->vector_layers[layer].active = false;
+    KTerm_UpdateVectorDrawn(term, term->vector_drawn_epoch);
+}
+
+void KTerm_ResetVectorLayer(KTerm* term, int layer) {
+    if (layer < 0 || layer >= KTERM_MAX_VECTOR_LAYERS) return;
+    term->vector_layers[layer].drawn = 0;
+    KTerm_UpdateVectorDrawn(term, term->vector_drawn_epoch);
+}
+
+bool KTerm_BeginVectors(KTerm* term, int layer, const KTermRenderBuffer* rb, size_t* start, bool* cleared) {
+    *start = 0;
+    *cleared = false;
+    if (layer < 0 || layer >= KTERM_MAX_VECTOR_LAYERS) return false;
+    const KTermVectorLayer* mark = &term->vector_layers[layer];
+    *cleared = (rb->vector_epoch != mark->epoch);
+    size_t drawn = *cleared ? 0 : mark->drawn;
+    // A gap means the layer lost vectors this buffer does not hold; the next frame sends them
+    if (rb->vector_first > drawn) return false;
+    if (drawn - rb->vector_first >= rb->vector_count) return false;
+    *start = drawn - rb->vector_first;
+    return true;
+}
+
+void KTerm_EndVectors(KTerm* term, int layer, const KTermRenderBuffer* rb) {
+    if (layer < 0 || layer >= KTERM_MAX_VECTOR_LAYERS) return;
+    KTermVectorLayer* mark = &term->vector_layers[layer];
+    mark->drawn = rb->vector_first + rb->vector_count;
+    mark->epoch = rb->vector_epoch;
+    KTerm_UpdateVectorDrawn(term, rb->vector_epoch);
+}
+
 static void KTerm_InitReGIS(KTerm* term) {
     memset(&term->regis, 0, sizeof(term->regis));
     term->regis.screen_min_x = 0;
@@ -2919,8 +3277,7 @@ static void KTerm_InitReGIS(KTerm* term) {
     term->regis.screen_max_y = REGIS_HEIGHT - 1;
 
     // Clear Vectors (Graphics)
-    term->vector_count = 0;
-    term->vector_clear_request = true;
+    KTerm_ClearVectors(term);
 }
 
 static void KTerm_InitTektronix(KTerm* term) {
@@ -2928,32 +3285,286 @@ static void KTerm_InitTektronix(KTerm* term) {
     term->tektronix.extra_byte = -1;
 
     // Clear Vectors (Graphics) - Shared with ReGIS
-    term->vector_count = 0;
-    term->vector_clear_request = true;
+    KTerm_ClearVectors(term);
 }
 
-static void KTerm_InitKitty(KTermSession* session) {
-    // Free existing images
-    if (session->kitty.images) {
-        for (int k = 0; k < session->kitty.image_count; k++) {
-            if (session->kitty.images[k].frames) {
-                for (int f = 0; f < session->kitty.images[k].frame_count; f++) {
-                    if (session->kitty.images[k].frames[f].data) {
-                        KTerm_Free(session->kitty.images[k].frames[f].data);
-                    }
-                    if (session->kitty.images[k].frames[f].texture.id != 0) {
-                        KTerm_DestroyTexture(&session->kitty.images[k].frames[f].texture);
-                    }
+// --- Kitty Image Table Helpers ---
+
+static inline uint32_t KTerm_KittyHashId(uint32_t id, int capacity) {
+    return (id * 2654435761u) & (uint32_t)(capacity - 1);
+}
+
+// Rebuild the id -> index table from images[]. Called after growth and after any removal
+// (removal compacts images[], which shifts indices).
+static void KTerm_KittyRebuildIndex(KittyGraphics* kitty) {
+    int cap = (kitty->id_table_capacity > 0) ? kitty->id_table_capacity : KTERM_KITTY_ID_TABLE_MIN;
+    while (cap < kitty->image_count * 2) cap *= 2;
+
+    if (cap != kitty->id_table_capacity || !kitty->id_table) {
+        int* table = (int*)KTerm_Realloc(kitty->id_table, cap * sizeof(int));
+        if (!table) return;
+        kitty->id_table = table;
+        kitty->id_table_capacity = cap;
+    }
+    memset(kitty->id_table, 0xFF, cap * sizeof(int)); // -1 = empty
+
+    if (!kitty->images) return;
+    for (int i = 0; i < kitty->image_count; i++) {
+        uint32_t h = KTerm_KittyHashId(kitty->images[i].id, cap);
+        while (kitty->id_table[h] != -1) h = (h + 1) & (cap - 1);
+        kitty->id_table[h] = i;
+    }
+}
+
+static KittyImageBuffer* KTerm_KittyFindImage(KittyGraphics* kitty, uint32_t id) {
+    if (!kitty->images || !kitty->id_table) return NULL;
+    int cap = kitty->id_table_capacity;
+    uint32_t h = KTerm_KittyHashId(id, cap);
+    for (int probe = 0; probe < cap; probe++) {
+        int idx = kitty->id_table[h];
+        if (idx == -1) return NULL;
+        if (idx < kitty->image_count && kitty->images[idx].id == id) return &kitty->images[idx];
+        h = (h + 1) & (cap - 1);
+    }
+    return NULL;
+}
+
+static void KTerm_KittyIndexInsert(KittyGraphics* kitty, int index) {
+    if (!kitty->id_table || kitty->image_count * 2 > kitty->id_table_capacity) {
+        KTerm_KittyRebuildIndex(kitty); // Grows and re-inserts everything, including index
+        return;
+    }
+    int cap = kitty->id_table_capacity;
+    uint32_t h = KTerm_KittyHashId(kitty->images[index].id, cap);
+    while (kitty->id_table[h] != -1) h = (h + 1) & (cap - 1);
+    kitty->id_table[h] = index;
+}
+
+static KittyPlacement* KTerm_KittyFindPlacement(KittyGraphics* kitty, uint32_t image_id, uint32_t placement_id) {
+    for (int i = 0; i < kitty->placement_count; i++) {
+        if (kitty->placements[i].image_id == image_id && kitty->placements[i].placement_id == placement_id) {
+            return &kitty->placements[i];
+        }
+    }
+    return NULL;
+}
+
+static void KTerm_KittyRemovePlacement(KittyGraphics* kitty, int index) {
+    KittyImageBuffer* img = KTerm_KittyFindImage(kitty, kitty->placements[index].image_id);
+    if (img && img->placement_count > 0) img->placement_count--;
+    memmove(&kitty->placements[index], &kitty->placements[index + 1], (kitty->placement_count - index - 1) * sizeof(KittyPlacement));
+    kitty->placement_count--;
+}
+
+// An image is "shown" if its implicit placement is visible or any extra placement references it.
+static inline bool KTerm_KittyIsShown(const KittyImageBuffer* img) {
+    return img->visible || img->placement_count > 0;
+}
+
+static void KTerm_KittyFreeFrames(KittyGraphics* kitty, KittyImageBuffer* img) {
+    if (img->frames) {
+        for (int f = 0; f < img->frame_count; f++) {
+            if (img->frames[f].data) {
+                if (kitty->current_memory_usage >= img->frames[f].capacity) {
+                    kitty->current_memory_usage -= img->frames[f].capacity;
+                } else {
+                    kitty->current_memory_usage = 0; // Should not happen
                 }
-                KTerm_Free(session->kitty.images[k].frames);
+                KTerm_Free(img->frames[f].data);
             }
+            if (img->frames[f].texture.id != 0) KTerm_DestroyTexture(&img->frames[f].texture);
+        }
+        KTerm_Free(img->frames);
+        kitty->render_ops_dirty = true; // Cached ops point at these pixels and textures
+    }
+    img->frames = NULL;
+    img->frame_count = 0;
+    img->frame_capacity = 0;
+}
+
+// Remove images[index] and every placement referencing it. Compacts images[] and keeps
+// active_upload pointing at the same image if it survives.
+static void KTerm_KittyRemoveImage(KittyGraphics* kitty, int index) {
+    KittyImageBuffer* img = &kitty->images[index];
+    uint32_t id = img->id;
+    uint32_t active_id = 0;
+    bool had_active = (kitty->active_upload != NULL && kitty->active_upload != img);
+    if (had_active) active_id = kitty->active_upload->id;
+    if (kitty->active_upload == img) kitty->active_upload = NULL;
+
+    KTerm_KittyFreeFrames(kitty, img);
+    memmove(&kitty->images[index], &kitty->images[index + 1], (kitty->image_count - index - 1) * sizeof(KittyImageBuffer));
+    kitty->image_count--;
+
+    for (int p = kitty->placement_count - 1; p >= 0; p--) {
+        if (kitty->placements[p].image_id == id) {
+            memmove(&kitty->placements[p], &kitty->placements[p + 1], (kitty->placement_count - p - 1) * sizeof(KittyPlacement));
+            kitty->placement_count--;
+        }
+    }
+
+    KTerm_KittyRebuildIndex(kitty);
+    if (had_active) kitty->active_upload = KTerm_KittyFindImage(kitty, active_id);
+    kitty->render_ops_dirty = true;
+}
+
+// Evict least-recently-used images until 'needed' more bytes fit under KTERM_KITTY_MEMORY_LIMIT.
+// Images that are not shown anywhere go first; the image with id 'protect_id' (the one being
+// uploaded) is never evicted. Returns false if the space could not be freed.
+static bool KTerm_KittyEvictForSpace(KTerm* term, KTermSession* session, size_t needed, uint32_t protect_id) {
+    KittyGraphics* kitty = &session->kitty;
+    while (kitty->current_memory_usage + needed > KTERM_KITTY_MEMORY_LIMIT) {
+        int victim = -1;
+        for (int i = 0; i < kitty->image_count; i++) {
+            KittyImageBuffer* img = &kitty->images[i];
+            if (img->id == protect_id || img == kitty->active_upload) continue;
+            if (victim == -1) { victim = i; continue; }
+            KittyImageBuffer* best = &kitty->images[victim];
+            bool shown = KTerm_KittyIsShown(img);
+            bool best_shown = KTerm_KittyIsShown(best);
+            if ((!shown && best_shown) || (shown == best_shown && img->last_used < best->last_used)) victim = i;
+        }
+        if (victim == -1) return false;
+
+        if (session->options.debug_sequences) {
+            char msg[64];
+            snprintf(msg, sizeof(msg), "Kitty: Evicted Image ID=%u", kitty->images[victim].id);
+            KTerm_LogUnsupportedSequence(term, msg);
         }
-        KTerm_Free(session->kitty.images);
-        session->kitty.images = NULL;
+        KTerm_KittyRemoveImage(kitty, victim);
+        kitty->evicted_images++;
     }
-    session->kitty.image_count = 0;
-    session->kitty.image_capacity = 0;
-    session->kitty.current_memory_usage = 0;
+    return true;
+}
+
+static void KTerm_KittyFreeAll(KittyGraphics* kitty) {
+    if (kitty->images) {
+        for (int k = 0; k < kitty->image_count; k++) {
+            KTerm_KittyFreeFrames(kitty, &kitty->images[k]);
+        }
+        KTerm_Free(kitty->images);
+        kitty->images = NULL;
+    }
+    if (kitty->id_table) {
+        KTerm_Free(kitty->id_table);
+        kitty->id_table = NULL;
+    }
+    if (kitty->placements) {
+        KTerm_Free(kitty->placements);
+        kitty->placements = NULL;
+    }
+    if (kitty->anim_heap) {
+        KTerm_Free(kitty->anim_heap);
+        kitty->anim_heap = NULL;
+    }
+    if (kitty->render_ops) {
+        KTerm_Free(kitty->render_ops);
+        kitty->render_ops = NULL;
+    }
+    kitty->anim_count = 0;
+    kitty->anim_capacity = 0;
+    kitty->render_op_count = 0;
+    kitty->render_op_capacity = 0;
+    kitty->render_ops_dirty = true;
+    kitty->image_count = 0;
+    kitty->image_capacity = 0;
+    kitty->id_table_capacity = 0;
+    kitty->placement_count = 0;
+    kitty->placement_capacity = 0;
+    kitty->current_memory_usage = 0;
+    kitty->lru_clock = 0;
+    kitty->evicted_images = 0;
+    kitty->active_upload = NULL;
+}
+
+// --- Kitty Animation Scheduler ---
+// Animating images sit in a per-session min-heap keyed on their next frame deadline, so
+// KTerm_Update only touches images whose frame is actually due. Entries are invalidated
+// lazily: a popped entry is ignored unless the image still exists and still expects it.
+
+static bool KTerm_KittyHeapPush(KittyGraphics* kitty, KittyAnimTimer t) {
+    if (kitty->anim_count >= kitty->anim_capacity) {
+        int new_cap = (kitty->anim_capacity == 0) ? 16 : kitty->anim_capacity * 2;
+        KittyAnimTimer* heap = KTerm_Realloc(kitty->anim_heap, new_cap * sizeof(KittyAnimTimer));
+        if (!heap) return false;
+        kitty->anim_heap = heap;
+        kitty->anim_capacity = new_cap;
+    }
+    int i = kitty->anim_count++;
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (kitty->anim_heap[parent].deadline <= t.deadline) break;
+        kitty->anim_heap[i] = kitty->anim_heap[parent];
+        i = parent;
+    }
+    kitty->anim_heap[i] = t;
+    return true;
+}
+
+static KittyAnimTimer KTerm_KittyHeapPop(KittyGraphics* kitty) {
+    KittyAnimTimer top = kitty->anim_heap[0];
+    KittyAnimTimer last = kitty->anim_heap[--kitty->anim_count];
+    int i = 0;
+    for (;;) {
+        int child = 2 * i + 1;
+        if (child >= kitty->anim_count) break;
+        if (child + 1 < kitty->anim_count && kitty->anim_heap[child + 1].deadline < kitty->anim_heap[child].deadline) child++;
+        if (last.deadline <= kitty->anim_heap[child].deadline) break;
+        kitty->anim_heap[i] = kitty->anim_heap[child];
+        i = child;
+    }
+    if (kitty->anim_count > 0) kitty->anim_heap[i] = last;
+    return top;
+}
+
+static inline int KTerm_KittyFrameDelay(const KittyImageBuffer* img) {
+    int delay = img->frames[img->current_frame].delay_ms;
+    return (delay <= 0) ? 40 : delay; // Default min delay
+}
+
+// Queue the next frame deadline for an image if it is animating, shown and not yet scheduled.
+static void KTerm_KittyScheduleAnimation(KittyGraphics* kitty, KittyImageBuffer* img) {
+    if (img->anim_scheduled || img->frame_count < 2 || !img->complete || !KTerm_KittyIsShown(img)) return;
+    if (img->current_frame >= img->frame_count) img->current_frame = 0;
+
+    double remaining = KTerm_KittyFrameDelay(img) - img->frame_timer;
+    if (remaining < 0) remaining = 0;
+    img->next_frame_time = kitty->anim_clock_ms + remaining;
+
+    // Unscheduled on failure, so the next show or frame tries again
+    KittyAnimTimer t = { img->next_frame_time, img->id };
+    img->anim_scheduled = KTerm_KittyHeapPush(kitty, t);
+}
+
+// Advance the session animation clock and step only the images whose deadline has passed.
+static void KTerm_KittyTickAnimations(KittyGraphics* kitty, double dt_ms) {
+    kitty->anim_clock_ms += dt_ms;
+
+    while (kitty->anim_count > 0 && kitty->anim_heap[0].deadline <= kitty->anim_clock_ms) {
+        KittyAnimTimer t = KTerm_KittyHeapPop(kitty);
+        KittyImageBuffer* img = KTerm_KittyFindImage(kitty, t.image_id);
+        if (!img || !img->anim_scheduled || img->next_frame_time != t.deadline) continue; // Stale
+        img->anim_scheduled = false;
+        if (img->frame_count < 2 || !img->complete || !KTerm_KittyIsShown(img)) continue; // Paused until shown again
+
+        // Catch up on every frame that became due (large dt or long stall)
+        double due = t.deadline;
+        do {
+            img->current_frame = (img->current_frame + 1) % img->frame_count;
+            due += KTerm_KittyFrameDelay(img);
+        } while (due <= kitty->anim_clock_ms);
+
+        img->frame_timer = KTerm_KittyFrameDelay(img) - (due - kitty->anim_clock_ms);
+        img->next_frame_time = due;
+        KittyAnimTimer next = { due, img->id };
+        img->anim_scheduled = KTerm_KittyHeapPush(kitty, next);
+        kitty->render_ops_dirty = true;
+    }
+}
+
+static void KTerm_InitKitty(KTermSession* session) {
+    // Free existing images
+    KTerm_KittyFreeAll(&session->kitty);
 
     memset(&session->kitty.cmd, 0, sizeof(session->kitty.cmd));
     session->kitty.state = 0; // KEY
@@ -2978,11 +3589,11 @@ void KTerm_ResetGraphics(KTerm* term, KTermSession* session, GraphicsResetFlags
     // Kitty is per-session.
 
     if (flags & GRAPHICS_RESET_KITTY && term->kitty_target_session >= 0) {
-        s = &term->sessions[term->kitty_target_session];
+        s = term->sessions[term->kitty_target_session];
     } else if (flags & GRAPHICS_RESET_REGIS && term->regis_target_session >= 0) {
-        s = &term->sessions[term->regis_target_session];
+        s = term->sessions[term->regis_target_session];
     } else if (flags & GRAPHICS_RESET_TEK && term->tektronix_target_session >= 0) {
-        s = &term->sessions[term->tektronix_target_session];
+        s = term->sessions[term->tektronix_target_session];
     }
     if (!s) s = session;  // Fallback
 
@@ -2997,18 +3608,98 @@ void KTerm_ResetGraphics(KTerm* term, KTermSession* session, GraphicsResetFlags
     }
     if (flags == GRAPHICS_RESET_ALL || (flags & GRAPHICS_RESET_SIXEL)) {
         KTermSession* sixel_s = session;
-        if (term->sixel_target_session >= 0 && term->sixel_target_session < MAX_SESSIONS) {
-            sixel_s = &term->sessions[term->sixel_target_session];
+        if (term->sixel_target_session >= 0 && term->sixel_target_session < term->session_count) {
+            sixel_s = term->sessions[term->sixel_target_session];
         }
         KTerm_InitSixelGraphics(term, sixel_s);
     }
 
     // Force dirty redraw
     for(int i = 0; i < s->rows; i++) {
-        s->row_dirty[i] = KTERM_DIRTY_FRAMES;
+        KTerm_MarkRowDirty(s, i);
     }
 }
 
+// =============================================================================
+// SESSION TABLE
+// =============================================================================
+// Sessions are allocated one by one and referenced from a table that doubles as
+// it fills. A slot is never freed: closing its session frees the buffers but the
+// input ring and bumps the generation, so old handles go stale, and
+// KTerm_CreateSession reopens the slot under a new handle.
+
+// Appends a zeroed session to the table; returns its index or -1
+static int KTerm_AddSessionSlot(KTerm* term) {
+    if (term->session_count >= KTERM_MAX_SESSION_SLOTS) return -1; // Handles have no room for more
+    if (term->session_count >= term->session_capacity) {
+        if (term->retired_session_table_count >= (int)(sizeof(term->retired_session_tables) / sizeof(term->retired_session_tables[0]))) return -1;
+        int new_cap = (term->session_capacity == 0) ? MAX_SESSIONS : term->session_capacity * 2;
+        KTermSession** table = (KTermSession**)KTerm_Calloc((size_t)new_cap, sizeof(KTermSession*));
+        int* list = (int*)KTerm_Realloc(term->update_list, (size_t)new_cap * sizeof(int));
+        if (!table || !list) {
+            if (table) KTerm_Free(table);
+            if (list) term->update_list = list;
+            KTerm_ReportError(term, KTERM_LOG_ERROR, KTERM_SOURCE_SYSTEM, "Failed to grow the session table to %d", new_cap);
+            return -1;
+        }
+        term->update_list = list;
+        term->update_capacity = new_cap;
+        if (term->sessions) {
+            memcpy(table, term->sessions, (size_t)term->session_count * sizeof(KTermSession*));
+            term->retired_session_tables[term->retired_session_table_count++] = term->sessions;
+        }
+        term->sessions = table;
+        term->session_capacity = new_cap;
+    }
+
+    KTermSession* session = (KTermSession*)KTerm_Calloc(1, sizeof(KTermSession));
+    if (!session) {
+        KTerm_ReportError(term, KTERM_LOG_ERROR, KTERM_SOURCE_SYSTEM, "Failed to allocate session %d", term->session_count);
+        return -1;
+    }
+    int index = term->session_count;
+    session->index = index;
+    atomic_init(&session->wake_next, -1);
+    atomic_init(&session->wake_queued, false);
+    KTERM_MUTEX_INIT(session->lock); // Session Lock (Phase 3), once per session lifetime
+
+    // Publish the slot before the count that makes it reachable
+    term->sessions[index] = session;
+    atomic_thread_fence(memory_order_release);
+    term->session_count = index + 1;
+    return index;
+}
+
+// Brings a slot to the state of a freshly initialized session (closed)
+static bool KTerm_SetupSession(KTerm* term, int index) {
+    if (!KTerm_InitSession(term, index)) return false;
+    KTermSession* session = term->sessions[index];
+
+    // Context switch to use existing helper functions
+    int saved = term->active_session;
+    term->active_session = index;
+
+    KTerm_InitVTConformance(term, session);
+    KTerm_InitTabStops(term, session);
+    KTerm_InitCharacterSets(term, session);
+    KTerm_InitInputState(term, session);
+    KTerm_InitSixelGraphics(term, session);
+
+    // Initialize Kitty Graphics
+    KTerm_KittyFreeAll(&session->kitty);
+    memset(&session->kitty, 0, sizeof(session->kitty));
+
+    session->fast_forward = false;
+    session->fast_forwarding = false;
+    session->fast_forward_stale = false;
+    session->fast_forward_scroll = 0;
+    session->protection_used = false;
+
+    session->session_open = false;
+    term->active_session = saved;
+    return true;
+}
+
 bool KTerm_Init(KTerm* term) {
     KTerm_InitFontData(term);
     KTerm_InitKTermColorPalette(term);
@@ -3017,9 +3708,10 @@ bool KTerm_Init(KTerm* term) {
     if (term->width == 0) term->width = DEFAULT_TERM_WIDTH;
     if (term->height == 0) term->height = DEFAULT_TERM_HEIGHT;
 
-    // Initialize Session Locks (Phase 3) - Done once per terminal lifetime
-    for (int i = 0; i < MAX_SESSIONS; i++) {
-        KTERM_MUTEX_INIT(term->sessions[i].lock);
+    // The first MAX_SESSIONS sessions exist from the start
+    if (!term->sessions) atomic_init(&term->wake_head, -1);
+    while (term->session_count < MAX_SESSIONS) {
+        if (KTerm_AddSessionSlot(term) < 0) return false;
     }
 
     // Default Font
@@ -3032,6 +3724,7 @@ bool KTerm_Init(KTerm* term) {
     KTerm_CalculateFontMetrics(term->current_font_data, 256, term->font_data_width, term->font_data_height, 0, false, term->font_metrics);
     term->active_session = 0;
     term->pending_session_switch = -1;
+    term->output_session = -1;
     term->split_screen_active = false;
     term->split_row = term->height / 2;
     term->session_top = 0;
@@ -3055,34 +3748,14 @@ bool KTerm_Init(KTerm* term) {
     term->sixel_target_session = -1;
 
     // Init sessions
-    for (int i = 0; i < MAX_SESSIONS; i++) {
-        if (!KTerm_InitSession(term, i)) return false;
-        KTermSession* session = &term->sessions[i];
-
-        // Context switch to use existing helper functions
-        int saved = term->active_session;
-        term->active_session = i;
-
-        KTerm_InitVTConformance(term, session);
-        KTerm_InitTabStops(term, session);
-        KTerm_InitCharacterSets(term, session);
-        KTerm_InitInputState(term, session);
-        KTerm_InitSixelGraphics(term, session);
-
-        // Initialize Kitty Graphics
-        memset(&term->sessions[i].kitty, 0, sizeof(term->sessions[i].kitty));
-        term->sessions[i].kitty.images = NULL;
-        term->sessions[i].kitty.image_count = 0;
-        term->sessions[i].kitty.image_capacity = 0;
-
-        // Only the first session is active by default in the multiplexer
-        if (i > 0) {
-            term->sessions[i].session_open = false;
-        }
-
-        term->active_session = saved;
+    KTerm_ResolveBufferSizes(term);
+    for (int i = 0; i < term->session_count; i++) {
+        if (!KTerm_SetupSession(term, i)) return false;
     }
+    // Only the first session is active by default in the multiplexer
+    term->sessions[0]->session_open = true;
     term->active_session = 0;
+    if (!KTerm_OpenSessionBuffers(term, term->sessions[0])) return false;
 
     // Initialize Layout Tree
     term->layout = KTermLayout_Create(term->width, term->height);
@@ -3090,21 +3763,30 @@ bool KTerm_Init(KTerm* term) {
 
     InitCharacterSetLUT(term);
 
-    // Allocate full Unicode map
-    if (term->glyph_map) KTerm_Free(term->glyph_map);
-    term->glyph_map = (uint16_t*)KTerm_Calloc(0x110000, sizeof(uint16_t));
+    // Allocate the top level of the sparse Unicode map; blocks come on demand
+    KTerm_FreeGlyphMap(term);
+    term->glyph_map = (uint32_t**)KTerm_Calloc(KTERM_GLYPH_MAP_BLOCKS, sizeof(uint32_t*));
     if (!term->glyph_map) return false;
+    if (term->cluster_map) KTerm_Free(term->cluster_map);
+    term->cluster_map = (KTermClusterEntry*)KTerm_Calloc(KTERM_CLUSTER_TABLE_SIZE, sizeof(KTermClusterEntry));
+    if (!term->cluster_map) return false;
+    term->cluster_count = 0;
 
-    // Initialize Dynamic Atlas dimensions before creation
+    // Initialize Dynamic Atlas dimensions before creation: one page, grown on demand
     term->atlas_width = 1024;
-    term->atlas_height = 1024;
     term->atlas_cols = 128;
+    term->atlas_height = KTERM_ATLAS_PAGE_ROWS * DEFAULT_CHAR_HEIGHT;
+    term->atlas_slots_per_page = term->atlas_cols * KTERM_ATLAS_PAGE_ROWS;
+    if (term->atlas_max_pages <= 0 || term->atlas_max_pages > KTERM_ATLAS_MAX_PAGES) term->atlas_max_pages = KTERM_ATLAS_MAX_PAGES;
+    memset(term->atlas_pages, 0, sizeof(term->atlas_pages));
+    term->atlas_pages[0].cells = 1;
+    term->atlas_pages[0].used = 256; // Base font
+    term->atlas_page_count = 1;
+    term->atlas_fill_page[0] = 0;
+    for (int c = 1; c < KTERM_GLYPH_MAX_CELLS; c++) term->atlas_fill_page[c] = -1;
 
     // Allocate LRU Cache
-    size_t capacity = (term->atlas_width / DEFAULT_CHAR_WIDTH) * (term->atlas_height / DEFAULT_CHAR_HEIGHT);
-    term->glyph_last_used = (uint64_t*)KTerm_Calloc(capacity, sizeof(uint64_t));
-    if (!term->glyph_last_used) return false;
-    term->atlas_to_codepoint = (uint32_t*)KTerm_Calloc(capacity, sizeof(uint32_t));
+    term->atlas_to_codepoint = (uint32_t*)KTerm_Calloc(term->atlas_slots_per_page, sizeof(uint32_t));
     if (!term->atlas_to_codepoint) return false;
     term->frame_count = 0;
 
@@ -3121,6 +3803,12 @@ bool KTerm_Init(KTerm* term) {
     KTERM_MUTEX_INIT(term->lock);
     term->main_thread_id = KTERM_THREAD_CURRENT();
 
+    // Glyph rasterizer sync objects (the worker itself is opt-in)
+    KTERM_MUTEX_INIT(term->glyph_raster.lock);
+    KTERM_MUTEX_INIT(term->glyph_raster.font_lock);
+    KTERM_COND_INIT(term->glyph_raster.wake);
+    KTERM_COND_INIT(term->glyph_raster.idle);
+
     return true;
 }
 
@@ -3135,25 +3823,232 @@ static void _KTermAssertMainThread(KTerm* term, const char* file, int line) {
 
 
 
-void KTerm_DispatchSequence(KTerm* term, KTermSession* session, VTParseState type) {
-    // Ensure buffer is null-terminated
-    if (session->escape_pos < MAX_COMMAND_BUFFER) {
-        session->escape_buffer[session->escape_pos] = '\0';
-    } else {
-        session->escape_buffer[MAX_COMMAND_BUFFER - 1] = '\0';
+// =============================================================================
+// PERFORMANCE COUNTERS
+// =============================================================================
+
+// Monotonic nanoseconds for latencies, trace spans and replay pacing: a wall-clock
+// step (NTP, manual change) must not show up as a negative or huge interval
+static uint64_t KTerm_StatsNow(void) {
+    struct timespec ts;
+#if defined(CLOCK_MONOTONIC)
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+#else
+    timespec_get(&ts, TIME_UTC); // No monotonic clock in <time.h> here
+#endif
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static void KTerm_StatsRecord(KTermLatencyHistogram* h, uint64_t ns) {
+    uint64_t us = ns / 1000;
+    int bucket = 0;
+    while (us && bucket < KTERM_STATS_HIST_BUCKETS - 1) { us >>= 1; bucket++; }
+    h->buckets[bucket]++;
+    h->count++;
+    h->total_ns += ns;
+    if (ns > h->max_ns) h->max_ns = ns;
+}
+
+#ifdef KTERM_ENABLE_TRACE
+uint64_t KTerm_TraceClock(KTerm* term) {
+    if (!term || !atomic_load_explicit(&term->tracer.active, memory_order_relaxed)) return 0;
+    return KTerm_StatsNow();
+}
+
+// The calling thread's ring, claimed on its first event. Lock-free: slots are
+// claimed with one atomic increment and published with a release store.
+static KTermTraceRing* KTerm_TraceRing(KTermTracer* tracer) {
+    kterm_thread_t self = KTERM_THREAD_CURRENT();
+    int count = atomic_load_explicit(&tracer->ring_count, memory_order_acquire);
+    if (count > KTERM_TRACE_MAX_THREADS) count = KTERM_TRACE_MAX_THREADS;
+    for (int i = 0; i < count; i++) {
+        KTermTraceRing* ring = &tracer->rings[i];
+        if (atomic_load_explicit(&ring->ready, memory_order_acquire) && KTERM_THREAD_EQUAL(ring->thread, self)) return ring;
+    }
+
+    int index = atomic_fetch_add_explicit(&tracer->ring_count, 1, memory_order_acq_rel);
+    if (index >= KTERM_TRACE_MAX_THREADS) return NULL;
+    KTermTraceRing* ring = &tracer->rings[index];
+    ring->events = (KTermTraceEvent*)KTerm_Malloc(KTERM_TRACE_RING_SIZE * sizeof(KTermTraceEvent));
+    if (!ring->events) return NULL;
+    ring->thread = self;
+    atomic_store_explicit(&ring->ready, true, memory_order_release);
+    return ring;
+}
+
+void KTerm_TraceSpan(KTerm* term, const char* name, uint64_t start) {
+    if (start == 0 || !atomic_load_explicit(&term->tracer.active, memory_order_relaxed)) return;
+    uint64_t end = KTerm_StatsNow();
+    KTermTraceRing* ring = KTerm_TraceRing(&term->tracer);
+    if (!ring) return;
+
+    unsigned head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    unsigned tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    if (head - tail >= KTERM_TRACE_RING_SIZE) {
+        atomic_fetch_add_explicit(&ring->dropped, 1, memory_order_relaxed);
+        return;
     }
+    KTermTraceEvent* e = &ring->events[head & (KTERM_TRACE_RING_SIZE - 1)];
+    e->name = name;
+    e->start_ns = start;
+    e->dur_ns = end - start;
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+}
 
-    switch (type) {
-        case PARSE_OSC: KTerm_ExecuteOSCCommand(term, session); break;
-        case PARSE_DCS: KTerm_ExecuteDCSCommand(term, session); break;
+// Event lines are formatted by hand: fprintf with %f costs more than the rest of a span
+static char* KTerm_TraceAppend(char* p, const char* s) {
+    size_t n = strlen(s);
+    if (n > 96) n = 96; // Names are short literals; keep the line buffer safe
+    memcpy(p, s, n);
+    return p + n;
+}
+
+static char* KTerm_TraceAppendUInt(char* p, uint64_t v) {
+    char digits[24];
+    int n = 0;
+    do { digits[n++] = (char)('0' + v % 10); v /= 10; } while (v);
+    while (n) *p++ = digits[--n];
+    return p;
+}
+
+// Nanoseconds as microseconds with three decimals; whole microseconds print without them
+static char* KTerm_TraceAppendMicros(char* p, uint64_t ns) {
+    p = KTerm_TraceAppendUInt(p, ns / 1000);
+    unsigned frac = (unsigned)(ns % 1000);
+    if (frac) {
+        *p++ = '.';
+        *p++ = (char)('0' + frac / 100);
+        *p++ = (char)('0' + frac / 10 % 10);
+        *p++ = (char)('0' + frac % 10);
+    }
+    return p;
+}
+
+bool KTerm_TraceStart(KTerm* term, const char* path) {
+    if (!term || !path) return false;
+    KTerm_TraceStop(term);
+    KTermTracer* tracer = &term->tracer;
+    tracer->file = fopen(path, "w");
+    if (!tracer->file) {
+        KTerm_ReportError(term, KTERM_LOG_ERROR, KTERM_SOURCE_SYSTEM, "Cannot open trace file %s", path);
+        return false;
+    }
+    setvbuf(tracer->file, NULL, _IOFBF, 1 << 16);
+    fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", tracer->file);
+    tracer->wrote_event = false;
+    tracer->origin_ns = KTerm_StatsNow();
+
+    // Events left over from an earlier trace are discarded
+    int count = atomic_load_explicit(&tracer->ring_count, memory_order_acquire);
+    if (count > KTERM_TRACE_MAX_THREADS) count = KTERM_TRACE_MAX_THREADS;
+    for (int i = 0; i < count; i++) {
+        KTermTraceRing* ring = &tracer->rings[i];
+        atomic_store_explicit(&ring->tail, atomic_load_explicit(&ring->head, memory_order_acquire), memory_order_release);
+        atomic_store_explicit(&ring->dropped, 0, memory_order_relaxed);
+    }
+    atomic_store_explicit(&tracer->active, true, memory_order_release);
+    return true;
+}
+
+void KTerm_TraceFlush(KTerm* term) {
+    KTermTracer* tracer = &term->tracer;
+    if (!tracer->file) return;
+    int count = atomic_load_explicit(&tracer->ring_count, memory_order_acquire);
+    if (count > KTERM_TRACE_MAX_THREADS) count = KTERM_TRACE_MAX_THREADS;
+    for (int i = 0; i < count; i++) {
+        KTermTraceRing* ring = &tracer->rings[i];
+        if (!atomic_load_explicit(&ring->ready, memory_order_acquire)) continue;
+        unsigned head = atomic_load_explicit(&ring->head, memory_order_acquire);
+        unsigned tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+        for (; tail != head; tail++) {
+            KTermTraceEvent* e = &ring->events[tail & (KTERM_TRACE_RING_SIZE - 1)];
+            if (e->start_ns < tracer->origin_ns) continue; // Began before KTerm_TraceStart
+            char line[256];
+            char* p = line;
+            if (tracer->wrote_event) { *p++ = ','; *p++ = '\n'; }
+            p = KTerm_TraceAppend(p, "{\"name\":\"");
+            p = KTerm_TraceAppend(p, e->name);
+            p = KTerm_TraceAppend(p, "\",\"cat\":\"kterm\",\"ph\":\"X\",\"pid\":1,\"tid\":");
+            p = KTerm_TraceAppendUInt(p, (uint64_t)i);
+            p = KTerm_TraceAppend(p, ",\"ts\":");
+            p = KTerm_TraceAppendMicros(p, e->start_ns - tracer->origin_ns);
+            p = KTerm_TraceAppend(p, ",\"dur\":");
+            p = KTerm_TraceAppendMicros(p, e->dur_ns);
+            *p++ = '}';
+            fwrite(line, 1, (size_t)(p - line), tracer->file);
+            tracer->wrote_event = true;
+        }
+        atomic_store_explicit(&ring->tail, tail, memory_order_release);
+    }
+}
+
+void KTerm_TraceStop(KTerm* term) {
+    if (!term) return;
+    KTermTracer* tracer = &term->tracer;
+    atomic_store_explicit(&tracer->active, false, memory_order_release);
+    if (!tracer->file) return;
+    KTerm_TraceFlush(term);
+
+    // Name the threads, and record dropped events so a gap is not mistaken for idle time
+    int count = atomic_load_explicit(&tracer->ring_count, memory_order_acquire);
+    if (count > KTERM_TRACE_MAX_THREADS) count = KTERM_TRACE_MAX_THREADS;
+    for (int i = 0; i < count; i++) {
+        KTermTraceRing* ring = &tracer->rings[i];
+        if (!atomic_load_explicit(&ring->ready, memory_order_acquire)) continue;
+        fprintf(tracer->file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"kterm-%d\",\"dropped\":%u}}",
+                tracer->wrote_event ? ",\n" : "", i, i, atomic_load_explicit(&ring->dropped, memory_order_relaxed));
+        tracer->wrote_event = true;
+    }
+    fputs("\n]}\n", tracer->file);
+    fclose(tracer->file);
+    tracer->file = NULL;
+}
+#endif
+
+static inline void KTerm_StatsCountUpload(KTerm* term, size_t bytes) {
+    if (!KTERM_STATS_ENABLED(term)) return;
+    // The logic thread uploads the atlas and images, KTerm_Draw the rest
+    atomic_fetch_add_explicit(&term->stats_uploaded, (uint_fast64_t)bytes, memory_order_relaxed);
+    atomic_fetch_add_explicit(&term->stats_frame_uploaded, (uint_fast64_t)bytes, memory_order_relaxed);
+}
+
+static inline void KTerm_StatsCountSequence(KTerm* term, KTermSession* session, KTermStatSeqType type) {
+    if (!KTERM_STATS_ENABLED(term)) return;
+    session->stats.sequences[type]++;
+    term->stats_frame.sequences++;
+}
+
+void KTerm_DispatchSequence(KTerm* term, KTermSession* session, VTParseState type) {
+    // Ensure buffer is null-terminated
+    if (session->escape_pos < MAX_COMMAND_BUFFER) {
+        session->escape_buffer[session->escape_pos] = '\0';
+    } else {
+        session->escape_buffer[MAX_COMMAND_BUFFER - 1] = '\0';
+    }
+
+    if (KTERM_STATS_ENABLED(term)) {
+        switch (type) {
+            case PARSE_OSC:   KTerm_StatsCountSequence(term, session, KTERM_STAT_SEQ_OSC); break;
+            case PARSE_DCS:   KTerm_StatsCountSequence(term, session, KTERM_STAT_SEQ_DCS); break;
+            case PARSE_APC:   KTerm_StatsCountSequence(term, session, KTERM_STAT_SEQ_APC); break;
+            case PARSE_PM:    KTerm_StatsCountSequence(term, session, KTERM_STAT_SEQ_PM); break;
+            case PARSE_SOS:   KTerm_StatsCountSequence(term, session, KTERM_STAT_SEQ_SOS); break;
+            case PARSE_KITTY: KTerm_StatsCountSequence(term, session, KTERM_STAT_SEQ_KITTY); break;
+            default: break;
+        }
+    }
+
+    switch (type) {
+        case PARSE_OSC: KTerm_ExecuteOSCCommand(term, session); break;
+        case PARSE_DCS: KTerm_ExecuteDCSCommand(term, session); break;
         case PARSE_APC: KTerm_ExecuteAPCCommand(term, session); break;
         case PARSE_PM:  KTerm_ExecutePMCommand(term, session); break;
         case PARSE_SOS: KTerm_ExecuteSOSCommand(term, session); break;
         case PARSE_KITTY:
             {
                 KTermSession* target = session;
-                if (term->kitty_target_session >= 0 && term->kitty_target_session < MAX_SESSIONS) {
-                    target = &term->sessions[term->kitty_target_session];
+                if (term->kitty_target_session >= 0 && term->kitty_target_session < term->session_count) {
+                    target = term->sessions[term->kitty_target_session];
                 }
                 KTerm_ExecuteKittyCommand(term, target);
             }
@@ -3301,8 +4196,8 @@ void KTerm_ProcessAPCChar(KTerm* term, KTermSession* session, unsigned char ch)
     if (session->escape_pos == 0 && ch == 'G') {
          // Determine Target
          KTermSession* target_session = session;
-         if (term->kitty_target_session >= 0 && term->kitty_target_session < MAX_SESSIONS) {
-             target_session = &term->sessions[term->kitty_target_session];
+         if (term->kitty_target_session >= 0 && term->kitty_target_session < term->session_count) {
+             target_session = term->sessions[term->kitty_target_session];
          }
 
          session->parse_state = PARSE_KITTY;
@@ -3599,7 +4494,7 @@ void ExecuteDECSCPP(KTerm* term, KTermSession* session) {
         // 2. Resize
         // We use the internal resize function which does not take the lock (caller holds it)
         // We need the session index.
-//         int session_idx = (int)(session - term->sessions);
+//         int session_idx = session->index;
         KTerm_QueueResize(session, cols, session->rows, true);
 
         // 3. Side effects (Clear screen, Home cursor, Reset margins)
@@ -3627,7 +4522,7 @@ void ExecuteDECSCPP(KTerm* term, KTermSession* session) {
                  session->screen_buffer[i] = default_char;
              }
              // Mark all rows dirty
-             for(int r=0; r<session->rows; r++) session->row_dirty[r] = KTERM_DIRTY_FRAMES;
+             for(int r=0; r<session->rows; r++) KTerm_MarkRowDirty(session, r);
         }
     }
 }
@@ -3641,7 +4536,17 @@ void KTerm_ProcessChar(KTerm* term, KTermSession* session, unsigned char ch) {
 
     switch (session->parse_state) {
         case VT_PARSE_NORMAL:              KTerm_ProcessNormalChar(term, session, ch); break;
-        case VT_PARSE_ESCAPE:              KTerm_ProcessEscapeChar(term, session, ch); break;
+        case VT_PARSE_ESCAPE:
+            KTerm_ProcessEscapeChar(term, session, ch);
+            if (KTERM_STATS_ENABLED(term)) {
+                // Sequences that continue as CSI or a string are counted when they finish
+                VTParseState next = session->parse_state;
+                if (next != PARSE_CSI && next != PARSE_OSC && next != PARSE_DCS && next != PARSE_APC &&
+                    next != PARSE_PM && next != PARSE_SOS) {
+                    KTerm_StatsCountSequence(term, session, KTERM_STAT_SEQ_ESC);
+                }
+            }
+            break;
         case PARSE_CSI:                 KTerm_ProcessCSIChar(term, session, ch); break;
         case PARSE_OSC:                 KTerm_ProcessOSCChar(term, session, ch); break;
         case PARSE_DCS:                 KTerm_ProcessDCSChar(term, session, ch); break;
@@ -3650,8 +4555,8 @@ void KTerm_ProcessChar(KTerm* term, KTermSession* session, unsigned char ch) {
         case PARSE_TEKTRONIX:
             {
                 KTermSession* target = session;
-                if (term->tektronix_target_session != -1 && term->tektronix_target_session >= 0 && term->tektronix_target_session < MAX_SESSIONS) {
-                    target = &term->sessions[term->tektronix_target_session];
+                if (term->tektronix_target_session != -1 && term->tektronix_target_session >= 0 && term->tektronix_target_session < term->session_count) {
+                    target = term->sessions[term->tektronix_target_session];
                 }
                 ProcessTektronixChar(term, target, ch);
             }
@@ -3659,8 +4564,8 @@ void KTerm_ProcessChar(KTerm* term, KTermSession* session, unsigned char ch) {
         case PARSE_REGIS:
             {
                 KTermSession* target = session;
-                if (term->regis_target_session != -1 && term->regis_target_session >= 0 && term->regis_target_session < MAX_SESSIONS) {
-                    target = &term->sessions[term->regis_target_session];
+                if (term->regis_target_session != -1 && term->regis_target_session >= 0 && term->regis_target_session < term->session_count) {
+                    target = term->sessions[term->regis_target_session];
                 }
                 ProcessReGISChar(term, target, ch);
             }
@@ -3668,8 +4573,8 @@ void KTerm_ProcessChar(KTerm* term, KTermSession* session, unsigned char ch) {
         case PARSE_KITTY:
             {
                 KTermSession* target = session;
-                if (term->kitty_target_session != -1 && term->kitty_target_session >= 0 && term->kitty_target_session < MAX_SESSIONS) {
-                    target = &term->sessions[term->kitty_target_session];
+                if (term->kitty_target_session != -1 && term->kitty_target_session >= 0 && term->kitty_target_session < term->session_count) {
+                    target = term->sessions[term->kitty_target_session];
                 }
                 KTerm_ProcessKittyChar(term, target, ch);
             }
@@ -4068,17 +4973,98 @@ void ExecuteDECRARA(KTerm* term, KTermSession* session) {
                 KTerm_ApplyAttributeToCell(term, cell, param, &i, true);
             }
         }
-        session->row_dirty[y] = KTERM_DIRTY_FRAMES;
+        KTerm_MarkRowDirty(session, y);
     }
 #endif
 }
 
 
-static unsigned int KTerm_CalculateRectChecksum(KTerm* term, int top, int left, int bottom, int right) {
+// =============================================================================
+// ROW CHECKSUMS
+// =============================================================================
+// Checksums are kept per viewport row and summed again only after
+// KTerm_MarkRowDirty, so polling an unchanged screen costs O(rows).
+
+static inline uint64_t KTerm_HashMix(uint64_t h, uint32_t v) {
+    // FNV-1a over 32-bit words
+    h ^= v;
+    return h * 1099511628211ull;
+}
+
+static uint64_t KTerm_HashColor(uint64_t h, const ExtendedKTermColor* c) {
+    h = KTerm_HashMix(h, (uint32_t)c->color_mode);
+    if (c->color_mode == 0) return KTerm_HashMix(h, (uint32_t)c->value.index);
+    if (c->color_mode == 2) return h; // Default: whatever the union still holds is not shown
+    const RGB_KTermColor* rgb = &c->value.rgb;
+    return KTerm_HashMix(h, (uint32_t)rgb->r | ((uint32_t)rgb->g << 8) | ((uint32_t)rgb->b << 16) | ((uint32_t)rgb->a << 24));
+}
+
+static inline uint32_t KTerm_ChecksumColor(const ExtendedKTermColor* c) {
+    return c->color_mode == 0 ? (uint32_t)c->value.index
+                              : ((uint32_t)c->value.rgb.r << 16 | (uint32_t)c->value.rgb.g << 8 | c->value.rgb.b);
+}
+
+static void KTerm_FreeChecksumCache(KTermSession* session) {
+    if (session->row_checksums) KTerm_Free(session->row_checksums);
+    session->row_checksums = NULL;
+    session->checksum_rows = 0;
+    session->checksum_cols = 0;
+}
+
+static void KTerm_SumRow(KTermSession* session, int y, KTermRowChecksum* out) {
+    const EnhancedTermChar* row = GetActiveScreenRow(session, y);
+    uint64_t hash = 14695981039346656037ull;
+    uint64_t dsr_sum = 0;
+    uint32_t ch_sum = 0;
+    for (int x = 0; x < session->cols; x++) {
+        const EnhancedTermChar* cell = &row[x];
+        ch_sum += cell->ch;
+        dsr_sum += (uint64_t)cell->ch + KTerm_ChecksumColor(&cell->fg_color) + KTerm_ChecksumColor(&cell->bg_color);
+        hash = KTerm_HashMix(hash, cell->ch);
+        hash = KTerm_HashColor(hash, &cell->fg_color);
+        hash = KTerm_HashColor(hash, &cell->bg_color);
+        hash = KTerm_HashColor(hash, &cell->ul_color);
+        hash = KTerm_HashColor(hash, &cell->st_color);
+        hash = KTerm_HashMix(hash, cell->flags & ~(uint32_t)KTERM_FLAG_DIRTY);
+    }
+    out->hash = hash;
+    out->dsr_sum = dsr_sum;
+    out->ch_sum = ch_sum;
+    out->valid = true;
+    session->checksum_row_builds++;
+}
+
+// Checksums of viewport row y. Falls back to summing into `scratch` when the
+// cache cannot be allocated.
+static const KTermRowChecksum* KTerm_GetRowChecksum(KTermSession* session, int y, KTermRowChecksum* scratch) {
+    if (session->checksum_rows != session->rows || session->checksum_cols != session->cols) {
+        KTerm_FreeChecksumCache(session);
+        session->row_checksums = (KTermRowChecksum*)KTerm_Calloc(session->rows, sizeof(KTermRowChecksum)); // All invalid
+        if (session->row_checksums) {
+            session->checksum_rows = session->rows;
+            session->checksum_cols = session->cols;
+        }
+    }
+    if (!session->row_checksums) {
+        KTerm_SumRow(session, y, scratch);
+        return scratch;
+    }
+    KTermRowChecksum* rc = &session->row_checksums[y];
+    if (!rc->valid) KTerm_SumRow(session, y, rc);
+    return rc;
+}
+
+static unsigned int KTerm_CalculateRectChecksum(KTermSession* session, int top, int left, int bottom, int right) {
     unsigned int checksum = 0;
+    KTermRowChecksum scratch;
+    bool full_width = (left == 0 && right >= session->cols - 1);
     for (int y = top; y <= bottom; y++) {
+        if (full_width && y < session->rows) {
+            checksum += KTerm_GetRowChecksum(session, y, &scratch)->ch_sum;
+            continue;
+        }
         for (int x = left; x <= right; x++) {
-            EnhancedTermChar* cell = GetActiveScreenCell(GET_SESSION(term), y, x);
+            EnhancedTermChar* cell = GetActiveScreenCell(session, y, x);
             if (cell) {
                 checksum += cell->ch;
             }
@@ -4087,6 +5073,21 @@ static unsigned int KTerm_CalculateRectChecksum(KTerm* term, int top, int left,
     return checksum;
 }
 
+uint64_t KTerm_GetScreenHash(KTerm* term) {
+    if (!term) return 0;
+    KTermSession* session = GET_SESSION(term);
+    KTermRowChecksum scratch;
+    uint64_t h = 14695981039346656037ull;
+    h = KTerm_HashMix(h, (uint32_t)session->cols);
+    h = KTerm_HashMix(h, (uint32_t)session->rows);
+    for (int y = 0; y < session->rows; y++) {
+        uint64_t row = KTerm_GetRowChecksum(session, y, &scratch)->hash;
+        h = KTerm_HashMix(h, (uint32_t)row);
+        h = KTerm_HashMix(h, (uint32_t)(row >> 32));
+    }
+    return h;
+}
+
 void ExecuteDECECR(KTerm* term, KTermSession* session) {
     if (!session) session = GET_SESSION(term); // Enable Checksum Reporting
     // CSI Pt ; Pc z (Enable/Disable Checksum Reporting)
@@ -4127,7 +5128,7 @@ void ExecuteDECRQCRA(KTerm* term, KTermSession* session) {
 
     unsigned int checksum = 0;
     if (top <= bottom && left <= right) {
-        checksum = KTerm_CalculateRectChecksum(term, top, left, bottom, right);
+        checksum = KTerm_CalculateRectChecksum(session, top, left, bottom, right);
     }
 
     // Response: DCS Pid ! ~ Checksum ST
@@ -4245,11 +5246,11 @@ void ExecuteDECSSDT(KTerm* term, KTermSession* session) {
 
     int mode = KTerm_GetCSIParam(term, session, 0, 0);
     if (mode == 0) {
-        KTerm_SetSplitScreen(term, false, 0, 0, 0);
+        KTerm_SetSplitScreenIndices(term, false, 0, 0, 0);
     } else if (mode == 1) {
         // Default split: Center, Session 0 Top, Session 1 Bottom
         // Future: Support parameterized split points
-        KTerm_SetSplitScreen(term, true, term->height / 2, 0, 1);
+        KTerm_SetSplitScreenIndices(term, true, term->height / 2, 0, 1);
     } else {
         if (session->options.debug_sequences) {
             char msg[64];
@@ -4320,7 +5321,7 @@ void ExecuteDECERA(KTerm* term, KTermSession* session) {
         for (int x = left; x <= right; x++) {
             KTerm_ClearCell(term, GetActiveScreenCell(session, y, x));
         }
-        session->row_dirty[y] = KTERM_DIRTY_FRAMES;
+        KTerm_MarkRowDirty(session, y);
     }
 #endif
 }
@@ -4372,7 +5373,7 @@ void ExecuteDECSERA(KTerm* term, KTermSession* session) {
                 KTerm_ClearCell(term, cell);
             }
         }
-        session->row_dirty[y] = KTERM_DIRTY_FRAMES;
+        KTerm_MarkRowDirty(session, y);
     }
 #endif
 }
@@ -4420,8 +5421,8 @@ void KTerm_ProcessDCSChar(KTerm* term, KTermSession* session, unsigned char ch)
             // Sixel Graphics command
             // Determine Target Session
             KTermSession* target_session = session;
-            if (term->sixel_target_session >= 0 && term->sixel_target_session < MAX_SESSIONS) {
-                target_session = &term->sessions[term->sixel_target_session];
+            if (term->sixel_target_session >= 0 && term->sixel_target_session < term->session_count) {
+                target_session = term->sessions[term->sixel_target_session];
             }
 
             KTerm_ParseCSIParams(term, session->escape_buffer, target_session->sixel.params, MAX_ESCAPE_PARAMS);
@@ -4459,6 +5460,9 @@ void KTerm_ProcessDCSChar(KTerm* term, KTermSession* session, unsigned char ch)
             target_session->sixel.logical_start_row = target_session->screen_head;
             target_session->sixel.x = target_session->cursor.x * term->char_width;
             target_session->sixel.y = target_session->cursor.y * term->char_height;
+#ifdef KTERM_ENABLE_TRACE
+            session->sixel.trace_start = KTerm_TraceClock(term);
+#endif
 
             session->parse_state = PARSE_SIXEL;
             session->escape_pos = 0;
@@ -4501,6 +5505,157 @@ void KTerm_ProcessDCSChar(KTerm* term, KTermSession* session, unsigned char ch)
 // ENHANCED FONT SYSTEM WITH UNICODE SUPPORT
 // =============================================================================
 
+// Glyph keys are codepoints, or KTERM_GLYPH_NARROW + codepoint for a wide
+// codepoint squeezed into one cell
+static inline uint32_t KTerm_GlyphKeyCodepoint(uint32_t key) {
+    return (key >= KTERM_GLYPH_NARROW) ? key - KTERM_GLYPH_NARROW : key;
+}
+
+// Wide (CJK, fullwidth) glyphs go to 2-cell pages unless drawn narrow
+static inline int KTerm_GlyphKeyCells(uint32_t key) {
+    return (key < KTERM_GLYPH_NARROW && KTerm_wcwidth(key) == 2) ? 2 : 1;
+}
+
+// Release whatever owns an atlas slot that is about to be reused
+static void KTerm_ReleaseAtlasSlot(KTerm* term, uint32_t slot) {
+    uint32_t owner = term->atlas_to_codepoint[slot];
+    if (owner & KTERM_CLUSTER_SLOT_FLAG) {
+        uint32_t entry = owner & ~KTERM_CLUSTER_SLOT_FLAG;
+        // The table may have been reset since; only clear a live owner
+        if (term->cluster_map && entry < KTERM_CLUSTER_TABLE_SIZE && term->cluster_map[entry].slot == slot) {
+            term->cluster_map[entry].slot = 0;
+        }
+    } else if (owner < 2 * KTERM_GLYPH_NARROW && KTerm_GlyphMapGet(term, owner) == slot) {
+        KTerm_GlyphMapSet(term, owner, 0); // Clear from map
+    }
+    term->atlas_to_codepoint[slot] = 0;
+}
+
+// Append an atlas page below the existing ones. The texture is recreated at the
+// new height by the next full upload. Returns the page index, or -1.
+static int KTerm_AddAtlasPage(KTerm* term, int cells) {
+    int p = term->atlas_page_count;
+    if (p >= term->atlas_max_pages || !term->font_atlas_pixels) return -1;
+
+    uint32_t spp = term->atlas_slots_per_page;
+    size_t page_bytes = (size_t)KTERM_ATLAS_PAGE_ROWS * DEFAULT_CHAR_HEIGHT * term->atlas_width * 4;
+    unsigned char* pixels = (unsigned char*)KTerm_Realloc(term->font_atlas_pixels, page_bytes * (p + 1));
+    if (!pixels) return -1;
+    term->font_atlas_pixels = pixels;
+    memset(pixels + page_bytes * p, 0, page_bytes);
+
+    uint32_t* owners = (uint32_t*)KTerm_Realloc(term->atlas_to_codepoint, (size_t)(p + 1) * spp * sizeof(uint32_t));
+    if (!owners) return -1;
+    term->atlas_to_codepoint = owners;
+    memset(owners + (size_t)p * spp, 0, spp * sizeof(uint32_t));
+
+    memset(&term->atlas_pages[p], 0, sizeof(KTermAtlasPage));
+    term->atlas_pages[p].cells = (uint8_t)cells;
+    term->atlas_page_count = p + 1;
+    term->atlas_height = (uint32_t)(p + 1) * KTERM_ATLAS_PAGE_ROWS * DEFAULT_CHAR_HEIGHT;
+    term->font_atlas_dirty = true; // Texture size changed
+    return p;
+}
+
+// Drop every glyph on a page so it can be refilled. Page 0 keeps the base font.
+// Returns the number of glyphs dropped.
+static uint32_t KTerm_EvictAtlasPage(KTerm* term, int p) {
+    KTermAtlasPage* page = &term->atlas_pages[p];
+    uint32_t first = (uint32_t)p * term->atlas_slots_per_page;
+    uint32_t start = (p == 0) ? 256 : 0;
+    uint32_t dropped = 0;
+    for (uint32_t s = start; s < page->used; s++) {
+        if (term->atlas_to_codepoint[first + s] != 0) {
+            KTerm_ReleaseAtlasSlot(term, first + s);
+            dropped++;
+        }
+    }
+    page->used = start;
+    page->glyphs = 0;
+
+    // Cells on screen may still show the old glyph ids: redraw everything
+    for (int i = 0; i < term->session_count; i++) {
+        KTermSession* session = term->sessions[i];
+        if (!session->row_dirty) continue;
+        for (int y = 0; y < session->rows; y++) KTerm_MarkRowDirty(session, y);
+    }
+    return dropped;
+}
+
+// Pick the page for the next `cells`-wide glyph: a new page while under
+// atlas_max_pages, otherwise the least recently used page, evicted whole.
+static int KTerm_AcquireAtlasPage(KTerm* term, int cells) {
+    int p = KTerm_AddAtlasPage(term, cells);
+    if (p >= 0) return p;
+
+    int victim = -1;
+    for (int i = 0; i < term->atlas_page_count; i++) {
+        if (i == 0 && cells != 1) continue; // Page 0 holds the base font: 1-cell only
+        if (victim < 0 || term->atlas_pages[i].last_used < term->atlas_pages[victim].last_used) victim = i;
+    }
+    if (victim < 0) return -1;
+
+    term->atlas_glyphs_evicted += KTerm_EvictAtlasPage(term, victim);
+    term->atlas_page_evictions++;
+    term->atlas_pages[victim].cells = (uint8_t)cells;
+    for (int c = 0; c < KTERM_GLYPH_MAX_CELLS; c++) {
+        if (term->atlas_fill_page[c] == victim) term->atlas_fill_page[c] = -1;
+    }
+    return victim;
+}
+
+static bool KTerm_AtlasHasRoom(KTerm* term, int cells) {
+    int p = term->atlas_fill_page[cells - 1];
+    if (p >= 0 && term->atlas_pages[p].used + cells <= term->atlas_slots_per_page) return true;
+    return term->atlas_page_count < term->atlas_max_pages;
+}
+
+// Reserve `*cells` adjacent slots on a page of that size class. Falls back to a
+// single cell when no 2-cell page can be had. Returns 0 on failure (slots below
+// 256 are never handed out).
+static uint32_t KTerm_ReserveAtlasSlot(KTerm* term, int* cells) {
+    int c = *cells;
+    int p = term->atlas_fill_page[c - 1];
+    if (p < 0 || term->atlas_pages[p].used + c > term->atlas_slots_per_page) {
+        p = KTerm_AcquireAtlasPage(term, c);
+        if (p < 0) {
+            if (c == 1) return 0;
+            *cells = 1;
+            return KTerm_ReserveAtlasSlot(term, cells);
+        }
+        term->atlas_fill_page[c - 1] = p;
+    }
+
+    KTermAtlasPage* page = &term->atlas_pages[p];
+    uint32_t slot = (uint32_t)p * term->atlas_slots_per_page + page->used;
+    page->used += c;
+    page->glyphs++;
+    page->last_used = term->frame_count;
+    return slot;
+}
+
+// Record a lookup so the page is not the next eviction victim
+static inline void KTerm_TouchGlyph(KTerm* term, uint32_t id) {
+    uint32_t p = id / term->atlas_slots_per_page;
+    if (id >= 256 && p < (uint32_t)term->atlas_page_count) term->atlas_pages[p].last_used = term->frame_count;
+}
+
+// Cells covered by a glyph id: 2 for glyphs on 2-cell pages
+static inline int KTerm_GlyphCells(KTerm* term, uint32_t id) {
+    if (id < 256 || term->atlas_slots_per_page == 0) return 1;
+    uint32_t p = id / term->atlas_slots_per_page;
+    return (p < (uint32_t)term->atlas_page_count) ? term->atlas_pages[p].cells : 1;
+}
+
+// Empty every page (the base font stays). Used when the atlas pixels are rebuilt.
+static void KTerm_ResetAtlasPages(KTerm* term) {
+    if (!term->atlas_to_codepoint) return;
+    for (int p = 0; p < term->atlas_page_count; p++) KTerm_EvictAtlasPage(term, p);
+    term->atlas_pages[0].cells = 1;
+    term->atlas_fill_page[0] = 0;
+    for (int c = 1; c < KTERM_GLYPH_MAX_CELLS; c++) term->atlas_fill_page[c] = -1;
+}
+
 void KTerm_CreateFontTexture(KTerm* term) {
     if (term->font_texture.generation != 0) {
         KTerm_DestroyTexture(&term->font_texture);
@@ -4512,10 +5667,10 @@ void KTerm_CreateFontTexture(KTerm* term) {
     if (!term->font_atlas_pixels) {
         term->font_atlas_pixels = KTerm_Calloc(term->atlas_width * term->atlas_height * 4, 1);
         if (!term->font_atlas_pixels) return;
-        term->next_atlas_index = 256; // Start dynamic allocation after base set
     }
-    // Clear buffer for new layout
-    memset(term->font_atlas_pixels, 0, term->atlas_width * term->atlas_height * 4);
+    // Clear buffer for new layout; dynamic glyphs lose their pixels, so drop them
+    KTerm_ResetAtlasPages(term);
+    memset(term->font_atlas_pixels, 0, (size_t)term->atlas_width * term->atlas_height * 4);
 
     unsigned char* pixels = term->font_atlas_pixels;
 
@@ -4660,8 +5815,8 @@ void KTerm_InitCompute(KTerm* term) {
     term->row_scratch_buffer = (EnhancedTermChar*)KTerm_Calloc(term->width, sizeof(EnhancedTermChar));
 
     // 4. Init Vector Engine (Storage Tube Architecture)
-    term->vector_capacity = 65536; // Max new lines per frame
-    KTerm_CreateBuffer(term->vector_capacity * sizeof(GPUVectorLine), NULL, KTERM_BUFFER_USAGE_STORAGE_BUFFER | KTERM_BUFFER_USAGE_TRANSFER_DST, &term->vector_buffer);
+    term->vector_capacity = 1024; // Grows with the plot
+    KTerm_CreateBuffer(KTERM_VECTOR_BATCH * sizeof(GPUVectorLine), NULL, KTERM_BUFFER_USAGE_STORAGE_BUFFER | KTERM_BUFFER_USAGE_TRANSFER_DST, &term->vector_buffer);
     term->vector_staging_buffer = (GPUVectorLine*)KTerm_Calloc(term->vector_capacity, sizeof(GPUVectorLine));
 
     // Create Persistent Vector Layer Texture (Storage Tube Surface)
@@ -4687,7 +5842,7 @@ void KTerm_InitCompute(KTerm* term) {
             }
             KTerm_Free(shader_body);
         } else {
-             if (term->sessions[0].options.debug_sequences) KTerm_LogUnsupportedSequence(term, "Failed to load vector shader");
+             if (term->sessions[0]->options.debug_sequences) KTerm_LogUnsupportedSequence(term, "Failed to load vector shader");
         }
     }
 
@@ -4709,7 +5864,7 @@ void KTerm_InitCompute(KTerm* term) {
             }
             KTerm_Free(shader_body);
         } else {
-             if (term->sessions[0].options.debug_sequences) KTerm_LogUnsupportedSequence(term, "Failed to load sixel shader");
+             if (term->sessions[0]->options.debug_sequences) KTerm_LogUnsupportedSequence(term, "Failed to load sixel shader");
         }
     }
 
@@ -4786,13 +5941,17 @@ unsigned int TranslateCharacter(KTerm* term, unsigned char ch, CharsetState* sta
     return ch;
 }
 
-// Render a glyph from TTF or fallback
-static void RenderGlyphToAtlas(KTerm* term, uint32_t codepoint, uint32_t idx) {
-    int col = idx % term->atlas_cols;
-    int row = idx / term->atlas_cols;
-    int x_start = col * DEFAULT_CHAR_WIDTH;
-    int y_start = row * DEFAULT_CHAR_HEIGHT;
+// Render a glyph from TTF or fallback into `cells` adjacent RGBA cells. `dst` is
+// the top-left pixel and `stride` the row pitch in bytes. Safe to call from the
+// rasterizer thread: it only reads the font.
+static void KTerm_RasterizeGlyph(KTerm* term, uint32_t codepoint, int cells, unsigned char* dst, int stride) {
     bool rendered = false;
+    int glyph_w = cells * DEFAULT_CHAR_WIDTH;
+
+    // Clear the cells first: they may hold an evicted glyph
+    for (int y = 0; y < DEFAULT_CHAR_HEIGHT; y++) {
+        memset(&dst[y * stride], 0, glyph_w * 4);
+    }
 
     if (term->ttf.loaded) {
         // TTF Rendering
@@ -4802,16 +5961,16 @@ static void RenderGlyphToAtlas(KTerm* term, uint32_t codepoint, uint32_t idx) {
         if (bitmap) {
             for (int y = 0; y < h; y++) {
                 for (int x = 0; x < w; x++) {
-                    int px = x + (DEFAULT_CHAR_WIDTH - w)/2; // Simple center X
+                    int px = x + (glyph_w - w)/2; // Simple center X
                     int py = y + term->ttf.baseline + yoff; // yoff is negative (distance from baseline up)
 
-                    if (px >= 0 && px < DEFAULT_CHAR_WIDTH && py >= 0 && py < DEFAULT_CHAR_HEIGHT) {
+                    if (px >= 0 && px < glyph_w && py >= 0 && py < DEFAULT_CHAR_HEIGHT) {
                         int val = bitmap[y * w + x];
-                        int px_idx = ((y_start + py) * term->atlas_width + (x_start + px)) * 4;
-                        term->font_atlas_pixels[px_idx+0] = 255;
-                        term->font_atlas_pixels[px_idx+1] = 255;
-                        term->font_atlas_pixels[px_idx+2] = 255;
-                        term->font_atlas_pixels[px_idx+3] = val; // Use alpha
+                        int px_idx = py * stride + px * 4;
+                        dst[px_idx+0] = 255;
+                        dst[px_idx+1] = 255;
+                        dst[px_idx+2] = 255;
+                        dst[px_idx+3] = val; // Use alpha
                     }
                 }
             }
@@ -4825,10 +5984,10 @@ static void RenderGlyphToAtlas(KTerm* term, uint32_t codepoint, uint32_t idx) {
         if (codepoint == 0xFFFD) {
             // Draw Replacement Character (Diamond with ?)
             for (int y = 0; y < DEFAULT_CHAR_HEIGHT; y++) {
-                for (int x = 0; x < DEFAULT_CHAR_WIDTH; x++) {
+                for (int x = 0; x < glyph_w; x++) {
                     bool on = false;
                     // Diamond shape: abs(x - center_x) + abs(y - center_y) <= size
-                    int cx = DEFAULT_CHAR_WIDTH / 2;
+                    int cx = glyph_w / 2;
                     int cy = DEFAULT_CHAR_HEIGHT / 2;
                     if (abs(x - cx) + abs(y - cy) <= 3) on = true;
                     // Hollow it out
@@ -4839,28 +5998,60 @@ static void RenderGlyphToAtlas(KTerm* term, uint32_t codepoint, uint32_t idx) {
                     if (y == cy - 1 && x == cx) on = true;
                     if (y == cy - 2 && (x == cx || x == cx + 1)) on = true;
 
-                    int px_idx = ((y_start + y) * term->atlas_width + (x_start + x)) * 4;
+                    int px_idx = y * stride + x * 4;
                     unsigned char val = on ? 255 : 0;
-                    term->font_atlas_pixels[px_idx+0] = val;
-                    term->font_atlas_pixels[px_idx+1] = val;
-                    term->font_atlas_pixels[px_idx+2] = val;
-                    term->font_atlas_pixels[px_idx+3] = val;
+                    dst[px_idx+0] = val;
+                    dst[px_idx+1] = val;
+                    dst[px_idx+2] = val;
+                    dst[px_idx+3] = val;
                 }
             }
         } else {
             // Draw Hex Box (Fallback)
             for (int y = 0; y < DEFAULT_CHAR_HEIGHT; y++) {
-                for (int x = 0; x < DEFAULT_CHAR_WIDTH; x++) {
+                for (int x = 0; x < glyph_w; x++) {
                     bool on = false;
-                    if (x == 0 || x == DEFAULT_CHAR_WIDTH-1 || y == 0 || y == DEFAULT_CHAR_HEIGHT-1) on = true;
-                    if (x == DEFAULT_CHAR_WIDTH/2 && y == DEFAULT_CHAR_HEIGHT/2) on = true; // Dot
+                    if (x == 0 || x == glyph_w-1 || y == 0 || y == DEFAULT_CHAR_HEIGHT-1) on = true;
+                    if (x == glyph_w/2 && y == DEFAULT_CHAR_HEIGHT/2) on = true; // Dot
 
-                    int px_idx = ((y_start + y) * term->atlas_width + (x_start + x)) * 4;
+                    int px_idx = y * stride + x * 4;
                     unsigned char val = on ? 255 : 0;
-                    term->font_atlas_pixels[px_idx+0] = val;
-                    term->font_atlas_pixels[px_idx+1] = val;
-                    term->font_atlas_pixels[px_idx+2] = val;
-                    term->font_atlas_pixels[px_idx+3] = val;
+                    dst[px_idx+0] = val;
+                    dst[px_idx+1] = val;
+                    dst[px_idx+2] = val;
+                    dst[px_idx+3] = val;
+                }
+            }
+        }
+    }
+}
+
+static unsigned char* KTerm_AtlasSlotPixels(KTerm* term, uint32_t idx) {
+    int col = idx % term->atlas_cols;
+    int row = idx / term->atlas_cols;
+    return &term->font_atlas_pixels[((size_t)row * DEFAULT_CHAR_HEIGHT * term->atlas_width + (size_t)col * DEFAULT_CHAR_WIDTH) * 4];
+}
+
+static void RenderGlyphToAtlas(KTerm* term, uint32_t codepoint, uint32_t idx, int cells) {
+    if (!term->font_atlas_pixels) return;
+    KTerm_RasterizeGlyph(term, codepoint, cells, KTerm_AtlasSlotPixels(term, idx), term->atlas_width * 4);
+}
+
+// Draw each mark of a cluster the font has over `dst`, merged by max alpha.
+// Reads the font: the caller holds glyph_raster.font_lock.
+static void KTerm_ComposeClusterMarks(KTerm* term, const uint32_t* codepoints, int count, int cells, unsigned char* dst, int stride) {
+    if (!term->ttf.loaded) return;
+    int glyph_w = cells * DEFAULT_CHAR_WIDTH;
+    unsigned char mark[KTERM_GLYPH_MAX_CELLS * DEFAULT_CHAR_WIDTH * DEFAULT_CHAR_HEIGHT * 4];
+    for (int i = 1; i < count; i++) {
+        if (stbtt_FindGlyphIndex(&term->ttf.info, (int)codepoints[i]) == 0) continue;
+        KTerm_RasterizeGlyph(term, codepoints[i], cells, mark, glyph_w * 4);
+        for (int y = 0; y < DEFAULT_CHAR_HEIGHT; y++) {
+            for (int x = 0; x < glyph_w; x++) {
+                unsigned char* m = &mark[(y * glyph_w + x) * 4];
+                unsigned char* d = &dst[y * stride + x * 4];
+                if (m[3] > d[3]) {
+                    d[0] = m[0]; d[1] = m[1]; d[2] = m[2]; d[3] = m[3];
                 }
             }
         }
@@ -4875,10 +6066,15 @@ void KTerm_LoadFont(KTerm* term, const char* filepath) {
         return;
     }
 
+    // The background rasterizer reads the font; keep it out while we swap
+    KTERM_MUTEX_LOCK(term->glyph_raster.font_lock);
+    term->ttf.loaded = false;
     if (term->ttf.file_buffer) KTERM_FREE(term->ttf.file_buffer);
     term->ttf.file_buffer = buffer;
+    term->ttf.file_size = size;
 
     if (!stbtt_InitFont(&term->ttf.info, buffer, 0)) {
+        KTERM_MUTEX_UNLOCK(term->glyph_raster.font_lock);
         KTerm_ReportError(term, KTERM_LOG_ERROR, KTERM_SOURCE_SYSTEM, "Failed to init TrueType font: %s", filepath);
         return;
     }
@@ -4892,6 +6088,431 @@ void KTerm_LoadFont(KTerm* term, const char* filepath) {
     term->ttf.baseline = (int)(term->ttf.ascent * term->ttf.scale) + y_adjust;
 
     term->ttf.loaded = true;
+    KTERM_MUTEX_UNLOCK(term->glyph_raster.font_lock);
+}
+
+// Queue a single atlas slot for a sub-rectangle upload. Too many pending slots
+// degrade to a full upload, which is cheaper than hundreds of tiny copies.
+static void KTerm_MarkAtlasSlotDirty(KTerm* term, uint32_t idx) {
+    if (term->font_atlas_dirty) return; // Full upload already pending
+    if (term->atlas_dirty_count >= KTERM_ATLAS_DIRTY_SLOTS) {
+        term->font_atlas_dirty = true;
+        term->atlas_dirty_count = 0;
+        return;
+    }
+    term->atlas_dirty_slots[term->atlas_dirty_count++] = idx;
+}
+
+static kterm_thread_result_t KTerm_GlyphRasterWorker(void* arg) {
+    KTerm* term = (KTerm*)arg;
+    KTermGlyphRaster* gr = &term->glyph_raster;
+    KTermGlyphResult result;
+
+    KTERM_MUTEX_LOCK(gr->lock);
+    while (true) {
+        while (!gr->stop && gr->job_count == 0) KTERM_COND_WAIT(gr->wake, gr->lock);
+        if (gr->stop) break;
+
+        KTermGlyphJob job = gr->jobs[gr->job_head];
+        gr->job_head = (gr->job_head + 1) % KTERM_GLYPH_RASTER_QUEUE;
+        gr->job_count--;
+        gr->busy++;
+        KTERM_MUTEX_UNLOCK(gr->lock);
+
+        result.job = job;
+        int stride = job.cells * DEFAULT_CHAR_WIDTH * 4;
+        KTERM_TRACE_BEGIN(term, trace_glyph);
+        KTERM_MUTEX_LOCK(gr->font_lock);
+        if (job.merge) {
+            memset(result.pixels, 0, (size_t)stride * DEFAULT_CHAR_HEIGHT);
+        } else {
+            KTerm_RasterizeGlyph(term, job.count > 1 ? job.codepoints[0] : KTerm_GlyphKeyCodepoint(job.codepoint), job.cells, result.pixels, stride);
+        }
+        if (job.count > 1) KTerm_ComposeClusterMarks(term, job.codepoints, job.count, job.cells, result.pixels, stride);
+        KTERM_MUTEX_UNLOCK(gr->font_lock);
+        KTERM_TRACE_END(term, trace_glyph, "RasterizeGlyph");
+
+        KTERM_MUTEX_LOCK(gr->lock);
+        gr->results[gr->result_count++] = result; // Never overflows: enqueue bounds jobs + busy + results
+        gr->busy--;
+        if (gr->job_count == 0 && gr->busy == 0) KTERM_COND_SIGNAL(gr->idle);
+    }
+    KTERM_MUTEX_UNLOCK(gr->lock);
+    return KTERM_THREAD_RESULT_OK;
+}
+
+// Hand a slot to the worker. Returns false when the queue is full so the caller
+// can render inline instead.
+static bool KTerm_QueueGlyphRaster(KTerm* term, const KTermGlyphJob* job) {
+    KTermGlyphRaster* gr = &term->glyph_raster;
+    bool queued = false;
+    KTERM_MUTEX_LOCK(gr->lock);
+    if (gr->job_count + gr->busy + gr->result_count < KTERM_GLYPH_RASTER_QUEUE) {
+        int tail = (gr->job_head + gr->job_count) % KTERM_GLYPH_RASTER_QUEUE;
+        gr->jobs[tail] = *job;
+        gr->job_count++;
+        KTERM_COND_SIGNAL(gr->wake);
+        queued = true;
+    }
+    KTERM_MUTEX_UNLOCK(gr->lock);
+    return queued;
+}
+
+// Copy finished glyphs into the atlas (logic thread). Results whose slot was
+// evicted and reassigned in the meantime are dropped.
+static bool KTerm_GlyphResultLive(KTerm* term, const KTermGlyphJob* job) {
+    if (term->atlas_to_codepoint[job->slot] != job->codepoint) return false;
+    if (job->count <= 1) return KTerm_GlyphMapGet(term, job->codepoint) == job->slot;
+    KTermClusterEntry* e = &term->cluster_map[job->codepoint & ~KTERM_CLUSTER_SLOT_FLAG];
+    return e->slot == job->slot && e->hash == job->hash && e->count == job->count;
+}
+
+static void KTerm_CommitRasterizedGlyphs(KTerm* term) {
+    KTermGlyphRaster* gr = &term->glyph_raster;
+    if (!gr->results) return;
+
+    KTERM_MUTEX_LOCK(gr->lock);
+    for (int i = 0; i < gr->result_count; i++) {
+        KTermGlyphJob* job = &gr->results[i].job;
+        unsigned char* pixels = gr->results[i].pixels;
+        if (!term->font_atlas_pixels || !KTerm_GlyphResultLive(term, job)) continue;
+
+        unsigned char* dst = KTerm_AtlasSlotPixels(term, job->slot);
+        int row_bytes = job->cells * DEFAULT_CHAR_WIDTH * 4;
+        for (int y = 0; y < DEFAULT_CHAR_HEIGHT; y++) {
+            unsigned char* d = &dst[(size_t)y * term->atlas_width * 4];
+            const unsigned char* s = &pixels[y * row_bytes];
+            if (!job->merge) {
+                memcpy(d, s, row_bytes);
+                continue;
+            }
+            // Marks over the bitmap base, as KTerm_ComposeClusterMarks would
+            for (int x = 0; x < row_bytes; x += 4) {
+                if (s[x + 3] > d[x + 3]) memcpy(&d[x], &s[x], 4);
+            }
+        }
+        for (int c = 0; c < job->cells; c++) KTerm_MarkAtlasSlotDirty(term, job->slot + c);
+    }
+    gr->result_count = 0;
+    KTERM_MUTEX_UNLOCK(gr->lock);
+}
+
+// Fill freshly (re)assigned atlas slots, on the worker if it is running
+static void KTerm_FillGlyphSlot(KTerm* term, uint32_t codepoint, uint32_t idx, int cells) {
+    KTermGlyphJob job = { .codepoint = codepoint, .slot = idx, .cells = cells, .count = 1 };
+    if (term->glyph_raster.running && term->font_atlas_pixels && KTerm_QueueGlyphRaster(term, &job)) {
+        // Placeholder: blank until the worker result is committed
+        unsigned char* dst = KTerm_AtlasSlotPixels(term, idx);
+        for (int y = 0; y < DEFAULT_CHAR_HEIGHT; y++) {
+            memset(&dst[(size_t)y * term->atlas_width * 4], 0, cells * DEFAULT_CHAR_WIDTH * 4);
+        }
+    } else {
+        KTERM_MUTEX_LOCK(term->glyph_raster.font_lock);
+        RenderGlyphToAtlas(term, KTerm_GlyphKeyCodepoint(codepoint), idx, cells);
+        KTERM_MUTEX_UNLOCK(term->glyph_raster.font_lock);
+    }
+    for (int c = 0; c < cells; c++) KTerm_MarkAtlasSlotDirty(term, idx + c);
+}
+
+void KTerm_FlushGlyphRaster(KTerm* term) {
+    KTermGlyphRaster* gr = &term->glyph_raster;
+    if (gr->running) {
+        KTERM_MUTEX_LOCK(gr->lock);
+        while (gr->job_count > 0 || gr->busy > 0) KTERM_COND_WAIT(gr->idle, gr->lock);
+        KTERM_MUTEX_UNLOCK(gr->lock);
+    }
+    KTerm_CommitRasterizedGlyphs(term);
+}
+
+bool KTerm_SetAsyncGlyphRaster(KTerm* term, bool enable) {
+    KTermGlyphRaster* gr = &term->glyph_raster;
+    if (enable == gr->running) return gr->running;
+
+    if (enable) {
+        if (!gr->jobs) gr->jobs = (KTermGlyphJob*)KTerm_Calloc(KTERM_GLYPH_RASTER_QUEUE, sizeof(KTermGlyphJob));
+        if (!gr->results) gr->results = (KTermGlyphResult*)KTerm_Calloc(KTERM_GLYPH_RASTER_QUEUE, sizeof(KTermGlyphResult));
+        if (!gr->jobs || !gr->results) return false;
+        gr->job_head = 0;
+        gr->job_count = 0;
+        gr->busy = 0;
+        gr->stop = false;
+        if (!KTERM_THREAD_CREATE(gr->thread, KTerm_GlyphRasterWorker, term)) {
+            KTerm_ReportError(term, KTERM_LOG_WARNING, KTERM_SOURCE_SYSTEM, "Failed to start glyph rasterizer thread; rendering glyphs inline");
+            return false;
+        }
+        gr->running = true;
+        return true;
+    }
+
+    // Drain first so no reserved slot is left blank
+    KTerm_FlushGlyphRaster(term);
+    KTERM_MUTEX_LOCK(gr->lock);
+    gr->stop = true;
+    KTERM_COND_SIGNAL(gr->wake);
+    KTERM_MUTEX_UNLOCK(gr->lock);
+    KTERM_THREAD_JOIN(gr->thread);
+    gr->running = false;
+    return false;
+}
+
+int KTerm_PrewarmGlyphs(KTerm* term, uint32_t first, uint32_t last) {
+    if (!term->glyph_map || first > last) return 0;
+    if (last >= 0x110000) last = 0x10FFFF;
+
+    // Only fill free slots and new pages: prewarming must not evict glyphs already on screen
+    int reserved = 0;
+    for (uint32_t cp = first; cp <= last; cp++) {
+        if (KTerm_GlyphMapGet(term, cp) != 0) continue;
+        if (!KTerm_AtlasHasRoom(term, (KTerm_wcwidth(cp) == 2) ? 2 : 1)) continue;
+        if (term->ttf.loaded && stbtt_FindGlyphIndex(&term->ttf.info, (int)cp) == 0) continue; // Not in the font
+        KTerm_AllocateGlyph(term, cp);
+        reserved++;
+    }
+    return reserved;
+}
+
+// On-disk glyph cache layout: header, one KTermGlyphCachePage per atlas page,
+// the slot owners (atlas_to_codepoint) of each page's used slots, base font
+// metrics, then the used pixel rows of each page.
+typedef struct {
+    char magic[4];          // "KTGC"
+    uint32_t version;       // KTERM_GLYPH_CACHE_VERSION
+    uint64_t font_hash;     // KTerm_GlyphCacheKey
+    uint32_t cell_width;
+    uint32_t cell_height;
+    uint32_t atlas_width;
+    uint32_t atlas_cols;
+    uint32_t page_rows;     // Slot rows per page
+    uint32_t page_count;    // Pages stored
+    uint32_t glyph_count;   // Slot owners stored (sum of page `used`)
+    uint32_t pixel_rows;    // Atlas pixel rows stored (sum over pages)
+} KTermGlyphCacheHeader;
+
+typedef struct {
+    uint32_t cells;         // Size class
+    uint32_t used;          // Slots in use, page-relative
+} KTermGlyphCachePage;
+
+static uint32_t KTerm_GlyphCachePageRows(KTerm* term, uint32_t used) {
+    return ((used + term->atlas_cols - 1) / term->atlas_cols) * DEFAULT_CHAR_HEIGHT;
+}
+
+static uint64_t KTerm_HashBytes(uint64_t h, const void* data, size_t len) {
+    const unsigned char* p = (const unsigned char*)data;
+    for (size_t i = 0; i < len; i++) {
+        h ^= p[i];
+        h *= 1099511628211ULL; // FNV-1a
+    }
+    return h;
+}
+
+static uint64_t KTerm_GlyphCacheKey(KTerm* term) {
+    uint64_t h = 14695981039346656037ULL;
+    if (term->ttf.loaded && term->ttf.file_buffer) {
+        h = KTerm_HashBytes(h, term->ttf.file_buffer, term->ttf.file_size);
+        h = KTerm_HashBytes(h, &term->ttf.scale, sizeof(term->ttf.scale));
+    }
+    if (term->current_font_data) {
+        size_t bytes = 256 * (size_t)term->font_data_height * (term->current_font_is_16bit ? 2 : 1);
+        h = KTerm_HashBytes(h, term->current_font_data, bytes);
+    }
+    int32_t geometry[4] = { term->char_width, term->char_height, term->font_data_width, term->font_data_height };
+    return KTerm_HashBytes(h, geometry, sizeof(geometry));
+}
+
+static void KTerm_FillGlyphCacheHeader(KTerm* term, KTermGlyphCacheHeader* hdr) {
+    memset(hdr, 0, sizeof(*hdr));
+    memcpy(hdr->magic, "KTGC", 4);
+    hdr->version = KTERM_GLYPH_CACHE_VERSION;
+    hdr->font_hash = KTerm_GlyphCacheKey(term);
+    hdr->cell_width = DEFAULT_CHAR_WIDTH;
+    hdr->cell_height = DEFAULT_CHAR_HEIGHT;
+    hdr->atlas_width = term->atlas_width;
+    hdr->atlas_cols = term->atlas_cols;
+    hdr->page_rows = KTERM_ATLAS_PAGE_ROWS;
+}
+
+bool KTerm_SaveGlyphCache(KTerm* term, const char* path) {
+    if (!term->font_atlas_pixels || !term->atlas_to_codepoint || !path) return false;
+    if (GET_SESSION(term)->soft_font.active) return false; // Soft fonts are per-session, never cached
+
+    KTerm_FlushGlyphRaster(term);
+
+    KTermGlyphCacheHeader hdr;
+    KTerm_FillGlyphCacheHeader(term, &hdr);
+    KTermGlyphCachePage pages[KTERM_ATLAS_MAX_PAGES];
+    hdr.page_count = (uint32_t)term->atlas_page_count;
+    for (uint32_t p = 0; p < hdr.page_count; p++) {
+        pages[p].cells = term->atlas_pages[p].cells;
+        pages[p].used = term->atlas_pages[p].used;
+        hdr.glyph_count += pages[p].used;
+        hdr.pixel_rows += KTerm_GlyphCachePageRows(term, pages[p].used);
+    }
+
+    FILE* f = fopen(path, "wb");
+    if (!f) {
+        KTerm_ReportError(term, KTERM_LOG_WARNING, KTERM_SOURCE_SYSTEM, "Cannot write glyph cache: %s", path);
+        return false;
+    }
+    size_t page_bytes = (size_t)KTERM_ATLAS_PAGE_ROWS * DEFAULT_CHAR_HEIGHT * term->atlas_width * 4;
+    bool ok = fwrite(&hdr, sizeof(hdr), 1, f) == 1;
+    if (ok) ok = fwrite(pages, sizeof(KTermGlyphCachePage), hdr.page_count, f) == hdr.page_count;
+    for (uint32_t p = 0; ok && p < hdr.page_count; p++) {
+        if (pages[p].used == 0) continue;
+        ok = fwrite(&term->atlas_to_codepoint[p * term->atlas_slots_per_page], sizeof(uint32_t), pages[p].used, f) == pages[p].used;
+    }
+    if (ok) ok = fwrite(term->font_metrics, sizeof(term->font_metrics), 1, f) == 1;
+    for (uint32_t p = 0; ok && p < hdr.page_count; p++) {
+        uint32_t rows = KTerm_GlyphCachePageRows(term, pages[p].used);
+        if (rows == 0) continue;
+        ok = fwrite(term->font_atlas_pixels + p * page_bytes, (size_t)rows * term->atlas_width * 4, 1, f) == 1;
+    }
+    if (fclose(f) != 0) ok = false;
+    if (!ok) remove(path); // Never leave a truncated cache behind
+    return ok;
+}
+
+// Validate `data` as a cache for the current font and install it
+static bool KTerm_ApplyGlyphCache(KTerm* term, const unsigned char* data, size_t size) {
+    KTermGlyphCacheHeader expect;
+    KTerm_FillGlyphCacheHeader(term, &expect);
+    if (size < sizeof(KTermGlyphCacheHeader)) return false;
+
+    KTermGlyphCacheHeader hdr;
+    memcpy(&hdr, data, sizeof(hdr));
+    if (memcmp(hdr.magic, expect.magic, 4) != 0 || hdr.version != expect.version ||
+        hdr.font_hash != expect.font_hash ||
+        hdr.cell_width != expect.cell_width || hdr.cell_height != expect.cell_height ||
+        hdr.atlas_width != expect.atlas_width || hdr.atlas_cols != expect.atlas_cols ||
+        hdr.page_rows != expect.page_rows ||
+        hdr.page_count == 0 || hdr.page_count > (uint32_t)term->atlas_max_pages) {
+        return false;
+    }
+
+    // Validate the page table against the header and the file size
+    KTermGlyphCachePage pages[KTERM_ATLAS_MAX_PAGES];
+    size_t page_table_bytes = hdr.page_count * sizeof(KTermGlyphCachePage);
+    if (size < sizeof(hdr) + page_table_bytes) return false;
+    memcpy(pages, data + sizeof(hdr), page_table_bytes);
+    uint32_t glyph_count = 0, pixel_rows = 0;
+    for (uint32_t p = 0; p < hdr.page_count; p++) {
+        if (pages[p].cells < 1 || pages[p].cells > KTERM_GLYPH_MAX_CELLS || pages[p].used > term->atlas_slots_per_page) return false;
+        if (p == 0 && (pages[p].cells != 1 || pages[p].used < 256)) return false;
+        glyph_count += pages[p].used;
+        pixel_rows += KTerm_GlyphCachePageRows(term, pages[p].used);
+    }
+    if (glyph_count != hdr.glyph_count || pixel_rows != hdr.pixel_rows) return false;
+    size_t codepoint_bytes = (size_t)hdr.glyph_count * sizeof(uint32_t);
+    size_t pixel_bytes = (size_t)hdr.pixel_rows * term->atlas_width * 4;
+    if (size != sizeof(hdr) + page_table_bytes + codepoint_bytes + sizeof(term->font_metrics) + pixel_bytes) return false;
+
+    while (term->atlas_page_count < (int)hdr.page_count) {
+        if (KTerm_AddAtlasPage(term, 1) < 0) return false;
+    }
+
+    const unsigned char* p = data + sizeof(hdr) + page_table_bytes;
+    const unsigned char* codepoints = p;
+    p += codepoint_bytes;
+    const unsigned char* metrics = p;
+    p += sizeof(term->font_metrics);
+
+    // Drop current dynamic glyphs, then adopt the cached ones
+    KTerm_ResetAtlasPages(term);
+    uint32_t spp = term->atlas_slots_per_page;
+    size_t page_bytes = (size_t)KTERM_ATLAS_PAGE_ROWS * DEFAULT_CHAR_HEIGHT * term->atlas_width * 4;
+    for (uint32_t pg = 0; pg < hdr.page_count; pg++) {
+        KTermAtlasPage* page = &term->atlas_pages[pg];
+        page->cells = (uint8_t)pages[pg].cells;
+        page->used = pages[pg].used;
+        page->glyphs = 0;
+        page->last_used = 0;
+        for (uint32_t s = (pg == 0) ? 256 : 0; s < pages[pg].used; s++) {
+            uint32_t cp;
+            memcpy(&cp, codepoints + s * sizeof(uint32_t), sizeof(cp));
+            uint32_t slot = pg * spp + s;
+            bool single = cp != 0 && cp < 2 * KTERM_GLYPH_NARROW; // Cluster slots are not restored
+            term->atlas_to_codepoint[slot] = single ? cp : 0;
+            if (single && KTerm_GlyphMapGet(term, cp) == 0 && KTerm_GlyphMapSet(term, cp, slot)) page->glyphs++;
+        }
+        codepoints += (size_t)pages[pg].used * sizeof(uint32_t);
+        term->atlas_fill_page[page->cells - 1] = (int)pg;
+
+        size_t bytes = (size_t)KTerm_GlyphCachePageRows(term, pages[pg].used) * term->atlas_width * 4;
+        unsigned char* dst = term->font_atlas_pixels + pg * page_bytes;
+        memcpy(dst, p, bytes);
+        memset(dst + bytes, 0, page_bytes - bytes);
+        p += bytes;
+    }
+    if (term->cluster_map) {
+        memset(term->cluster_map, 0, KTERM_CLUSTER_TABLE_SIZE * sizeof(KTermClusterEntry));
+        term->cluster_count = 0;
+    }
+
+    memcpy(term->font_metrics, metrics, sizeof(term->font_metrics));
+    term->font_atlas_dirty = true;
+    term->atlas_dirty_count = 0;
+    return true;
+}
+
+bool KTerm_LoadGlyphCache(KTerm* term, const char* path) {
+    if (!term->font_atlas_pixels || !term->glyph_map || !term->atlas_to_codepoint || !path) return false;
+    if (GET_SESSION(term)->soft_font.active) return false;
+
+    // Worker results would land on top of the cached atlas
+    KTerm_FlushGlyphRaster(term);
+
+    bool ok = false;
+#ifdef KTERM_HAS_MMAP
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        void* map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map != MAP_FAILED) {
+            ok = KTerm_ApplyGlyphCache(term, (const unsigned char*)map, (size_t)st.st_size);
+            munmap(map, (size_t)st.st_size);
+        }
+    }
+    close(fd);
+#else
+    unsigned int size = 0;
+    unsigned char* data = NULL;
+    if (KTerm_LoadFileData(path, &size, &data) == KTERM_SUCCESS && data) {
+        ok = KTerm_ApplyGlyphCache(term, data, size);
+        KTERM_FREE(data);
+    }
+#endif
+    if (!ok) {
+        KTerm_ReportError(term, KTERM_LOG_INFO, KTERM_SOURCE_SYSTEM, "Glyph cache not used (missing or stale): %s", path);
+    }
+    return ok;
+}
+
+// Look up or allocate the atlas slot of a glyph key (see KTerm_GlyphKeyCodepoint)
+static uint32_t KTerm_AllocateGlyphKey(KTerm* term, uint32_t codepoint) {
+    // Safety check if glyph_map wasn't allocated
+    if (!term->glyph_map || codepoint >= 2 * KTERM_GLYPH_NARROW) return '?';
+
+    // Check if already mapped
+    uint32_t id = KTerm_GlyphMapGet(term, codepoint);
+    if (id != 0) {
+        KTerm_TouchGlyph(term, id);
+        return id;
+    }
+
+    if (KTERM_STATS_ENABLED(term)) {
+        term->stats.atlas_misses++;
+        term->stats_frame.atlas_misses++;
+    }
+
+    int cells = KTerm_GlyphKeyCells(codepoint);
+    uint32_t idx = KTerm_ReserveAtlasSlot(term, &cells);
+    if (idx == 0) return '?'; // Should not happen: the atlas always has page 0
+    if (!KTerm_GlyphMapSet(term, codepoint, idx)) return '?';
+    term->atlas_to_codepoint[idx] = codepoint;
+
+    KTerm_FillGlyphSlot(term, codepoint, idx, cells);
+    return idx;
 }
 
 // Helper to allocate a glyph index in the dynamic atlas for any Unicode codepoint
@@ -4900,82 +6521,109 @@ uint32_t KTerm_AllocateGlyph(KTerm* term, uint32_t codepoint) {
     if (codepoint >= 0x110000) {
         return '?'; // Return safe fallback
     }
+    return KTerm_AllocateGlyphKey(term, codepoint);
+}
 
-    // Check if already mapped
-    if (term->glyph_map && term->glyph_map[codepoint] != 0) {
-        return term->glyph_map[codepoint];
+uint32_t KTerm_GetGlyphId(KTerm* term, uint32_t codepoint) {
+    if (!term->glyph_map || codepoint >= 0x110000) return 0;
+    return KTerm_GlyphMapGet(term, codepoint);
+}
+
+static uint32_t KTerm_HashCluster(const uint32_t* codepoints, int count) {
+    uint32_t h = 2166136261u;
+    for (int i = 0; i < count; i++) {
+        h = (h ^ codepoints[i]) * 16777619u; // FNV-1a over whole codepoints
     }
+    return h;
+}
 
-    // Safety check if glyph_map wasn't allocated
-    if (!term->glyph_map) return '?';
-
-    // Check capacity
-    uint32_t capacity = (term->atlas_width / DEFAULT_CHAR_WIDTH) * (term->atlas_height / DEFAULT_CHAR_HEIGHT);
-    if (term->next_atlas_index >= capacity) {
-        // Atlas full. Use Clock Eviction Algorithm.
-        // Iterate cyclically starting from atlas_clock_hand.
-        // We look for an entry that wasn't used THIS frame.
-        // If all were used this frame, we just pick the one at the hand (FIFO fallback).
-        
-        uint32_t lru_index = 0;
-        uint32_t start_hand = term->atlas_clock_hand;
-        if (start_hand < 256) start_hand = 256; // Ensure range
-
-        while (true) {
-             // Check if used this frame
-             if (term->glyph_last_used[term->atlas_clock_hand] != term->frame_count) {
-                 lru_index = term->atlas_clock_hand;
-                 break;
-             }
-             
-             // Move hand
-             term->atlas_clock_hand++;
-             if (term->atlas_clock_hand >= capacity) term->atlas_clock_hand = 256;
-             
-             // Full circle?
-             if (term->atlas_clock_hand == start_hand) {
-                 // All used this frame! Force eviction at current hand.
-                 lru_index = start_hand;
-                 break;
-             }
+// Compose a cluster into `cells` slots: the base glyph, then each mark the font
+// can draw, merged by max alpha. Bitmap fonts have no marks, so the cell shows the base.
+// Anything that needs the font goes to the rasterizer when it is running; the slot
+// shows the bitmap base (or nothing) until the result is committed.
+static void KTerm_RenderClusterToAtlas(KTerm* term, const uint32_t* codepoints, int count, uint32_t slot, int cells, uint32_t entry) {
+    if (!term->font_atlas_pixels) return;
+    unsigned char* dst = KTerm_AtlasSlotPixels(term, slot);
+    int stride = term->atlas_width * 4;
+
+    uint32_t base = KTerm_GlyphKeyCodepoint(codepoints[0]);
+    bool bitmap_base = base < 256 && cells == 1;
+    if (bitmap_base) {
+        // Bitmap font glyph already in the atlas
+        unsigned char* src = KTerm_AtlasSlotPixels(term, base);
+        for (int y = 0; y < DEFAULT_CHAR_HEIGHT; y++) {
+            memcpy(&dst[y * stride], &src[y * stride], DEFAULT_CHAR_WIDTH * 4);
         }
-        
-        // Move hand forward for next time
-        term->atlas_clock_hand = lru_index + 1;
-        if (term->atlas_clock_hand >= capacity) term->atlas_clock_hand = 256;
-
-        // Evict
-        if (lru_index >= 256) {
-            uint32_t old_codepoint = term->atlas_to_codepoint[lru_index];
-            if (old_codepoint < 65536) { // Safety check for map size
-                term->glyph_map[old_codepoint] = 0; // Clear from map
-            } else if (old_codepoint < 0x110000) {
-                 // Handle full unicode range if map supports it (it does: 0x110000)
-                 term->glyph_map[old_codepoint] = 0;
-            }
-
-            // Reuse this index
-            term->glyph_map[codepoint] = (uint16_t)lru_index;
-            term->atlas_to_codepoint[lru_index] = codepoint;
-            term->glyph_last_used[lru_index] = term->frame_count; // Touch
-
-            RenderGlyphToAtlas(term, codepoint, lru_index);
-            term->font_atlas_dirty = true;
-            return lru_index;
-        } else {
-            return '?'; // Should not happen if capacity > 256
+        if (!term->ttf.loaded) return;
+    }
+
+    KTermGlyphJob job = { .codepoint = KTERM_CLUSTER_SLOT_FLAG | entry, .slot = slot, .cells = cells,
+                          .count = (uint8_t)count, .merge = bitmap_base, .hash = term->cluster_map[entry].hash };
+    memcpy(job.codepoints, codepoints, count * sizeof(uint32_t));
+    job.codepoints[0] = base;
+    if (term->glyph_raster.running && KTerm_QueueGlyphRaster(term, &job)) {
+        if (!bitmap_base) {
+            for (int y = 0; y < DEFAULT_CHAR_HEIGHT; y++) memset(&dst[y * stride], 0, cells * DEFAULT_CHAR_WIDTH * 4);
         }
+        return;
     }
 
-    uint32_t idx = term->next_atlas_index++;
-    term->glyph_map[codepoint] = (uint16_t)idx;
-    term->atlas_to_codepoint[idx] = codepoint;
-    term->glyph_last_used[idx] = term->frame_count;
+    KTERM_MUTEX_LOCK(term->glyph_raster.font_lock);
+    // Rasterize directly: the base slot may still be an async placeholder
+    if (!bitmap_base) KTerm_RasterizeGlyph(term, base, cells, dst, stride);
+    KTerm_ComposeClusterMarks(term, codepoints, count, cells, dst, stride);
+    KTERM_MUTEX_UNLOCK(term->glyph_raster.font_lock);
+}
+
+uint32_t KTerm_AllocateCluster(KTerm* term, const uint32_t* codepoints, int count) {
+    if (count <= 1 || !term->cluster_map) return KTerm_AllocateGlyphKey(term, codepoints[0]);
+    if (count > KTERM_CLUSTER_MAX) count = KTERM_CLUSTER_MAX;
+
+    uint32_t hash = KTerm_HashCluster(codepoints, count);
+    uint32_t mask = KTERM_CLUSTER_TABLE_SIZE - 1;
+    uint32_t i = hash & mask;
+    KTermClusterEntry* e;
+    while (true) {
+        e = &term->cluster_map[i];
+        if (e->count == 0) break;
+        if (e->hash == hash && e->count == count && memcmp(e->codepoints, codepoints, count * sizeof(uint32_t)) == 0) {
+            if (e->slot != 0) {
+                KTerm_TouchGlyph(term, e->slot);
+                return e->slot;
+            }
+            break; // Known cluster whose slot was evicted: refill the same entry
+        }
+        i = (i + 1) & mask;
+    }
 
-    RenderGlyphToAtlas(term, codepoint, idx);
+    if (e->count == 0) {
+        // Keep probes short: start over when the table is 3/4 full. Old slots stay
+        // in the atlas until their page is evicted.
+        if (term->cluster_count >= KTERM_CLUSTER_TABLE_SIZE * 3 / 4) {
+            memset(term->cluster_map, 0, KTERM_CLUSTER_TABLE_SIZE * sizeof(KTermClusterEntry));
+            term->cluster_count = 0;
+            i = hash & mask;
+            e = &term->cluster_map[i];
+        }
+        e->hash = hash;
+        e->count = (uint8_t)count;
+        memcpy(e->codepoints, codepoints, count * sizeof(uint32_t));
+        term->cluster_count++;
+    }
 
-    term->font_atlas_dirty = true;
-    return idx;
+    if (KTERM_STATS_ENABLED(term)) {
+        term->stats.atlas_misses++;
+        term->stats_frame.atlas_misses++;
+    }
+    int cells = KTerm_GlyphKeyCells(codepoints[0]);
+    uint32_t slot = KTerm_ReserveAtlasSlot(term, &cells);
+    if (slot == 0) return KTerm_AllocateGlyphKey(term, codepoints[0]);
+
+    e->slot = slot;
+    term->atlas_to_codepoint[slot] = KTERM_CLUSTER_SLOT_FLAG | i;
+    KTerm_RenderClusterToAtlas(term, codepoints, count, slot, cells, i);
+    for (int c = 0; c < cells; c++) KTerm_MarkAtlasSlotDirty(term, slot + c);
+    return slot;
 }
 
 // Helper to map Unicode codepoints to Dynamic Atlas indices
@@ -4988,143 +6636,8 @@ uint32_t MapUnicodeToAtlas(KTerm* term, uint32_t codepoint) {
 
 // Legacy wrapper (deprecated in favor of dynamic system, but kept for logic compat)
 uint8_t MapUnicodeToCP437(uint32_t codepoint) {
-    // This function returns a CP437 index (0-255).
-    // It logic is hardcoded.
-    if (codepoint < 128) return (uint8_t)codepoint;
-
-    // Direct mappings for common box drawing and symbols present in CP437
-    switch (codepoint) {
-        case 0xFFFD: return '?'; // Replacement character
-        case 0x00C7: return 128; // Ç
-        case 0x00FC: return 129; // ü
-        case 0x00E9: return 130; // é
-        case 0x00E2: return 131; // â
-        case 0x00E4: return 132; // ä
-        case 0x00E0: return 133; // à
-        case 0x00E5: return 134; // å
-        case 0x00E7: return 135; // ç
-        case 0x00EA: return 136; // ê
-        case 0x00EB: return 137; // ë
-        case 0x00E8: return 138; // è
-        case 0x00EF: return 139; // ï
-        case 0x00EE: return 140; // î
-        case 0x00EC: return 141; // ì
-        case 0x00C4: return 142; // Ä
-        case 0x00C5: return 143; // Å
-        case 0x00C9: return 144; // É
-        case 0x00E6: return 145; // æ
-        case 0x00C6: return 146; // Æ
-        case 0x00F4: return 147; // ô
-        case 0x00F6: return 148; // ö
-        case 0x00F2: return 149; // ò
-        case 0x00FB: return 150; // û
-        case 0x00F9: return 151; // ù
-        case 0x00FF: return 152; // ÿ
-        case 0x00D6: return 153; // Ö
-        case 0x00DC: return 154; // Ü
-        case 0x00A2: return 155; // ¢
-        case 0x00A3: return 156; // £
-        case 0x00A5: return 157; // ¥
-        case 0x20A7: return 158; // ₧
-        case 0x0192: return 159; // ƒ
-        case 0x00E1: return 160; // á
-        case 0x00ED: return 161; // í
-        case 0x00F3: return 162; // ó
-        case 0x00FA: return 163; // ú
-        case 0x00F1: return 164; // ñ
-        case 0x00D1: return 165; // Ñ
-        case 0x00AA: return 166; // ª
-        case 0x00BA: return 167; // º
-        case 0x00BF: return 168; // ¿
-        case 0x2310: return 169; // ⌐
-        case 0x00AC: return 170; // ¬
-        case 0x00BD: return 171; // ½
-        case 0x00BC: return 172; // ¼
-        case 0x00A1: return 173; // ¡
-        case 0x00AB: return 174; // «
-        case 0x00BB: return 175; // »
-        case 0x2591: return 176; // ░
-        case 0x2592: return 177; // ▒
-        case 0x2593: return 178; // ▓
-        case 0x2502: return 179; // │
-        case 0x2524: return 180; // ┤
-        case 0x2561: return 181; // ╡
-        case 0x2562: return 182; // ╢
-        case 0x2556: return 183; // ╖
-        case 0x2555: return 184; // ╕
-        case 0x2563: return 185; // ╣
-        case 0x2551: return 186; // ║
-        case 0x2557: return 187; // ╗
-        case 0x255D: return 188; // ╝
-        case 0x255C: return 189; // ╜
-        case 0x255B: return 190; // ╛
-        case 0x2510: return 191; // ┐
-        case 0x2514: return 192; // └
-        case 0x2534: return 193; // ┴
-        case 0x252C: return 194; // ┬
-        case 0x251C: return 195; // ├
-        case 0x2500: return 196; // ─
-        case 0x253C: return 197; // ┼
-        case 0x255E: return 198; // ╞
-        case 0x255F: return 199; // ╟
-        case 0x255A: return 200; // ╚
-        case 0x2554: return 201; // ╔
-        case 0x2569: return 202; // ╩
-        case 0x2566: return 203; // ╦
-        case 0x2560: return 204; // ╠
-        case 0x2550: return 205; // ═
-        case 0x256C: return 206; // ╬
-        case 0x2567: return 207; // ╧
-        case 0x2568: return 208; // ╨
-        case 0x2564: return 209; // ╤
-        case 0x2565: return 210; // ╥
-        case 0x2559: return 211; // ╙
-        case 0x2558: return 212; // ╘
-        case 0x2552: return 213; // ╒
-        case 0x2553: return 214; // ╓
-        case 0x256B: return 215; // ╫
-        case 0x256A: return 216; // ╪
-        case 0x2518: return 217; // ┘
-        case 0x250C: return 218; // ┌
-        case 0x2588: return 219; // █
-        case 0x2584: return 220; // ▄
-        case 0x258C: return 221; // ▌
-        case 0x2590: return 222; // ▐
-        case 0x2580: return 223; // ▀
-        case 0x03B1: return 224; // α
-        case 0x00DF: return 225; // ß
-        case 0x0393: return 226; // Γ
-        case 0x03C0: return 227; // π
-        case 0x03A3: return 228; // Σ
-        case 0x03C3: return 229; // σ
-        case 0x00B5: return 230; // µ
-        case 0x03C4: return 231; // τ
-        case 0x03A6: return 232; // Φ
-        case 0x0398: return 233; // Θ
-        case 0x03A9: return 234; // Ω
-        case 0x03B4: return 235; // δ
-        case 0x221E: return 236; // ∞
-        case 0x03C6: return 237; // φ
-        case 0x03B5: return 238; // ε
-        case 0x2229: return 239; // ∩
-        case 0x2261: return 240; // ≡
-        case 0x00B1: return 241; // ±
-        case 0x2265: return 242; // ≥
-        case 0x2264: return 243; // ≤
-        case 0x2320: return 244; // ⌠
-        case 0x2321: return 245; // ⌡
-        case 0x00F7: return 246; // ÷
-        case 0x2248: return 247; // ≈
-        case 0x00B0: return 248; // °
-        case 0x2219: return 249; // ∙
-        case 0x00B7: return 250; // ·
-        case 0x221A: return 251; // √
-        case 0x207F: return 252; // ⁿ
-        case 0x00B2: return 253; // ²
-        case 0x25A0: return 254; // ■
-        case 0x00A0: return 255; // NBSP
-        default: return '?';     // Fallback
-    }
+    // CP437 index (0-255), '?' when the codepoint has no CP437 equivalent.
+    return KT_UPROPS_CP437(KTerm_CodepointProps(codepoint));
 }
 
 // VT100/220 "Special Graphics" to CP437 Lookup Table.
@@ -5286,7 +6799,7 @@ static void KTerm_ScrollUpRegion_Internal(KTerm* term, KTermSession* session, in
         for (int i = 0; i < lines; i++) {
             // Increment head (scrolling down in memory, visually up)
             session->screen_head = (session->screen_head + 1) % session->buffer_height;
-            if (session->history_rows_populated < MAX_SCROLLBACK_LINES) {
+            if (session->history_rows_populated < term->session_buffer_sizes.scrollback) {
                 session->history_rows_populated++;
             }
 
@@ -5305,7 +6818,7 @@ static void KTerm_ScrollUpRegion_Internal(KTerm* term, KTermSession* session, in
         }
         // Invalidate all viewport rows because the data under them has shifted
         for (int y = 0; y < term->height; y++) {
-            session->row_dirty[y] = KTERM_DIRTY_FRAMES;
+            KTerm_MarkRowDirty(session, y);
         }
         return;
     }
@@ -5318,14 +6831,14 @@ static void KTerm_ScrollUpRegion_Internal(KTerm* term, KTermSession* session, in
                 *GetActiveScreenCell(session, y, x) = *GetActiveScreenCell(session, y + 1, x);
                 GetActiveScreenCell(session, y, x)->flags |= KTERM_FLAG_DIRTY;
             }
-            session->row_dirty[y] = KTERM_DIRTY_FRAMES;
+            KTerm_MarkRowDirty(session, y);
         }
 
         // Clear bottom line of the region
         for (int x = session->left_margin; x <= session->right_margin; x++) {
             KTerm_ClearCell_Internal(session, GetActiveScreenCell(session, bottom, x));
         }
-        session->row_dirty[bottom] = KTERM_DIRTY_FRAMES;
+        KTerm_MarkRowDirty(session, bottom);
     }
 }
 
@@ -5351,14 +6864,14 @@ static void KTerm_ScrollDownRegion_Internal(KTerm* term, KTermSession* session,
                 *GetActiveScreenCell(session, y, x) = *GetActiveScreenCell(session, y - 1, x);
                 GetActiveScreenCell(session, y, x)->flags |= KTERM_FLAG_DIRTY;
             }
-            session->row_dirty[y] = KTERM_DIRTY_FRAMES;
+            KTerm_MarkRowDirty(session, y);
         }
 
         // Clear top line
         for (int x = session->left_margin; x <= session->right_margin; x++) {
             KTerm_ClearCell_Internal(session, GetActiveScreenCell(session, top, x));
         }
-        session->row_dirty[top] = KTERM_DIRTY_FRAMES;
+        KTerm_MarkRowDirty(session, top);
     }
 }
 
@@ -5387,7 +6900,7 @@ static void KTerm_InsertLinesAt_Internal(KTerm* term, KTermSession* session, int
                 *GetActiveScreenCell(session, y, x) = *GetActiveScreenCell(session, y - count, x);
                 GetActiveScreenCell(session, y, x)->flags |= KTERM_FLAG_DIRTY;
             }
-            session->row_dirty[y] = KTERM_DIRTY_FRAMES;
+            KTerm_MarkRowDirty(session, y);
     }
     }
 
@@ -5396,7 +6909,7 @@ static void KTerm_InsertLinesAt_Internal(KTerm* term, KTermSession* session, int
         for (int x = session->left_margin; x <= session->right_margin; x++) {
             KTerm_ClearCell_Internal(session, GetActiveScreenCell(session, y, x));
         }
-        session->row_dirty[y] = KTERM_DIRTY_FRAMES;
+        KTerm_MarkRowDirty(session, y);
     }
 }
 
@@ -5437,7 +6950,7 @@ static void KTerm_DeleteLinesAt_Internal(KTerm* term, KTermSession* session, int
             *GetActiveScreenCell(session, y, x) = *GetActiveScreenCell(session, y + count, x);
             GetActiveScreenCell(session, y, x)->flags |= KTERM_FLAG_DIRTY;
         }
-        session->row_dirty[y] = KTERM_DIRTY_FRAMES;
+        KTerm_MarkRowDirty(session, y);
     }
 
     // Clear bottom lines
@@ -5446,7 +6959,7 @@ static void KTerm_DeleteLinesAt_Internal(KTerm* term, KTermSession* session, int
             for (int x = session->left_margin; x <= session->right_margin; x++) {
                 KTerm_ClearCell_Internal(session, GetActiveScreenCell(session, y, x));
             }
-            session->row_dirty[y] = KTERM_DIRTY_FRAMES;
+            KTerm_MarkRowDirty(session, y);
     }
     }
 }
@@ -5472,7 +6985,7 @@ static void KTerm_InsertCharactersAt_Internal(KTerm* term, KTermSession* session
     for (int x = col; x < col + count && x <= session->right_margin; x++) {
         KTerm_ClearCell_Internal(session, GetActiveScreenCell(session, row, x));
     }
-    session->row_dirty[row] = KTERM_DIRTY_FRAMES;
+    KTerm_MarkRowDirty(session, row);
 }
 
 void KTerm_InsertCharactersAt(KTerm* term, int row, int col, int count) {
@@ -5496,7 +7009,7 @@ static void KTerm_DeleteCharactersAt_Internal(KTerm* term, KTermSession* session
             KTerm_ClearCell_Internal(session, GetActiveScreenCell(session, row, x));
         }
     }
-    session->row_dirty[row] = KTERM_DIRTY_FRAMES;
+    KTerm_MarkRowDirty(session, row);
 }
 
 void KTerm_DeleteCharactersAt(KTerm* term, int row, int col, int count) {
@@ -5735,9 +7248,10 @@ void KTerm_ProcessNormalChar(KTerm* term, KTermSession* session, unsigned char c
 
 // Update KTerm_ProcessControlChar
 void KTerm_ProcessControlChar(KTerm* term, KTermSession* session, unsigned char ch) {
+    if (ch != 0x1B) KTerm_StatsCountSequence(term, session, KTERM_STAT_SEQ_C0); // ESC is counted with its sequence
     switch (ch) {
         case 0x05: // ENQ - Enquiry
-            if (session->answerback_buffer[0] != '\0') {
+            if (session->answerback_buffer && session->answerback_buffer[0] != '\0') {
                 KTerm_QueueResponse(term, session->answerback_buffer);
             }
             break;
@@ -5766,7 +7280,9 @@ void KTerm_ProcessControlChar(KTerm* term, KTermSession* session, unsigned char
             session->cursor.y++;
             if (session->cursor.y > session->scroll_bottom) {
                 session->cursor.y = session->scroll_bottom;
-                KTerm_ScrollUpRegion(term, session->scroll_top, session->scroll_bottom, 1);
+                // Queued on this session, which need not be the active one
+                KTermRect r = {session->left_margin, session->scroll_top, session->right_margin - session->left_margin + 1, session->scroll_bottom - session->scroll_top + 1};
+                KTerm_QueueScrollRegion(session, r, 1);
             }
             if (session->ansi_modes.line_feed_new_line) {
                 session->cursor.x = session->left_margin;
@@ -5957,7 +7473,8 @@ void KTerm_ProcessEscapeChar(KTerm* term, KTermSession* session, unsigned char c
             session->cursor.y--;
             if (session->cursor.y < session->scroll_top) {
                 session->cursor.y = session->scroll_top;
-                KTerm_ScrollDownRegion(term, session->scroll_top, session->scroll_bottom, 1);
+                KTermRect r = {session->left_margin, session->scroll_top, session->right_margin - session->left_margin + 1, session->scroll_bottom - session->scroll_top + 1};
+                KTerm_QueueScrollRegion(session, r, -1);
             }
             session->parse_state = VT_PARSE_NORMAL;
             break;
@@ -6018,51 +7535,240 @@ void KTerm_ProcessEscapeChar(KTerm* term, KTermSession* session, unsigned char c
     }
 }
 
+static void KTerm_RecordInput(KTerm* term, KTermSession* session, unsigned char ch);
+
+// Producers check this per byte; the recorder itself is freed only by KTerm_Cleanup
+static inline bool KTerm_IsRecording(KTerm* term) {
+    return atomic_load_explicit(&term->recording, memory_order_acquire);
+}
+
 // =============================================================================
-// Internal helper for writing to a specific session without changing global state
-static bool KTerm_WriteCharToSessionInternal(KTerm* term, KTermSession* session, unsigned char ch) {
-    (void)term; // Currently unused, but kept for signature consistency
+// PER-SESSION BUFFERS
+// =============================================================================
+// The input ring, input event ring, op queue and reply buffer are sized from
+// KTermConfig (sizes are set on the session by KTerm_InitSession) and allocated
+// when the session is opened or activated, or by the first producer that feeds a
+// closed session. Unused sessions therefore hold none of them.
 
-    // Load head relaxed (only this thread writes to it)
-    int current_head = atomic_load_explicit(&session->pipeline_head, memory_order_relaxed);
-    int next_head = (current_head + 1) % sizeof(session->input_pipeline);
+static bool KTerm_AllocOpQueue(KTermOpQueue* queue);
 
-    // Load tail acquire (another thread writes to it)
-    int current_tail = atomic_load_explicit(&session->pipeline_tail, memory_order_acquire);
+static size_t KTerm_RoundUpPow2(size_t n) {
+    size_t p = 1;
+    while (p < n) p <<= 1;
+    return p;
+}
 
-    if (next_head == current_tail) {
-        atomic_store_explicit(&session->pipeline_overflow, true, memory_order_relaxed);
+// Fills in defaults and rounds the ring sizes; called by KTerm_Init before the sessions
+static void KTerm_ResolveBufferSizes(KTerm* term) {
+    if (term->session_buffer_sizes.input_pipeline < 2) term->session_buffer_sizes.input_pipeline = KTERM_INPUT_PIPELINE_SIZE;
+    if (term->session_buffer_sizes.input_pipeline > (1u << 30)) term->session_buffer_sizes.input_pipeline = 1u << 30;
+    term->session_buffer_sizes.input_pipeline = KTerm_RoundUpPow2(term->session_buffer_sizes.input_pipeline);
+    if (term->session_buffer_sizes.key_events < 2) term->session_buffer_sizes.key_events = KEY_EVENT_BUFFER_SIZE;
+    if (term->session_buffer_sizes.key_events > (1 << 24)) term->session_buffer_sizes.key_events = 1 << 24;
+    term->session_buffer_sizes.key_events = (int)KTerm_RoundUpPow2((size_t)term->session_buffer_sizes.key_events);
+    if (term->session_buffer_sizes.op_queue < 2) term->session_buffer_sizes.op_queue = KTERM_OP_QUEUE_SIZE;
+    if (term->session_buffer_sizes.op_queue > (1 << 24)) term->session_buffer_sizes.op_queue = 1 << 24;
+    term->session_buffer_sizes.op_queue = (int)KTerm_RoundUpPow2((size_t)term->session_buffer_sizes.op_queue);
+    if (term->session_buffer_sizes.responses < 64) term->session_buffer_sizes.responses = KTERM_OUTPUT_PIPELINE_SIZE;
+    if (term->session_buffer_sizes.responses > INT_MAX) term->session_buffer_sizes.responses = INT_MAX;
+    if (term->session_buffer_sizes.scrollback <= 0) term->session_buffer_sizes.scrollback = MAX_SCROLLBACK_LINES;
+    if (term->session_buffer_sizes.scrollback > 1000000) term->session_buffer_sizes.scrollback = 1000000;
+}
+
+// Allocated by the producer before its first head store, so the consumer
+// (which only reads the ring after seeing head != tail) never sees it missing
+static bool KTerm_AllocInputPipeline(KTerm* term, KTermSession* session) {
+    if (session->input_pipeline) return true;
+    session->input_pipeline = (unsigned char*)KTerm_Malloc((size_t)session->pipeline_mask + 1);
+    if (!session->input_pipeline) {
+        KTerm_ReportError(term, KTERM_LOG_ERROR, KTERM_SOURCE_SYSTEM, "Failed to allocate %d byte input pipeline", session->pipeline_mask + 1);
         return false;
     }
-
-    session->input_pipeline[current_head] = ch;
-
-    // Store head release (publishes the data write)
-    atomic_store_explicit(&session->pipeline_head, next_head, memory_order_release);
     return true;
 }
 
-// ENHANCED PIPELINE PROCESSING
-// =============================================================================
-bool KTerm_WriteChar(KTerm* term, unsigned char ch) {
-    // Wrapper around internal function using active session
-    // Reads active_session once atomically (in C sense)
-    KTermSession* session = &term->sessions[term->active_session];
-    return KTerm_WriteCharToSessionInternal(term, session, ch);
+static bool KTerm_AllocKeyEvents(KTerm* term, KTermSession* session) {
+    if (session->input.buffer) return true;
+    session->input.buffer = (KTermEvent*)KTerm_Malloc(((size_t)session->input.buffer_mask + 1) * sizeof(KTermEvent));
+    if (!session->input.buffer) {
+        KTerm_ReportError(term, KTERM_LOG_ERROR, KTERM_SOURCE_SYSTEM, "Failed to allocate %d entry input event buffer", session->input.buffer_mask + 1);
+        return false;
+    }
+    return true;
 }
 
-bool KTerm_WriteString(KTerm* term, const char* str) {
-    if (!str) return false;
-
-    while (*str) {
-        if (!KTerm_WriteChar(term, *str)) {
-            return false;
-        }
-        str++;
+static bool KTerm_AllocResponseBuffer(KTerm* term, KTermSession* session) {
+    if (session->answerback_buffer) return true;
+    session->answerback_buffer = (char*)KTerm_Calloc(session->response_capacity, 1);
+    if (!session->answerback_buffer) {
+        KTerm_ReportError(term, KTERM_LOG_ERROR, KTERM_SOURCE_SYSTEM, "Failed to allocate %zu byte response buffer", session->response_capacity);
+        return false;
     }
+    if (session->response_length == 0) KTerm_SetLevelAnswerback(session);
     return true;
 }
 
+// Everything a session needs to run; called when it is opened or activated
+static bool KTerm_OpenSessionBuffers(KTerm* term, KTermSession* session) {
+    if (!KTerm_AllocInputPipeline(term, session) || !KTerm_AllocKeyEvents(term, session) ||
+        !KTerm_AllocResponseBuffer(term, session)) {
+        return false;
+    }
+    if (!KTerm_AllocOpQueue(&session->op_queue)) {
+        KTerm_ReportError(term, KTERM_LOG_ERROR, KTERM_SOURCE_SYSTEM, "Failed to allocate %d entry op queue", session->op_queue.capacity);
+        return false;
+    }
+    return true;
+}
+
+// =============================================================================
+// UPDATE LIST
+// =============================================================================
+// KTerm_Update visits only the sessions on term->update_list, so idle sessions
+// cost nothing per frame. Producers on any thread push a session they feed onto
+// the wake list (a lock-free stack through wake_next); each frame the update
+// thread takes the whole stack, adds the visible sessions, and afterwards keeps
+// listed only the sessions that still have work.
+
+// Any thread: the session is visited by the next KTerm_Update
+static void KTerm_WakeSession(KTerm* term, KTermSession* session) {
+    if (atomic_exchange_explicit(&session->wake_queued, true, memory_order_acq_rel)) return;
+    int head = atomic_load_explicit(&term->wake_head, memory_order_relaxed);
+    do {
+        atomic_store_explicit(&session->wake_next, head, memory_order_relaxed);
+    } while (!atomic_compare_exchange_weak_explicit(&term->wake_head, &head, session->index,
+                                                    memory_order_release, memory_order_relaxed));
+}
+
+// Update thread only: the session is visited by the frame being built or run
+static void KTerm_ListSession(KTerm* term, KTermSession* session) {
+    if (session->update_listed || !term->update_list || !session->screen_buffer) return; // Closed slots have nothing to run
+    session->update_listed = true;
+    term->update_list[term->update_count++] = session->index;
+}
+
+static void KTerm_ListWokenSessions(KTerm* term) {
+    int index = atomic_exchange_explicit(&term->wake_head, -1, memory_order_acquire);
+    while (index >= 0) {
+        KTermSession* session = term->sessions[index];
+        index = atomic_load_explicit(&session->wake_next, memory_order_relaxed);
+        // Cleared before the pipeline is read, so a later write wakes the session again.
+        // The fence orders the clear before the head loads that follow, matching the
+        // producers' fence between their head store and flag load
+        atomic_store_explicit(&session->wake_queued, false, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+        KTerm_ListSession(term, session);
+    }
+}
+
+static void KTerm_ListVisibleSessions(KTerm* term) {
+    KTerm_ListSession(term, GET_SESSION(term));
+    if (term->split_screen_active) {
+        KTerm_ListSession(term, term->sessions[term->session_top]);
+        KTerm_ListSession(term, term->sessions[term->session_bottom]);
+    }
+    int leaves = KTermLayout_GetLeafCount(term->layout);
+    for (int i = 0; i < leaves; i++) {
+        int index = KTermLayout_GetLeaf(term->layout, i)->session_index;
+        if (index >= 0 && index < term->session_count) KTerm_ListSession(term, term->sessions[index]);
+    }
+}
+
+// Input, grid ops, animations, timers or output still waiting after a frame
+static bool KTerm_SessionHasWork(KTerm* term, KTermSession* session) {
+    return atomic_load_explicit(&session->pipeline_head, memory_order_acquire) !=
+               atomic_load_explicit(&session->pipeline_tail, memory_order_relaxed) ||
+           session->op_queue.count > 0 || (session->kitty.anim_count > 0 && !session->fast_forwarding) ||
+           session->visual_bell_timer > 0 ||
+           (session->response_length > 0 && term->response_callback) ||
+           session->output_head != session->output_tail || session->mouse.pending_motion[0] != '\0';
+}
+
+static void KTerm_PruneUpdateList(KTerm* term) {
+    int kept = 0;
+    for (int k = 0; k < term->update_count; k++) {
+        KTermSession* session = term->sessions[term->update_list[k]];
+        if (KTerm_SessionHasWork(term, session)) term->update_list[kept++] = session->index;
+        else session->update_listed = false;
+    }
+    term->update_count = kept;
+}
+
+// =============================================================================
+// Producer side of a session pipeline. Bytes are stored against a local head and
+// published together, so bulk writers pay for the release store, the fence and
+// the wake check once per call instead of once per byte.
+
+static bool KTerm_PipelineReady(KTerm* term, KTermSession* session) {
+    if (!session->screen_buffer) return false; // Closed slot, nothing would drain it
+    if (session->input_pipeline || KTerm_AllocInputPipeline(term, session)) return true;
+    atomic_store_explicit(&session->pipeline_overflow, true, memory_order_relaxed);
+    return false;
+}
+
+// Store one byte at *head and advance it. Nothing is visible to the parser until published.
+static inline bool KTerm_PipelineStore(KTerm* term, KTermSession* session, int* head, unsigned char ch) {
+    int next_head = (*head + 1) & session->pipeline_mask;
+
+    // Load tail acquire (another thread writes to it)
+    if (next_head == atomic_load_explicit(&session->pipeline_tail, memory_order_acquire)) {
+        atomic_store_explicit(&session->pipeline_overflow, true, memory_order_relaxed);
+        return false;
+    }
+
+    session->input_pipeline[*head] = ch;
+    *head = next_head;
+    if (KTerm_IsRecording(term)) KTerm_RecordInput(term, session, ch);
+    return true;
+}
+
+static void KTerm_PipelinePublish(KTerm* term, KTermSession* session, int head) {
+    // Store head release (publishes the data writes)
+    atomic_store_explicit(&session->pipeline_head, head, memory_order_release);
+    // Only the first publish after each frame pays for the wake; the update thread
+    // re-reads the head after clearing the flag, so bytes racing it are not lost.
+    // Pairs with the fence in KTerm_ListWokenSessions: without it the flag load may
+    // be satisfied before the head store is visible and both sides miss the bytes
+    atomic_thread_fence(memory_order_seq_cst);
+    if (!atomic_load_explicit(&session->wake_queued, memory_order_relaxed)) KTerm_WakeSession(term, session);
+}
+
+// Internal helper for writing to a specific session without changing global state
+static bool KTerm_WriteCharToSessionInternal(KTerm* term, KTermSession* session, unsigned char ch) {
+    if (!KTerm_PipelineReady(term, session)) return false;
+
+    // Load head relaxed (only this thread writes to it)
+    int head = atomic_load_explicit(&session->pipeline_head, memory_order_relaxed);
+    if (!KTerm_PipelineStore(term, session, &head, ch)) return false;
+    KTerm_PipelinePublish(term, session, head);
+    return true;
+}
+
+// ENHANCED PIPELINE PROCESSING
+// =============================================================================
+bool KTerm_WriteChar(KTerm* term, unsigned char ch) {
+    // Wrapper around internal function using active session
+    // Reads active_session once atomically (in C sense)
+    KTermSession* session = term->sessions[term->active_session];
+    return KTerm_WriteCharToSessionInternal(term, session, ch);
+}
+
+// Store a block and publish it once; what fits is still delivered when the pipeline fills up
+static size_t KTerm_WriteDataInternal(KTerm* term, KTermSession* session, const unsigned char* data, size_t len) {
+    if (len == 0 || !KTerm_PipelineReady(term, session)) return 0;
+    int head = atomic_load_explicit(&session->pipeline_head, memory_order_relaxed);
+    size_t n = 0;
+    while (n < len && KTerm_PipelineStore(term, session, &head, data[n])) n++;
+    if (n > 0) KTerm_PipelinePublish(term, session, head);
+    return n;
+}
+
+bool KTerm_WriteString(KTerm* term, const char* str) {
+    if (!str) return false;
+    size_t len = strlen(str);
+    return KTerm_WriteDataInternal(term, term->sessions[term->active_session], (const unsigned char*)str, len) == len;
+}
+
 bool KTerm_WriteFormat(KTerm* term, const char* format, ...) {
     char buffer[1024];
     va_list args;
@@ -6073,6 +7779,1753 @@ bool KTerm_WriteFormat(KTerm* term, const char* format, ...) {
     return KTerm_WriteString(term, buffer);
 }
 
+// =============================================================================
+// RECORD AND REPLAY
+// =============================================================================
+// Host input is recorded where it enters the session pipelines, so a capture
+// replays through the normal KTerm_Update loop. Bytes are grouped into chunks
+// per session; a chunk ends at a session switch, when it is full, and at every
+// KTerm_Update, so recorded timing has frame resolution.
+//
+// Binary (KTRC) layout, little-endian:
+//   header: "KTRC" u16 version, u16 cols, u16 rows, u16 sessions, u32 reserved
+//   record: u8 type, varint delta_us, then
+//     DATA:   varint session, varint length, bytes
+//     RESIZE: varint cols, varint rows
+//     HASH:   u64 screen hash (last record)
+
+#define KTERM_RECORD_VERSION 1
+#define KTERM_RECORD_CHUNK 4096
+
+enum { KTERM_REC_DATA = 1, KTERM_REC_RESIZE = 2, KTERM_REC_HASH = 3 };
+
+// The recorder is allocated by the first KTerm_RecordStart and freed by KTerm_Cleanup only:
+// a producer thread that saw `recording` set may still reach it after KTerm_RecordStop.
+// Everything below is under `lock`; `file` is NULL while stopped.
+struct KTermRecorder_T {
+    FILE* file;
+    KTermRecordFormat format;
+    kterm_mutex_t lock;      // KTerm_WriteChar may run on a producer thread
+    int session;             // asciicast: the one session recorded
+    double start_time;
+    uint64_t last_us;        // Binary: time of the previous record
+    int pending_session;
+    double pending_time;     // Time of the first pending byte
+    size_t pending_len;
+    unsigned char pending[KTERM_RECORD_CHUNK];
+};
+
+static void KTerm_RecordPutVarint(FILE* f, uint64_t v) {
+    while (v >= 0x80) {
+        fputc((int)(v & 0x7F) | 0x80, f);
+        v >>= 7;
+    }
+    fputc((int)v, f);
+}
+
+static void KTerm_RecordPutU16(FILE* f, uint32_t v) {
+    fputc((int)(v & 0xFF), f);
+    fputc((int)((v >> 8) & 0xFF), f);
+}
+
+// Binary records carry the time since the previous record
+static void KTerm_RecordBeginRecord(struct KTermRecorder_T* rec, int type, double when) {
+    double since_start = when - rec->start_time;
+    uint64_t us = since_start > 0 ? (uint64_t)(since_start * 1e6 + 0.5) : 0;
+    if (us < rec->last_us) us = rec->last_us;
+    fputc(type, rec->file);
+    KTerm_RecordPutVarint(rec->file, us - rec->last_us);
+    rec->last_us = us;
+}
+
+static size_t KTerm_RecordUTF8Length(unsigned char lead) {
+    if (lead < 0x80) return 1;
+    if ((lead & 0xE0) == 0xC0 && lead >= 0xC2) return 2;
+    if ((lead & 0xF0) == 0xE0) return 3;
+    if ((lead & 0xF8) == 0xF0 && lead <= 0xF4) return 4;
+    return 0; // Continuation byte or invalid lead
+}
+
+// Writes `len` bytes as a JSON string body. asciicast text must be UTF-8:
+// invalid bytes become U+FFFD. A sequence cut off at the end is left for the
+// next chunk unless `final`; returns the number of bytes consumed.
+static size_t KTerm_RecordWriteJSONText(FILE* f, const unsigned char* data, size_t len, bool final) {
+    size_t i = 0;
+    while (i < len) {
+        unsigned char c = data[i];
+        if (c < 0x80) {
+            if (c == '"' || c == '\\') { fputc('\\', f); fputc(c, f); }
+            else if (c < 0x20 || c == 0x7F) fprintf(f, "\\u%04x", c);
+            else fputc(c, f);
+            i++;
+            continue;
+        }
+        size_t n = KTerm_RecordUTF8Length(c);
+        if (n > 0 && i + n > len && !final) break;
+        bool valid = n > 0 && i + n <= len;
+        for (size_t k = 1; valid && k < n; k++) {
+            if ((data[i + k] & 0xC0) != 0x80) valid = false;
+        }
+        if (valid) {
+            fwrite(&data[i], 1, n, f);
+            i += n;
+        } else {
+            fputs("\\ufffd", f);
+            i++;
+        }
+    }
+    return i;
+}
+
+static void KTerm_RecordFlushPending(struct KTermRecorder_T* rec, bool final) {
+    if (rec->pending_len == 0) return;
+    if (rec->format == KTERM_RECORD_BINARY) {
+        KTerm_RecordBeginRecord(rec, KTERM_REC_DATA, rec->pending_time);
+        KTerm_RecordPutVarint(rec->file, (uint64_t)rec->pending_session);
+        KTerm_RecordPutVarint(rec->file, (uint64_t)rec->pending_len);
+        fwrite(rec->pending, 1, rec->pending_len, rec->file);
+        rec->pending_len = 0;
+        return;
+    }
+
+    fprintf(rec->file, "[%.6f, \"o\", \"", rec->pending_time - rec->start_time);
+    size_t used = KTerm_RecordWriteJSONText(rec->file, rec->pending, rec->pending_len, final);
+    fputs("\"]\n", rec->file);
+    // Keep a split UTF-8 sequence for the next chunk
+    memmove(rec->pending, rec->pending + used, rec->pending_len - used);
+    rec->pending_len -= used;
+}
+
+// Called for every byte accepted into a session pipeline while recording
+static void KTerm_RecordInput(KTerm* term, KTermSession* session, unsigned char ch) {
+    struct KTermRecorder_T* rec = term->recorder;
+    int index = session->index;
+    KTERM_MUTEX_LOCK(rec->lock);
+    if (!rec->file || (rec->format == KTERM_RECORD_ASCIICAST && index != rec->session)) {
+        KTERM_MUTEX_UNLOCK(rec->lock);
+        return;
+    }
+    if (rec->pending_len > 0 && (index != rec->pending_session || rec->pending_len == KTERM_RECORD_CHUNK)) {
+        KTerm_RecordFlushPending(rec, false);
+    }
+    if (rec->pending_len == 0) {
+        rec->pending_session = index;
+        rec->pending_time = KTerm_TimerGetTime();
+    }
+    rec->pending[rec->pending_len++] = ch;
+    KTERM_MUTEX_UNLOCK(rec->lock);
+}
+
+// Frame boundary: KTerm_Update closes the chunk in progress
+static void KTerm_RecordFrame(KTerm* term) {
+    struct KTermRecorder_T* rec = term->recorder;
+    KTERM_MUTEX_LOCK(rec->lock);
+    if (rec->file) KTerm_RecordFlushPending(rec, false);
+    KTERM_MUTEX_UNLOCK(rec->lock);
+}
+
+static void KTerm_RecordResize(KTerm* term, int cols, int rows) {
+    struct KTermRecorder_T* rec = term->recorder;
+    KTERM_MUTEX_LOCK(rec->lock);
+    if (!rec->file) {
+        KTERM_MUTEX_UNLOCK(rec->lock);
+        return;
+    }
+    KTerm_RecordFlushPending(rec, false);
+    double now = KTerm_TimerGetTime();
+    if (rec->format == KTERM_RECORD_BINARY) {
+        KTerm_RecordBeginRecord(rec, KTERM_REC_RESIZE, now);
+        KTerm_RecordPutVarint(rec->file, (uint64_t)cols);
+        KTerm_RecordPutVarint(rec->file, (uint64_t)rows);
+    } else {
+        fprintf(rec->file, "[%.6f, \"r\", \"%dx%d\"]\n", now - rec->start_time, cols, rows);
+    }
+    KTERM_MUTEX_UNLOCK(rec->lock);
+}
+
+bool KTerm_RecordStart(KTerm* term, const char* path, KTermRecordFormat format) {
+    if (!term || !path) return false;
+    KTerm_RecordStop(term);
+
+    struct KTermRecorder_T* rec = term->recorder;
+    if (!rec) {
+        rec = (struct KTermRecorder_T*)KTerm_Calloc(1, sizeof(struct KTermRecorder_T));
+        if (!rec) return false;
+        KTERM_MUTEX_INIT(rec->lock);
+        term->recorder = rec;
+    }
+    FILE* file = fopen(path, "wb");
+    if (!file) {
+        KTerm_ReportError(term, KTERM_LOG_ERROR, KTERM_SOURCE_SYSTEM, "Cannot open recording file %s", path);
+        return false;
+    }
+
+    KTERM_MUTEX_LOCK(rec->lock);
+    rec->file = file;
+    rec->format = format;
+    rec->session = term->active_session;
+    rec->start_time = KTerm_TimerGetTime();
+    rec->last_us = 0;
+    rec->pending_len = 0;
+
+    if (format == KTERM_RECORD_BINARY) {
+        fwrite("KTRC", 1, 4, rec->file);
+        KTerm_RecordPutU16(rec->file, KTERM_RECORD_VERSION);
+        KTerm_RecordPutU16(rec->file, (uint32_t)term->width);
+        KTerm_RecordPutU16(rec->file, (uint32_t)term->height);
+        KTerm_RecordPutU16(rec->file, (uint32_t)term->session_count);
+        fwrite("\0\0\0\0", 1, 4, rec->file);
+    } else {
+        fprintf(rec->file, "{\"version\": 2, \"width\": %d, \"height\": %d, \"timestamp\": %lld}\n",
+                term->width, term->height, (long long)time(NULL));
+    }
+    KTERM_MUTEX_UNLOCK(rec->lock);
+    atomic_store_explicit(&term->recording, true, memory_order_release);
+    return true;
+}
+
+static bool KTerm_ReplayInputPending(KTerm* term) {
+    for (int i = 0; i < term->session_count; i++) {
+        KTermSession* session = term->sessions[i];
+        if (atomic_load_explicit(&session->pipeline_head, memory_order_acquire) !=
+            atomic_load_explicit(&session->pipeline_tail, memory_order_acquire)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void KTerm_RecordStop(KTerm* term) {
+    if (!term || !term->recorder) return;
+    if (!atomic_exchange_explicit(&term->recording, false, memory_order_acq_rel)) return;
+    struct KTermRecorder_T* rec = term->recorder;
+
+    // Producers that still see `recording` set find the file gone and drop the byte
+    KTERM_MUTEX_LOCK(rec->lock);
+    KTerm_RecordFlushPending(rec, true);
+    // The hash only means something once the recorded input has been parsed
+    if (KTerm_ReplayInputPending(term)) {
+        KTerm_ReportError(term, KTERM_LOG_WARNING, KTERM_SOURCE_SYSTEM,
+                          "Recording stopped with unparsed input; no screen hash written");
+    } else {
+        uint64_t hash = KTerm_GetScreenHash(term);
+        double now = KTerm_TimerGetTime();
+        if (rec->format == KTERM_RECORD_BINARY) {
+            KTerm_RecordBeginRecord(rec, KTERM_REC_HASH, now);
+            for (int b = 0; b < 8; b++) fputc((int)((hash >> (b * 8)) & 0xFF), rec->file);
+        } else {
+            fprintf(rec->file, "[%.6f, \"m\", \"kterm-hash:%016llx\"]\n", now - rec->start_time, (unsigned long long)hash);
+        }
+    }
+    fclose(rec->file);
+    rec->file = NULL;
+    rec->pending_len = 0;
+    KTERM_MUTEX_UNLOCK(rec->lock);
+}
+
+// --- Replay ---
+
+static void KTerm_ReplayWait(double when, uint64_t wall_start, double speed) {
+    if (speed <= 0) return;
+    uint64_t target = wall_start + (uint64_t)(when / speed * 1e9);
+    uint64_t now = KTerm_StatsNow();
+    if (target <= now) return;
+    uint64_t wait = target - now;
+    struct timespec ts = { (time_t)(wait / 1000000000ull), (long)(wait % 1000000000ull) };
+    KTERM_THREAD_SLEEP(ts);
+}
+
+static void KTerm_ReplayDrain(KTerm* term, KTermReplayResult* r) {
+    for (int guard = 0; guard < 1000000 && KTerm_ReplayInputPending(term); guard++) {
+        KTerm_Update(term);
+        r->frames++;
+    }
+}
+
+static void KTerm_ReplayData(KTerm* term, int session_index, const unsigned char* data, size_t len, KTermReplayResult* r) {
+    if (session_index < 0 || session_index >= term->session_count) return;
+    KTermSession* session = term->sessions[session_index];
+    if (!KTerm_PipelineReady(term, session)) return;
+    int head = atomic_load_explicit(&session->pipeline_head, memory_order_relaxed);
+    for (size_t i = 0; i < len; i++) {
+        // A full pipeline is drained the way the host loop would
+        while (!KTerm_PipelineStore(term, session, &head, data[i])) {
+            KTerm_PipelinePublish(term, session, head);
+            KTerm_Update(term);
+            r->frames++;
+        }
+    }
+    KTerm_PipelinePublish(term, session, head);
+    KTerm_Update(term);
+    r->frames++;
+    r->bytes += len;
+    r->chunks++;
+}
+
+static void KTerm_ReplayResize(KTerm* term, int cols, int rows, KTermReplayResult* r) {
+    // Input sent before the resize is parsed before it, and replay does not throttle
+    KTerm_ReplayDrain(term, r);
+    term->last_resize_time = -1.0;
+    KTerm_Resize(term, cols, rows);
+    r->resizes++;
+}
+
+static bool KTerm_ReplayReadVarint(const unsigned char** p, const unsigned char* end, uint64_t* out) {
+    uint64_t v = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (*p >= end) return false;
+        unsigned char b = *(*p)++;
+        v |= (uint64_t)(b & 0x7F) << shift;
+        if (!(b & 0x80)) { *out = v; return true; }
+    }
+    return false;
+}
+
+static bool KTerm_ReplayBinary(KTerm* term, const unsigned char* data, size_t size, double speed,
+                               uint64_t wall_start, KTermReplayResult* r) {
+    if (size < 16) return false;
+    int version = data[4] | (data[5] << 8);
+    int cols = data[6] | (data[7] << 8);
+    int rows = data[8] | (data[9] << 8);
+    if (version != KTERM_RECORD_VERSION) return false;
+    if (cols != term->width || rows != term->height) KTerm_ReplayResize(term, cols, rows, r);
+
+    const unsigned char* p = data + 16;
+    const unsigned char* end = data + size;
+    uint64_t time_us = 0;
+    while (p < end) {
+        int type = *p++;
+        uint64_t delta, a, b;
+        if (!KTerm_ReplayReadVarint(&p, end, &delta)) return false;
+        time_us += delta;
+        r->recorded_seconds = (double)time_us / 1e6;
+        KTerm_ReplayWait(r->recorded_seconds, wall_start, speed);
+
+        switch (type) {
+            case KTERM_REC_DATA:
+                if (!KTerm_ReplayReadVarint(&p, end, &a) || !KTerm_ReplayReadVarint(&p, end, &b)) return false;
+                if (b > (uint64_t)(end - p)) return false;
+                KTerm_ReplayData(term, (int)a, p, (size_t)b, r);
+                p += b;
+                break;
+            case KTERM_REC_RESIZE:
+                if (!KTerm_ReplayReadVarint(&p, end, &a) || !KTerm_ReplayReadVarint(&p, end, &b)) return false;
+                KTerm_ReplayResize(term, (int)a, (int)b, r);
+                break;
+            case KTERM_REC_HASH:
+                if (end - p < 8) return false;
+                r->expected_hash = 0;
+                for (int i = 0; i < 8; i++) r->expected_hash |= (uint64_t)p[i] << (i * 8);
+                r->has_expected_hash = true;
+                p += 8;
+                break;
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+// Decodes the JSON string starting after its opening quote into `out`;
+// returns the position after the closing quote, or NULL if malformed.
+static const char* KTerm_ReplayJSONString(const char* p, const char* end, unsigned char* out, size_t* out_len) {
+    size_t n = 0;
+    while (p < end && *p != '"') {
+        if (*p != '\\') { out[n++] = (unsigned char)*p++; continue; }
+        if (++p >= end) return NULL;
+        char esc = *p++;
+        switch (esc) {
+            case 'n': out[n++] = '\n'; break;
+            case 'r': out[n++] = '\r'; break;
+            case 't': out[n++] = '\t'; break;
+            case 'b': out[n++] = '\b'; break;
+            case 'f': out[n++] = '\f'; break;
+            case 'u': {
+                if (end - p < 4) return NULL;
+                char hex[5] = { p[0], p[1], p[2], p[3], 0 };
+                uint32_t cp = (uint32_t)strtoul(hex, NULL, 16);
+                p += 4;
+                // Surrogate pair
+                if (cp >= 0xD800 && cp <= 0xDBFF && end - p >= 6 && p[0] == '\\' && p[1] == 'u') {
+                    char lo_hex[5] = { p[2], p[3], p[4], p[5], 0 };
+                    uint32_t lo = (uint32_t)strtoul(lo_hex, NULL, 16);
+                    if (lo >= 0xDC00 && lo <= 0xDFFF) {
+                        cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+                        p += 6;
+                    }
+                }
+                if (cp < 0x80) out[n++] = (unsigned char)cp;
+                else if (cp < 0x800) {
+                    out[n++] = (unsigned char)(0xC0 | (cp >> 6));
+                    out[n++] = (unsigned char)(0x80 | (cp & 0x3F));
+                } else if (cp < 0x10000) {
+                    out[n++] = (unsigned char)(0xE0 | (cp >> 12));
+                    out[n++] = (unsigned char)(0x80 | ((cp >> 6) & 0x3F));
+                    out[n++] = (unsigned char)(0x80 | (cp & 0x3F));
+                } else {
+                    out[n++] = (unsigned char)(0xF0 | (cp >> 18));
+                    out[n++] = (unsigned char)(0x80 | ((cp >> 12) & 0x3F));
+                    out[n++] = (unsigned char)(0x80 | ((cp >> 6) & 0x3F));
+                    out[n++] = (unsigned char)(0x80 | (cp & 0x3F));
+                }
+                break;
+            }
+            default: out[n++] = (unsigned char)esc; break; // \" \\ \/
+        }
+    }
+    if (p >= end) return NULL;
+    *out_len = n;
+    return p + 1;
+}
+
+static bool KTerm_ReplayAsciicast(KTerm* term, const char* data, size_t size, double speed,
+                                  uint64_t wall_start, KTermReplayResult* r) {
+    const char* end = data + size;
+    const char* line_end = memchr(data, '\n', size);
+    if (!line_end) line_end = end;
+
+    // Header: only the geometry matters
+    const char* w = strstr(data, "\"width\"");
+    const char* h = strstr(data, "\"height\"");
+    if (!w || !h || w > line_end || h > line_end || !strstr(data, "\"version\"")) return false;
+    int cols = (int)strtol(strchr(w, ':') + 1, NULL, 10);
+    int rows = (int)strtol(strchr(h, ':') + 1, NULL, 10);
+    if (cols > 0 && rows > 0 && (cols != term->width || rows != term->height)) KTerm_ReplayResize(term, cols, rows, r);
+
+    unsigned char* text = (unsigned char*)KTerm_Malloc(size + 1);
+    if (!text) return false;
+    bool ok = true;
+    for (const char* line = line_end; line < end && ok; line = line_end) {
+        line++;
+        line_end = memchr(line, '\n', (size_t)(end - line));
+        if (!line_end) line_end = end;
+        while (line < line_end && (*line == ' ' || *line == '\t' || *line == '\r')) line++;
+        if (line >= line_end) continue;
+        if (*line != '[') { ok = false; break; }
+
+        // [time, "code", "data"]
+        char* after_time;
+        double when = strtod(line + 1, &after_time);
+        const char* code = memchr(after_time, '"', (size_t)(line_end - after_time));
+        const char* body = code ? memchr(code + 3, '"', (size_t)(line_end - (code + 3))) : NULL;
+        size_t len = 0;
+        if (!code || !body || code + 3 > line_end || !KTerm_ReplayJSONString(body + 1, line_end, text, &len)) {
+            ok = false;
+            break;
+        }
+        r->recorded_seconds = when;
+        KTerm_ReplayWait(when, wall_start, speed);
+
+        if (code[1] == 'o') {
+            KTerm_ReplayData(term, term->active_session, text, len, r);
+        } else if (code[1] == 'r') {
+            text[len] = '\0';
+            int rc = 0, rr = 0;
+            if (sscanf((const char*)text, "%dx%d", &rc, &rr) == 2 && rc > 0 && rr > 0) KTerm_ReplayResize(term, rc, rr, r);
+        } else if (code[1] == 'm' && len == 27 && memcmp(text, "kterm-hash:", 11) == 0) {
+            text[len] = '\0';
+            r->expected_hash = strtoull((const char*)text + 11, NULL, 16);
+            r->has_expected_hash = true;
+        }
+        // "i" (input) events are not host output
+    }
+    KTerm_Free(text);
+    return ok;
+}
+
+bool KTerm_Replay(KTerm* term, const char* path, double speed, KTermReplayResult* result) {
+    KTermReplayResult local;
+    KTermReplayResult* r = result ? result : &local;
+    memset(r, 0, sizeof(*r));
+    if (!term || !path) return false;
+
+    FILE* f = fopen(path, "rb");
+    if (!f) {
+        KTerm_ReportError(term, KTERM_LOG_ERROR, KTERM_SOURCE_SYSTEM, "Cannot open replay file %s", path);
+        return false;
+    }
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    unsigned char* data = size > 0 ? (unsigned char*)KTerm_Malloc((size_t)size + 1) : NULL;
+    if (!data || fread(data, 1, (size_t)size, f) != (size_t)size) {
+        fclose(f);
+        KTerm_Free(data);
+        KTerm_ReportError(term, KTERM_LOG_ERROR, KTERM_SOURCE_SYSTEM, "Cannot read replay file %s", path);
+        return false;
+    }
+    fclose(f);
+    data[size] = '\0';
+
+    uint64_t wall_start = KTerm_StatsNow();
+    bool ok;
+    if (size >= 4 && memcmp(data, "KTRC", 4) == 0) {
+        ok = KTerm_ReplayBinary(term, data, (size_t)size, speed, wall_start, r);
+    } else {
+        ok = KTerm_ReplayAsciicast(term, (const char*)data, (size_t)size, speed, wall_start, r);
+    }
+    KTerm_Free(data);
+    if (!ok) {
+        KTerm_ReportError(term, KTERM_LOG_ERROR, KTERM_SOURCE_SYSTEM, "Malformed replay file %s", path);
+        return false;
+    }
+
+    KTerm_ReplayDrain(term, r);
+    r->elapsed_seconds = (double)(KTerm_StatsNow() - wall_start) / 1e9;
+    r->screen_hash = KTerm_GetScreenHash(term);
+    r->hash_match = !r->has_expected_hash || r->screen_hash == r->expected_hash;
+    if (!r->hash_match) {
+        KTerm_ReportError(term, KTERM_LOG_WARNING, KTERM_SOURCE_SYSTEM,
+                          "Replay of %s ended on screen hash %016llx, recorded %016llx", path,
+                          (unsigned long long)r->screen_hash, (unsigned long long)r->expected_hash);
+    }
+    return true;
+}
+
+// =============================================================================
+// SESSION SNAPSHOTS
+// =============================================================================
+// A snapshot holds what a session shows and what it needs to go on parsing:
+// the scrollback and both screens, cursor and SGR state, modes, margins, tab
+// stops, charsets, title, soft font, Kitty and Sixel images, a sequence in
+// progress and the input not yet parsed. Restoring one in a new process takes
+// the place of replaying the session's output.
+//
+// KTSS layout, little-endian:
+//   header: "KTSS" u16 version, u16 flags, u32 body size before compression
+//   body:   chunks of u8 tag, varint length, payload; unknown tags are skipped
+//   cells:  runs of equal cells, each a u8 mask of the fields that differ from
+//           the previous run (KTERM_SNAP_CELL_*), varint length - 1 when the
+//           mask has KTERM_SNAP_CELL_RUN, then those fields
+// Signed values are zigzag varints. The ring is written oldest row first, so a
+// snapshot restores into any scrollback size; history that does not fit is
+// dropped oldest first.
+//
+// With KTERM_SNAPSHOT_COMPRESS the body is LZ77 coded: varint literal count,
+// literals, and until the body is complete, varint match length - 4 and varint
+// distance.
+
+#define KTERM_SNAPSHOT_VERSION 1
+#define KTERM_SNAPSHOT_HEADER 12
+#define KTERM_SNAPSHOT_HASH_BITS 14
+
+enum {
+    KTERM_SNAP_GRID = 1, KTERM_SNAP_CURSOR = 2, KTERM_SNAP_MODES = 3, KTERM_SNAP_TITLE = 4,
+    KTERM_SNAP_SOFT_FONT = 5, KTERM_SNAP_KITTY = 6, KTERM_SNAP_SIXEL = 7, KTERM_SNAP_PARSER = 8,
+    KTERM_SNAP_INPUT = 9
+};
+
+enum {
+    KTERM_SNAP_CELL_CH = 1, KTERM_SNAP_CELL_FLAGS = 2, KTERM_SNAP_CELL_FG = 4, KTERM_SNAP_CELL_BG = 8,
+    KTERM_SNAP_CELL_UL = 16, KTERM_SNAP_CELL_ST = 32, KTERM_SNAP_CELL_RUN = 64
+};
+
+typedef struct {
+    unsigned char* data;
+    size_t len;
+    size_t cap;
+    bool failed; // Out of memory
+} KTermSnapshotWriter;
+
+typedef struct {
+    const unsigned char* p;
+    const unsigned char* end;
+    bool failed; // Truncated or out of range
+} KTermSnapshotReader;
+
+// Run-length state shared by the rows of a buffer
+typedef struct {
+    EnhancedTermChar last; // Cell of the previous run; fields not written are taken from it
+    EnhancedTermChar pending;
+    uint64_t run;
+    bool protected_cells;  // Restore: a DECSCA protected cell was read
+} KTermSnapshotCells;
+
+// Restore state that cannot live in the staging session until it is committed
+typedef struct {
+    bool have_grid;
+    int gl, gr;             // Charset slots (0-3) of session->charset
+    int saved_gl, saved_gr; // The same for the DECSC state
+    unsigned char* input;   // Unparsed host bytes
+    size_t input_len;
+} KTermSnapshotRestore;
+
+static void KTerm_SnapPutBytes(KTermSnapshotWriter* w, const void* p, size_t n) {
+    if (w->failed) return;
+    if (w->len + n > w->cap) {
+        size_t cap = w->cap ? w->cap : 4096;
+        while (cap < w->len + n) cap *= 2;
+        unsigned char* data = (unsigned char*)KTerm_Realloc(w->data, cap);
+        if (!data) {
+            w->failed = true;
+            return;
+        }
+        w->data = data;
+        w->cap = cap;
+    }
+    if (n > 0) memcpy(w->data + w->len, p, n);
+    w->len += n;
+}
+
+static void KTerm_SnapPutU8(KTermSnapshotWriter* w, unsigned int v) {
+    unsigned char b = (unsigned char)v;
+    KTerm_SnapPutBytes(w, &b, 1);
+}
+
+static void KTerm_SnapPutVarint(KTermSnapshotWriter* w, uint64_t v) {
+    unsigned char b[10];
+    int n = 0;
+    while (v >= 0x80) {
+        b[n++] = (unsigned char)((v & 0x7F) | 0x80);
+        v >>= 7;
+    }
+    b[n++] = (unsigned char)v;
+    KTerm_SnapPutBytes(w, b, (size_t)n);
+}
+
+static void KTerm_SnapPutInt(KTermSnapshotWriter* w, int v) {
+    KTerm_SnapPutVarint(w, ((uint32_t)v << 1) ^ (uint32_t)(v >> 31));
+}
+
+static void KTerm_SnapPutColor(KTermSnapshotWriter* w, const ExtendedKTermColor* c) {
+    KTerm_SnapPutVarint(w, (uint32_t)c->color_mode);
+    if (c->color_mode == 1) {
+        unsigned char rgba[4] = { c->value.rgb.r, c->value.rgb.g, c->value.rgb.b, c->value.rgb.a };
+        KTerm_SnapPutBytes(w, rgba, 4);
+    } else {
+        // Mode 2 (default) keeps stale RGB bits in the union; only a palette index carries meaning
+        KTerm_SnapPutInt(w, c->color_mode == 0 ? c->value.index : 0);
+    }
+}
+
+static void KTerm_SnapPutString(KTermSnapshotWriter* w, const char* s) {
+    size_t n = strlen(s);
+    KTerm_SnapPutVarint(w, n);
+    KTerm_SnapPutBytes(w, s, n);
+}
+
+// Append `chunk` as a tagged chunk and empty it for the next one
+static void KTerm_SnapPutChunk(KTermSnapshotWriter* w, int tag, KTermSnapshotWriter* chunk) {
+    if (chunk->failed) w->failed = true;
+    KTerm_SnapPutU8(w, (unsigned int)tag);
+    KTerm_SnapPutVarint(w, chunk->len);
+    KTerm_SnapPutBytes(w, chunk->data, chunk->len);
+    chunk->len = 0;
+}
+
+static uint64_t KTerm_SnapGetVarint(KTermSnapshotReader* r) {
+    uint64_t v = 0;
+    if (r->failed || !KTerm_ReplayReadVarint(&r->p, r->end, &v)) {
+        r->failed = true;
+        return 0;
+    }
+    return v;
+}
+
+static int KTerm_SnapGetInt(KTermSnapshotReader* r) {
+    uint64_t v = KTerm_SnapGetVarint(r);
+    if (v > 0xFFFFFFFFu) r->failed = true;
+    uint32_t u = (uint32_t)v;
+    return (int)((u >> 1) ^ (0u - (u & 1)));
+}
+
+// A varint in [0, max]
+static int KTerm_SnapGetCount(KTermSnapshotReader* r, int max) {
+    uint64_t v = KTerm_SnapGetVarint(r);
+    if (v > (uint64_t)max) {
+        r->failed = true;
+        return 0;
+    }
+    return (int)v;
+}
+
+static unsigned int KTerm_SnapGetU8(KTermSnapshotReader* r) {
+    if (r->failed || r->p >= r->end) {
+        r->failed = true;
+        return 0;
+    }
+    return *r->p++;
+}
+
+static bool KTerm_SnapGetBytes(KTermSnapshotReader* r, void* out, size_t n) {
+    if (r->failed || (size_t)(r->end - r->p) < n) {
+        r->failed = true;
+        return false;
+    }
+    memcpy(out, r->p, n);
+    r->p += n;
+    return true;
+}
+
+// Items of at least one byte each: a count beyond the bytes left is malformed
+static int KTerm_SnapGetItems(KTermSnapshotReader* r) {
+    size_t left = (size_t)(r->end - r->p);
+    return KTerm_SnapGetCount(r, left > INT_MAX ? INT_MAX : (int)left);
+}
+
+static ExtendedKTermColor KTerm_SnapGetColor(KTermSnapshotReader* r) {
+    ExtendedKTermColor c;
+    memset(&c, 0, sizeof(c));
+    c.color_mode = KTerm_SnapGetCount(r, 2);
+    if (c.color_mode == 1) {
+        unsigned char rgba[4] = {0};
+        KTerm_SnapGetBytes(r, rgba, 4);
+        c.value.rgb = (RGB_KTermColor){ rgba[0], rgba[1], rgba[2], rgba[3] };
+    } else {
+        // Indexes color_palette when rendered: anything past the palette is malformed
+        c.value.index = KTerm_SnapGetInt(r);
+        if (c.value.index < 0 || c.value.index > 255) {
+            r->failed = true;
+            c.value.index = 0;
+        }
+    }
+    return c;
+}
+
+static void KTerm_SnapGetString(KTermSnapshotReader* r, char* out, size_t cap) {
+    size_t n = (size_t)KTerm_SnapGetItems(r);
+    if (n >= cap || !KTerm_SnapGetBytes(r, out, n)) {
+        r->failed = true;
+        n = 0;
+    }
+    out[n] = '\0';
+}
+
+static bool KTerm_SnapSameColor(const ExtendedKTermColor* a, const ExtendedKTermColor* b) {
+    if (a->color_mode != b->color_mode) return false;
+    if (a->color_mode == 2) return true; // Default: the union holds nothing
+    if (a->color_mode == 0) return a->value.index == b->value.index;
+    return a->value.rgb.r == b->value.rgb.r && a->value.rgb.g == b->value.rgb.g &&
+           a->value.rgb.b == b->value.rgb.b && a->value.rgb.a == b->value.rgb.a;
+}
+
+static unsigned int KTerm_SnapCellDiff(const EnhancedTermChar* a, const EnhancedTermChar* b) {
+    unsigned int mask = 0;
+    if (a->ch != b->ch) mask |= KTERM_SNAP_CELL_CH;
+    if (a->flags != b->flags) mask |= KTERM_SNAP_CELL_FLAGS;
+    if (!KTerm_SnapSameColor(&a->fg_color, &b->fg_color)) mask |= KTERM_SNAP_CELL_FG;
+    if (!KTerm_SnapSameColor(&a->bg_color, &b->bg_color)) mask |= KTERM_SNAP_CELL_BG;
+    if (!KTerm_SnapSameColor(&a->ul_color, &b->ul_color)) mask |= KTERM_SNAP_CELL_UL;
+    if (!KTerm_SnapSameColor(&a->st_color, &b->st_color)) mask |= KTERM_SNAP_CELL_ST;
+    return mask;
+}
+
+static void KTerm_SnapFlushRun(KTermSnapshotWriter* w, KTermSnapshotCells* c) {
+    if (c->run == 0) return;
+    const EnhancedTermChar* cell = &c->pending;
+    unsigned int mask = KTerm_SnapCellDiff(cell, &c->last);
+    if (c->run > 1) mask |= KTERM_SNAP_CELL_RUN;
+    KTerm_SnapPutU8(w, mask);
+    if (mask & KTERM_SNAP_CELL_RUN) KTerm_SnapPutVarint(w, c->run - 1);
+    if (mask & KTERM_SNAP_CELL_CH) KTerm_SnapPutVarint(w, cell->ch);
+    if (mask & KTERM_SNAP_CELL_FLAGS) KTerm_SnapPutVarint(w, cell->flags);
+    if (mask & KTERM_SNAP_CELL_FG) KTerm_SnapPutColor(w, &cell->fg_color);
+    if (mask & KTERM_SNAP_CELL_BG) KTerm_SnapPutColor(w, &cell->bg_color);
+    if (mask & KTERM_SNAP_CELL_UL) KTerm_SnapPutColor(w, &cell->ul_color);
+    if (mask & KTERM_SNAP_CELL_ST) KTerm_SnapPutColor(w, &cell->st_color);
+    c->last = c->pending;
+    c->run = 0;
+}
+
+static void KTerm_SnapPutCells(KTermSnapshotWriter* w, KTermSnapshotCells* c, const EnhancedTermChar* cells, int count) {
+    for (int i = 0; i < count; i++) {
+        EnhancedTermChar cell = cells[i];
+        cell.flags &= ~KTERM_FLAG_DIRTY;
+        if (c->run > 0 && KTerm_SnapCellDiff(&cell, &c->pending) == 0) {
+            c->run++;
+            continue;
+        }
+        KTerm_SnapFlushRun(w, c);
+        c->pending = cell;
+        c->run = 1;
+    }
+}
+
+static void KTerm_SnapGetRun(KTermSnapshotReader* r, KTermSnapshotCells* c) {
+    unsigned int mask = KTerm_SnapGetU8(r);
+    if (mask & ~0x7Fu) r->failed = true;
+    c->run = (mask & KTERM_SNAP_CELL_RUN) ? KTerm_SnapGetVarint(r) + 1 : 1;
+    EnhancedTermChar* cell = &c->last;
+    if (mask & KTERM_SNAP_CELL_CH) cell->ch = (unsigned int)KTerm_SnapGetVarint(r);
+    if (mask & KTERM_SNAP_CELL_FLAGS) cell->flags = (uint32_t)KTerm_SnapGetVarint(r) & ~KTERM_FLAG_DIRTY;
+    if (mask & KTERM_SNAP_CELL_FG) cell->fg_color = KTerm_SnapGetColor(r);
+    if (mask & KTERM_SNAP_CELL_BG) cell->bg_color = KTerm_SnapGetColor(r);
+    if (mask & KTERM_SNAP_CELL_UL) cell->ul_color = KTerm_SnapGetColor(r);
+    if (mask & KTERM_SNAP_CELL_ST) cell->st_color = KTerm_SnapGetColor(r);
+    if (r->failed) c->run = 0;
+}
+
+static void KTerm_SnapGetCells(KTermSnapshotReader* r, KTermSnapshotCells* c, EnhancedTermChar* out, int count) {
+    for (int i = 0; i < count && !r->failed; i++) {
+        if (c->run == 0) {
+            KTerm_SnapGetRun(r, c);
+            if (c->last.flags & KTERM_ATTR_PROTECTED) c->protected_cells = true;
+            if (r->failed) return;
+        }
+        out[i] = c->last;
+        out[i].flags |= KTERM_FLAG_DIRTY;
+        c->run--;
+    }
+}
+
+// History that does not fit is passed over a run at a time
+static void KTerm_SnapSkipCells(KTermSnapshotReader* r, KTermSnapshotCells* c, uint64_t count) {
+    while (count > 0 && !r->failed) {
+        if (c->run == 0) KTerm_SnapGetRun(r, c);
+        uint64_t n = (c->run < count) ? c->run : count;
+        c->run -= n;
+        count -= n;
+    }
+}
+
+// Rows of the buffer swapped out to alt_buffer: the alternate screen, or the primary
+// ring while the alternate screen is shown (a screen high if resized meanwhile)
+static int KTerm_SnapshotSwappedHeight(KTerm* term, KTermSession* session) {
+    if (!(session->dec_modes & KTERM_MODE_ALTSCREEN) || session->buffer_height != session->rows) return session->rows;
+    return session->rows + term->session_buffer_sizes.scrollback;
+}
+
+// Row y of the primary ring or of the alternate screen, whichever buffer holds it now
+static const EnhancedTermChar* KTerm_SnapshotRow(KTerm* term, KTermSession* session, bool primary, int y) {
+    bool alt = (session->dec_modes & KTERM_MODE_ALTSCREEN) != 0;
+    if (primary != alt) return GetActiveScreenRow(session, y);
+    int height = KTerm_SnapshotSwappedHeight(term, session);
+    int index = (session->alt_screen_head + y) % height;
+    if (index < 0) index += height;
+    return &session->alt_buffer[index * session->cols];
+}
+
+// gl/gr point at g0-g3 of the live charset, also from the DECSC copy
+static int KTerm_SnapshotCharsetSlot(const CharsetState* cs, const CharsetState* home, const CharacterSet* p) {
+    if (p == &cs->g1 || p == &home->g1) return 1;
+    if (p == &cs->g2 || p == &home->g2) return 2;
+    if (p == &cs->g3 || p == &home->g3) return 3;
+    return 0;
+}
+
+static CharacterSet* KTerm_SnapshotCharsetPtr(CharsetState* home, int slot) {
+    switch (slot) {
+        case 1: return &home->g1;
+        case 2: return &home->g2;
+        case 3: return &home->g3;
+        default: return &home->g0;
+    }
+}
+
+static void KTerm_SnapPutCharset(KTermSnapshotWriter* w, const CharsetState* cs, const CharsetState* home) {
+    KTerm_SnapPutVarint(w, (uint32_t)cs->g0);
+    KTerm_SnapPutVarint(w, (uint32_t)cs->g1);
+    KTerm_SnapPutVarint(w, (uint32_t)cs->g2);
+    KTerm_SnapPutVarint(w, (uint32_t)cs->g3);
+    KTerm_SnapPutU8(w, (unsigned int)KTerm_SnapshotCharsetSlot(cs, home, cs->gl));
+    KTerm_SnapPutU8(w, (unsigned int)KTerm_SnapshotCharsetSlot(cs, home, cs->gr));
+    KTerm_SnapPutU8(w, cs->single_shift_2);
+    KTerm_SnapPutU8(w, cs->single_shift_3);
+}
+
+static void KTerm_SnapGetCharset(KTermSnapshotReader* r, CharsetState* cs, int* gl, int* gr) {
+    cs->g0 = (CharacterSet)KTerm_SnapGetCount(r, CHARSET_COUNT - 1);
+    cs->g1 = (CharacterSet)KTerm_SnapGetCount(r, CHARSET_COUNT - 1);
+    cs->g2 = (CharacterSet)KTerm_SnapGetCount(r, CHARSET_COUNT - 1);
+    cs->g3 = (CharacterSet)KTerm_SnapGetCount(r, CHARSET_COUNT - 1);
+    *gl = (int)(KTerm_SnapGetU8(r) & 3);
+    *gr = (int)(KTerm_SnapGetU8(r) & 3);
+    cs->single_shift_2 = KTerm_SnapGetU8(r) != 0;
+    cs->single_shift_3 = KTerm_SnapGetU8(r) != 0;
+}
+
+// Rows a Kitty or Sixel image has scrolled since it was placed
+static int KTerm_SnapshotScrolled(KTermSession* session, int start_row) {
+    int dist = (session->screen_head - start_row) % session->buffer_height;
+    return dist < 0 ? dist + session->buffer_height : dist;
+}
+
+static void KTerm_SnapPutGrid(KTerm* term, KTermSession* session, KTermSnapshotWriter* w) {
+    bool alt = (session->dec_modes & KTERM_MODE_ALTSCREEN) != 0;
+    int primary_height = alt ? KTerm_SnapshotSwappedHeight(term, session) : session->buffer_height;
+    int history = session->history_rows_populated;
+    if (history > primary_height - session->rows) history = primary_height - session->rows;
+    if (history < 0) history = 0;
+
+    KTerm_SnapPutVarint(w, (uint32_t)session->cols);
+    KTerm_SnapPutVarint(w, (uint32_t)session->rows);
+    KTerm_SnapPutVarint(w, (uint32_t)history);
+    KTerm_SnapPutU8(w, alt);
+    KTerm_SnapPutInt(w, session->lines_per_page);
+    KTerm_SnapPutInt(w, session->view_offset);
+    KTerm_SnapPutInt(w, session->saved_view_offset);
+
+    KTermSnapshotCells cells;
+    memset(&cells, 0, sizeof(cells));
+    for (int y = -history; y < session->rows; y++) {
+        KTerm_SnapPutCells(w, &cells, KTerm_SnapshotRow(term, session, true, y), session->cols);
+    }
+    for (int y = 0; y < session->rows; y++) {
+        KTerm_SnapPutCells(w, &cells, KTerm_SnapshotRow(term, session, false, y), session->cols);
+    }
+    KTerm_SnapFlushRun(w, &cells);
+}
+
+static bool KTerm_SnapGetGrid(KTerm* term, KTermSession* st, KTermSnapshotRestore* ctx, KTermSnapshotReader* r) {
+    int cols = KTerm_SnapGetCount(r, KTERM_MAX_COLS);
+    int rows = KTerm_SnapGetCount(r, KTERM_MAX_ROWS);
+    int history = KTerm_SnapGetCount(r, INT_MAX / 2);
+    bool alt = KTerm_SnapGetU8(r) != 0;
+    int lines_per_page = KTerm_SnapGetInt(r);
+    int view_offset = KTerm_SnapGetInt(r);
+    int saved_view_offset = KTerm_SnapGetInt(r);
+    if (r->failed || cols < 1 || rows < 1 || ctx->have_grid) return false;
+
+    int height = rows + term->session_buffer_sizes.scrollback;
+    int kept = (history < height - rows) ? history : height - rows;
+    EnhancedTermChar* primary = (EnhancedTermChar*)KTerm_Malloc((size_t)height * cols * sizeof(EnhancedTermChar));
+    EnhancedTermChar* alternate = (EnhancedTermChar*)KTerm_Malloc((size_t)rows * cols * sizeof(EnhancedTermChar));
+    st->row_dirty = (uint8_t*)KTerm_Calloc((size_t)rows, sizeof(uint8_t));
+    if (!primary || !alternate || !st->row_dirty) {
+        KTerm_Free(primary);
+        KTerm_Free(alternate);
+        return false;
+    }
+    EnhancedTermChar blank = {
+        .ch = ' ',
+        .fg_color = {.color_mode = 0, .value.index = COLOR_WHITE},
+        .bg_color = {.color_mode = 0, .value.index = COLOR_BLACK},
+        .flags = KTERM_FLAG_DIRTY
+    };
+    for (int i = 0; i < height * cols; i++) primary[i] = blank;
+
+    // Head at 0: history row -k lands at height - k
+    KTermSnapshotCells cells;
+    memset(&cells, 0, sizeof(cells));
+    KTerm_SnapSkipCells(r, &cells, (uint64_t)(history - kept) * (uint64_t)cols);
+    for (int y = -kept; y < rows && !r->failed; y++) KTerm_SnapGetCells(r, &cells, &primary[((y + height) % height) * cols], cols);
+    for (int y = 0; y < rows && !r->failed; y++) KTerm_SnapGetCells(r, &cells, &alternate[y * cols], cols);
+    if (r->failed || cells.run != 0) {
+        KTerm_Free(primary);
+        KTerm_Free(alternate);
+        return false;
+    }
+
+    st->cols = cols;
+    st->rows = rows;
+    st->screen_buffer = alt ? alternate : primary;
+    st->alt_buffer = alt ? primary : alternate;
+    st->buffer_height = alt ? rows : height;
+    st->screen_head = 0;
+    st->alt_screen_head = 0;
+    st->history_rows_populated = kept;
+    st->lines_per_page = lines_per_page;
+    st->view_offset = alt ? 0 : (view_offset < 0 ? 0 : (view_offset > kept ? kept : view_offset));
+    st->saved_view_offset = saved_view_offset < 0 ? 0 : (saved_view_offset > kept ? kept : saved_view_offset);
+    st->protection_used = cells.protected_cells;
+    if (alt) st->dec_modes |= KTERM_MODE_ALTSCREEN;
+    ctx->have_grid = true;
+    return true;
+}
+
+static void KTerm_SnapPutCursor(KTermSession* session, KTermSnapshotWriter* w) {
+    KTerm_SnapPutInt(w, session->cursor.x);
+    KTerm_SnapPutInt(w, session->cursor.y);
+    KTerm_SnapPutU8(w, session->cursor.visible);
+    KTerm_SnapPutU8(w, session->cursor.blink_enabled);
+    KTerm_SnapPutVarint(w, (uint32_t)session->cursor.shape);
+    KTerm_SnapPutColor(w, &session->cursor.color);
+
+    const SavedCursorState* saved = &session->saved_cursor;
+    KTerm_SnapPutU8(w, session->saved_cursor_valid);
+    KTerm_SnapPutInt(w, saved->x);
+    KTerm_SnapPutInt(w, saved->y);
+    KTerm_SnapPutU8(w, saved->origin_mode);
+    KTerm_SnapPutU8(w, saved->auto_wrap_mode);
+    KTerm_SnapPutColor(w, &saved->fg_color);
+    KTerm_SnapPutColor(w, &saved->bg_color);
+    KTerm_SnapPutVarint(w, saved->attributes);
+    KTerm_SnapPutCharset(w, &saved->charset, &session->charset);
+}
+
+static int KTerm_SnapClamp(int v, int lo, int hi) {
+    return v < lo ? lo : (v > hi ? hi : v);
+}
+
+static bool KTerm_SnapGetCursor(KTermSession* st, KTermSnapshotRestore* ctx, KTermSnapshotReader* r) {
+    if (!ctx->have_grid) return false;
+    // x may sit one past the last column while a wrap is pending
+    st->cursor.x = KTerm_SnapClamp(KTerm_SnapGetInt(r), 0, st->cols);
+    st->cursor.y = KTerm_SnapClamp(KTerm_SnapGetInt(r), 0, st->rows - 1);
+    st->cursor.visible = KTerm_SnapGetU8(r) != 0;
+    st->cursor.blink_enabled = KTerm_SnapGetU8(r) != 0;
+    st->cursor.shape = (CursorShape)KTerm_SnapGetCount(r, CURSOR_BAR_BLINK);
+    st->cursor.color = KTerm_SnapGetColor(r);
+
+    SavedCursorState* saved = &st->saved_cursor;
+    st->saved_cursor_valid = KTerm_SnapGetU8(r) != 0;
+    saved->x = KTerm_SnapClamp(KTerm_SnapGetInt(r), 0, st->cols);
+    saved->y = KTerm_SnapClamp(KTerm_SnapGetInt(r), 0, st->rows - 1);
+    saved->origin_mode = KTerm_SnapGetU8(r) != 0;
+    saved->auto_wrap_mode = KTerm_SnapGetU8(r) != 0;
+    saved->fg_color = KTerm_SnapGetColor(r);
+    saved->bg_color = KTerm_SnapGetColor(r);
+    saved->attributes = (uint32_t)KTerm_SnapGetVarint(r);
+    KTerm_SnapGetCharset(r, &saved->charset, &ctx->saved_gl, &ctx->saved_gr);
+    return !r->failed;
+}
+
+static void KTerm_SnapPutModes(KTermSession* session, KTermSnapshotWriter* w) {
+    KTerm_SnapPutVarint(w, session->dec_modes);
+    KTerm_SnapPutU8(w, session->ansi_modes.insert_replace);
+    KTerm_SnapPutU8(w, session->ansi_modes.line_feed_new_line);
+
+    KTerm_SnapPutColor(w, &session->current_fg);
+    KTerm_SnapPutColor(w, &session->current_bg);
+    KTerm_SnapPutColor(w, &session->current_ul_color);
+    KTerm_SnapPutColor(w, &session->current_st_color);
+    KTerm_SnapPutVarint(w, session->current_attributes);
+    KTerm_SnapPutVarint(w, (uint32_t)session->sgr_stack_depth);
+    for (int i = 0; i < session->sgr_stack_depth; i++) {
+        const SavedSGRState* sgr = &session->sgr_stack[i];
+        KTerm_SnapPutColor(w, &sgr->fg_color);
+        KTerm_SnapPutColor(w, &sgr->bg_color);
+        KTerm_SnapPutColor(w, &sgr->ul_color);
+        KTerm_SnapPutColor(w, &sgr->st_color);
+        KTerm_SnapPutVarint(w, sgr->attributes);
+    }
+
+    KTerm_SnapPutInt(w, session->scroll_top);
+    KTerm_SnapPutInt(w, session->scroll_bottom);
+    KTerm_SnapPutInt(w, session->left_margin);
+    KTerm_SnapPutInt(w, session->right_margin);
+    KTerm_SnapPutCharset(w, &session->charset, &session->charset);
+
+    // Tab stops as the distance from the previous one
+    KTerm_SnapPutVarint(w, (uint32_t)session->tab_stops.default_width);
+    int stops = 0;
+    for (int i = 0; i < session->tab_stops.capacity; i++) stops += session->tab_stops.stops[i];
+    KTerm_SnapPutVarint(w, (uint32_t)stops);
+    for (int i = 0, prev = 0; i < session->tab_stops.capacity; i++) {
+        if (!session->tab_stops.stops[i]) continue;
+        KTerm_SnapPutVarint(w, (uint32_t)(i - prev));
+        prev = i;
+    }
+
+    KTerm_SnapPutVarint(w, (uint32_t)session->conformance.level);
+    KTerm_SnapPutVarint(w, session->conformance.features);
+    KTerm_SnapPutU8(w, session->conformance.strict_mode);
+    KTerm_SnapPutU8(w, session->enable_wide_chars);
+    KTerm_SnapPutU8(w, session->input.keypad_application_mode);
+    KTerm_SnapPutU8(w, session->input.use_8bit_controls);
+    KTerm_SnapPutU8(w, session->input.backarrow_sends_bs);
+    KTerm_SnapPutU8(w, session->input.delete_sends_del);
+    KTerm_SnapPutU8(w, session->input.meta_sends_escape);
+    KTerm_SnapPutVarint(w, (uint32_t)session->mouse.mode);
+    KTerm_SnapPutU8(w, session->mouse.enabled);
+    KTerm_SnapPutU8(w, session->mouse.sgr_mode);
+    KTerm_SnapPutU8(w, session->mouse.focus_tracking);
+    KTerm_SnapPutU8(w, session->bracketed_paste.enabled);
+}
+
+static bool KTerm_SnapGetModes(KTermSession* st, KTermSnapshotRestore* ctx, KTermSnapshotReader* r) {
+    if (!ctx->have_grid) return false;
+    // The alternate screen is part of the grid chunk
+    st->dec_modes = ((uint32_t)KTerm_SnapGetVarint(r) & ~KTERM_MODE_ALTSCREEN) | (st->dec_modes & KTERM_MODE_ALTSCREEN);
+    st->ansi_modes.insert_replace = KTerm_SnapGetU8(r) != 0;
+    st->ansi_modes.line_feed_new_line = KTerm_SnapGetU8(r) != 0;
+
+    st->current_fg = KTerm_SnapGetColor(r);
+    st->current_bg = KTerm_SnapGetColor(r);
+    st->current_ul_color = KTerm_SnapGetColor(r);
+    st->current_st_color = KTerm_SnapGetColor(r);
+    st->current_attributes = (uint32_t)KTerm_SnapGetVarint(r);
+    st->sgr_stack_depth = KTerm_SnapGetCount(r, (int)(sizeof(st->sgr_stack) / sizeof(st->sgr_stack[0])));
+    for (int i = 0; i < st->sgr_stack_depth && !r->failed; i++) {
+        SavedSGRState* sgr = &st->sgr_stack[i];
+        sgr->fg_color = KTerm_SnapGetColor(r);
+        sgr->bg_color = KTerm_SnapGetColor(r);
+        sgr->ul_color = KTerm_SnapGetColor(r);
+        sgr->st_color = KTerm_SnapGetColor(r);
+        sgr->attributes = (uint32_t)KTerm_SnapGetVarint(r);
+    }
+
+    st->scroll_top = KTerm_SnapGetInt(r);
+    st->scroll_bottom = KTerm_SnapGetInt(r);
+    st->left_margin = KTerm_SnapGetInt(r);
+    st->right_margin = KTerm_SnapGetInt(r);
+    if (st->scroll_top < 0 || st->scroll_bottom >= st->rows || st->scroll_top > st->scroll_bottom) {
+        st->scroll_top = 0;
+        st->scroll_bottom = st->rows - 1;
+    }
+    if (st->left_margin < 0 || st->right_margin >= st->cols || st->left_margin > st->right_margin) {
+        st->left_margin = 0;
+        st->right_margin = st->cols - 1;
+    }
+    KTerm_SnapGetCharset(r, &st->charset, &ctx->gl, &ctx->gr);
+
+    TabStops* tabs = &st->tab_stops;
+    tabs->default_width = KTerm_SnapGetCount(r, KTERM_MAX_COLS);
+    if (tabs->default_width < 1) tabs->default_width = 8;
+    tabs->capacity = (st->cols < MAX_TAB_STOPS) ? MAX_TAB_STOPS : st->cols;
+    tabs->stops = (bool*)KTerm_Calloc((size_t)tabs->capacity, sizeof(bool));
+    if (!tabs->stops) return false;
+    int stops = KTerm_SnapGetItems(r);
+    for (int i = 0, col = 0; i < stops && !r->failed; i++) {
+        col += KTerm_SnapGetCount(r, KTERM_MAX_COLS);
+        if (col < tabs->capacity && !tabs->stops[col]) {
+            tabs->stops[col] = true;
+            tabs->count++;
+        }
+    }
+
+    st->conformance.level = (VTLevel)KTerm_SnapGetCount(r, INT_MAX);
+    st->conformance.features = (VTFeatures)KTerm_SnapGetVarint(r);
+    st->conformance.strict_mode = KTerm_SnapGetU8(r) != 0;
+    st->enable_wide_chars = KTerm_SnapGetU8(r) != 0;
+    st->input.keypad_application_mode = KTerm_SnapGetU8(r) != 0;
+    st->input.use_8bit_controls = KTerm_SnapGetU8(r) != 0;
+    st->input.backarrow_sends_bs = KTerm_SnapGetU8(r) != 0;
+    st->input.delete_sends_del = KTerm_SnapGetU8(r) != 0;
+    st->input.meta_sends_escape = KTerm_SnapGetU8(r) != 0;
+    st->mouse.mode = (MouseTrackingMode)KTerm_SnapGetCount(r, MOUSE_TRACKING_PIXEL);
+    st->mouse.enabled = KTerm_SnapGetU8(r) != 0;
+    st->mouse.sgr_mode = KTerm_SnapGetU8(r) != 0;
+    st->mouse.focus_tracking = KTerm_SnapGetU8(r) != 0;
+    st->bracketed_paste.enabled = KTerm_SnapGetU8(r) != 0;
+    return !r->failed;
+}
+
+static void KTerm_SnapPutSoftFont(KTermSession* session, KTermSnapshotWriter* w) {
+    const SoftFont* font = &session->soft_font;
+    KTerm_SnapPutVarint(w, (uint32_t)font->char_width);
+    KTerm_SnapPutVarint(w, (uint32_t)font->char_height);
+    KTerm_SnapPutU8(w, font->active);
+    KTerm_SnapPutBytes(w, font->name, sizeof(font->name));
+    int loaded = 0;
+    for (int i = 0; i < 256; i++) loaded += font->loaded[i];
+    KTerm_SnapPutVarint(w, (uint32_t)loaded);
+    for (int i = 0; i < 256; i++) {
+        if (!font->loaded[i]) continue;
+        KTerm_SnapPutU8(w, (unsigned int)i);
+        KTerm_SnapPutBytes(w, font->font_data[i], sizeof(font->font_data[i]));
+    }
+}
+
+static bool KTerm_SnapGetSoftFont(KTermSession* st, KTermSnapshotReader* r) {
+    SoftFont* font = &st->soft_font;
+    font->char_width = KTerm_SnapGetCount(r, 32);
+    font->char_height = KTerm_SnapGetCount(r, 32);
+    font->active = KTerm_SnapGetU8(r) != 0;
+    KTerm_SnapGetBytes(r, font->name, sizeof(font->name));
+    font->name[sizeof(font->name) - 1] = '\0';
+    int loaded = KTerm_SnapGetCount(r, 256);
+    for (int i = 0; i < loaded && !r->failed; i++) {
+        int ch = (int)KTerm_SnapGetU8(r);
+        font->loaded[ch] = true;
+        KTerm_SnapGetBytes(r, font->font_data[ch], sizeof(font->font_data[ch]));
+    }
+    if (r->failed || font->char_width < 1 || font->char_height < 1) return false;
+    KTerm_CalculateFontMetrics(font->font_data, 256, font->char_width, font->char_height, 32, false, font->metrics);
+    font->dirty = true;
+    return true;
+}
+
+// Complete images whose frames hold exactly width x height RGBA pixels, which is all the
+// restore side accepts
+static bool KTerm_SnapKittyKept(const KittyImageBuffer* img) {
+    if (!img || !img->complete) return false;
+    for (int f = 0; f < img->frame_count; f++) {
+        const KittyFrame* frame = &img->frames[f];
+        if (frame->width <= 0 || frame->height <= 0) return false;
+        if (frame->size != (size_t)frame->width * (size_t)frame->height * 4) return false;
+    }
+    return img->frame_count > 0;
+}
+
+// Kept images only: an upload in progress is dropped with the sequence carrying it
+static void KTerm_SnapPutKitty(KTermSession* session, KTermSnapshotWriter* w) {
+    const KittyGraphics* kitty = &session->kitty;
+    int count = 0;
+    for (int i = 0; i < kitty->image_count; i++) count += KTerm_SnapKittyKept(&kitty->images[i]);
+    KTerm_SnapPutVarint(w, (uint32_t)count);
+    for (int i = 0; i < kitty->image_count; i++) {
+        const KittyImageBuffer* img = &kitty->images[i];
+        if (!KTerm_SnapKittyKept(img)) continue;
+        KTerm_SnapPutVarint(w, img->id);
+        KTerm_SnapPutInt(w, img->x);
+        KTerm_SnapPutInt(w, img->y);
+        KTerm_SnapPutInt(w, img->z_index);
+        KTerm_SnapPutVarint(w, (uint32_t)KTerm_SnapshotScrolled(session, img->start_row));
+        KTerm_SnapPutU8(w, img->visible);
+        KTerm_SnapPutVarint(w, (uint32_t)img->current_frame);
+        KTerm_SnapPutVarint(w, (uint32_t)img->frame_count);
+        for (int f = 0; f < img->frame_count; f++) {
+            const KittyFrame* frame = &img->frames[f];
+            KTerm_SnapPutVarint(w, (uint32_t)frame->width);
+            KTerm_SnapPutVarint(w, (uint32_t)frame->height);
+            KTerm_SnapPutInt(w, frame->delay_ms);
+            KTerm_SnapPutVarint(w, frame->size);
+            KTerm_SnapPutBytes(w, frame->data, frame->size);
+        }
+    }
+    int placements = 0;
+    for (int i = 0; i < kitty->placement_count; i++) {
+        const KittyImageBuffer* img = KTerm_KittyFindImage((KittyGraphics*)kitty, kitty->placements[i].image_id);
+        placements += KTerm_SnapKittyKept(img);
+    }
+    KTerm_SnapPutVarint(w, (uint32_t)placements);
+    for (int i = 0; i < kitty->placement_count; i++) {
+        const KittyPlacement* pl = &kitty->placements[i];
+        const KittyImageBuffer* img = KTerm_KittyFindImage((KittyGraphics*)kitty, pl->image_id);
+        if (!KTerm_SnapKittyKept(img)) continue;
+        KTerm_SnapPutVarint(w, pl->image_id);
+        KTerm_SnapPutVarint(w, pl->placement_id);
+        KTerm_SnapPutInt(w, pl->x);
+        KTerm_SnapPutInt(w, pl->y);
+        KTerm_SnapPutInt(w, pl->z_index);
+        KTerm_SnapPutVarint(w, (uint32_t)KTerm_SnapshotScrolled(session, pl->start_row));
+    }
+}
+
+// start_row for an image that has scrolled `dist` rows in the restored ring
+static int KTerm_SnapGetStartRow(KTermSession* st, KTermSnapshotReader* r) {
+    int dist = KTerm_SnapGetCount(r, INT_MAX);
+    if (dist >= st->buffer_height) dist = st->buffer_height - 1;
+    return (st->buffer_height - dist) % st->buffer_height;
+}
+
+static bool KTerm_SnapGetKitty(KTermSession* st, KTermSnapshotRestore* ctx, KTermSnapshotReader* r) {
+    KittyGraphics* kitty = &st->kitty;
+    if (!ctx->have_grid || kitty->images) return false;
+    int count = KTerm_SnapGetItems(r);
+    if (count > 0) {
+        kitty->images = (KittyImageBuffer*)KTerm_Calloc((size_t)count, sizeof(KittyImageBuffer));
+        if (!kitty->images) return false;
+        kitty->image_capacity = count;
+    }
+    for (int i = 0; i < count && !r->failed; i++) {
+        KittyImageBuffer* img = &kitty->images[kitty->image_count++];
+        img->id = (uint32_t)KTerm_SnapGetVarint(r);
+        img->x = KTerm_SnapGetInt(r);
+        img->y = KTerm_SnapGetInt(r);
+        img->z_index = KTerm_SnapGetInt(r);
+        img->start_row = KTerm_SnapGetStartRow(st, r);
+        img->visible = KTerm_SnapGetU8(r) != 0;
+        img->complete = true;
+        img->last_used = ++kitty->lru_clock;
+        img->current_frame = KTerm_SnapGetItems(r);
+        int frames = KTerm_SnapGetItems(r);
+        if (r->failed || frames < 1 || img->current_frame >= frames) return false;
+        img->frames = (KittyFrame*)KTerm_Calloc((size_t)frames, sizeof(KittyFrame));
+        if (!img->frames) return false;
+        img->frame_capacity = frames;
+        for (int f = 0; f < frames && !r->failed; f++) {
+            KittyFrame* frame = &img->frames[img->frame_count++];
+            frame->width = KTerm_SnapGetCount(r, INT_MAX);
+            frame->height = KTerm_SnapGetCount(r, INT_MAX);
+            frame->delay_ms = KTerm_SnapGetInt(r);
+            size_t size = (size_t)KTerm_SnapGetItems(r);
+            if (r->failed || frame->width == 0 || frame->height == 0) return false;
+            // Frames are RGBA at width x height; anything else would be read past its end
+            if ((size_t)frame->width > SIZE_MAX / 4 / (size_t)frame->height) return false;
+            if (size != (size_t)frame->width * (size_t)frame->height * 4) return false;
+            // Same cap the upload path enforces
+            if (kitty->current_memory_usage + size > KTERM_KITTY_MEMORY_LIMIT) return false;
+            frame->data = (unsigned char*)KTerm_Malloc(size);
+            if (!frame->data) return false;
+            frame->size = size;
+            frame->capacity = size;
+            kitty->current_memory_usage += size;
+            KTerm_SnapGetBytes(r, frame->data, size);
+        }
+    }
+    int placements = KTerm_SnapGetItems(r);
+    if (placements > 0 && !r->failed) {
+        kitty->placements = (KittyPlacement*)KTerm_Calloc((size_t)placements, sizeof(KittyPlacement));
+        if (!kitty->placements) return false;
+        kitty->placement_capacity = placements;
+    }
+    KTerm_KittyRebuildIndex(kitty);
+    for (int i = 0; i < placements && !r->failed; i++) {
+        KittyPlacement* pl = &kitty->placements[kitty->placement_count++];
+        pl->image_id = (uint32_t)KTerm_SnapGetVarint(r);
+        pl->placement_id = (uint32_t)KTerm_SnapGetVarint(r);
+        pl->x = KTerm_SnapGetInt(r);
+        pl->y = KTerm_SnapGetInt(r);
+        pl->z_index = KTerm_SnapGetInt(r);
+        pl->start_row = KTerm_SnapGetStartRow(st, r);
+        KittyImageBuffer* img = KTerm_KittyFindImage(kitty, pl->image_id);
+        if (!img) return false;
+        img->placement_count++;
+    }
+    kitty->render_ops_dirty = true;
+    return !r->failed;
+}
+
+static void KTerm_SnapPutSixel(KTermSession* session, KTermSnapshotWriter* w) {
+    const SixelGraphics* sixel = &session->sixel;
+    KTerm_SnapPutU8(w, sixel->active);
+    KTerm_SnapPutU8(w, sixel->scrolling);
+    KTerm_SnapPutU8(w, sixel->transparent_bg);
+    KTerm_SnapPutVarint(w, (uint32_t)sixel->width);
+    KTerm_SnapPutVarint(w, (uint32_t)sixel->height);
+    KTerm_SnapPutInt(w, sixel->x);
+    KTerm_SnapPutInt(w, sixel->y);
+    KTerm_SnapPutInt(w, session->screen_head - sixel->logical_start_row);
+    for (int i = 0; i < 256; i++) {
+        unsigned char rgba[4] = { sixel->palette[i].r, sixel->palette[i].g, sixel->palette[i].b, sixel->palette[i].a };
+        KTerm_SnapPutBytes(w, rgba, 4);
+    }
+    KTerm_SnapPutVarint(w, sixel->strip_count);
+    for (size_t i = 0; i < sixel->strip_count; i++) {
+        const GPUSixelStrip* strip = &sixel->strips[i];
+        KTerm_SnapPutVarint(w, strip->x);
+        KTerm_SnapPutVarint(w, strip->y);
+        KTerm_SnapPutVarint(w, strip->pattern);
+        KTerm_SnapPutVarint(w, strip->color_index);
+    }
+}
+
+static bool KTerm_SnapGetSixel(KTermSession* st, KTermSnapshotRestore* ctx, KTermSnapshotReader* r) {
+    SixelGraphics* sixel = &st->sixel;
+    if (!ctx->have_grid || sixel->strips) return false;
+    sixel->active = KTerm_SnapGetU8(r) != 0;
+    sixel->scrolling = KTerm_SnapGetU8(r) != 0;
+    sixel->transparent_bg = KTerm_SnapGetU8(r) != 0;
+    sixel->width = KTerm_SnapGetCount(r, INT_MAX);
+    sixel->height = KTerm_SnapGetCount(r, INT_MAX);
+    sixel->x = KTerm_SnapGetInt(r);
+    sixel->y = KTerm_SnapGetInt(r);
+    sixel->logical_start_row = -KTerm_SnapGetInt(r);
+    for (int i = 0; i < 256; i++) {
+        unsigned char rgba[4] = {0};
+        KTerm_SnapGetBytes(r, rgba, 4);
+        sixel->palette[i] = (RGB_KTermColor){ rgba[0], rgba[1], rgba[2], rgba[3] };
+    }
+    int count = KTerm_SnapGetItems(r);
+    if (r->failed) return false;
+    if (count > 0) {
+        sixel->strips = (GPUSixelStrip*)KTerm_Calloc((size_t)count, sizeof(GPUSixelStrip));
+        if (!sixel->strips) return false;
+        sixel->strip_capacity = (size_t)count;
+    }
+    for (int i = 0; i < count && !r->failed; i++) {
+        GPUSixelStrip* strip = &sixel->strips[sixel->strip_count++];
+        strip->x = (uint32_t)KTerm_SnapGetVarint(r);
+        strip->y = (uint32_t)KTerm_SnapGetVarint(r);
+        strip->pattern = (uint32_t)KTerm_SnapGetVarint(r);
+        // Indexes the sixel palette in the shader, which does not mask it
+        uint64_t color_index = KTerm_SnapGetVarint(r);
+        if (color_index > 255) return false;
+        strip->color_index = (uint32_t)color_index;
+    }
+    sixel->dirty = true;
+    return !r->failed;
+}
+
+static void KTerm_SnapPutParser(KTermSession* session, KTermSnapshotWriter* w) {
+    KTerm_SnapPutVarint(w, (uint32_t)session->parse_state);
+    KTerm_SnapPutVarint(w, (uint32_t)session->saved_parse_state);
+    int pos = KTerm_SnapClamp(session->escape_pos, 0, MAX_COMMAND_BUFFER);
+    KTerm_SnapPutVarint(w, (uint32_t)pos);
+    KTerm_SnapPutBytes(w, session->escape_buffer, (size_t)pos);
+    KTerm_SnapPutVarint(w, session->utf8.codepoint);
+    KTerm_SnapPutVarint(w, session->utf8.min_codepoint);
+    KTerm_SnapPutVarint(w, (uint32_t)session->utf8.bytes_remaining);
+    KTerm_SnapPutVarint(w, session->last_char);
+}
+
+static bool KTerm_SnapGetParser(KTermSession* st, KTermSnapshotReader* r) {
+    st->parse_state = (VTParseState)KTerm_SnapGetCount(r, PARSE_nF);
+    st->saved_parse_state = (VTParseState)KTerm_SnapGetCount(r, PARSE_nF);
+    st->escape_pos = KTerm_SnapGetCount(r, MAX_COMMAND_BUFFER);
+    KTerm_SnapGetBytes(r, st->escape_buffer, (size_t)st->escape_pos);
+    if (st->escape_pos < MAX_COMMAND_BUFFER) st->escape_buffer[st->escape_pos] = '\0';
+    st->utf8.codepoint = (uint32_t)KTerm_SnapGetVarint(r);
+    st->utf8.min_codepoint = (uint32_t)KTerm_SnapGetVarint(r);
+    st->utf8.bytes_remaining = KTerm_SnapGetCount(r, 3);
+    st->last_char = (unsigned int)KTerm_SnapGetVarint(r);
+
+    // Graphics payloads keep their decoder state elsewhere; the rest of such a sequence is dropped
+    if (st->parse_state >= PARSE_SIXEL && st->parse_state <= PARSE_KITTY) {
+        st->parse_state = VT_PARSE_NORMAL;
+        st->escape_pos = 0;
+    }
+    return !r->failed;
+}
+
+static bool KTerm_SnapGetInput(KTermSnapshotRestore* ctx, KTermSnapshotReader* r) {
+    size_t len = (size_t)(r->end - r->p);
+    if (ctx->input || len == 0) return false;
+    ctx->input = (unsigned char*)KTerm_Malloc(len);
+    if (!ctx->input) return false;
+    ctx->input_len = len;
+    return KTerm_SnapGetBytes(r, ctx->input, len);
+}
+
+static bool KTerm_SnapshotCompress(KTermSnapshotWriter* out, const unsigned char* in, size_t n) {
+    uint32_t* table = (uint32_t*)KTerm_Calloc((size_t)1 << KTERM_SNAPSHOT_HASH_BITS, sizeof(uint32_t));
+    if (!table) return false;
+    size_t i = 0, anchor = 0;
+    while (i + 4 <= n) {
+        uint32_t v;
+        memcpy(&v, in + i, 4);
+        uint32_t h = (v * 2654435761u) >> (32 - KTERM_SNAPSHOT_HASH_BITS);
+        size_t candidate = table[h]; // Position + 1, 0 = empty
+        table[h] = (uint32_t)(i + 1);
+        if (candidate == 0 || memcmp(in + candidate - 1, in + i, 4) != 0) {
+            i++;
+            continue;
+        }
+        candidate--;
+        size_t len = 4;
+        while (i + len < n && in[candidate + len] == in[i + len]) len++;
+        KTerm_SnapPutVarint(out, i - anchor);
+        KTerm_SnapPutBytes(out, in + anchor, i - anchor);
+        KTerm_SnapPutVarint(out, len - 4);
+        KTerm_SnapPutVarint(out, i - candidate);
+        i += len;
+        anchor = i;
+    }
+    KTerm_SnapPutVarint(out, n - anchor);
+    KTerm_SnapPutBytes(out, in + anchor, n - anchor);
+    KTerm_Free(table);
+    return !out->failed;
+}
+
+static bool KTerm_SnapshotDecompress(const unsigned char* p, const unsigned char* end, unsigned char* out, size_t size) {
+    size_t pos = 0;
+    for (;;) {
+        uint64_t literals, len, dist;
+        if (!KTerm_ReplayReadVarint(&p, end, &literals) || literals > size - pos || literals > (uint64_t)(end - p)) return false;
+        memcpy(out + pos, p, (size_t)literals);
+        p += literals;
+        pos += (size_t)literals;
+        if (pos == size) return p == end;
+        if (!KTerm_ReplayReadVarint(&p, end, &len) || !KTerm_ReplayReadVarint(&p, end, &dist)) return false;
+        if (size - pos < 4 || len > size - pos - 4 || dist == 0 || dist > pos) return false;
+        len += 4;
+        // Byte by byte: a match may overlap its own output
+        for (size_t k = 0; k < len; k++) out[pos + k] = out[pos - dist + k];
+        pos += (size_t)len;
+    }
+}
+
+bool KTerm_SerializeSession(KTerm* term, int session_index, unsigned int flags, unsigned char** data, size_t* size) {
+    if (data) *data = NULL;
+    if (size) *size = 0;
+    KTermSession* session = KTerm_LookupSession(term, session_index);
+    if (!session || !data || !size || !session->screen_buffer) return false;
+
+    KTermSnapshotWriter body = {0}, chunk = {0};
+    KTERM_MUTEX_LOCK(session->lock);
+    // The grid as parsed so far: queued ops applied, fast-forwarded rows in place
+    KTerm_FlushOps(term, session);
+    KTerm_FastForwardSettle(session);
+
+    KTerm_SnapPutGrid(term, session, &chunk);
+    KTerm_SnapPutChunk(&body, KTERM_SNAP_GRID, &chunk);
+    KTerm_SnapPutCursor(session, &chunk);
+    KTerm_SnapPutChunk(&body, KTERM_SNAP_CURSOR, &chunk);
+    KTerm_SnapPutModes(session, &chunk);
+    KTerm_SnapPutChunk(&body, KTERM_SNAP_MODES, &chunk);
+    KTerm_SnapPutString(&chunk, session->title.window_title);
+    KTerm_SnapPutString(&chunk, session->title.icon_title);
+    KTerm_SnapPutChunk(&body, KTERM_SNAP_TITLE, &chunk);
+    KTerm_SnapPutSoftFont(session, &chunk);
+    KTerm_SnapPutChunk(&body, KTERM_SNAP_SOFT_FONT, &chunk);
+    if (session->kitty.image_count > 0) {
+        KTerm_SnapPutKitty(session, &chunk);
+        KTerm_SnapPutChunk(&body, KTERM_SNAP_KITTY, &chunk);
+    }
+    if (session->sixel.strip_count > 0) {
+        KTerm_SnapPutSixel(session, &chunk);
+        KTerm_SnapPutChunk(&body, KTERM_SNAP_SIXEL, &chunk);
+    }
+    KTerm_SnapPutParser(session, &chunk);
+    KTerm_SnapPutChunk(&body, KTERM_SNAP_PARSER, &chunk);
+
+    // Input not parsed yet goes with the session
+    int tail = atomic_load_explicit(&session->pipeline_tail, memory_order_relaxed);
+    int head = atomic_load_explicit(&session->pipeline_head, memory_order_acquire);
+    if (session->input_pipeline && head != tail) {
+        for (int i = tail; i != head; i = (i + 1) & session->pipeline_mask) {
+            KTerm_SnapPutBytes(&chunk, &session->input_pipeline[i], 1);
+        }
+        KTerm_SnapPutChunk(&body, KTERM_SNAP_INPUT, &chunk);
+    }
+    KTERM_MUTEX_UNLOCK(session->lock);
+    KTerm_Free(chunk.data);
+
+    KTermSnapshotWriter out = {0};
+    if (!body.failed && body.len <= 0xFFFFFFFFu) {
+        unsigned char header[KTERM_SNAPSHOT_HEADER] = { 'K', 'T', 'S', 'S' };
+        KTerm_SnapPutBytes(&out, header, sizeof(header));
+        if (!(flags & KTERM_SNAPSHOT_COMPRESS) || !KTerm_SnapshotCompress(&out, body.data, body.len) ||
+            out.len >= KTERM_SNAPSHOT_HEADER + body.len) {
+            // Stored as is when compression does not pay
+            flags &= ~KTERM_SNAPSHOT_COMPRESS;
+            out.failed = false;
+            out.len = KTERM_SNAPSHOT_HEADER;
+            KTerm_SnapPutBytes(&out, body.data, body.len);
+        }
+        unsigned char* h = out.data;
+        if (h) {
+            h[4] = KTERM_SNAPSHOT_VERSION & 0xFF;
+            h[5] = (KTERM_SNAPSHOT_VERSION >> 8) & 0xFF;
+            h[6] = (unsigned char)(flags & KTERM_SNAPSHOT_COMPRESS);
+            h[7] = 0;
+            for (int i = 0; i < 4; i++) h[8 + i] = (unsigned char)((uint64_t)body.len >> (8 * i));
+        }
+    }
+    bool ok = !body.failed && !out.failed && out.data && body.len <= 0xFFFFFFFFu;
+    KTerm_Free(body.data);
+    if (!ok) {
+        KTerm_Free(out.data);
+        KTerm_ReportError(term, KTERM_LOG_ERROR, KTERM_SOURCE_SYSTEM, "Failed to serialize session %d", session_index);
+        return false;
+    }
+    *data = out.data;
+    *size = out.len;
+    return true;
+}
+
+// Everything the staging session owns
+static void KTerm_SnapshotFreeStaging(KTermSession* st, KTermSnapshotRestore* ctx) {
+    KTerm_Free(st->row_dirty);
+    KTerm_Free(st->screen_buffer);
+    KTerm_Free(st->alt_buffer);
+    KTerm_Free(st->tab_stops.stops);
+    KTerm_Free(st->sixel.strips);
+    KTerm_KittyFreeAll(&st->kitty);
+    KTerm_Free(ctx->input);
+    KTerm_Free(st);
+}
+
+// Move the decoded state into the session; the buffers change hands, nothing is copied twice
+static void KTerm_SnapshotCommit(KTerm* term, KTermSession* session, KTermSession* st, KTermSnapshotRestore* ctx) {
+    // Pending work was for the old contents
+    session->op_queue.head = 0;
+    session->op_queue.tail = 0;
+    session->op_queue.count = 0;
+    KTerm_FreeChecksumCache(session);
+    KTerm_FreeBiDiCache(session);
+
+    KTerm_Free(session->row_dirty);
+    KTerm_Free(session->screen_buffer);
+    KTerm_Free(session->alt_buffer);
+    session->row_dirty = st->row_dirty;
+    session->screen_buffer = st->screen_buffer;
+    session->alt_buffer = st->alt_buffer;
+    st->row_dirty = NULL;
+    st->screen_buffer = NULL;
+    st->alt_buffer = NULL;
+    session->cols = st->cols;
+    session->rows = st->rows;
+    session->buffer_height = st->buffer_height;
+    session->screen_head = st->screen_head;
+    session->alt_screen_head = st->alt_screen_head;
+    session->history_rows_populated = st->history_rows_populated;
+    session->view_offset = st->view_offset;
+    session->saved_view_offset = st->saved_view_offset;
+    session->lines_per_page = st->lines_per_page;
+
+    session->cursor = st->cursor;
+    session->cursor.blink_state = true;
+    session->saved_cursor = st->saved_cursor;
+    session->saved_cursor_valid = st->saved_cursor_valid;
+    session->dec_modes = st->dec_modes;
+    session->ansi_modes = st->ansi_modes;
+    session->current_fg = st->current_fg;
+    session->current_bg = st->current_bg;
+    session->current_ul_color = st->current_ul_color;
+    session->current_st_color = st->current_st_color;
+    session->current_attributes = st->current_attributes;
+    memcpy(session->sgr_stack, st->sgr_stack, sizeof(session->sgr_stack));
+    session->sgr_stack_depth = st->sgr_stack_depth;
+    session->scroll_top = st->scroll_top;
+    session->scroll_bottom = st->scroll_bottom;
+    session->left_margin = st->left_margin;
+    session->right_margin = st->right_margin;
+
+    // Both charsets select from the live one, as DECSC/DECRC leave them
+    session->charset = st->charset;
+    session->charset.gl = KTerm_SnapshotCharsetPtr(&session->charset, ctx->gl);
+    session->charset.gr = KTerm_SnapshotCharsetPtr(&session->charset, ctx->gr);
+    session->saved_cursor.charset.gl = KTerm_SnapshotCharsetPtr(&session->charset, ctx->saved_gl);
+    session->saved_cursor.charset.gr = KTerm_SnapshotCharsetPtr(&session->charset, ctx->saved_gr);
+
+    KTerm_Free(session->tab_stops.stops);
+    session->tab_stops = st->tab_stops;
+    st->tab_stops.stops = NULL;
+
+    if (session->conformance.level != st->conformance.level) KTerm_SetLevel(term, session, st->conformance.level);
+    session->conformance.features = st->conformance.features;
+    session->conformance.strict_mode = st->conformance.strict_mode;
+    session->enable_wide_chars = st->enable_wide_chars;
+    session->input.keypad_application_mode = st->input.keypad_application_mode;
+    session->input.use_8bit_controls = st->input.use_8bit_controls;
+    session->input.backarrow_sends_bs = st->input.backarrow_sends_bs;
+    session->input.delete_sends_del = st->input.delete_sends_del;
+    session->input.meta_sends_escape = st->input.meta_sends_escape;
+    session->mouse.mode = st->mouse.mode;
+    session->mouse.enabled = st->mouse.enabled;
+    session->mouse.sgr_mode = st->mouse.sgr_mode;
+    session->mouse.focus_tracking = st->mouse.focus_tracking;
+    session->bracketed_paste.enabled = st->bracketed_paste.enabled;
+
+    memcpy(session->title.window_title, st->title.window_title, sizeof(session->title.window_title));
+    memcpy(session->title.icon_title, st->title.icon_title, sizeof(session->title.icon_title));
+    session->title.title_changed = true;
+    session->title.icon_changed = true;
+    session->soft_font = st->soft_font;
+
+    // Images: the decoder state of an upload in progress goes with it
+    KittyGraphics* kitty = &session->kitty;
+    KTerm_KittyFreeAll(kitty);
+    kitty->images = st->kitty.images;
+    kitty->image_count = st->kitty.image_count;
+    kitty->image_capacity = st->kitty.image_capacity;
+    kitty->current_memory_usage = st->kitty.current_memory_usage;
+    kitty->placements = st->kitty.placements;
+    kitty->placement_count = st->kitty.placement_count;
+    kitty->placement_capacity = st->kitty.placement_capacity;
+    kitty->lru_clock = st->kitty.lru_clock;
+    kitty->id_table = st->kitty.id_table;
+    kitty->id_table_capacity = st->kitty.id_table_capacity;
+    kitty->continuing = false;
+    memset(&st->kitty, 0, sizeof(st->kitty));
+    KTerm_KittyRebuildIndex(kitty);
+    for (int i = 0; i < kitty->image_count; i++) KTerm_KittyScheduleAnimation(kitty, &kitty->images[i]);
+
+    SixelGraphics* sixel = &session->sixel;
+    KTerm_Free(sixel->strips);
+    sixel->strips = st->sixel.strips;
+    sixel->strip_count = st->sixel.strip_count;
+    sixel->strip_capacity = st->sixel.strip_capacity;
+    st->sixel.strips = NULL;
+    sixel->active = st->sixel.active;
+    sixel->scrolling = st->sixel.scrolling;
+    sixel->transparent_bg = st->sixel.transparent_bg;
+    sixel->width = st->sixel.width;
+    sixel->height = st->sixel.height;
+    sixel->x = st->sixel.x;
+    sixel->y = st->sixel.y;
+    sixel->logical_start_row = st->sixel.logical_start_row;
+    if (sixel->strips) memcpy(sixel->palette, st->sixel.palette, sizeof(sixel->palette));
+    sixel->dirty = true;
+
+    session->parse_state = st->parse_state;
+    session->saved_parse_state = st->saved_parse_state;
+    memcpy(session->escape_buffer, st->escape_buffer, sizeof(session->escape_buffer));
+    session->escape_pos = st->escape_pos;
+    session->utf8.codepoint = st->utf8.codepoint;
+    session->utf8.min_codepoint = st->utf8.min_codepoint;
+    session->utf8.bytes_remaining = st->utf8.bytes_remaining;
+    session->last_char = st->last_char;
+
+    // Input still to parse replaces what was queued for the old contents
+    atomic_store_explicit(&session->pipeline_tail, 0, memory_order_relaxed);
+    size_t n = ctx->input_len;
+    if (n > (size_t)session->pipeline_mask) {
+        n = (size_t)session->pipeline_mask;
+        session->pipeline_overflow = true;
+    }
+    if (n > 0) memcpy(session->input_pipeline, ctx->input, n);
+    atomic_store_explicit(&session->pipeline_head, (int)n, memory_order_release);
+    session->pipeline_count = 0;
+
+    session->protection_used = st->protection_used || (session->current_attributes & KTERM_ATTR_PROTECTED);
+    session->fast_forward_scroll = 0;
+    session->fast_forward_stale = true;
+    for (int y = 0; y < session->rows; y++) KTerm_MarkRowDirty(session, y);
+    session->dirty_rect = (KTermRect){0, 0, session->cols, session->rows};
+    kitty->render_ops_dirty = true;
+}
+
+bool KTerm_RestoreSession(KTerm* term, int session_index, const unsigned char* data, size_t size) {
+    if (!KTerm_LookupSession(term, session_index) || !data) return false;
+    session_index = KTERM_SESSION_INDEX(session_index);
+    if (size < KTERM_SNAPSHOT_HEADER || memcmp(data, "KTSS", 4) != 0) {
+        KTerm_ReportError(term, KTERM_LOG_ERROR, KTERM_SOURCE_API, "Not a session snapshot");
+        return false;
+    }
+    int version = data[4] | (data[5] << 8);
+    int flags = data[6] | (data[7] << 8);
+    size_t body_size = (size_t)data[8] | ((size_t)data[9] << 8) | ((size_t)data[10] << 16) | ((size_t)data[11] << 24);
+    if (version != KTERM_SNAPSHOT_VERSION || (flags & ~KTERM_SNAPSHOT_COMPRESS)) {
+        KTerm_ReportError(term, KTERM_LOG_ERROR, KTERM_SOURCE_API, "Unsupported session snapshot version %d", version);
+        return false;
+    }
+
+    const unsigned char* body = data + KTERM_SNAPSHOT_HEADER;
+    unsigned char* inflated = NULL;
+    if (flags & KTERM_SNAPSHOT_COMPRESS) {
+        inflated = (unsigned char*)KTerm_Malloc(body_size ? body_size : 1);
+        if (!inflated || !KTerm_SnapshotDecompress(body, data + size, inflated, body_size)) {
+            KTerm_Free(inflated);
+            KTerm_ReportError(term, KTERM_LOG_ERROR, KTERM_SOURCE_API, "Malformed session snapshot");
+            return false;
+        }
+        body = inflated;
+    } else if (size - KTERM_SNAPSHOT_HEADER != body_size) {
+        KTerm_ReportError(term, KTERM_LOG_ERROR, KTERM_SOURCE_API, "Malformed session snapshot");
+        return false;
+    }
+
+    // Decoded into a staging session, so a bad snapshot leaves the session as it was
+    KTermSession* st = (KTermSession*)KTerm_Calloc(1, sizeof(KTermSession));
+    KTermSnapshotRestore ctx = {0};
+    bool ok = st != NULL;
+    KTermSnapshotReader r = { body, body + body_size, false };
+    while (ok && r.p < r.end) {
+        int tag = (int)KTerm_SnapGetU8(&r);
+        size_t len = (size_t)KTerm_SnapGetVarint(&r);
+        if (r.failed || len > (size_t)(r.end - r.p)) {
+            ok = false;
+            break;
+        }
+        KTermSnapshotReader c = { r.p, r.p + len, false };
+        r.p += len;
+        switch (tag) {
+            case KTERM_SNAP_GRID: ok = KTerm_SnapGetGrid(term, st, &ctx, &c); break;
+            case KTERM_SNAP_CURSOR: ok = KTerm_SnapGetCursor(st, &ctx, &c); break;
+            case KTERM_SNAP_MODES: ok = KTerm_SnapGetModes(st, &ctx, &c); break;
+            case KTERM_SNAP_TITLE:
+                KTerm_SnapGetString(&c, st->title.window_title, sizeof(st->title.window_title));
+                KTerm_SnapGetString(&c, st->title.icon_title, sizeof(st->title.icon_title));
+                ok = !c.failed;
+                break;
+            case KTERM_SNAP_SOFT_FONT: ok = KTerm_SnapGetSoftFont(st, &c); break;
+            case KTERM_SNAP_KITTY: ok = KTerm_SnapGetKitty(st, &ctx, &c); break;
+            case KTERM_SNAP_SIXEL: ok = KTerm_SnapGetSixel(st, &ctx, &c); break;
+            case KTERM_SNAP_PARSER: ok = KTerm_SnapGetParser(st, &c); break;
+            case KTERM_SNAP_INPUT: ok = KTerm_SnapGetInput(&ctx, &c); break;
+            default: break; // From a newer writer
+        }
+    }
+    KTerm_Free(inflated);
+    // A usable session needs at least the grid and its modes
+    ok = ok && ctx.have_grid && st->tab_stops.stops != NULL && st->soft_font.char_width > 0;
+
+    KTermSession* session = term->sessions[session_index];
+    if (ok && !session->session_open) {
+        ok = KTerm_SetupSession(term, session_index) && KTerm_OpenSessionBuffers(term, session);
+        if (ok) session->session_open = true;
+        else KTerm_FreeSessionBuffers(session); // Leaves the slot closed, as KTerm_CreateSession does
+    } else {
+        ok = ok && KTerm_OpenSessionBuffers(term, session);
+    }
+    if (!ok) {
+        if (st) KTerm_SnapshotFreeStaging(st, &ctx);
+        KTerm_ReportError(term, KTERM_LOG_ERROR, KTERM_SOURCE_API, "Malformed session snapshot");
+        return false;
+    }
+
+    KTERM_MUTEX_LOCK(session->lock);
+    KTerm_SnapshotCommit(term, session, st, &ctx);
+    KTERM_MUTEX_UNLOCK(session->lock);
+    KTerm_SnapshotFreeStaging(st, &ctx);
+    KTerm_WakeSession(term, session); // Parses the carried input and redraws if shown
+    return true;
+}
+
 void KTerm_ClearEvents(KTerm* term) {
     GET_SESSION(term)->pipeline_head = 0;
     GET_SESSION(term)->pipeline_tail = 0;
@@ -6160,6 +9613,48 @@ void KTerm_SetMouseTracking(KTerm* term, MouseTrackingMode mode) {
     GET_SESSION(term)->mouse.enabled = (mode != MOUSE_TRACKING_OFF);
 }
 
+// Motion reports (button-event and any-event tracking) have bit 32 set in Cb
+static bool KTerm_IsMouseMotionReport(const char* seq) {
+    if (seq[0] != '\x1B' || seq[1] != '[') return false;
+    if (seq[2] == '<') {
+        // SGR: CSI < Cb ; Px ; Py M
+        int cb = atoi(seq + 3);
+        size_t len = strlen(seq);
+        return (cb & 32) && seq[len - 1] == 'M';
+    }
+    if (seq[2] == 'M' && seq[3] != '\0') {
+        // X10/VT200: CSI M Cb Cx Cy, each byte offset by 32
+        return (((unsigned char)seq[3] - 32) & 32) != 0;
+    }
+    return false;
+}
+
+// Sends a session's held motion report, ahead of whatever follows it
+static void KTerm_FlushMouseMotion(KTerm* term, int index) {
+    KTermSession* session = term->sessions[index];
+    if (session->mouse.pending_motion[0] == '\0') return;
+    int saved = term->output_session;
+    term->output_session = index;
+    KTerm_QueueResponse(term, session->mouse.pending_motion);
+    term->output_session = saved;
+    session->mouse.pending_motion[0] = '\0';
+}
+
+void KTerm_QueueMouseReport(KTerm* term, const char* report, bool motion) {
+    if (!report || report[0] == '\0') return;
+    KTermSession* session = GET_SESSION(term);
+    if (motion && session->mouse.coalesce_motion && strlen(report) < sizeof(session->mouse.pending_motion)) {
+        // Only the latest position of the frame is reported
+        if (session->mouse.pending_motion[0] != '\0') session->mouse.motion_coalesced++;
+        strcpy(session->mouse.pending_motion, report);
+        KTerm_ListSession(term, session);
+        return;
+    }
+    // Presses, releases and wheel steps are never merged or reordered
+    KTerm_FlushMouseMotion(term, term->active_session);
+    KTerm_QueueResponse(term, report);
+}
+
 // Enable or disable mouse features
 // Toggles specific mouse functionalities based on feature name
 void KTerm_EnableMouseFeature(KTerm* term, const char* feature, bool enable) {
@@ -6199,9 +9694,14 @@ void KTerm_EnableMouseFeature(KTerm* term, const char* feature, bool enable) {
         } else if (GET_SESSION(term)->mouse.mode == MOUSE_TRACKING_PIXEL) {
             GET_SESSION(term)->mouse.mode = MOUSE_TRACKING_OFF;
         }
+    } else if (strcmp(feature, "coalesce") == 0) {
+        // Enable/disable per-frame coalescing of motion reports
+        if (!enable) KTerm_FlushMouseMotion(term, term->active_session);
+        GET_SESSION(term)->mouse.coalesce_motion = enable;
     }
 }
 
+
 void KTerm_EnableBracketedPaste(KTerm* term, bool enable) {
     GET_SESSION(term)->bracketed_paste.enabled = enable;
 }
@@ -6299,7 +9799,7 @@ void KTerm_SetPipelineTimeBudget(KTerm* term, double pct) {
 void KTerm_ShowDiagnostics(KTerm* term) {
     KTermStatus status = KTerm_GetStatus(term);
     KTerm_WriteFormat(term, "=== Buffer Diagnostics ===\n");
-    KTerm_WriteFormat(term, "Pipeline: %zu/%d bytes\n", status.pipeline_usage, (int)sizeof(GET_SESSION(term)->input_pipeline));
+    KTerm_WriteFormat(term, "Pipeline: %zu/%d bytes\n", status.pipeline_usage, GET_SESSION(term)->pipeline_mask + 1);
     KTerm_WriteFormat(term, "Keyboard: %zu events\n", status.key_usage);
     KTerm_WriteFormat(term, "Overflow: %s\n", status.overflow_detected ? "YES" : "No");
     KTerm_WriteFormat(term, "Avg Process Time: %.6f ms\n", status.avg_process_time * 1000.0);
@@ -6333,7 +9833,7 @@ void KTerm_SwapScreenBuffer(KTerm* term) {
 
     if ((session->dec_modes & KTERM_MODE_ALTSCREEN)) {
         // Switching BACK to Main Screen
-        GET_SESSION(term)->buffer_height = term->height + MAX_SCROLLBACK_LINES;
+        GET_SESSION(term)->buffer_height = term->height + term->session_buffer_sizes.scrollback;
         session->dec_modes &= ~KTERM_MODE_ALTSCREEN;
 
         // Restore view offset (if we want to restore scroll position, otherwise 0)
@@ -6352,8 +9852,182 @@ void KTerm_SwapScreenBuffer(KTerm* term) {
 
     // Force full redraw
     for (int i=0; i<term->height; i++) {
-        GET_SESSION(term)->row_dirty[i] = KTERM_DIRTY_FRAMES;
+        KTerm_MarkRowDirty(GET_SESSION(term), i);
+    }
+}
+
+// =============================================================================
+// FAST-FORWARD (HIDDEN SESSIONS)
+// =============================================================================
+// A session with fast-forward requested that no pane shows takes runs of printable
+// bytes, CR and LF straight into the grid: no SET_CELL ops, dirty rows or dirty rect.
+// A scroll of a margin region only rotates KTermSession.fast_forward_scroll, so lines
+// that scroll straight out are never copied; the rows are moved into place once,
+// before anything else reads the grid. All other input takes the normal parser.
+
+static bool KTerm_IsSessionVisible(KTerm* term, int index) {
+    if (index == term->active_session) return true;
+    if (term->split_screen_active && (index == term->session_top || index == term->session_bottom)) return true;
+    return KTermLayout_FindSessionPane(term->layout, index) != NULL;
+}
+
+// Called by KTerm_Update before the session's frame
+static void KTerm_UpdateFastForward(KTerm* term, KTermSession* session) {
+    bool hidden = session->fast_forward && !KTerm_IsSessionVisible(term, session->index);
+    if (!hidden && session->fast_forward_stale) {
+        // Shown again: redraw everything once
+        for (int y = 0; y < session->rows; y++) KTerm_MarkRowDirty(session, y);
+        session->dirty_rect = (KTermRect){0, 0, session->cols, session->rows};
+        session->fast_forward_stale = false;
+    }
+    session->fast_forwarding = hidden;
+}
+
+// Where viewport row y is stored while a region scroll is pending
+static inline int KTerm_FastForwardRow(KTermSession* session, int y) {
+    if (session->fast_forward_scroll == 0 || y < session->scroll_top || y > session->scroll_bottom) return y;
+    int h = session->scroll_bottom - session->scroll_top + 1;
+    return session->scroll_top + (y - session->scroll_top + session->fast_forward_scroll) % h;
+}
+
+static void KTerm_ReverseRows(KTermSession* session, int first, int last) {
+    for (; first < last; first++, last--) {
+        EnhancedTermChar* a = GetActiveScreenRow(session, first);
+        EnhancedTermChar* b = GetActiveScreenRow(session, last);
+        for (int x = 0; x < session->cols; x++) {
+            EnhancedTermChar t = a[x];
+            a[x] = b[x];
+            b[x] = t;
+        }
+    }
+}
+
+// Move the rotated region rows into place for the normal path
+static void KTerm_FastForwardSettle(KTermSession* session) {
+    int k = session->fast_forward_scroll;
+    if (k == 0) return;
+    int top = session->scroll_top, bottom = session->scroll_bottom;
+    KTerm_ReverseRows(session, top, top + k - 1);
+    KTerm_ReverseRows(session, top + k, bottom);
+    KTerm_ReverseRows(session, top, bottom);
+    session->fast_forward_scroll = 0;
+}
+
+// Scroll the full-width region up one line, as KTerm_ApplyScrollOp does minus the dirty marks.
+// A collapsed scroll leaves the new row as it is: it is reused and cleared again before the run ends.
+static void KTerm_FastForwardScroll(KTermSession* session, bool collapsed) {
+    int top = session->scroll_top, bottom = session->scroll_bottom;
+    if (top == 0 && bottom == session->rows - 1) {
+        if (!collapsed) {
+            int new_row_idx = (session->screen_head + session->rows) % session->buffer_height;
+            EnhancedTermChar* row_ptr = &session->screen_buffer[new_row_idx * session->cols];
+            for (int x = 0; x < session->cols; x++) KTerm_ClearCell_Internal(session, &row_ptr[x]);
+        }
+        session->screen_head = (session->screen_head + 1) % session->buffer_height;
+        if (session->history_rows_populated < session->buffer_height - session->rows) session->history_rows_populated++;
+        if (session->view_offset > 0) session->view_offset++;
+        return;
+    }
+    // The region's top row is reused as its new bottom row
+    EnhancedTermChar* row_ptr = GetActiveScreenRow(session, KTerm_FastForwardRow(session, top));
+    for (int x = 0; x < session->cols; x++) KTerm_ClearCell_Internal(session, &row_ptr[x]);
+    session->fast_forward_scroll = (session->fast_forward_scroll + 1) % (bottom - top + 1);
+}
+
+// Parse printable bytes, CR and LF from the input ring at `tail`, up to `budget` of them.
+// Returns the bytes consumed: 0 when the next byte or the session's modes need the parser.
+static int KTerm_FastForwardRun(KTerm* term, KTermSession* session, int tail, int head, int budget) {
+    if (session->parse_state != VT_PARSE_NORMAL || session->printer_controller_enabled) return 0;
+    // Ops queued by the normal path (a resize among them) come before anything written here
+    if (session->op_queue.count > 0) {
+        KTerm_FastForwardSettle(session);
+        KTerm_FlushOps(term, session);
+    }
+    if (session->protection_used || (session->dec_modes & KTERM_MODE_INSERT) || !(session->dec_modes & KTERM_MODE_DECAWM)) return 0;
+    if (session->left_margin != 0 || session->right_margin != session->cols - 1) return 0;
+    CharsetState* charset = &session->charset;
+    if (charset->single_shift_2 || charset->single_shift_3) return 0;
+    CharacterSet set = *charset->gl;
+    if (set == CHARSET_UTF8 && session->utf8.bytes_remaining > 0) return 0;
+    const uint32_t* lut = (set != CHARSET_UTF8 && set < CHARSET_COUNT) ? term->charset_lut[set] : NULL;
+
+    EnhancedTermChar cell;
+    cell.ch = ' ';
+    cell.fg_color = session->current_fg;
+    cell.bg_color = session->current_bg;
+    cell.ul_color = session->current_ul_color;
+    cell.st_color = session->current_st_color;
+    uint32_t flags = session->current_attributes | KTERM_FLAG_DIRTY;
+    const uint32_t line_attrs = KTERM_ATTR_DOUBLE_WIDTH | KTERM_ATTR_DOUBLE_HEIGHT_TOP | KTERM_ATTR_DOUBLE_HEIGHT_BOT;
+
+    // With the whole screen scrolling, everything written before the last buffer_height scrolls
+    // of the run is overwritten before the run ends: for those lines only the cursor and the
+    // ring head move. Line feeds are counted; wraps only add scrolls.
+    int collapse = 0;
+    if (session->scroll_top == 0 && session->scroll_bottom == session->rows - 1 &&
+        session->cursor.y >= 0 && session->cursor.y <= session->scroll_bottom) {
+        int feeds = 0;
+        for (int t = tail, n = 0; n < budget && t != head; t = (t + 1) & session->pipeline_mask, n++) {
+            unsigned char c = session->input_pipeline[t];
+            if (c >= 0x0A && c <= 0x0C) feeds++;
+            else if (c != 0x0D && (c < 0x20 || c >= 0x7F)) break;
+        }
+        collapse = feeds - (session->scroll_bottom - session->cursor.y) - session->buffer_height;
+    }
+
+    int done = 0;
+    while (done < budget && tail != head) {
+        unsigned char ch = session->input_pipeline[tail];
+        if (ch >= 0x20 && ch < 0x7F) {
+            if (session->cursor.x > session->right_margin) {
+                // Auto-wrap
+                session->cursor.x = session->left_margin;
+                session->cursor.y++;
+                if (session->cursor.y > session->scroll_bottom) {
+                    session->cursor.y = session->scroll_bottom;
+                    KTerm_FastForwardScroll(session, collapse > 0);
+                }
+            }
+            // As much of the run as fits on the row
+            EnhancedTermChar* row = GetActiveScreenRow(session, KTerm_FastForwardRow(session, session->cursor.y));
+            int x = session->cursor.x;
+            while (x <= session->right_margin && done < budget && tail != head) {
+                ch = session->input_pipeline[tail];
+                if (ch < 0x20 || ch >= 0x7F) break;
+                cell.ch = lut ? lut[ch] : ch;
+                if (collapse <= 0) {
+                    cell.flags = flags | (row[x].flags & line_attrs);
+                    row[x] = cell;
+                }
+                x++;
+                tail = (tail + 1) & session->pipeline_mask;
+                done++;
+            }
+            session->cursor.x = x;
+            session->last_char = cell.ch;
+            session->fast_forward_stale = true;
+        } else if (ch >= 0x0A && ch <= 0x0C) { // LF, VT, FF
+            KTerm_StatsCountSequence(term, session, KTERM_STAT_SEQ_C0);
+            session->cursor.y++;
+            if (session->cursor.y > session->scroll_bottom) {
+                session->cursor.y = session->scroll_bottom;
+                KTerm_FastForwardScroll(session, collapse > 0);
+                session->fast_forward_stale = true;
+            }
+            if (session->ansi_modes.line_feed_new_line) session->cursor.x = session->left_margin;
+            collapse--;
+            tail = (tail + 1) & session->pipeline_mask;
+            done++;
+        } else if (ch == 0x0D) { // CR
+            KTerm_StatsCountSequence(term, session, KTERM_STAT_SEQ_C0);
+            session->cursor.x = session->left_margin;
+            tail = (tail + 1) & session->pipeline_mask;
+            done++;
+        } else {
+            break;
+        }
     }
+    return done;
 }
 
 static void KTerm_ProcessEventsInternal(KTerm* term, KTermSession* session) {
@@ -6369,14 +10043,16 @@ static void KTerm_ProcessEventsInternal(KTerm* term, KTermSession* session) {
     // Capture the index of the session OWNING this buffer
     // int processing_session_idx = term->active_session;
 
+    KTERM_TRACE_BEGIN(term, trace_parse);
     double start_time = KTerm_TimerGetTime();
+    uint64_t stats_start = KTERM_STATS_ENABLED(term) ? KTerm_StatsNow() : 0;
     int chars_processed = 0;
     int target_chars = session->VTperformance.chars_per_frame;
 
-    int pipeline_usage = (current_head - current_tail + sizeof(session->input_pipeline)) % sizeof(session->input_pipeline);
+    int pipeline_usage = (current_head - current_tail) & session->pipeline_mask;
 
     if (session->dec_modes & KTERM_MODE_DECXRLM) {
-        int usage_percent = (pipeline_usage * 100) / (int)sizeof(session->input_pipeline);
+        int usage_percent = (int)(((int64_t)pipeline_usage * 100) / (session->pipeline_mask + 1));
         if (usage_percent > 75 && !session->xoff_sent) {
             KTerm_QueueResponseBytes(term, "\x13", 1); // XOFF
             session->xoff_sent = true;
@@ -6394,6 +10070,7 @@ static void KTerm_ProcessEventsInternal(KTerm* term, KTermSession* session) {
         session->VTperformance.burst_mode = false;
     }
 
+    bool fast_wrote = false;
     while (chars_processed < target_chars) {
         // Re-check for empty (we are consuming)
         // Note: current_head is a snapshot. If producer added more, we will process them next frame.
@@ -6403,8 +10080,20 @@ static void KTerm_ProcessEventsInternal(KTerm* term, KTermSession* session) {
             break;
         }
 
+        if (session->fast_forwarding) {
+            int n = KTerm_FastForwardRun(term, session, current_tail, current_head, target_chars - chars_processed);
+            if (n > 0) {
+                current_tail = (current_tail + n) & session->pipeline_mask;
+                atomic_store_explicit(&session->pipeline_tail, current_tail, memory_order_release);
+                chars_processed += n;
+                fast_wrote = true;
+                continue;
+            }
+            KTerm_FastForwardSettle(session);
+        }
+
         unsigned char ch = session->input_pipeline[current_tail];
-        int next_tail = (current_tail + 1) % sizeof(session->input_pipeline);
+        int next_tail = (current_tail + 1) & session->pipeline_mask;
 
         // Process char.
         // Pass 'session' explicitly to avoid context fragility if active_session changes.
@@ -6417,6 +10106,22 @@ static void KTerm_ProcessEventsInternal(KTerm* term, KTermSession* session) {
         chars_processed++;
     }
 
+    if (session->fast_forwarding) {
+        KTerm_FastForwardSettle(session);
+        // Rows changed without KTerm_MarkRowDirty: drop their cached checksums
+        if (fast_wrote && session->row_checksums) {
+            for (int y = 0; y < session->checksum_rows; y++) session->row_checksums[y].valid = false;
+        }
+    }
+
+    if (KTERM_STATS_ENABLED(term)) {
+        uint64_t elapsed = KTerm_StatsNow() - stats_start;
+        session->stats.bytes_parsed += (uint64_t)chars_processed;
+        KTerm_StatsRecord(&session->stats.parse, elapsed);
+        term->stats_frame.bytes_parsed += (uint64_t)chars_processed;
+        term->stats_frame.parse_ns += elapsed;
+    }
+
     // Update performance metrics
     if (chars_processed > 0) {
         double total_time = KTerm_TimerGetTime() - start_time;
@@ -6424,6 +10129,7 @@ static void KTerm_ProcessEventsInternal(KTerm* term, KTermSession* session) {
         session->VTperformance.avg_process_time =
             session->VTperformance.avg_process_time * 0.9 + time_per_char * 0.1;
     }
+    KTERM_TRACE_END(term, trace_parse, "ProcessEvents");
 }
 
 void KTerm_ProcessEvents(KTerm* term) {
@@ -6455,8 +10161,8 @@ void KTerm_ReportError(KTerm* term, KTermErrorLevel level, KTermErrorSource sour
         // Fallback: Print to stderr if level is ERROR or FATAL, or if generic debugging is on
         bool debug = false;
         // Basic check to see if session 0 might be initialized
-        if (term->sessions[0].screen_buffer) {
-             debug = term->sessions[0].status.debugging;
+        if (term->sessions[0]->screen_buffer) {
+             debug = term->sessions[0]->status.debugging;
         }
 
         if (level >= KTERM_LOG_ERROR || debug) {
@@ -6571,6 +10277,10 @@ static void ClearCSIParams(KTermSession* session) {
 void KTerm_ProcessSixelSTChar(KTerm* term, KTermSession* session, unsigned char ch) {
     if (ch == '\\') { // This is ST
         session->parse_state = VT_PARSE_NORMAL;
+#ifdef KTERM_ENABLE_TRACE
+        KTerm_TraceSpan(term, "SixelDecode", session->sixel.trace_start);
+        session->sixel.trace_start = 0;
+#endif
         // Finalize sixel image size
         session->sixel.width = session->sixel.max_x;
         session->sixel.height = session->sixel.max_y;
@@ -6745,6 +10455,7 @@ static void ExecuteED_Internal(KTerm* term, KTermSession* session, bool private_
                 if (private_mode && (cell->flags & KTERM_ATTR_PROTECTED)) continue;
                 KTerm_ClearCell_Internal(session, cell);
             }
+            KTerm_MarkRowDirty(session, session->cursor.y);
             // Clear remaining lines
             for (int y = session->cursor.y + 1; y < term->height; y++) {
                 for (int x = 0; x < term->width; x++) {
@@ -6752,6 +10463,7 @@ static void ExecuteED_Internal(KTerm* term, KTermSession* session, bool private_
                     if (private_mode && (cell->flags & KTERM_ATTR_PROTECTED)) continue;
                     KTerm_ClearCell_Internal(session, cell);
                 }
+                KTerm_MarkRowDirty(session, y);
             }
             break;
 
@@ -6763,6 +10475,7 @@ static void ExecuteED_Internal(KTerm* term, KTermSession* session, bool private_
                     if (private_mode && (cell->flags & KTERM_ATTR_PROTECTED)) continue;
                     KTerm_ClearCell(term, cell);
                 }
+                KTerm_MarkRowDirty(GET_SESSION(term), y);
             }
             // Clear current line up to cursor
             for (int x = 0; x <= GET_SESSION(term)->cursor.x; x++) {
@@ -6770,6 +10483,7 @@ static void ExecuteED_Internal(KTerm* term, KTermSession* session, bool private_
                 if (private_mode && (cell->flags & KTERM_ATTR_PROTECTED)) continue;
                 KTerm_ClearCell(term, cell);
             }
+            KTerm_MarkRowDirty(GET_SESSION(term), GET_SESSION(term)->cursor.y);
             break;
 
         case 2: // Clear entire screen
@@ -6779,6 +10493,7 @@ static void ExecuteED_Internal(KTerm* term, KTermSession* session, bool private_
                     if (private_mode && (cell->flags & KTERM_ATTR_PROTECTED)) continue;
                     KTerm_ClearCell(term, cell);
                 }
+                KTerm_MarkRowDirty(session, y);
             }
             if (session->conformance.level == VT_LEVEL_ANSI_SYS) {
                 session->cursor.x = 0;
@@ -6792,7 +10507,7 @@ static void ExecuteED_Internal(KTerm* term, KTermSession* session, bool private_
                  KTerm_ClearCell(term, &session->screen_buffer[i]);
             }
             // Mark all rows dirty
-            for(int r=0; r<session->rows; r++) session->row_dirty[r] = KTERM_DIRTY_FRAMES;
+            for(int r=0; r<session->rows; r++) KTerm_MarkRowDirty(session, r);
             break;
 
         default:
@@ -6812,6 +10527,7 @@ static void ExecuteEL_Internal(KTerm* term, KTermSession* session, bool private_
                 if (private_mode && (cell->flags & KTERM_ATTR_PROTECTED)) continue;
                 KTerm_ClearCell_Internal(session, cell);
             }
+            KTerm_MarkRowDirty(session, session->cursor.y);
             break;
 
         case 1: // Clear from beginning of line to cursor
@@ -6820,6 +10536,7 @@ static void ExecuteEL_Internal(KTerm* term, KTermSession* session, bool private_
                 if (private_mode && (cell->flags & KTERM_ATTR_PROTECTED)) continue;
                 KTerm_ClearCell_Internal(session, cell);
             }
+            KTerm_MarkRowDirty(session, session->cursor.y);
             break;
 
         case 2: // Clear entire line
@@ -6828,6 +10545,7 @@ static void ExecuteEL_Internal(KTerm* term, KTermSession* session, bool private_
                 if (private_mode && (cell->flags & KTERM_ATTR_PROTECTED)) continue;
                 KTerm_ClearCell_Internal(session, cell);
             }
+            KTerm_MarkRowDirty(session, session->cursor.y);
             break;
 
         default:
@@ -7186,20 +10904,16 @@ void ExecuteSGR(KTerm* term, KTermSession* session) {
 // =============================================================================
 
 // Helper function to compute screen buffer checksum (for CSI ?63 n)
-static uint32_t ComputeScreenChecksum(KTerm* term, int page) {
+// 16-bit end-around-carry sum of codepoints and colors, from the row cache
+static uint32_t ComputeScreenChecksum(KTermSession* session, int page) {
     (void)page;
-    uint32_t checksum = 0;
-    // Simple CRC16-like checksum for screen buffer
-    for (int y = 0; y < term->height; y++) {
-        for (int x = 0; x < term->width; x++) {
-            EnhancedTermChar *cell = GetScreenCell(GET_SESSION(term), y, x);
-            checksum += cell->ch;
-            checksum += (cell->fg_color.color_mode == 0 ? cell->fg_color.value.index : (cell->fg_color.value.rgb.r << 16 | cell->fg_color.value.rgb.g << 8 | cell->fg_color.value.rgb.b));
-            checksum += (cell->bg_color.color_mode == 0 ? cell->bg_color.value.index : (cell->bg_color.value.rgb.r << 16 | cell->bg_color.value.rgb.g << 8 | cell->bg_color.value.rgb.b));
-            checksum = (checksum >> 16) + (checksum & 0xFFFF);
-        }
+    KTermRowChecksum scratch;
+    uint64_t checksum = 0;
+    for (int y = 0; y < session->rows; y++) {
+        checksum += KTerm_GetRowChecksum(session, y, &scratch)->dsr_sum;
     }
-    return checksum & 0xFFFF;
+    while (checksum >> 16) checksum = (checksum >> 16) + (checksum & 0xFFFF);
+    return (uint32_t)checksum;
 }
 
 static void SwitchScreenBuffer(KTerm* term, KTermSession* session, bool to_alternate) {
@@ -7267,7 +10981,7 @@ static void KTerm_SetModeInternal(KTerm* term, KTermSession* session, int mode,
                             for (int x = 0; x < cols; x++) {
                                 KTerm_ClearCell(term, GetScreenCell(session, y, x));
                             }
-                            session->row_dirty[y] = KTERM_DIRTY_FRAMES;
+                            KTerm_MarkRowDirty(session, y);
     }
 
                         // 2. Reset Margins
@@ -7348,7 +11062,7 @@ static void KTerm_SetModeInternal(KTerm* term, KTermSession* session, int mode,
                     term->tektronix.x = 0;
                     term->tektronix.y = 0;
                     term->tektronix.pen_down = false;
-                    term->vector_count = 0; // Clear screen on entry
+                    KTerm_ClearVectors(term); // Clear screen on entry
                 } else {
                     session->parse_state = VT_PARSE_NORMAL;
                 }
@@ -7377,7 +11091,7 @@ static void KTerm_SetModeInternal(KTerm* term, KTermSession* session, int mode,
             case 64: // DECSCCM - Multi-Session Support
                  if (enable) session->conformance.features |= KTERM_FEATURE_MULTI_SESSION_MODE; else session->conformance.features &= ~KTERM_FEATURE_MULTI_SESSION_MODE;
                  if (!enable && term->active_session != 0) {
-                     KTerm_SetActiveSession(term, 0);
+                     KTerm_SetActiveSessionIndex(term, 0);
                  }
                  break;
 
@@ -7528,6 +11242,9 @@ static void KTerm_SetModeInternal(KTerm* term, KTermSession* session, int mode,
 
             case 8246: // BDSM - Bi-Directional Support Mode (Private)
                 if (enable) session->dec_modes |= KTERM_MODE_BDSM; else session->dec_modes &= ~KTERM_MODE_BDSM;
+                // Rows changed while BDSM was off have no valid map; redraw in the new order
+                if (session->bidi_row_state) memset(session->bidi_row_state, KTERM_BIDI_ROW_STALE, session->bidi_rows);
+                for (int r = 0; r < session->rows; r++) KTerm_MarkRowDirty(session, r);
                 break;
 
             case 2004: // Bracketed Paste Mode
@@ -7811,17 +11528,100 @@ static void ExecuteMC(KTerm* term, KTermSession* session) {
         }
     }
 }
+// Hands the host as much of a session's ring as it accepts, in at most two pieces
+static void KTerm_DeliverSessionOutput(KTerm* term, int index) {
+    KTermSession* session = term->sessions[index];
+    uint32_t pending = session->output_head - session->output_tail;
+    if (pending == 0 || !term->session_sink) return;
+
+    uint32_t start = session->output_tail & (KTERM_OUTPUT_RING_SIZE - 1);
+    uint32_t first = KTERM_OUTPUT_RING_SIZE - start;
+    if (first > pending) first = pending;
+    KTermIOVec iov[2] = {
+        { session->output_ring + start, first },
+        { session->output_ring, pending - first }
+    };
+    size_t accepted = term->session_sink(term->session_sink_ctx, KTerm_SessionHandle(session), iov, (pending > first) ? 2 : 1);
+    if (accepted > pending) accepted = pending;
+
+    KTermOutputStatus* status = &session->output_status;
+    session->output_tail += (uint32_t)accepted;
+    status->deliveries++;
+    status->bytes_delivered += accepted;
+    if (accepted < pending) {
+        status->stalls++;
+        status->backpressure = true;
+    } else {
+        status->backpressure = false;
+        session->output_drop_reported = false;
+    }
+}
+
+// Drops a whole reply rather than sending a truncated sequence
+static void KTerm_DropOutput(KTerm* term, int index, size_t len) {
+    KTermSession* session = term->sessions[index];
+    KTermOutputStatus* status = &session->output_status;
+    if (!session->output_drop_reported) {
+        KTerm_ReportError(term, KTERM_LOG_WARNING, KTERM_SOURCE_SYSTEM,
+                          "Session %d output buffer full, dropping %zu bytes", index, len);
+        session->output_drop_reported = true;
+    }
+    status->bytes_dropped += len;
+    status->backpressure = true;
+}
+
+static void KTerm_QueueSessionOutput(KTerm* term, int index, const char* data, size_t len) {
+    KTermSession* session = term->sessions[index];
+    if (!session->output_ring) {
+        session->output_ring = (char*)KTerm_Malloc(KTERM_OUTPUT_RING_SIZE);
+        if (!session->output_ring) {
+            KTerm_DropOutput(term, index, len);
+            return;
+        }
+        session->output_head = session->output_tail = 0;
+    }
+
+    // A full ring goes to the host early before the reply is given up
+    if (session->output_head - session->output_tail + len > KTERM_OUTPUT_RING_SIZE) {
+        KTerm_DeliverSessionOutput(term, index);
+        if (session->output_head - session->output_tail + len > KTERM_OUTPUT_RING_SIZE) {
+            KTerm_DropOutput(term, index, len);
+            return;
+        }
+    }
+
+    uint32_t start = session->output_head & (KTERM_OUTPUT_RING_SIZE - 1);
+    size_t first = KTERM_OUTPUT_RING_SIZE - start;
+    if (first > len) first = len;
+    memcpy(session->output_ring + start, data, first);
+    memcpy(session->output_ring, data + first, len - first);
+    session->output_head += (uint32_t)len;
+}
+
 // Internal Write Primitive (Handles Sink vs Legacy Buffer)
 static void KTerm_WriteInternal(KTerm* term, const char* data, size_t len, bool is_binary) {
-    if (term->output_sink) {
+    // Replies belong to the session whose input produced them, not the one on screen
+    int index = (term->output_session >= 0) ? term->output_session : term->active_session;
+    KTermSession* session = term->sessions[index];
+    session->output_status.writes++;
+    KTerm_ListSession(term, session); // Delivered at the end of the frame
+
+    if (term->session_sink) {
+        if (session->response_enabled) KTerm_QueueSessionOutput(term, index, data, len);
+    } else if (term->output_sink) {
         // Zero-copy direct sink output
         term->output_sink(term->output_sink_ctx, data, len);
+        session->output_status.deliveries++;
+        session->output_status.bytes_delivered += len;
     } else {
         // Legacy Buffering Logic
-        KTermSession* session = GET_SESSION(term);
         if (!session->response_enabled) return;
+        if (!session->answerback_buffer && !KTerm_AllocResponseBuffer(term, session)) {
+            KTerm_DropOutput(term, index, len);
+            return;
+        }
 
-        size_t capacity = sizeof(session->answerback_buffer);
+        size_t capacity = session->response_capacity;
         // Reserve 1 byte for null terminator if not binary
         size_t effective_capacity = is_binary ? capacity : capacity - 1;
 
@@ -7839,9 +11639,7 @@ static void KTerm_WriteInternal(KTerm* term, const char* data, size_t len, bool
                 size_t available = effective_capacity - session->response_length;
 
                 if (len > available) {
-                    if (session->options.debug_sequences) {
-                        fprintf(stderr, "KTerm_WriteInternal: Response buffer full, dropping %zu bytes\n", len - available);
-                    }
+                    KTerm_DropOutput(term, index, len - available);
                     len = available;
                 }
             }
@@ -7868,6 +11666,71 @@ void KTerm_QueueResponseBytes(KTerm* term, const char* data, size_t len) {
     KTerm_WriteInternal(term, data, len, true);
 }
 
+void KTerm_SetSessionSink(KTerm* term, KTermSessionSink sink, void* ctx) {
+    if (!term) return;
+    KTerm_FlushOutput(term); // Last delivery to the previous sink
+    term->session_sink = sink;
+    term->session_sink_ctx = ctx;
+    if (!sink) return;
+
+    // Replies still in the legacy buffers move to the rings
+    for (int i = 0; i < term->session_count; i++) {
+        KTermSession* session = term->sessions[i];
+        if (session->response_length > 0) {
+            KTerm_QueueSessionOutput(term, i, session->answerback_buffer, (size_t)session->response_length);
+            session->response_length = 0;
+        }
+    }
+}
+
+void KTerm_FlushOutput(KTerm* term) {
+    if (!term || !term->session_sink) return;
+    for (int i = 0; i < term->session_count; i++) KTerm_DeliverSessionOutput(term, i);
+}
+
+bool KTerm_GetOutputStatus(KTerm* term, int session_index, KTermOutputStatus* status) {
+    KTermSession* session = KTerm_LookupSession(term, session_index);
+    if (!session || !status) return false;
+    *status = session->output_status;
+    if (term->session_sink) {
+        status->pending = session->output_head - session->output_tail;
+        status->capacity = KTERM_OUTPUT_RING_SIZE;
+    } else {
+        status->pending = (size_t)session->response_length;
+        status->capacity = session->response_capacity;
+    }
+    return true;
+}
+
+bool KTerm_GetSessionFootprint(KTerm* term, int session_index, KTermSessionFootprint* footprint) {
+    KTermSession* session = KTerm_LookupSession(term, session_index);
+    if (!session || !footprint) return false;
+    memset(footprint, 0, sizeof(*footprint));
+    footprint->session_struct = sizeof(KTermSession);
+
+    size_t cell = sizeof(EnhancedTermChar);
+    if (session->screen_buffer) footprint->screen += (size_t)session->buffer_height * session->cols * cell;
+    if (session->alt_buffer) footprint->screen += (size_t)session->rows * session->cols * cell;
+    if (session->row_dirty) footprint->screen += (size_t)session->rows;
+
+    if (session->input_pipeline) footprint->input_pipeline = (size_t)session->pipeline_mask + 1;
+    if (session->input.buffer) footprint->key_events = ((size_t)session->input.buffer_mask + 1) * sizeof(KTermEvent);
+    if (session->op_queue.ops) footprint->op_queue = (size_t)session->op_queue.capacity * sizeof(KTermOp);
+    if (session->answerback_buffer) footprint->responses = session->response_capacity;
+    if (session->output_ring) footprint->output_ring = KTERM_OUTPUT_RING_SIZE;
+
+    if (session->tab_stops.stops) footprint->caches += (size_t)session->tab_stops.capacity * sizeof(bool);
+    if (session->bidi_map) {
+        footprint->caches += (size_t)session->bidi_rows * session->bidi_cols * sizeof(uint16_t) +
+                             (size_t)session->bidi_rows + (size_t)session->bidi_cols * cell;
+    }
+    if (session->row_checksums) footprint->caches += (size_t)session->checksum_rows * sizeof(KTermRowChecksum);
+
+    footprint->total = footprint->session_struct + footprint->screen + footprint->input_pipeline + footprint->key_events +
+                       footprint->op_queue + footprint->responses + footprint->output_ring + footprint->caches;
+    return true;
+}
+
 // Enhanced ExecuteDSR function with new handlers
 static void ExecuteDSR(KTerm* term, KTermSession* session) {
     if (!session) session = GET_SESSION(term);
@@ -7921,14 +11784,14 @@ static void ExecuteDSR(KTerm* term, KTermSession* session) {
 
                 int limit = session->conformance.max_session_count;
                 if (limit == 0) limit = 1;
-                if (limit > MAX_SESSIONS) limit = MAX_SESSIONS;
+                if (limit > term->session_count) limit = term->session_count;
 
                 char response[MAX_COMMAND_BUFFER];
                 int offset = snprintf(response, sizeof(response), "\x1BP$p");
                 for (int i = 0; i < limit; i++) {
                     int seq = i + 1;
                     int status = 1; // Not open
-                    if (term->sessions[i].session_open) {
+                    if (term->sessions[i]->session_open) {
                         status = (i == term->active_session) ? 2 : 3;
                     }
                     int attr = 0;
@@ -7963,7 +11826,7 @@ static void ExecuteDSR(KTerm* term, KTermSession* session) {
             }
             case 63: {
                 int page = (session->param_count > 1) ? session->escape_params[1] : 1;
-                session->checksum.last_checksum = ComputeScreenChecksum(term, page);
+                session->checksum.last_checksum = ComputeScreenChecksum(session, page);
                 char response[64];
                 snprintf(response, sizeof(response), "\x1B[?63;%d;%d;%04Xn",
                          page, session->checksum.algorithm, session->checksum.last_checksum);
@@ -8353,6 +12216,7 @@ void ExecuteDECSCA(KTerm* term, KTermSession* session) {
     int ps = KTerm_GetCSIParam(term, session, 0, 0);
     if (ps == 1) {
         session->current_attributes |= KTERM_ATTR_PROTECTED;
+        session->protection_used = true;
     } else {
         session->current_attributes &= ~KTERM_ATTR_PROTECTED;
     }
@@ -8618,11 +12482,11 @@ void ExecuteDECSN(KTerm* term, KTermSession* session) {
     // If param is omitted (0 returned by KTerm_GetCSIParam if 0 is default), VT520 DECSN usually defaults to 1.
     if (session_id == 0) session_id = 1;
 
-    // Use max_session_count from features if set, otherwise default to MAX_SESSIONS (or 1 if single session)
+    // Use max_session_count from features if set (capped by the sessions that exist), otherwise 1
     // Actually we should rely on max_session_count. If 0 (uninitialized safety), default to 1.
     int limit = session->conformance.max_session_count;
     if (limit == 0) limit = 1;
-    if (limit > MAX_SESSIONS) limit = MAX_SESSIONS;
+    if (limit > term->session_count) limit = term->session_count;
 
     if (session_id >= 1 && session_id <= limit) {
         // Respect Multi-Session Mode Lock
@@ -8636,8 +12500,8 @@ void ExecuteDECSN(KTerm* term, KTermSession* session) {
             return;
         }
 
-        if (term->sessions[session_id - 1].session_open) {
-            KTerm_SetActiveSession(term, session_id - 1);
+        if (term->sessions[session_id - 1]->session_open) {
+            KTerm_SetActiveSessionIndex(term, session_id - 1);
         } else {
             if (session->options.debug_sequences) {
                 char msg[64];
@@ -8712,6 +12576,7 @@ void KTerm_ProcessCSIChar(KTerm* term, KTermSession* session, unsigned char ch)
     if (is_final) {
         // Parse parameters into session->escape_params
         KTerm_ParseCSIParams_Internal(session, session->escape_buffer, NULL, MAX_ESCAPE_PARAMS);
+        KTerm_StatsCountSequence(term, session, KTERM_STAT_SEQ_CSI);
 
         // Handle DECSCUSR (CSI Ps SP q)
         if (ch == 'q' && session->escape_pos >= 1 && session->escape_buffer[session->escape_pos - 1] == ' ') {
@@ -8737,8 +12602,8 @@ void KTerm_ProcessCSIChar(KTerm* term, KTermSession* session, unsigned char ch)
             KTerm_ExecuteCSICommand(term, session, ch);
         }
 
-        // Reset parser state
-        session->parse_state = VT_PARSE_NORMAL;
+        // Reset parser state (DECTEK has just switched it to Tektronix mode)
+        if (session->parse_state != PARSE_TEKTRONIX) session->parse_state = VT_PARSE_NORMAL;
         ClearCSIParams(session);
     } else if (ch >= 0x20 && ch <= 0x3F) {
         // Accumulate intermediate characters (e.g., digits, ';', '?')
@@ -9779,6 +13644,8 @@ void KTerm_ExecuteDCSAnswerback(KTerm* term, KTermSession* session) {
             if (length >= MAX_COMMAND_BUFFER) {
                 length = MAX_COMMAND_BUFFER - 1; // Prevent overflow
             }
+            if (!KTerm_AllocResponseBuffer(term, session)) return;
+            if (length >= session->response_capacity) length = session->response_capacity - 1;
             strncpy(session->answerback_buffer, message_start, length);
             session->answerback_buffer[length] = '\0';
         } else if (session->options.debug_sequences) {
@@ -10070,7 +13937,7 @@ void KTerm_ProcessHashChar(KTerm* term, KTermSession* session, unsigned char ch)
                 cell->flags &= ~KTERM_ATTR_DOUBLE_HEIGHT_BOT;
                 cell->flags |= (KTERM_ATTR_DOUBLE_HEIGHT_TOP | KTERM_ATTR_DOUBLE_WIDTH | KTERM_FLAG_DIRTY);
             }
-            session->row_dirty[session->cursor.y] = KTERM_DIRTY_FRAMES;
+            KTerm_MarkRowDirty(session, session->cursor.y);
             break;
 
         case '4': // DECDHL - Double-height line, bottom half
@@ -10079,7 +13946,7 @@ void KTerm_ProcessHashChar(KTerm* term, KTermSession* session, unsigned char ch)
                 cell->flags &= ~KTERM_ATTR_DOUBLE_HEIGHT_TOP;
                 cell->flags |= (KTERM_ATTR_DOUBLE_HEIGHT_BOT | KTERM_ATTR_DOUBLE_WIDTH | KTERM_FLAG_DIRTY);
             }
-            session->row_dirty[session->cursor.y] = KTERM_DIRTY_FRAMES;
+            KTerm_MarkRowDirty(session, session->cursor.y);
             break;
 
         case '5': // DECSWL - Single-width single-height line
@@ -10088,7 +13955,7 @@ void KTerm_ProcessHashChar(KTerm* term, KTermSession* session, unsigned char ch)
                 cell->flags &= ~(KTERM_ATTR_DOUBLE_HEIGHT_TOP | KTERM_ATTR_DOUBLE_HEIGHT_BOT | KTERM_ATTR_DOUBLE_WIDTH);
                 cell->flags |= KTERM_FLAG_DIRTY;
             }
-            session->row_dirty[session->cursor.y] = KTERM_DIRTY_FRAMES;
+            KTerm_MarkRowDirty(session, session->cursor.y);
             break;
 
         case '6': // DECDWL - Double-width single-height line
@@ -10097,7 +13964,7 @@ void KTerm_ProcessHashChar(KTerm* term, KTermSession* session, unsigned char ch)
                 cell->flags &= ~(KTERM_ATTR_DOUBLE_HEIGHT_TOP | KTERM_ATTR_DOUBLE_HEIGHT_BOT);
                 cell->flags |= (KTERM_ATTR_DOUBLE_WIDTH | KTERM_FLAG_DIRTY);
             }
-            session->row_dirty[session->cursor.y] = KTERM_DIRTY_FRAMES;
+            KTerm_MarkRowDirty(session, session->cursor.y);
             break;
 
         case '8': // DECALN - Screen Alignment Pattern
@@ -10111,6 +13978,7 @@ void KTerm_ProcessHashChar(KTerm* term, KTermSession* session, unsigned char ch)
                     // Reset attributes
                     cell->flags = KTERM_FLAG_DIRTY;
                 }
+                KTerm_MarkRowDirty(session, y);
             }
             session->cursor.x = 0;
             session->cursor.y = 0;
@@ -10180,103 +14048,243 @@ void KTerm_ProcessPercentChar(KTerm* term, KTermSession* session, unsigned char
     GET_SESSION(term)->parse_state = VT_PARSE_NORMAL;
 }
 
-static void ReGIS_DrawLine(KTerm* term, int x0, int y0, int x1, int y1) {
-    if (term->vector_count < term->vector_capacity) {
-        GPUVectorLine* line = &term->vector_staging_buffer[term->vector_count];
+typedef struct { float x, y; } ReGISPoint;
 
-        // Aspect Ratio Correction
-        float logical_w = (float)(term->regis.screen_max_x - term->regis.screen_min_x + 1);
-        float logical_h = (float)(term->regis.screen_max_y - term->regis.screen_min_y + 1);
-        if (logical_w <= 0) logical_w = REGIS_WIDTH;
-        if (logical_h <= 0) logical_h = REGIS_HEIGHT;
+// Aspect-preserving fit of the logical screen into the cell grid, in pixels
+static void ReGIS_UpdateTransform(KTerm* term) {
+    if (term->regis.xform.cols == term->width && term->regis.xform.rows == term->height &&
+        term->regis.xform.min_x == term->regis.screen_min_x && term->regis.xform.min_y == term->regis.screen_min_y &&
+        term->regis.xform.max_x == term->regis.screen_max_x && term->regis.xform.max_y == term->regis.screen_max_y) {
+        return;
+    }
 
-        float screen_w = (float)(term->width * DEFAULT_CHAR_WIDTH);
-        float screen_h = (float)(term->height * DEFAULT_CHAR_HEIGHT);
-        float scale_x = screen_w / logical_w;
-        float scale_y = screen_h / logical_h;
-        float scale_factor = (scale_x < scale_y) ? scale_x : scale_y;
+    float logical_w = (float)(term->regis.screen_max_x - term->regis.screen_min_x + 1);
+    float logical_h = (float)(term->regis.screen_max_y - term->regis.screen_min_y + 1);
+    if (logical_w <= 0) logical_w = REGIS_WIDTH;
+    if (logical_h <= 0) logical_h = REGIS_HEIGHT;
+
+    float screen_w = (float)(term->width * DEFAULT_CHAR_WIDTH);
+    float screen_h = (float)(term->height * DEFAULT_CHAR_HEIGHT);
+    float scale_x = screen_w / logical_w;
+    float scale_y = screen_h / logical_h;
+    float scale_factor = (scale_x < scale_y) ? scale_x : scale_y;
+
+    term->regis.xform.scale = scale_factor;
+    term->regis.xform.x_margin = (screen_w - logical_w * scale_factor) / 2.0f;
+    term->regis.xform.y_margin = (screen_h - logical_h * scale_factor) / 2.0f;
+    term->regis.xform.screen_w = screen_w;
+    term->regis.xform.screen_h = screen_h;
+    term->regis.xform.inv_w = 1.0f / screen_w;
+    term->regis.xform.inv_h = 1.0f / screen_h;
+
+    term->regis.xform.min_x = term->regis.screen_min_x;
+    term->regis.xform.min_y = term->regis.screen_min_y;
+    term->regis.xform.max_x = term->regis.screen_max_x;
+    term->regis.xform.max_y = term->regis.screen_max_y;
+    term->regis.xform.cols = term->width;
+    term->regis.xform.rows = term->height;
+}
+
+static inline ReGISPoint ReGIS_ToPixels(KTerm* term, float x, float y) {
+    ReGISPoint p;
+    p.x = term->regis.xform.x_margin + (x - (float)term->regis.xform.min_x) * term->regis.xform.scale;
+    p.y = term->regis.xform.y_margin + (y - (float)term->regis.xform.min_y) * term->regis.xform.scale;
+    return p;
+}
 
-        float target_w = logical_w * scale_factor;
-        float target_h = logical_h * scale_factor;
-        float x_margin = (screen_w - target_w) / 2.0f;
-        float y_margin = (screen_h - target_h) / 2.0f;
+// One vector between two pixel positions (ReGIS_UpdateTransform must be current)
+static void ReGIS_EmitLine(KTerm* term, float u0_px, float v0_px, float u1_px, float v1_px) {
+    GPUVectorLine* line = KTerm_AllocVector(term);
+    if (!line) return;
 
-        float u0_px = x_margin + ((float)(x0 - term->regis.screen_min_x) * scale_factor);
-        float v0_px = y_margin + ((float)(y0 - term->regis.screen_min_y) * scale_factor);
-        float u1_px = x_margin + ((float)(x1 - term->regis.screen_min_x) * scale_factor);
-        float v1_px = y_margin + ((float)(y1 - term->regis.screen_min_y) * scale_factor);
+    // Y is inverted in ReGIS (0=Top) vs OpenGL UV (0=Bottom usually)
+    line->x0 = u0_px * term->regis.xform.inv_w;
+    line->y0 = 1.0f - (v0_px * term->regis.xform.inv_h);
+    line->x1 = u1_px * term->regis.xform.inv_w;
+    line->y1 = 1.0f - (v1_px * term->regis.xform.inv_h);
 
-        // Y is inverted in ReGIS (0=Top) vs OpenGL UV (0=Bottom usually)
-        line->x0 = u0_px / screen_w;
-        line->y0 = 1.0f - (v0_px / screen_h);
-        line->x1 = u1_px / screen_w;
-        line->y1 = 1.0f - (v1_px / screen_h);
+    line->color = term->regis.color;
+    line->intensity = 1.0f;
+    line->mode = term->regis.write_mode;
+}
 
-        line->color = term->regis.color;
-        line->intensity = 1.0f;
-        line->mode = term->regis.write_mode;
-        term->vector_count++;
+static void ReGIS_DrawLine(KTerm* term, int x0, int y0, int x1, int y1) {
+    ReGIS_UpdateTransform(term);
+    ReGISPoint p0 = ReGIS_ToPixels(term, (float)x0, (float)y0);
+    ReGISPoint p1 = ReGIS_ToPixels(term, (float)x1, (float)y1);
+    ReGIS_EmitLine(term, p0.x, p0.y, p1.x, p1.y);
+}
+
+// Segments for `radians` of a circle of `radius` logical units, keeping the
+// chord within half a pixel of the arc
+static int ReGIS_CurveSegments(KTerm* term, float radius, float radians) {
+    ReGIS_UpdateTransform(term);
+    float r_px = radius * term->regis.xform.scale;
+    float step = (r_px > 0.5f) ? 2.0f * acosf(1.0f - 0.5f / r_px) : 6.283185f;
+    int segments = (int)ceilf(fabsf(radians) / step);
+    if (segments < 4) segments = 4;
+    if (segments > 720) segments = 720;
+    return segments;
+}
+
+// Polyline along an arc around (cx, cy), from angle `start` through `radians`.
+// Points advance by a rotation instead of one sin/cos pair each.
+static void ReGIS_DrawArc(KTerm* term, float cx, float cy, float radius, float start, float radians, int segments) {
+    float step = radians / (float)segments;
+    float cs = cosf(step), sn = sinf(step);
+    float dx = cosf(start) * radius, dy = sinf(start) * radius;
+    ReGISPoint last = ReGIS_ToPixels(term, cx + dx, cy + dy);
+    for (int i = 0; i < segments; i++) {
+        float ndx = dx * cs - dy * sn;
+        dy = dx * sn + dy * cs;
+        dx = ndx;
+        ReGISPoint next = ReGIS_ToPixels(term, cx + dx, cy + dy);
+        ReGIS_EmitLine(term, last.x, last.y, next.x, next.y);
+        last = next;
     }
 }
 
-static int ReGIS_CompareInt(const void* a, const void* b) {
-    return (*(int*)a - *(int*)b);
-}
+typedef struct {
+    float x, dxdy; // X at the current row center, change per row
+    float y_end;   // Bottom of the edge (exclusive)
+    int id;        // Edge index, to follow a span from row to row
+} ReGISActiveEdge;
 
-static void ReGIS_FillPolygon(KTerm* term) {
-    if (term->regis.point_count < 3) {
-        term->regis.point_count = 0;
+// Rows of spans between the same two edges, so both sides stay straight
+typedef struct {
+    int left, right;          // Edge ids
+    float y_top, y_bottom;    // First and last row centers
+    float xl_top, xr_top;     // Span at y_top
+    float xl_bottom, xr_bottom;
+} ReGISTrapezoid;
+
+// One KTERM_VECTOR_FILL pair. Edges stay unclamped: the renderers clip each row.
+static void ReGIS_EmitTrapezoid(KTerm* term, const ReGISTrapezoid* t) {
+    GPUVectorLine* left = KTerm_AllocVector(term);
+    if (!left) return;
+    uint32_t left_index = term->vector_count - 1;
+    GPUVectorLine* right = KTerm_AllocVector(term);
+    if (!right) {
+        term->vector_count--; // Never leave half a pair
         return;
     }
-
-    // Scanline Fill Algorithm
-    int min_y = term->regis.screen_max_y, max_y = term->regis.screen_min_y;
-    for(int i=0; i<term->regis.point_count; i++) {
-        if (term->regis.point_buffer[i].y < min_y) min_y = term->regis.point_buffer[i].y;
-        if (term->regis.point_buffer[i].y > max_y) max_y = term->regis.point_buffer[i].y;
-    }
-    if (min_y < term->regis.screen_min_y) min_y = term->regis.screen_min_y;
-    if (max_y > term->regis.screen_max_y) max_y = term->regis.screen_max_y;
-
-    int nodes[64];
-    for (int y = min_y; y <= max_y; y++) {
-        int node_count = 0;
-        int j = term->regis.point_count - 1;
-        for (int i = 0; i < term->regis.point_count; i++) {
-            int y1 = term->regis.point_buffer[i].y;
-            int y2 = term->regis.point_buffer[j].y;
-            int x1 = term->regis.point_buffer[i].x;
-            int x2 = term->regis.point_buffer[j].x;
-
-            if ((y1 < y && y2 >= y) || (y2 < y && y1 >= y)) {
-                if (node_count < 64) {
-                    nodes[node_count++] = x1 + (int)((float)(y - y1) / (float)(y2 - y1) * (float)(x2 - x1));
-                }
+    left = &term->vector_staging_buffer[left_index]; // The second allocation may have moved it
+
+    float inv_w = term->regis.xform.inv_w, inv_h = term->regis.xform.inv_h;
+    left->x0 = t->xl_top * inv_w;
+    left->x1 = t->xl_bottom * inv_w;
+    right->x0 = t->xr_top * inv_w;
+    right->x1 = t->xr_bottom * inv_w;
+    left->y0 = right->y0 = 1.0f - t->y_top * inv_h;
+    left->y1 = right->y1 = 1.0f - t->y_bottom * inv_h;
+    left->color = right->color = term->regis.color;
+    left->intensity = right->intensity = 1.0f;
+    left->mode = term->regis.write_mode | KTERM_VECTOR_FILL;
+    right->mode = term->regis.write_mode | KTERM_VECTOR_FILL_RIGHT;
+}
+
+// Even-odd scanline fill of the point buffer. Edges enter an active-edge table
+// in order of their top and leave it past their bottom, so each row only sorts
+// the few edges that cross it. Consecutive rows spanned by the same two edges
+// merge into one trapezoid, which ends when either edge ends or the pairing changes.
+static void ReGIS_FillPolygon(KTerm* term) {
+    int count = term->regis.point_count;
+    term->regis.point_count = 0;
+    if (count < 3) return;
+    ReGIS_UpdateTransform(term);
+
+    // Edges in pixel space, sorted by top (insertion sort: at most 64)
+    struct { float y_top, y_bottom, x_top, dxdy; } edges[64];
+    int edge_count = 0;
+    for (int i = 0, j = count - 1; i < count; j = i++) {
+        ReGISPoint a = ReGIS_ToPixels(term, (float)term->regis.point_buffer[j].x, (float)term->regis.point_buffer[j].y);
+        ReGISPoint b = ReGIS_ToPixels(term, (float)term->regis.point_buffer[i].x, (float)term->regis.point_buffer[i].y);
+        if (a.y == b.y) continue; // Horizontal edges never cross a row center
+        if (a.y > b.y) { ReGISPoint t = a; a = b; b = t; }
+        int k = edge_count++;
+        while (k > 0 && edges[k - 1].y_top > a.y) { edges[k] = edges[k - 1]; k--; }
+        edges[k].y_top = a.y;
+        edges[k].y_bottom = b.y;
+        edges[k].x_top = a.x;
+        edges[k].dxdy = (b.x - a.x) / (b.y - a.y);
+    }
+    if (edge_count < 2) return;
+
+    float y_max = 0;
+    for (int i = 0; i < edge_count; i++) if (edges[i].y_bottom > y_max) y_max = edges[i].y_bottom;
+    float screen_h = term->regis.xform.screen_h;
+
+    ReGISActiveEdge active[64];
+    int active_count = 0;
+    int next_edge = 0;
+    ReGISTrapezoid open[32], next[32]; // One per span of the previous row / this row
+    int open_count = 0;
+    // Pixel rows whose centers fall inside [y_top, y_bottom)
+    int row = (int)ceilf(edges[0].y_top - 0.5f);
+    if (row < 0) row = 0;
+    for (; row < (int)screen_h && row + 0.5f < y_max; row++) {
+        float yc = row + 0.5f;
+
+        // Retire finished edges, advance the rest one row
+        int kept = 0;
+        for (int i = 0; i < active_count; i++) {
+            if (active[i].y_end <= yc) continue;
+            active[i].x += active[i].dxdy;
+            active[kept++] = active[i];
+        }
+        active_count = kept;
+
+        // Enter edges starting above this row center
+        while (next_edge < edge_count && edges[next_edge].y_top <= yc) {
+            if (edges[next_edge].y_bottom > yc) {
+                ReGISActiveEdge* e = &active[active_count++];
+                e->id = next_edge;
+                e->dxdy = edges[next_edge].dxdy;
+                e->x = edges[next_edge].x_top + (yc - edges[next_edge].y_top) * e->dxdy;
+                e->y_end = edges[next_edge].y_bottom;
             }
-            j = i;
-        }
-
-        qsort(nodes, node_count, sizeof(int), ReGIS_CompareInt);
-
-        for (int i = 0; i < node_count; i += 2) {
-            if (i + 1 < node_count) {
-                int x_start = nodes[i] < term->regis.screen_min_x ? term->regis.screen_min_x : nodes[i];
-                int x_end = nodes[i+1] > term->regis.screen_max_x ? term->regis.screen_max_x : nodes[i+1];
-                if (x_start > term->regis.screen_max_x) break;
-                if (x_end < term->regis.screen_min_x) continue;
-                if (x_start < x_end) {
-                     // Draw horizontal line span
-                     ReGIS_DrawLine(term, x_start, y, x_end, y);
-                }
+            next_edge++;
+        }
+
+        // Keep the table ordered by x; it is almost sorted from the last row
+        for (int i = 1; i < active_count; i++) {
+            ReGISActiveEdge e = active[i];
+            int k = i;
+            while (k > 0 && active[k - 1].x > e.x) { active[k] = active[k - 1]; k--; }
+            active[k] = e;
+        }
+
+        // Extend the previous row's trapezoids that have the same two edges
+        int next_count = 0;
+        for (int i = 0; i + 1 < active_count; i += 2) {
+            ReGISTrapezoid* t = &next[next_count++];
+            int j = 0;
+            while (j < open_count && (open[j].left != active[i].id || open[j].right != active[i + 1].id)) j++;
+            if (j < open_count) {
+                *t = open[j];
+                open[j].left = -1; // Taken
+            } else {
+                t->left = active[i].id;
+                t->right = active[i + 1].id;
+                t->y_top = yc;
+                t->xl_top = active[i].x;
+                t->xr_top = active[i + 1].x;
             }
+            t->y_bottom = yc;
+            t->xl_bottom = active[i].x;
+            t->xr_bottom = active[i + 1].x;
+        }
+        for (int j = 0; j < open_count; j++) {
+            if (open[j].left >= 0) ReGIS_EmitTrapezoid(term, &open[j]);
         }
+        memcpy(open, next, (size_t)next_count * sizeof(ReGISTrapezoid));
+        open_count = next_count;
     }
-    term->regis.point_count = 0;
+    for (int j = 0; j < open_count; j++) ReGIS_EmitTrapezoid(term, &open[j]);
 }
 
 // Cubic B-Spline interpolation
-static void ReGIS_EvalBSpline(KTerm* term, int p0x, int p0y, int p1x, int p1y, int p2x, int p2y, int p3x, int p3y, float t, int* out_x, int* out_y) {
-    (void)term;
+static ReGISPoint ReGIS_EvalBSpline(int p0x, int p0y, int p1x, int p1y, int p2x, int p2y, int p3x, int p3y, float t) {
     float t2 = t * t;
     float t3 = t2 * t;
     float b0 = (-t3 + 3*t2 - 3*t + 1) / 6.0f;
@@ -10284,8 +14292,10 @@ static void ReGIS_EvalBSpline(KTerm* term, int p0x, int p0y, int p1x, int p1y, i
     float b2 = (-3*t3 + 3*t2 + 3*t + 1) / 6.0f;
     float b3 = t3 / 6.0f;
 
-    *out_x = (int)(b0*p0x + b1*p1x + b2*p2x + b3*p3x);
-    *out_y = (int)(b0*p0y + b1*p1y + b2*p2y + b3*p3y);
+    ReGISPoint p;
+    p.x = b0*p0x + b1*p1x + b2*p2x + b3*p3x;
+    p.y = b0*p0y + b1*p1y + b2*p2y + b3*p3y;
+    return p;
 }
 
 static void ExecuteReGISCommand(KTerm* term, KTermSession* session) {
@@ -10350,8 +14360,9 @@ static void ExecuteReGISCommand(KTerm* term, KTermSession* session) {
     }
     // --- F: Polygon Fill ---
     else if (term->regis.command == 'F') {
-        // Collect points but don't draw immediately
-        for (int i = 0; i <= max_idx; i += 2) {
+        // Collect points but don't draw immediately. Without new data (closing
+        // parenthesis) the parameters are stale and hold no vertex.
+        for (int i = 0; term->regis.data_pending && i <= max_idx; i += 2) {
             int val_x = term->regis.params[i];
             bool rel_x = term->regis.params_relative[i];
             int val_y = (i + 1 <= max_idx) ? term->regis.params[i+1] : term->regis.y;
@@ -10421,18 +14432,21 @@ static void ExecuteReGISCommand(KTerm* term, KTermSession* session) {
                     int p2x = term->regis.point_buffer[i+2].x; int p2y = term->regis.point_buffer[i+2].y;
                     int p3x = term->regis.point_buffer[i+3].x; int p3y = term->regis.point_buffer[i+3].y;
 
-                    int seg_steps = 10;
-                    int last_x = -1, last_y = -1;
+                    // About one step per 4 pixels of the segment's control polygon
+                    ReGIS_UpdateTransform(term);
+                    float hull = hypotf((float)(p1x - p0x), (float)(p1y - p0y)) + hypotf((float)(p2x - p1x), (float)(p2y - p1y)) +
+                                 hypotf((float)(p3x - p2x), (float)(p3y - p2y));
+                    int seg_steps = (int)ceilf(hull * term->regis.xform.scale / 12.0f);
+                    if (seg_steps < 2) seg_steps = 2;
+                    if (seg_steps > 64) seg_steps = 64;
 
+                    ReGISPoint last = ReGIS_ToPixels(term, 0, 0);
                     for (int s=0; s<=seg_steps; s++) {
                         float t = (float)s / (float)seg_steps;
-                        int tx, ty;
-                        ReGIS_EvalBSpline(term, p0x, p0y, p1x, p1y, p2x, p2y, p3x, p3y, t, &tx, &ty);
-                        if (last_x != -1) {
-                            ReGIS_DrawLine(term, last_x, last_y, tx, ty);
-                        }
-                        last_x = tx;
-                        last_y = ty;
+                        ReGISPoint p = ReGIS_EvalBSpline(p0x, p0y, p1x, p1y, p2x, p2y, p3x, p3y, t);
+                        p = ReGIS_ToPixels(term, p.x, p.y);
+                        if (s > 0) ReGIS_EmitLine(term, last.x, last.y, p.x, p.y);
+                        last = p;
                     }
                 }
                 int keep = 3;
@@ -10468,25 +14482,12 @@ static void ExecuteReGISCommand(KTerm* term, KTermSession* session) {
                     degrees = (float)term->regis.params[2];
                 }
 
-                int segments = (int)(fabsf(degrees) / 5.0f);
-                if (segments < 4) segments = 4;
-                float rad_step = (degrees * 3.14159f / 180.0f) / segments;
-
-                float current_angle = start_angle;
-                int last_x = sx;
-                int last_y = sy;
-
-                for (int i=0; i<segments; i++) {
-                    current_angle += rad_step;
-                    int nx = cx + (int)(cosf(current_angle) * radius);
-                    int ny = cy + (int)(sinf(current_angle) * radius);
-                    ReGIS_DrawLine(term, last_x, last_y, nx, ny);
-                    last_x = nx;
-                    last_y = ny;
-                }
+                float radians = degrees * 3.14159f / 180.0f;
+                int segments = ReGIS_CurveSegments(term, radius, radians);
+                ReGIS_DrawArc(term, (float)cx, (float)cy, radius, start_angle, radians, segments);
 
-                term->regis.x = last_x;
-                term->regis.y = last_y;
+                term->regis.x = cx + (int)(cosf(start_angle + radians) * radius);
+                term->regis.y = cy + (int)(sinf(start_angle + radians) * radius);
             }
         }
         else {
@@ -10508,23 +14509,8 @@ static void ExecuteReGISCommand(KTerm* term, KTermSession* session) {
                      radius = (int)sqrtf(dx*dx + dy*dy);
                  }
 
-                 int cx = term->regis.x;
-                 int cy = term->regis.y;
-                 int segments = 32;
-                 float angle_step = 6.283185f / segments;
-
-                 for (int j = 0; j < segments; j++) {
-                    if (term->vector_count >= term->vector_capacity) break;
-                    float a1 = j * angle_step;
-                    float a2 = (j + 1) * angle_step;
-
-                    int x1 = cx + (int)(cosf(a1) * radius);
-                    int y1 = cy + (int)(sinf(a1) * radius);
-                    int x2 = cx + (int)(cosf(a2) * radius);
-                    int y2 = cy + (int)(sinf(a2) * radius);
-
-                    ReGIS_DrawLine(term, x1, y1, x2, y2);
-                 }
+                 int segments = ReGIS_CurveSegments(term, (float)radius, 6.283185f);
+                 ReGIS_DrawArc(term, (float)term->regis.x, (float)term->regis.y, (float)radius, 0.0f, 6.283185f, segments);
             }
         }
     }
@@ -10539,8 +14525,7 @@ static void ExecuteReGISCommand(KTerm* term, KTermSession* session) {
                  term->regis.screen_max_x = term->regis.params[2];
                  term->regis.screen_max_y = term->regis.params[3];
              }
-             term->vector_count = 0;
-             term->vector_clear_request = true;
+             KTerm_ClearVectors(term);
         } else if (term->regis.option_command == 'A') {
              // Screen Addressing S(A[x1,y1][x2,y2])
              if (term->regis.param_count >= 3) {
@@ -10788,8 +14773,8 @@ static void ProcessReGISChar(KTerm* term, KTermSession* session, unsigned char c
                                 float fx1 = start_x + (rx1 * cos_a - ly1 * sin_a);
                                 float fy1 = start_y + (rx1 * sin_a + ly1 * cos_a);
 
-                                if (term->vector_count < term->vector_capacity) {
-                                    GPUVectorLine* line = &term->vector_staging_buffer[term->vector_count];
+                                GPUVectorLine* line = KTerm_AllocVector(term);
+                                if (line) {
                                     line->x0 = fx0 / ((float)REGIS_WIDTH);
                                     line->y0 = 1.0f - (fy0 / ((float)REGIS_HEIGHT));
                                     line->x1 = fx1 / ((float)REGIS_WIDTH);
@@ -10797,7 +14782,6 @@ static void ProcessReGISChar(KTerm* term, KTermSession* session, unsigned char c
                                     line->color = term->regis.color;
                                     line->intensity = 1.0f;
                                     line->mode = term->regis.write_mode;
-                                    term->vector_count++;
                                  }
                                 c_bit += len - 1;
                             }
@@ -11039,7 +15023,7 @@ static void ProcessTektronixChar(KTerm* term, KTermSession* session, unsigned ch
         return;
     }
     if (ch == 0x0C) { // FF - Clear Screen
-        term->vector_count = 0;
+        KTerm_ClearVectors(term);
         term->tektronix.pen_down = false;
         term->tektronix.extra_byte = -1;
         return;
@@ -11118,9 +15102,8 @@ static void ProcessTektronixChar(KTerm* term, KTermSession* session, unsigned ch
 
         // DRAW
         if (term->tektronix.pen_down) {
-            if (term->vector_count < term->vector_capacity) {
-                GPUVectorLine* line = &term->vector_staging_buffer[term->vector_count];
-
+            GPUVectorLine* line = KTerm_AllocVector(term);
+            if (line) {
                 // 12-bit Coordinate Normalization (0-4095 -> 0.0-1.0)
                 float norm_x1 = (float)term->tektronix.x / 4096.0f;
                 float norm_y1 = (float)term->tektronix.y / 4096.0f;
@@ -11138,8 +15121,6 @@ static void ProcessTektronixChar(KTerm* term, KTermSession* session, unsigned ch
                 line->color = 0xFF00FF00; // Bright Green
                 line->intensity = 1.0f;
                 line->mode = 0; // Additive
-
-                term->vector_count++;
             }
         }
 
@@ -11166,15 +15147,14 @@ static void KTerm_PrepareKittyUpload(KTerm* term, KTermSession* session) {
         if (!kitty->images) {
             kitty->image_capacity = 64;
             kitty->images = KTerm_Calloc(kitty->image_capacity, sizeof(KittyImageBuffer));
+            if (!kitty->images) return;
+            kitty->image_count = 0;
+            kitty->placement_count = 0;
+            KTerm_KittyRebuildIndex(kitty);
         }
 
         // Find existing image
-        for (int i = 0; i < kitty->image_count; i++) {
-            if (kitty->images[i].id == kitty->cmd.id) {
-                img = &kitty->images[i];
-                break;
-            }
-        }
+        img = KTerm_KittyFindImage(kitty, kitty->cmd.id);
 
         if (kitty->cmd.action == 'f') {
             if (!img) return; // Error: Image not found for frame load
@@ -11182,21 +15162,10 @@ static void KTerm_PrepareKittyUpload(KTerm* term, KTermSession* session) {
             // 't' or 'T' - Create new or replace
             if (img) {
                 // Free existing frames
-                if (img->frames) {
-                    for (int f = 0; f < img->frame_count; f++) {
-                        if (img->frames[f].data) {
-                            if (kitty->current_memory_usage >= img->frames[f].capacity)
-                                kitty->current_memory_usage -= img->frames[f].capacity;
-                            KTerm_Free(img->frames[f].data);
-                        }
-                        if (img->frames[f].texture.id != 0) KTerm_DestroyTexture(&img->frames[f].texture);
-                    }
-                    KTerm_Free(img->frames);
-                }
-                // Reset image
-                img->frames = NULL;
-                img->frame_count = 0;
-                img->frame_capacity = 0;
+                KTerm_KittyFreeFrames(kitty, img);
+                img->current_frame = 0;
+                img->frame_timer = 0;
+                img->anim_scheduled = false; // Pending heap entry becomes stale
             } else {
                 // New Image
                 if (kitty->image_count >= kitty->image_capacity) {
@@ -11210,6 +15179,7 @@ static void KTerm_PrepareKittyUpload(KTerm* term, KTermSession* session) {
                 img = &kitty->images[kitty->image_count++];
                 memset(img, 0, sizeof(KittyImageBuffer));
                 img->id = kitty->cmd.id;
+                KTerm_KittyIndexInsert(kitty, kitty->image_count - 1);
             }
 
             // Set properties for t/T
@@ -11233,6 +15203,18 @@ static void KTerm_PrepareKittyUpload(KTerm* term, KTermSession* session) {
             img->z_index = kitty->cmd.z_index;
             img->complete = false;
         }
+        img->last_used = ++kitty->lru_clock;
+
+        // Make room before adding the frame (eviction may compact images[], so re-resolve img)
+        size_t initial_cap = 4096;
+        uint32_t img_id = img->id;
+        if (!KTerm_KittyEvictForSpace(term, session, initial_cap, img_id)) {
+            if (session->options.debug_sequences) KTerm_LogUnsupportedSequence(term, "Kitty: Memory limit exceeded");
+            kitty->active_upload = NULL;
+            return;
+        }
+        img = KTerm_KittyFindImage(kitty, img_id);
+        if (!img) return;
 
         // Add new frame
         if (img->frame_count >= img->frame_capacity) {
@@ -11253,21 +15235,15 @@ static void KTerm_PrepareKittyUpload(KTerm* term, KTermSession* session) {
              if (frame->delay_ms < 0) frame->delay_ms = 0; // Or global? Assume local for now
         }
 
-        size_t initial_cap = 4096;
-        if (kitty->current_memory_usage + initial_cap <= KTERM_KITTY_MEMORY_LIMIT) {
-            frame->capacity = initial_cap;
-            frame->data = KTerm_Malloc(frame->capacity);
-            frame->size = 0;
-            if (frame->data) {
-                kitty->current_memory_usage += initial_cap;
-                kitty->active_upload = img;
-            } else {
-                img->frame_count--;
-                kitty->active_upload = NULL;
-            }
+        frame->capacity = initial_cap;
+        frame->data = KTerm_Malloc(frame->capacity);
+        frame->size = 0;
+        if (frame->data) {
+            kitty->current_memory_usage += initial_cap;
+            kitty->active_upload = img;
         } else {
-             if (session->options.debug_sequences) KTerm_LogUnsupportedSequence(term, "Kitty: Memory limit exceeded");
-             kitty->active_upload = NULL;
+            img->frame_count--;
+            kitty->active_upload = NULL;
         }
     }
 }
@@ -11357,7 +15333,9 @@ void KTerm_ProcessKittyChar(KTerm* term, KTermSession* session, unsigned char ch
                     if (frame->data) {
                         if (frame->size >= frame->capacity) {
                             size_t new_cap = frame->capacity * 2;
-                            if (kitty->current_memory_usage + (new_cap - frame->capacity) <= KTERM_KITTY_MEMORY_LIMIT) {
+                            // Evict older images rather than refusing the upload (frame data is heap-owned,
+                            // so 'frame' stays valid even if images[] is compacted)
+                            if (KTerm_KittyEvictForSpace(term, session, new_cap - frame->capacity, kitty->active_upload->id)) {
                                 unsigned char* new_data = KTerm_Realloc(frame->data, new_cap);
                                 if (new_data) {
                                     kitty->current_memory_usage += (new_cap - frame->capacity);
@@ -11395,22 +15373,48 @@ void KTerm_ExecuteKittyCommand(KTerm* term, KTermSession* session) {
 
     if (kitty->cmd.action == 't' || kitty->cmd.action == 'T' || kitty->cmd.action == 'p') {
         // Placement Logic (Update x, y, z for ID)
-        if (kitty->images) {
-            for(int i=0; i<kitty->image_count; i++) {
-                if (kitty->images[i].id == kitty->cmd.id) {
-                    // Found image, update placement if provided
-                    if (kitty->cmd.has_x) kitty->images[i].x = kitty->cmd.x;
-                    if (kitty->cmd.has_y) kitty->images[i].y = kitty->cmd.y;
-                    if (kitty->cmd.z_index != 0) kitty->images[i].z_index = kitty->cmd.z_index;
-
-                    // a=T or a=p makes it visible. a=t might be just upload.
-                    if (kitty->cmd.action == 'T' || kitty->cmd.action == 'p') {
-                        kitty->images[i].visible = true;
-                        // On placement, re-anchor to current screen head
-                        kitty->images[i].start_row = session->screen_head;
-                    }
-                    break;
+        KittyImageBuffer* img = KTerm_KittyFindImage(kitty, kitty->cmd.id);
+        if (img && kitty->cmd.placement_id != 0 && kitty->cmd.action != 't') {
+            // Named placement: shares the image's pixels
+            KittyPlacement* pl = KTerm_KittyFindPlacement(kitty, img->id, kitty->cmd.placement_id);
+            if (!pl) {
+                if (kitty->placement_count >= kitty->placement_capacity) {
+                    int new_cap = (kitty->placement_capacity == 0) ? 16 : kitty->placement_capacity * 2;
+                    KittyPlacement* new_pl = KTerm_Realloc(kitty->placements, new_cap * sizeof(KittyPlacement));
+                    if (!new_pl) return; // OOM
+                    kitty->placements = new_pl;
+                    kitty->placement_capacity = new_cap;
                 }
+                pl = &kitty->placements[kitty->placement_count++];
+                memset(pl, 0, sizeof(KittyPlacement));
+                pl->image_id = img->id;
+                pl->placement_id = kitty->cmd.placement_id;
+                img->placement_count++;
+            }
+
+            int char_w = DEFAULT_CHAR_WIDTH;
+            int char_h = DEFAULT_CHAR_HEIGHT;
+            if (session->soft_font.active) {
+                char_w = session->soft_font.char_width;
+                char_h = session->soft_font.char_height;
+            }
+            pl->x = kitty->cmd.has_x ? kitty->cmd.x : session->cursor.x * char_w;
+            pl->y = kitty->cmd.has_y ? kitty->cmd.y : session->cursor.y * char_h;
+            pl->z_index = kitty->cmd.z_index;
+            pl->start_row = session->screen_head;
+            img->last_used = ++kitty->lru_clock;
+        } else if (img) {
+            // Found image, update placement if provided
+            if (kitty->cmd.has_x) img->x = kitty->cmd.x;
+            if (kitty->cmd.has_y) img->y = kitty->cmd.y;
+            if (kitty->cmd.z_index != 0) img->z_index = kitty->cmd.z_index;
+
+            // a=T or a=p makes it visible. a=t might be just upload.
+            if (kitty->cmd.action == 'T' || kitty->cmd.action == 'p') {
+                img->visible = true;
+                // On placement, re-anchor to current screen head
+                img->start_row = session->screen_head;
+                img->last_used = ++kitty->lru_clock;
             }
         }
     }
@@ -11423,45 +15427,20 @@ void KTerm_ExecuteKittyCommand(KTerm* term, KTermSession* session) {
         }
     } else if (kitty->cmd.action == 'd') {
         if (kitty->cmd.delete_action == 'a') {
-             if (kitty->images) {
-                for (int i = 0; i < kitty->image_count; i++) {
-                    if (kitty->images[i].frames) {
-                        for (int f = 0; f < kitty->images[i].frame_count; f++) {
-                            if (kitty->images[i].frames[f].data) KTerm_Free(kitty->images[i].frames[f].data);
-                            if (kitty->images[i].frames[f].texture.id != 0) KTerm_DestroyTexture(&kitty->images[i].frames[f].texture);
-                        }
-                        KTerm_Free(kitty->images[i].frames);
-                    }
-                }
-                KTerm_Free(kitty->images);
-                kitty->images = NULL;
-                kitty->image_count = 0;
-                kitty->image_capacity = 0;
-                kitty->active_upload = NULL;
-                kitty->current_memory_usage = 0; // Reset usage
-            }
+            KTerm_KittyFreeAll(kitty);
             if (session->options.debug_sequences) KTerm_LogUnsupportedSequence(term, "Kitty: Deleted All Images");
         } else if (kitty->cmd.delete_action == 'i') {
-            for (int i = 0; i < kitty->image_count; i++) {
-                if (kitty->images[i].id == kitty->cmd.id) {
-                    if (kitty->images[i].frames) {
-                        for (int f = 0; f < kitty->images[i].frame_count; f++) {
-                            if (kitty->images[i].frames[f].data) {
-                                if (kitty->current_memory_usage >= kitty->images[i].frames[f].capacity) {
-                                    kitty->current_memory_usage -= kitty->images[i].frames[f].capacity;
-                                } else {
-                                    kitty->current_memory_usage = 0; // Should not happen
-                                }
-                                KTerm_Free(kitty->images[i].frames[f].data);
-                            }
-                            if (kitty->images[i].frames[f].texture.id != 0) KTerm_DestroyTexture(&kitty->images[i].frames[f].texture);
-                        }
-                        KTerm_Free(kitty->images[i].frames);
+            if (kitty->cmd.placement_id != 0) {
+                // d=i with p=: delete a single placement, keep the pixels
+                for (int p = 0; p < kitty->placement_count; p++) {
+                    if (kitty->placements[p].image_id == kitty->cmd.id && kitty->placements[p].placement_id == kitty->cmd.placement_id) {
+                        KTerm_KittyRemovePlacement(kitty, p);
+                        break;
                     }
-                    memmove(&kitty->images[i], &kitty->images[i+1], (kitty->image_count - i - 1) * sizeof(KittyImageBuffer));
-                    kitty->image_count--;
-                    break;
                 }
+            } else {
+                KittyImageBuffer* img = KTerm_KittyFindImage(kitty, kitty->cmd.id);
+                if (img) KTerm_KittyRemoveImage(kitty, (int)(img - kitty->images));
             }
              if (session->options.debug_sequences) {
                 char msg[64];
@@ -11472,6 +15451,11 @@ void KTerm_ExecuteKittyCommand(KTerm* term, KTermSession* session) {
     } else if (kitty->cmd.action == 'q') {
         if (session->options.debug_sequences) KTerm_LogUnsupportedSequence(term, "Kitty: Query received");
     }
+
+    // Any command may change placements, visibility or frames
+    kitty->render_ops_dirty = true;
+    KittyImageBuffer* anim_img = KTerm_KittyFindImage(kitty, kitty->cmd.id);
+    if (anim_img) KTerm_KittyScheduleAnimation(kitty, anim_img);
 }
 
 void KTerm_ProcessVT52Char(KTerm* term, KTermSession* session, unsigned char ch) {
@@ -11645,8 +15629,8 @@ void KTerm_ProcessSixelChar(KTerm* term, KTermSession* session, unsigned char ch
 
     // Determine Target Session
     KTermSession* target_session = session;
-    if (term->sixel_target_session >= 0 && term->sixel_target_session < MAX_SESSIONS) {
-        target_session = &term->sessions[term->sixel_target_session];
+    if (term->sixel_target_session >= 0 && term->sixel_target_session < term->session_count) {
+        target_session = term->sessions[term->sixel_target_session];
     }
 
     // 1. Check for digits across all states that consume them
@@ -11958,7 +15942,7 @@ void KTerm_ExecuteRectangularOps2(KTerm* term, KTermSession* session) {
 
     unsigned int checksum = 0;
     if (top <= bottom && left <= right) {
-        checksum = KTerm_CalculateRectChecksum(term, top, left, bottom, right);
+        checksum = KTerm_CalculateRectChecksum(session, top, left, bottom, right);
     }
 
     char response[32];
@@ -12171,7 +16155,7 @@ void KTerm_ShowInfo(KTerm* term) {
 
     KTerm_WriteString(term, "\nStatistics:\n");
     KTermStatus status = KTerm_GetStatus(term);
-    KTerm_WriteFormat(term, "- Pipeline Usage: %zu/%d\n", status.pipeline_usage, (int)sizeof(GET_SESSION(term)->input_pipeline));
+    KTerm_WriteFormat(term, "- Pipeline Usage: %zu/%d\n", status.pipeline_usage, GET_SESSION(term)->pipeline_mask + 1);
     KTerm_WriteFormat(term, "- Key Buffer: %zu\n", status.key_usage);
     KTerm_WriteFormat(term, "- Unsupported Sequences: %d\n", session->conformance.compliance.unsupported_sequences);
 
@@ -12312,6 +16296,26 @@ static const VTLevelFeatureMapping vt_level_mappings[] = {
     { VT_LEVEL_ANSI_SYS, KTERM_FEATURE_VT100_MODE, 1 },
 };
 
+// The ENQ answerback lives in the reply buffer; sessions whose buffer is not
+// allocated yet get it when KTerm_AllocResponseBuffer runs
+static void KTerm_SetLevelAnswerback(KTermSession* session) {
+    if (!session->answerback_buffer) return;
+    VTLevel level = session->conformance.level;
+    const char* answerback;
+    if (level == VT_LEVEL_ANSI_SYS) answerback = "ANSI.SYS";
+    else if (level == VT_LEVEL_XTERM) answerback = "kterm xterm";
+    else if (level >= VT_LEVEL_525) answerback = "kterm VT525";
+    else if (level >= VT_LEVEL_520) answerback = "kterm VT520";
+    else if (level >= VT_LEVEL_420) answerback = "kterm VT420";
+    else if (level >= VT_LEVEL_340) answerback = "kterm VT340";
+    else if (level >= VT_LEVEL_320) answerback = "kterm VT320";
+    else if (level >= VT_LEVEL_220) answerback = "kterm VT220";
+    else if (level >= VT_LEVEL_102) answerback = "kterm VT102";
+    else if (level >= VT_LEVEL_100) answerback = "kterm VT100";
+    else answerback = "kterm VT52";
+    snprintf(session->answerback_buffer, session->response_capacity, "%s", answerback);
+}
+
 void KTerm_SetLevel(KTerm* term, KTermSession* session, VTLevel level) {
     if (!session) session = GET_SESSION(term);
     bool level_found = false;
@@ -12333,34 +16337,14 @@ void KTerm_SetLevel(KTerm* term, KTermSession* session, VTLevel level) {
     session->conformance.level = level;
 
     // Update Answerback string based on level
+    KTerm_SetLevelAnswerback(session);
     if (level == VT_LEVEL_ANSI_SYS) {
-        snprintf(session->answerback_buffer, MAX_COMMAND_BUFFER, "ANSI.SYS");
         // Force IBM Font
         KTerm_SetFont(term, "IBM");
         // Enforce authentic CGA palette (using the standard definitions)
         for (int i = 0; i < 16; i++) {
             term->color_palette[i] = (RGB_KTermColor){ cga_colors[i].r, cga_colors[i].g, cga_colors[i].b, 255 };
         }
-    } else if (level == VT_LEVEL_XTERM) {
-        snprintf(session->answerback_buffer, MAX_COMMAND_BUFFER, "kterm xterm");
-    } else if (level >= VT_LEVEL_525) {
-        snprintf(session->answerback_buffer, MAX_COMMAND_BUFFER, "kterm VT525");
-    } else if (level >= VT_LEVEL_520) {
-        snprintf(session->answerback_buffer, MAX_COMMAND_BUFFER, "kterm VT520");
-    } else if (level >= VT_LEVEL_420) {
-        snprintf(session->answerback_buffer, MAX_COMMAND_BUFFER, "kterm VT420");
-    } else if (level >= VT_LEVEL_340) {
-        snprintf(session->answerback_buffer, MAX_COMMAND_BUFFER, "kterm VT340");
-    } else if (level >= VT_LEVEL_320) {
-        snprintf(session->answerback_buffer, MAX_COMMAND_BUFFER, "kterm VT320");
-    } else if (level >= VT_LEVEL_220) {
-        snprintf(session->answerback_buffer, MAX_COMMAND_BUFFER, "kterm VT220");
-    } else if (level >= VT_LEVEL_102) {
-        snprintf(session->answerback_buffer, MAX_COMMAND_BUFFER, "kterm VT102");
-    } else if (level >= VT_LEVEL_100) {
-        snprintf(session->answerback_buffer, MAX_COMMAND_BUFFER, "kterm VT100");
-    } else {
-        snprintf(session->answerback_buffer, MAX_COMMAND_BUFFER, "kterm VT52");
     }
 
     // Update Device Attribute strings based on the level.
@@ -12480,7 +16464,7 @@ void KTerm_EnableDebug(KTerm* term, bool enable) {
  * - **Handling Input Devices**: Updates keyboard (`KTerm_UpdateKeyboard(term)`) and mouse (`KTerm_UpdateMouse(term)`) states.
  * - **Auto-Printing**: Queues lines for printing when `GET_SESSION(term)->auto_print_enabled` and a newline occurs.
  * - **Managing Timers**: Updates cursor blink, text blink, and visual bell timers for visual effects.
- * - **Flushing Responses**: Sends queued responses (e.g., DSR, DA, focus events) via `term->response_callback`.
+ * - **Flushing Responses**: Sends queued responses (e.g., DSR, DA, focus events) via `term->response_callback`, or as one vectored call per session to the sink set with `KTerm_SetSessionSink`.
  * - **Rendering**: Draws the terminal display with `KTerm_Draw(term)`, including the custom mouse cursor.
  *
  * Performance is tuned via `GET_SESSION(term)->VTperformance` (e.g., `chars_per_frame`, `time_budget`) to balance responsiveness and throughput.
@@ -12495,17 +16479,43 @@ void KTerm_Update(KTerm* term) {
     term->pending_session_switch = -1; // Reset pending switch
     int saved_session = term->active_session;
 
-    // Process all sessions
-    for (int i = 0; i < MAX_SESSIONS; i++) {
-        KTermSession* session = &term->sessions[i];
+    KTERM_TRACE_BEGIN(term, trace_update);
+    if (KTerm_IsRecording(term)) KTerm_RecordFrame(term);
+
+    if (KTERM_STATS_ENABLED(term)) {
+        // A frame runs from one update to the next, including the draw in between
+        term->stats_frame.bytes_uploaded = (uint64_t)atomic_exchange_explicit(&term->stats_frame_uploaded, 0, memory_order_relaxed);
+        term->stats_frame.draw_ns = (uint64_t)atomic_exchange_explicit(&term->stats_frame_draw_ns, 0, memory_order_relaxed);
+        if (term->stats.frames > 0) term->stats.last_frame = term->stats_frame;
+        memset(&term->stats_frame, 0, sizeof(term->stats_frame));
+        term->stats.frames++;
+    }
+
+    // Visit the sessions left with work, the ones fed since the last frame and the visible ones
+    KTerm_ListWokenSessions(term);
+    KTerm_ListVisibleSessions(term);
+    for (int k = 0; k < term->update_count; k++) {
+        int i = term->update_list[k];
+        KTermSession* session = term->sessions[i];
+        term->output_session = i;
 
         KTERM_MUTEX_LOCK(session->lock); // Lock Session (Phase 3)
 
+        if (session->fast_forward || session->fast_forwarding) KTerm_UpdateFastForward(term, session);
+
         // Process input from the pipeline
         KTerm_ProcessEventsInternal(term, session);
 
         // Flush queued operations to the grid
-        KTerm_FlushOps(term, session);
+        if (KTERM_STATS_ENABLED(term)) {
+            uint64_t flush_start = KTerm_StatsNow();
+            KTerm_FlushOps(term, session);
+            uint64_t elapsed = KTerm_StatsNow() - flush_start;
+            KTerm_StatsRecord(&session->stats.flush, elapsed);
+            term->stats_frame.flush_ns += elapsed;
+        } else {
+            KTerm_FlushOps(term, session);
+        }
 
         KTERM_MUTEX_UNLOCK(session->lock); // Unlock Session (Phase 3)
 
@@ -12526,32 +16536,22 @@ void KTerm_Update(KTerm* term) {
             if (session->visual_bell_timer < 0) session->visual_bell_timer = 0;
         }
 
-        // Animation Logic
-        if (session->kitty.images) {
-            float dt = KTerm_GetFrameTime();
-            for (int k=0; k<session->kitty.image_count; k++) {
-                KittyImageBuffer* img = &session->kitty.images[k];
-                if (img->frame_count > 1 && img->visible && img->complete) {
-                    img->frame_timer += (dt * 1000.0);
-                    int delay = img->frames[img->current_frame].delay_ms;
-                    if (delay <= 0) delay = 40; // Default min delay
-
-                    while (img->frame_timer >= delay) {
-                        img->frame_timer -= delay;
-                        img->current_frame = (img->current_frame + 1) % img->frame_count;
-                        delay = img->frames[img->current_frame].delay_ms;
-                        if (delay <= 0) delay = 40;
-                    }
-                }
-            }
+        // Animation Logic (only images with a due deadline are touched; paused while fast-forwarding)
+        if (session->kitty.anim_count > 0 && !session->fast_forwarding) {
+            KTerm_KittyTickAnimations(&session->kitty, KTerm_GetFrameTime() * 1000.0);
         }
 
         // Flush responses
         if (session->response_length > 0 && term->response_callback) {
             term->response_callback(term, session->answerback_buffer, session->response_length);
+            session->output_status.deliveries++;
+            session->output_status.bytes_delivered += session->response_length;
+            session->output_status.backpressure = false;
+            session->output_drop_reported = false;
             session->response_length = 0;
         }
     }
+    term->output_session = -1;
 
     // Restore active session for input handling, unless a switch occurred
     if (term->pending_session_switch != -1) {
@@ -12571,7 +16571,7 @@ void KTerm_Update(KTerm* term) {
 
             // 1. Send Sequence to Host
             if (event->sequence[0] != '\0') {
-                KTerm_QueueResponse(term, event->sequence);
+                KTerm_QueueMouseReport(term, event->sequence, KTerm_IsMouseMotionReport(event->sequence));
 
                 // 2. Local Echo
                 if ((session->dec_modes & KTERM_MODE_LOCALECHO) || (session->dec_modes & KTERM_MODE_DECHDPXM)) {
@@ -12584,7 +16584,7 @@ void KTerm_Update(KTerm* term) {
                 }
             }
 
-            current_tail = (current_tail + 1) % KEY_EVENT_BUFFER_SIZE;
+            current_tail = (current_tail + 1) & session->input.buffer_mask;
             atomic_store_explicit(&session->input.buffer_tail, current_tail, memory_order_release);
 
             // Refresh head snapshot
@@ -12612,8 +16612,30 @@ void KTerm_Update(KTerm* term) {
         GET_SESSION(term)->last_cursor_y = GET_SESSION(term)->cursor.y;
     }
 
+    // Motion held back this frame goes out behind everything queued before it
+    for (int k = 0; k < term->update_count; k++) KTerm_FlushMouseMotion(term, term->update_list[k]);
+
+    // One vectored delivery per session for everything queued this frame
+    if (term->session_sink) {
+        for (int k = 0; k < term->update_count; k++) KTerm_DeliverSessionOutput(term, term->update_list[k]);
+    }
+    KTerm_PruneUpdateList(term);
+
+    // Glyphs finished by the background rasterizer
+    KTerm_CommitRasterizedGlyphs(term);
+
     // Phase 4: Prepare Render Buffer and Swap
-    KTerm_PrepareRenderBuffer(term);
+    KTERM_TRACE_BEGIN(term, trace_prepare);
+    if (KTERM_STATS_ENABLED(term)) {
+        uint64_t prepare_start = KTerm_StatsNow();
+        KTerm_PrepareRenderBuffer(term);
+        uint64_t elapsed = KTerm_StatsNow() - prepare_start;
+        KTerm_StatsRecord(&term->stats.prepare, elapsed);
+        term->stats_frame.prepare_ns += elapsed;
+    } else {
+        KTerm_PrepareRenderBuffer(term);
+    }
+    KTERM_TRACE_END(term, trace_prepare, "PrepareRenderBuffer");
 
     KTERM_MUTEX_LOCK(term->render_lock);
     int temp = term->rb_front;
@@ -12621,6 +16643,11 @@ void KTerm_Update(KTerm* term) {
     term->rb_back = temp;
     KTERM_MUTEX_UNLOCK(term->render_lock);
 
+    KTERM_TRACE_END(term, trace_update, "KTerm_Update");
+#ifdef KTERM_ENABLE_TRACE
+    KTerm_TraceFlush(term);
+#endif
+
     // KTerm_Draw(term); // Decoupled: Rendering must be called explicitly (on render thread or main thread)
 }
 
@@ -12676,141 +16703,135 @@ void KTerm_Update(KTerm* term) {
 // BiDi Types
 #define BIDI_L  0 // Left-to-Right
 #define BIDI_R  1 // Right-to-Left
-#define BIDI_N  2 // Neutral (Numbers, Punctuation) - Simplified
-
-// Helper: Check if character is RTL (Hebrew/Arabic ranges)
-static bool IsRTL(uint32_t ch) {
-    // Hebrew: 0590-05FF
-    if (ch >= 0x0590 && ch <= 0x05FF) return true;
-    // Arabic: 0600-06FF
-    if (ch >= 0x0600 && ch <= 0x06FF) return true;
-    // Arabic Supplement: 0750-077F
-    if (ch >= 0x0750 && ch <= 0x077F) return true;
-    // Arabic Extended-A: 08A0-08FF
-    if (ch >= 0x08A0 && ch <= 0x08FF) return true;
-    // FB50-FDFF: Arabic Presentation Forms-A
-    if (ch >= 0xFB50 && ch <= 0xFDFF) return true;
-    // FE70-FEFF: Arabic Presentation Forms-B
-    if (ch >= 0xFE70 && ch <= 0xFEFF) return true;
-
-    return false;
-}
+#define BIDI_N  2 // Neutral (Numbers, Punctuation) - Simplified
 
 // Helper: Get Simplified BiDi Type
-static int GetBiDiType(uint32_t ch) {
-    if (IsRTL(ch)) return BIDI_R;
-
-    // Digits (0-9) are treated as LTR to prevent reversal (e.g. 123 -> 321)
-    if (ch >= '0' && ch <= '9') return BIDI_L;
-
-    // Weak/Neutral characters (Simplified)
-    // Spaces, Punctuation
-    if (ch < 0x41) return BIDI_N; // Space, Punctuation
-    if ((ch >= 0x5B && ch <= 0x60) || (ch >= 0x7B && ch <= 0x7E)) return BIDI_N; // brackets, etc.
-
-    // Default to Left-to-Right (Latin, Cyrillic, etc.)
-    return BIDI_L;
+// Hebrew/Arabic blocks are R; digits stay L to prevent reversal (123 -> 321);
+// space, ASCII punctuation and brackets are N; everything else is L.
+static inline int GetBiDiType(uint32_t ch) {
+    return KT_UPROPS_BIDI(KTerm_CodepointProps(ch));
 }
 
 // Helper: Mirror characters (Parentheses, Brackets)
-static uint32_t GetMirroredChar(uint32_t ch) {
-    switch (ch) {
-        case '(': return ')';
-        case ')': return '(';
-        case '[': return ']';
-        case ']': return '[';
-        case '{': return '}';
-        case '}': return '{';
-        case '<': return '>';
-        case '>': return '<';
-        default: return ch;
-    }
-}
-
-// Helper: Reverse a run of characters in place
-static void ReverseRun(EnhancedTermChar* row, int start, int end) {
-    while (start < end) {
-        EnhancedTermChar temp = row[start];
-        row[start] = row[end];
-        row[end] = temp;
-
-        // Apply mirroring when reversing
-        row[start].ch = GetMirroredChar(row[start].ch);
-        row[end].ch = GetMirroredChar(row[end].ch);
-
-        start++;
-        end--;
-    }
-    // Handle middle char if any
-    if (start == end) {
-        row[start].ch = GetMirroredChar(row[start].ch);
-    }
+static inline uint32_t GetMirroredChar(uint32_t ch) {
+    return KT_UPROPS_MIRROR(KTerm_CodepointProps(ch), ch);
 }
 
 // Main Reordering Algorithm (Visual Reordering)
 // Note: This internal implementation is used because fribidi is unavailable.
-static void BiDiReorderRow(KTermSession* session, EnhancedTermChar* row, int width) {
-    // Only reorder if BDSM is enabled
-    if (!(session->dec_modes & KTERM_MODE_BDSM)) return;
-
+// Fills map[visual] = logical column, flagging characters that are mirrored in
+// reversed runs. Combining marks stay after their base. Returns false (map
+// untouched) when the row has no RTL text.
+static bool BiDiBuildVisualMap(const EnhancedTermChar* row, int width, uint16_t* map) {
     // Allocate types array (dynamic if large, preventing stack overflow)
     int stack_types[512];
     int* types = stack_types;
     if (width > 512) {
         types = (int*)KTerm_Malloc(width * sizeof(int));
-        if (!types) return; // Allocation failed
+        if (!types) return false; // Allocation failed
     }
-    int effective_width = width;
 
     // 1. Determine base direction (Assume LTR for now)
-    // First pass: Classify
-    for (int i = 0; i < effective_width; i++) {
-        types[i] = GetBiDiType(row[i].ch);
+    // First pass: Classify. Marks take the type of their base.
+    bool has_rtl = false;
+    for (int i = 0; i < width; i++) {
+        if (i > 0 && (row[i].flags & KTERM_FLAG_COMBINING)) {
+            types[i] = types[i - 1];
+        } else {
+            types[i] = GetBiDiType(row[i].ch);
+        }
+        if (types[i] == BIDI_R) has_rtl = true;
+    }
+    if (!has_rtl) {
+        if (types != stack_types) KTerm_Free(types);
+        return false;
     }
 
-    // Second pass: Resolve Neutrals
+    // Second pass: Resolve Neutrals. A neutral run between two strong types of
+    // the same direction takes that direction, otherwise the base (L).
     int last_strong = BIDI_L; // Base direction
-    for (int i = 0; i < effective_width; i++) {
+    for (int i = 0; i < width; ) {
         if (types[i] != BIDI_N) {
-            last_strong = types[i];
-        } else {
-            // Look ahead for next strong
-            int next_strong = BIDI_L; // Default to base if end of line
-            for (int j = i + 1; j < effective_width; j++) {
-                if (types[j] != BIDI_N) {
-                    next_strong = types[j];
-                    break;
-                }
-            }
-
-            // Resolve neutral
-            if (last_strong == next_strong) {
-                types[i] = last_strong;
-            } else {
-                types[i] = BIDI_L; // Base direction (L)
+            last_strong = types[i++];
+            continue;
+        }
+        int j = i;
+        while (j < width && types[j] == BIDI_N) j++;
+        int next_strong = (j < width) ? types[j] : BIDI_L; // Default to base if end of line
+        int resolved = (last_strong == next_strong) ? last_strong : BIDI_L;
+        for (; i < j; i++) types[i] = resolved;
+    }
+
+    // Third pass: Identity map, then reverse R runs cluster by cluster
+    for (int i = 0; i < width; i++) map[i] = (uint16_t)i;
+    for (int i = 0; i < width; ) {
+        if (types[i] != BIDI_R) { i++; continue; }
+        int run_start = i;
+        while (i < width && types[i] == BIDI_R) i++;
+        int out = run_start;
+        int cluster_end = i - 1;
+        while (cluster_end >= run_start) {
+            int cluster_start = cluster_end;
+            while (cluster_start > run_start && (row[cluster_start].flags & KTERM_FLAG_COMBINING)) cluster_start--;
+            for (int k = cluster_start; k <= cluster_end; k++) {
+                uint16_t entry = (uint16_t)k;
+                if (k == cluster_start && GetMirroredChar(row[k].ch) != row[k].ch) entry |= KTERM_BIDI_MIRROR;
+                map[out++] = entry;
             }
+            cluster_end = cluster_start - 1;
         }
     }
 
-    // Third pass: Identify and Reverse R runs
-    int run_start = -1;
-    for (int i = 0; i < effective_width; i++) {
-        if (types[i] == BIDI_R) {
-            if (run_start == -1) run_start = i;
-        } else {
-            if (run_start != -1) {
-                ReverseRun(row, run_start, i - 1);
-                run_start = -1;
-            }
+    if (types != stack_types) {
+        KTerm_Free(types);
+    }
+    return true;
+}
+
+static void KTerm_FreeBiDiCache(KTermSession* session) {
+    if (session->bidi_map) KTerm_Free(session->bidi_map);
+    if (session->bidi_row_state) KTerm_Free(session->bidi_row_state);
+    if (session->bidi_scratch) KTerm_Free(session->bidi_scratch);
+    session->bidi_map = NULL;
+    session->bidi_row_state = NULL;
+    session->bidi_scratch = NULL;
+    session->bidi_rows = 0;
+    session->bidi_cols = 0;
+}
+
+// Returns the row in visual order for BDSM rendering. The map is rebuilt only
+// when the row was dirtied since it was last drawn (row_dirty is back at
+// KTERM_DIRTY_FRAMES); the remaining dirty frames and clean rows reuse it.
+// Returns the logical row when it has no RTL text or the cache is unavailable.
+static EnhancedTermChar* KTerm_BiDiVisualRow(KTermSession* session, int y, EnhancedTermChar* row) {
+    int cols = session->cols;
+    if (session->bidi_rows != session->rows || session->bidi_cols != cols) {
+        KTerm_FreeBiDiCache(session);
+        session->bidi_map = (uint16_t*)KTerm_Malloc((size_t)session->rows * cols * sizeof(uint16_t));
+        session->bidi_row_state = (uint8_t*)KTerm_Calloc(session->rows, sizeof(uint8_t)); // All STALE
+        session->bidi_scratch = (EnhancedTermChar*)KTerm_Malloc((size_t)cols * sizeof(EnhancedTermChar));
+        if (!session->bidi_map || !session->bidi_row_state || !session->bidi_scratch) {
+            KTerm_FreeBiDiCache(session);
+            return row;
         }
+        session->bidi_rows = session->rows;
+        session->bidi_cols = cols;
     }
-    if (run_start != -1) {
-        ReverseRun(row, run_start, effective_width - 1);
+
+    uint16_t* map = &session->bidi_map[(size_t)y * cols];
+    uint8_t* state = &session->bidi_row_state[y];
+    if (*state == KTERM_BIDI_ROW_STALE || session->row_dirty[y] >= KTERM_DIRTY_FRAMES) {
+        *state = BiDiBuildVisualMap(row, cols, map) ? KTERM_BIDI_ROW_MAPPED : KTERM_BIDI_ROW_LTR;
+        session->bidi_map_builds++;
     }
+    if (*state != KTERM_BIDI_ROW_MAPPED) return row;
 
-    if (types != stack_types) {
-        KTerm_Free(types);
+    EnhancedTermChar* visual = session->bidi_scratch;
+    for (int x = 0; x < cols; x++) {
+        visual[x] = row[map[x] & ~KTERM_BIDI_MIRROR];
+        if (map[x] & KTERM_BIDI_MIRROR) visual[x].ch = GetMirroredChar(visual[x].ch);
     }
+    return visual;
 }
 
 // JIT Run Builder
@@ -12847,10 +16868,23 @@ static KTermTextRun KTerm_BuildRun(EnhancedTermChar* row, int start_idx, int max
 // Updated Helper: Update a specific row segment for a pane
 static void KTerm_UpdatePaneRow(KTerm* term, KTermSession* source_session, KTermRenderBuffer* rb, int global_x, int global_y, int width, int source_y, int source_x) {
     if (source_y >= source_session->rows || source_y < 0) return;
+    if (KTERM_STATS_ENABLED(term)) {
+        term->stats.rows_converted++;
+        term->stats_frame.rows_converted++;
+    }
 
     EnhancedTermChar* src_row_ptr = GetScreenRow(source_session, source_y);
     int cols = source_session->cols;
 
+    // BiDi: draw the cached visual order. Reordering moves cells across the
+    // row, so the whole row is redrawn regardless of the dirty rectangle.
+    if (source_session->dec_modes & KTERM_MODE_BDSM) {
+        src_row_ptr = KTerm_BiDiVisualRow(source_session, source_y, src_row_ptr);
+        global_x -= source_x;
+        width = cols;
+        source_x = 0;
+    }
+
     // JIT Rendering Loop
     // Iterate through Visual columns (x) but advance Source index (idx) based on Runs.
 
@@ -12880,6 +16914,13 @@ static void KTerm_UpdatePaneRow(KTerm* term, KTermSession* source_session, KTerm
         // We should update `global_x` and `width`.
     }
 
+    // Likewise back up onto a wide character whose right half starts the range
+    if (current_source_idx > 0 && source_session->enable_wide_chars &&
+        src_row_ptr[current_source_idx].ch == ' ' &&
+        KTerm_wcwidth(src_row_ptr[current_source_idx - 1].ch) == 2) {
+        current_source_idx--;
+    }
+
     // Offset calculation
     int backtrack_dist = source_x - current_source_idx;
     // We adjust the drawing window
@@ -12896,20 +16937,30 @@ static void KTerm_UpdatePaneRow(KTerm* term, KTermSession* source_session, KTerm
         // For Phase 1: Flatten back to single GPUCell if possible, or use base char.
         // We want to support combining chars.
 
-        // TODO: Map run.codepoints to a single glyph ID (Composite)
-        // For now, mapping base char.
+        // Single codepoints map straight to a glyph; base + combining marks map to
+        // one composed glyph from the cluster cache.
+        // Without wide chars a wide codepoint takes one cell: only its 1-cell glyph is drawn
+        if (!source_session->enable_wide_chars && KTerm_GlyphKeyCells(run.codepoints[0]) == 2) {
+            run.codepoints[0] += KTERM_GLYPH_NARROW;
+        }
+
         uint32_t char_code;
         if (run.codepoint_count == 1 && run.codepoints[0] < 256) {
             char_code = run.codepoints[0];
+        } else if (run.codepoint_count == 1) {
+            char_code = KTerm_AllocateGlyphKey(term, run.codepoints[0]);
         } else {
-            // AllocateGlyph can handle single char.
-            // For combining, we need a new AllocateCombinedGlyph(term, codepoints, count).
-            // For "Start Small", let's just use the first char (Base) to verify structure,
-            // or modify AllocateGlyph to take a run?
-            // Existing AllocateGlyph takes single uint32.
-            // We can compose them into a "fake" codepoint or just use base.
-            // If we use base, we verify that the combining char is *hidden* (consumed).
-            char_code = KTerm_AllocateGlyph(term, run.codepoints[0]);
+            char_code = KTerm_AllocateCluster(term, run.codepoints, run.codepoint_count);
+        }
+        int glyph_cells = KTerm_GlyphCells(term, char_code);
+
+        // A wide character is stored as its base cell plus a blank filler cell;
+        // the 2-cell glyph covers both.
+        if (glyph_cells == 2 && run.visual_width == 1 && current_source_idx + run.length < cols &&
+            src_row_ptr[current_source_idx + run.length].ch == ' ' &&
+            !(src_row_ptr[current_source_idx + run.length].flags & KTERM_FLAG_COMBINING)) {
+            run.visual_width = 2;
+            run.length++;
         }
 
         // Apply to Visual Cells
@@ -12926,8 +16977,9 @@ static void KTerm_UpdatePaneRow(KTerm* term, KTermSession* source_session, KTerm
                         GPUCell* gpu_cell = &rb->cells[offset];
                         EnhancedTermChar* cell = &src_row_ptr[current_source_idx]; // Use Base attributes
 
-                        gpu_cell->char_code = (v == 0) ? char_code : 0; // Only first cell gets glyph? Or padding?
-                        // For double width, typically left cell has glyph, right is empty/padding.
+                        // A 2-cell glyph draws its right half from the next slot;
+                        // other wide cells leave the right cell empty.
+                        gpu_cell->char_code = (v < glyph_cells) ? char_code + v : 0;
 
                         // Copy Attributes (Colors)
                         // ... (Same color logic as before) ...
@@ -13069,8 +17121,8 @@ static bool RecursiveUpdateSSBO(KTerm* term, KTermPane* pane, KTermRenderBuffer*
     bool any_update = false;
 
     if (pane->type == PANE_LEAF) {
-        if (pane->session_index >= 0 && pane->session_index < MAX_SESSIONS) {
-            KTermSession* session = &term->sessions[pane->session_index];
+        if (pane->session_index >= 0 && pane->session_index < term->session_count) {
+            KTermSession* session = term->sessions[pane->session_index];
             if (session->session_open) {
                 // Iterate over visible rows of the pane
                 for (int y = 0; y < pane->height; y++) {
@@ -13109,9 +17161,160 @@ static bool RecursiveUpdateSSBO(KTerm* term, KTermPane* pane, KTermRenderBuffer*
     return any_update;
 }
 
+static int KTerm_CompareAtlasSlot(const void* a, const void* b) {
+    uint32_t sa = *(const uint32_t*)a;
+    uint32_t sb = *(const uint32_t*)b;
+    return (sa > sb) - (sa < sb);
+}
+
+// Upload pending glyph slots as sub-rectangles. Slots are sorted so neighbours
+// on the same atlas row merge into a single strip. Without region updates the
+// whole texture is updated once instead.
+static void KTerm_FlushAtlasUploads(KTerm* term) {
+    if (term->atlas_dirty_count == 0) return;
+    term->atlas_generation++;
+    if (term->font_texture.id == 0 || !term->font_atlas_pixels) {
+        term->font_atlas_dirty = true; // No texture to patch yet
+        term->atlas_dirty_count = 0;
+        return;
+    }
+
+    KTermImage img = {0};
+    img.width = term->atlas_width;
+    img.height = term->atlas_height;
+    img.channels = 4;
+    img.data = term->font_atlas_pixels;
+
+    KTERM_TRACE_BEGIN(term, trace_atlas);
+#ifdef KTERM_HAS_TEXTURE_REGION_UPDATE
+    int count = term->atlas_dirty_count;
+    uint32_t* slots = term->atlas_dirty_slots;
+    qsort(slots, count, sizeof(uint32_t), KTerm_CompareAtlasSlot);
+
+    int i = 0;
+    while (i < count) {
+        uint32_t first = slots[i];
+        uint32_t last = first;
+        uint32_t row = first / term->atlas_cols;
+        while (i + 1 < count && (slots[i + 1] == last || (slots[i + 1] == last + 1 && slots[i + 1] / term->atlas_cols == row))) {
+            last = slots[++i];
+        }
+        int col = (int)(first % term->atlas_cols);
+        KTerm_UpdateTextureRegion(term->font_texture, img,
+                                  col * DEFAULT_CHAR_WIDTH, (int)row * DEFAULT_CHAR_HEIGHT,
+                                  (int)(last - first + 1) * DEFAULT_CHAR_WIDTH, DEFAULT_CHAR_HEIGHT);
+        KTerm_StatsCountUpload(term, (size_t)(last - first + 1) * DEFAULT_CHAR_WIDTH * DEFAULT_CHAR_HEIGHT * 4);
+        i++;
+    }
+#else
+    KTerm_UpdateTexture(term->font_texture, img);
+    KTerm_StatsCountUpload(term, (size_t)term->atlas_width * term->atlas_height * 4);
+#endif
+    term->atlas_dirty_count = 0;
+    KTERM_TRACE_END(term, trace_atlas, "AtlasUpload");
+}
+
+// Returns the leaf pane showing a session (NULL if hidden), from the layout's session map
+static KTermPane* KTerm_GetSessionPane(KTerm* term, int session_index) {
+    if (!term->layout || !term->layout->root) return NULL;
+    return KTermLayout_FindSessionPane(term->layout, session_index);
+}
+
+// Append one blit op for a Kitty image placement (implicit or p=) to the session's op cache.
+// Returns false if a drawable placement was left out (texture or op allocation failed).
+static bool KTerm_EmitKittyRenderOp(KTerm* term, KTermSession* session, KTermPane* pane,
+                                    KittyImageBuffer* img, int x, int y, int z_index, int start_row) {
+    KittyGraphics* kitty = &session->kitty;
+    if (!img->frames || img->frame_count == 0 || !img->complete) return true; // Completion marks the cache dirty
+
+    if (img->current_frame >= img->frame_count) img->current_frame = 0;
+    KittyFrame* frame = &img->frames[img->current_frame];
+
+    // Lazy Texture Creation (Logic Thread)
+    if (frame->texture.id == 0 && frame->data) {
+        KTERM_TRACE_BEGIN(term, trace_kitty);
+        KTermImage kimg = {0};
+        kimg.width = frame->width;
+        kimg.height = frame->height;
+        kimg.channels = 4;
+        kimg.data = frame->data;
+        KTerm_CreateTextureEx(kimg, false, KTERM_TEXTURE_USAGE_SAMPLED, &frame->texture);
+        KTERM_TRACE_END(term, trace_kitty, "KittyUpload");
+    }
+
+    if (frame->texture.id == 0) return false;
+
+    // Ensure capacity
+    if (kitty->render_op_count >= kitty->render_op_capacity) {
+        int new_cap = (kitty->render_op_capacity == 0) ? 16 : kitty->render_op_capacity * 2;
+        KittyRenderOp* ops = (KittyRenderOp*)KTerm_Realloc(kitty->render_ops, new_cap * sizeof(KittyRenderOp));
+        if (!ops) return false;
+        kitty->render_ops = ops;
+        kitty->render_op_capacity = new_cap;
+    }
+
+    KittyRenderOp* op = &kitty->render_ops[kitty->render_op_count++];
+    op->texture = frame->texture;
+    op->pixels = frame->data;
+    op->width = frame->width;
+    op->height = frame->height;
+    op->z_index = z_index;
+
+    int dist = (session->screen_head - start_row + session->buffer_height) % session->buffer_height;
+    int y_shift = (dist * term->char_height) - (session->view_offset * term->char_height);
+
+    op->x = (pane->x * term->char_width) + x;
+    op->y = (pane->y * term->char_height) + y - y_shift;
+
+    op->clip_x = pane->x * term->char_width;
+    op->clip_y = pane->y * term->char_height;
+    op->clip_mx = op->clip_x + pane->width * term->char_width - 1;
+    op->clip_my = op->clip_y + pane->height * term->char_height - 1;
+    return true;
+}
+
+// Rebuild a session's Kitty op cache if placements/frames changed or the pane, scroll
+// position or cell size moved since the last build. Otherwise the cached ops are reused.
+static void KTerm_UpdateKittyRenderOps(KTerm* term, KTermSession* session, KTermPane* pane) {
+    KittyGraphics* kitty = &session->kitty;
+    unsigned int generation = term->layout ? term->layout->generation : 0;
+
+    if (!kitty->render_ops_dirty &&
+        kitty->render_screen_head == session->screen_head &&
+        kitty->render_view_offset == session->view_offset &&
+        kitty->render_char_width == term->char_width &&
+        kitty->render_char_height == term->char_height &&
+        kitty->render_layout_generation == generation) {
+        return;
+    }
+
+    kitty->render_op_count = 0;
+    bool complete = true;
+    for (int k = 0; k < kitty->image_count; k++) {
+        KittyImageBuffer* img = &kitty->images[k];
+        if (!img->visible) continue;
+        complete &= KTerm_EmitKittyRenderOp(term, session, pane, img, img->x, img->y, img->z_index, img->start_row);
+    }
+    for (int p = 0; p < kitty->placement_count; p++) {
+        KittyPlacement* pl = &kitty->placements[p];
+        KittyImageBuffer* img = KTerm_KittyFindImage(kitty, pl->image_id);
+        if (!img) continue;
+        complete &= KTerm_EmitKittyRenderOp(term, session, pane, img, pl->x, pl->y, pl->z_index, pl->start_row);
+    }
+
+    // A left-out op is retried next frame
+    kitty->render_ops_dirty = !complete;
+    kitty->render_screen_head = session->screen_head;
+    kitty->render_view_offset = session->view_offset;
+    kitty->render_char_width = term->char_width;
+    kitty->render_char_height = term->char_height;
+    kitty->render_layout_generation = generation;
+    kitty->render_op_rebuilds++;
+}
+
 void KTerm_PrepareRenderBuffer(KTerm* term) {
     KTermSession* session = GET_SESSION(term);
-    if (!term->terminal_buffer.id) return;
+    if (!term->terminal_buffer.id && !term->software_renderers) return;
 
     KTermRenderBuffer* rb = &term->render_buffers[term->rb_back];
 
@@ -13129,6 +17332,7 @@ void KTerm_PrepareRenderBuffer(KTerm* term) {
         }
 
         if (term->font_atlas_pixels) {
+            KTERM_TRACE_BEGIN(term, trace_atlas);
             KTermImage img = {0};
             img.width = term->atlas_width;
             img.height = term->atlas_height;
@@ -13137,6 +17341,8 @@ void KTerm_PrepareRenderBuffer(KTerm* term) {
 
             KTermTexture new_texture = {0};
             KTerm_CreateTexture(img, false, &new_texture);
+            KTerm_StatsCountUpload(term, (size_t)img.width * img.height * 4);
+            KTERM_TRACE_END(term, trace_atlas, "AtlasRebuild");
 
             if (new_texture.id != 0) {
                 if (term->font_texture.generation != 0) {
@@ -13148,6 +17354,9 @@ void KTerm_PrepareRenderBuffer(KTerm* term) {
         }
         GET_SESSION(term)->soft_font.dirty = false;
         term->font_atlas_dirty = false;
+        term->atlas_dirty_count = 0; // Covered by the full upload
+        term->atlas_generation++;
+        term->atlas_full_generation++;
     }
 
     // Vector Clear Request (Logic Thread)
@@ -13204,6 +17413,9 @@ void KTerm_PrepareRenderBuffer(KTerm* term) {
         }
     }
 
+    // Upload glyphs rasterized while converting rows, so they show up this frame
+    KTerm_FlushAtlasUploads(term);
+
     // Copy Sixel Data and Update Texture
     KTermSession* sixel_session = GET_SESSION(term); // Simplified: Assume active session for sixel
     int sixel_y_shift = 0;
@@ -13263,7 +17475,8 @@ void KTerm_PrepareRenderBuffer(KTerm* term) {
         rb->sixel_active = false;
     }
 
-    // Populate Push Constants (Snapshot) - AFTER Sixel update
+    // Populate Push Constants (Snapshot) - AFTER Sixel update. render_lock also
+    // covers the vector marks read below, which renderers move under it.
     KTERM_MUTEX_LOCK(term->render_lock);
     KTermPushConstants* pc = &rb->constants;
     memset(pc, 0, sizeof(KTermPushConstants));
@@ -13293,7 +17506,7 @@ void KTerm_PrepareRenderBuffer(KTerm* term) {
     uint32_t cursor_idx = 0xFFFFFFFF;
     KTermSession* focused_session = NULL;
     if (term->layout && term->layout->focused && term->layout->focused->type == PANE_LEAF) {
-        if (term->layout->focused->session_index >= 0) focused_session = &term->sessions[term->layout->focused->session_index];
+        if (term->layout->focused->session_index >= 0) focused_session = term->sessions[term->layout->focused->session_index];
     }
     if (!focused_session) focused_session = GET_SESSION(term);
 
@@ -13337,87 +17550,55 @@ void KTerm_PrepareRenderBuffer(KTerm* term) {
         pc->conceal_char_code = focused_session->conceal_char_code;
     }
 
-    // Copy Vector Data
-    if (term->vector_count > 0) {
-        if (rb->vector_capacity < term->vector_count) {
-             rb->vector_capacity = term->vector_count + 1024;
-             rb->vectors = (GPUVectorLine*)KTerm_Realloc(rb->vectors, rb->vector_capacity * sizeof(GPUVectorLine));
-        }
-        if (rb->vectors && term->vector_staging_buffer) {
-            memcpy(rb->vectors, term->vector_staging_buffer, term->vector_count * sizeof(GPUVectorLine));
-            rb->vector_count = term->vector_count;
-            pc->vector_count = term->vector_count;
+    // Copy Vector Data: only what the layers have not rasterized yet. Vectors a
+    // skipped frame never drew are sent again, since the mark did not move.
+    size_t vector_first = KTerm_VectorSendStart(term);
+    size_t new_vectors = term->vector_count - vector_first;
+    if (new_vectors > KTERM_VECTOR_BATCH) new_vectors = KTERM_VECTOR_BATCH;
+    if (rb->vector_capacity < new_vectors) {
+        GPUVectorLine* grown = (GPUVectorLine*)KTerm_Realloc(rb->vectors, new_vectors * sizeof(GPUVectorLine));
+        if (grown) {
+            rb->vectors = grown;
+            rb->vector_capacity = new_vectors;
+        } else {
+            new_vectors = rb->vector_capacity;
         }
-    } else {
-        rb->vector_count = 0;
-        pc->vector_count = 0;
     }
+    // A batch that ends on the left edge of a fill leaves the pair for the next one
+    if (new_vectors > 0 && vector_first + new_vectors < term->vector_count &&
+        (term->vector_staging_buffer[vector_first + new_vectors - 1].mode & KTERM_VECTOR_FILL)) {
+        new_vectors--;
+    }
+    if (new_vectors > 0) memcpy(rb->vectors, term->vector_staging_buffer + vector_first, new_vectors * sizeof(GPUVectorLine));
+    rb->vector_first = vector_first;
+    rb->vector_epoch = term->vector_epoch;
+    rb->vector_count = new_vectors;
+    pc->vector_count = (uint32_t)new_vectors;
 
-    // Copy Kitty Graphics Ops
+    // Copy Kitty Graphics Ops (from per-session caches of the sessions on screen)
     rb->kitty_count = 0;
-    for (int i = 0; i < MAX_SESSIONS; i++) {
-        KTermSession* session = &term->sessions[i];
+    int leaves = KTermLayout_GetLeafCount(term->layout);
+    for (int l = 0; l < leaves; l++) {
+        KTermPane* pane = KTermLayout_GetLeaf(term->layout, l);
+        int i = pane->session_index;
+        if (i < 0 || i >= term->session_count || KTerm_GetSessionPane(term, i) != pane) continue;
+        KTermSession* session = term->sessions[i];
         if (!session->session_open || !session->kitty.images) continue;
 
-        KTermPane* pane = NULL;
-        KTermPane* stack[32];
-        int stack_top = 0;
-        if (term->layout && term->layout->root) stack[stack_top++] = term->layout->root;
-        while (stack_top > 0) {
-            KTermPane* p = stack[--stack_top];
-            if (p->type == PANE_LEAF) {
-                if (p->session_index == i) { pane = p; break; }
-            } else {
-                if (p->child_b) stack[stack_top++] = p->child_b;
-                if (p->child_a) stack[stack_top++] = p->child_a;
-            }
-        }
-        if (!pane) continue;
-
-        for (int k = 0; k < session->kitty.image_count; k++) {
-            KittyImageBuffer* img = &session->kitty.images[k];
-            if (!img->visible || !img->frames || img->frame_count == 0 || !img->complete) continue;
-
-            if (img->current_frame >= img->frame_count) img->current_frame = 0;
-            KittyFrame* frame = &img->frames[img->current_frame];
-
-            // Lazy Texture Creation (Logic Thread)
-            if (frame->texture.id == 0 && frame->data) {
-                KTermImage kimg = {0};
-                kimg.width = frame->width;
-                kimg.height = frame->height;
-                kimg.channels = 4;
-                kimg.data = frame->data;
-                KTerm_CreateTextureEx(kimg, false, KTERM_TEXTURE_USAGE_SAMPLED, &frame->texture);
-            }
-
-            if (frame->texture.id == 0) continue;
-
-            // Ensure capacity
-            if (rb->kitty_count >= rb->kitty_capacity) {
-                rb->kitty_capacity = (rb->kitty_capacity == 0) ? 64 : rb->kitty_capacity * 2;
-                rb->kitty_ops = (KittyRenderOp*)KTerm_Realloc(rb->kitty_ops, rb->kitty_capacity * sizeof(KittyRenderOp));
-            }
-
-            if (rb->kitty_ops) {
-                KittyRenderOp* op = &rb->kitty_ops[rb->kitty_count++];
-                op->texture = frame->texture;
-                op->width = frame->width;
-                op->height = frame->height;
-                op->z_index = img->z_index;
+        KTerm_UpdateKittyRenderOps(term, session, pane);
+        if (session->kitty.render_op_count == 0) continue;
 
-                int dist = (session->screen_head - img->start_row + session->buffer_height) % session->buffer_height;
-                int y_shift = (dist * term->char_height) - (session->view_offset * term->char_height);
-
-                op->x = (pane->x * term->char_width) + img->x;
-                op->y = (pane->y * term->char_height) + img->y - y_shift;
-
-                op->clip_x = pane->x * term->char_width;
-                op->clip_y = pane->y * term->char_height;
-                op->clip_mx = op->clip_x + pane->width * term->char_width - 1;
-                op->clip_my = op->clip_y + pane->height * term->char_height - 1;
-            }
+        size_t needed = rb->kitty_count + (size_t)session->kitty.render_op_count;
+        if (needed > rb->kitty_capacity) {
+            size_t new_cap = (rb->kitty_capacity == 0) ? 64 : rb->kitty_capacity;
+            while (new_cap < needed) new_cap *= 2;
+            KittyRenderOp* ops = (KittyRenderOp*)KTerm_Realloc(rb->kitty_ops, new_cap * sizeof(KittyRenderOp));
+            if (!ops) continue;
+            rb->kitty_ops = ops;
+            rb->kitty_capacity = new_cap;
         }
+        memcpy(&rb->kitty_ops[rb->kitty_count], session->kitty.render_ops, session->kitty.render_op_count * sizeof(KittyRenderOp));
+        rb->kitty_count = needed;
     }
     KTERM_MUTEX_UNLOCK(term->render_lock);
 }
@@ -13427,6 +17608,8 @@ void KTerm_PrepareRenderBuffer(KTerm* term) {
 
 void KTerm_Draw(KTerm* term) {
     if (!term->compute_initialized) return;
+    uint64_t stats_start = KTERM_STATS_ENABLED(term) ? KTerm_StatsNow() : 0;
+    KTERM_TRACE_BEGIN(term, trace_draw);
 
     KTERM_MUTEX_LOCK(term->render_lock);
     KTermRenderBuffer* rb = &term->render_buffers[term->rb_front];
@@ -13444,6 +17627,7 @@ void KTerm_Draw(KTerm* term) {
         if (rb->sixel_active && rb->sixel_count > 0) {
             KTerm_UpdateBuffer(term->sixel_buffer, 0, rb->sixel_count * sizeof(GPUSixelStrip), rb->sixel_strips);
             KTerm_UpdateBuffer(term->sixel_palette_buffer, 0, 256 * sizeof(uint32_t), rb->sixel_palette);
+            KTerm_StatsCountUpload(term, rb->sixel_count * sizeof(GPUSixelStrip) + 256 * sizeof(uint32_t));
 
             if (KTerm_CmdBindPipeline(cmd, term->sixel_pipeline) == KTERM_SUCCESS &&
                 KTerm_CmdBindTexture(cmd, 0, term->sixel_texture) == KTERM_SUCCESS) {
@@ -13505,6 +17689,7 @@ void KTerm_Draw(KTerm* term) {
         // Use cell_count from render buffer which is capped at capacity, avoiding overflow if resize failed
         size_t required_size = rb->cell_count * sizeof(GPUCell);
         KTerm_UpdateBuffer(term->terminal_buffer, 0, required_size, rb->cells);
+        KTerm_StatsCountUpload(term, required_size);
 
         if (KTerm_CmdBindPipeline(cmd, term->compute_pipeline) == KTERM_SUCCESS &&
             KTerm_CmdBindTexture(cmd, 1, term->output_texture) == KTERM_SUCCESS) {
@@ -13536,18 +17721,24 @@ void KTerm_Draw(KTerm* term) {
             }
         }
 
-        // --- 6. Vectors ---
-        if (rb->vector_count > 0) {
-            KTerm_UpdateBuffer(term->vector_buffer, 0, rb->vector_count * sizeof(GPUVectorLine), rb->vectors);
+        // --- 6. Vectors (only those new to the retained layer) ---
+        size_t vector_start;
+        bool vector_cleared;
+        if (term->gpu_vector_layer < 0) term->gpu_vector_layer = KTerm_AddVectorLayer(term);
+        if (KTerm_BeginVectors(term, term->gpu_vector_layer, rb, &vector_start, &vector_cleared)) {
+            size_t count = rb->vector_count - vector_start;
+            KTerm_UpdateBuffer(term->vector_buffer, 0, count * sizeof(GPUVectorLine), rb->vectors + vector_start);
+            KTerm_StatsCountUpload(term, count * sizeof(GPUVectorLine));
             if (KTerm_CmdBindPipeline(cmd, term->vector_pipeline) == KTERM_SUCCESS &&
                 KTerm_CmdBindTexture(cmd, 1, term->vector_layer_texture) == KTERM_SUCCESS) {
 
                 KTermPushConstants vector_pc = {0}; // Should use specific vector PC struct ideally
-                vector_pc.vector_count = rb->vector_count;
+                vector_pc.vector_count = (uint32_t)count;
                 vector_pc.vector_buffer_addr = KTerm_GetBufferAddress(term->vector_buffer);
                 KTerm_CmdSetPushConstant(cmd, 0, &vector_pc, sizeof(vector_pc));
-                KTerm_CmdDispatch(cmd, (rb->vector_count + 63) / 64, 1, 1);
+                KTerm_CmdDispatch(cmd, ((uint32_t)count + 63) / 64, 1, 1);
                 KTerm_CmdPipelineBarrier(cmd, KTERM_BARRIER_COMPUTE_SHADER_WRITE, KTERM_BARRIER_COMPUTE_SHADER_READ);
+                KTerm_EndVectors(term, term->gpu_vector_layer, rb);
             }
         }
 
@@ -13558,12 +17749,110 @@ void KTerm_Draw(KTerm* term) {
     }
 
         KTerm_EndFrame();
+
+    if (KTERM_STATS_ENABLED(term)) {
+        uint64_t elapsed = KTerm_StatsNow() - stats_start;
+        KTerm_StatsRecord(&term->stats.draw, elapsed);
+        atomic_fetch_add_explicit(&term->stats_frame_draw_ns, (uint_fast64_t)elapsed, memory_order_relaxed);
+    }
     KTERM_MUTEX_UNLOCK(term->render_lock);
+    KTERM_TRACE_END(term, trace_draw, "KTerm_Draw");
 }
 
 
 // --- Lifecycle Management ---
 
+// Everything a session allocates, for KTerm_Cleanup and KTerm_CloseSession.
+// The slot itself and its lock stay; KTerm_SetupSession makes it usable again.
+// The input ring stays too: producer threads write into it without the session
+// lock (KTerm_PipelineReserve hands out pointers into it), so a close racing them
+// must not free it. A reopen reuses it and KTerm_Cleanup frees it.
+static void KTerm_FreeSessionBuffers(KTermSession* session) {
+    if (session->screen_buffer) {
+        KTerm_Free(session->screen_buffer);
+        session->screen_buffer = NULL;
+    }
+    if (session->alt_buffer) {
+        KTerm_Free(session->alt_buffer);
+        session->alt_buffer = NULL;
+    }
+    if (session->row_dirty) {
+        KTerm_Free(session->row_dirty);
+        session->row_dirty = NULL;
+    }
+    KTerm_FreeBiDiCache(session);
+    KTerm_FreeChecksumCache(session);
+    if (session->output_ring) {
+        KTerm_Free(session->output_ring);
+        session->output_ring = NULL;
+    }
+    session->output_head = session->output_tail = 0;
+    atomic_store_explicit(&session->pipeline_head, 0, memory_order_relaxed);
+    atomic_store_explicit(&session->pipeline_tail, 0, memory_order_relaxed);
+    if (session->input.buffer) {
+        KTerm_Free(session->input.buffer);
+        session->input.buffer = NULL;
+    }
+    if (session->answerback_buffer) {
+        KTerm_Free(session->answerback_buffer);
+        session->answerback_buffer = NULL;
+    }
+    session->response_length = 0;
+    KTerm_FreeOpQueue(&session->op_queue);
+
+    if (session->tab_stops.stops) {
+        KTerm_Free(session->tab_stops.stops);
+        session->tab_stops.stops = NULL;
+    }
+
+    // Free Kitty Graphics resources per session
+    KTerm_KittyFreeAll(&session->kitty);
+
+    // Free memory for programmable key sequences
+    for (size_t k = 0; k < session->programmable_keys.count; k++) {
+        if (session->programmable_keys.keys[k].sequence) {
+            KTerm_Free(session->programmable_keys.keys[k].sequence);
+            session->programmable_keys.keys[k].sequence = NULL;
+        }
+    }
+    if (session->programmable_keys.keys) {
+        KTerm_Free(session->programmable_keys.keys);
+        session->programmable_keys.keys = NULL;
+    }
+    session->programmable_keys.count = 0;
+    session->programmable_keys.capacity = 0;
+
+    // Free stored macros
+    if (session->stored_macros.macros) {
+        for (size_t m = 0; m < session->stored_macros.count; m++) {
+            if (session->stored_macros.macros[m].content) {
+                KTerm_Free(session->stored_macros.macros[m].content);
+            }
+        }
+        KTerm_Free(session->stored_macros.macros);
+        session->stored_macros.macros = NULL;
+    }
+    session->stored_macros.count = 0;
+    session->stored_macros.capacity = 0;
+
+    // Sixel data and the bracketed paste buffer
+    // Note: active_upload points to one of the images or is NULL, so no separate free needed
+    if (session->sixel.data) {
+        KTerm_Free(session->sixel.data);
+        session->sixel.data = NULL;
+    }
+    if (session->sixel.strips) {
+        KTerm_Free(session->sixel.strips);
+        session->sixel.strips = NULL;
+    }
+    session->sixel.strip_count = 0;
+    session->sixel.strip_capacity = 0;
+    if (session->bracketed_paste.buffer) {
+        KTerm_Free(session->bracketed_paste.buffer);
+        session->bracketed_paste.buffer = NULL;
+    }
+}
+
 /**
  * @brief Cleans up all resources allocated by the terminal library.
  * This function must be called when the application is shutting down, typically
@@ -13580,10 +17869,29 @@ void KTerm_Draw(KTerm* term) {
  * and releases GPU resources.
  */
 void KTerm_Cleanup(KTerm* term) {
-    KTermSession* session = GET_SESSION(term);
+    KTermSession* session = term->sessions ? GET_SESSION(term) : NULL;
+    // Stop the glyph rasterizer before the atlas goes away
+    KTerm_SetAsyncGlyphRaster(term, false);
+    if (term->glyph_raster.jobs) { KTerm_Free(term->glyph_raster.jobs); term->glyph_raster.jobs = NULL; }
+    if (term->glyph_raster.results) { KTerm_Free(term->glyph_raster.results); term->glyph_raster.results = NULL; }
+
+    KTerm_RecordStop(term);
+    if (term->recorder) {
+        KTERM_MUTEX_DESTROY(term->recorder->lock);
+        KTerm_Free(term->recorder);
+        term->recorder = NULL;
+    }
+
+#ifdef KTERM_ENABLE_TRACE
+    KTerm_TraceStop(term);
+    for (int i = 0; i < KTERM_TRACE_MAX_THREADS; i++) {
+        if (term->tracer.rings[i].events) { KTerm_Free(term->tracer.rings[i].events); term->tracer.rings[i].events = NULL; }
+    }
+#endif
+
     // Free LRU Cache
-    if (term->glyph_map) { KTerm_Free(term->glyph_map); term->glyph_map = NULL; }
-    if (term->glyph_last_used) { KTerm_Free(term->glyph_last_used); term->glyph_last_used = NULL; }
+    KTerm_FreeGlyphMap(term);
+    if (term->cluster_map) { KTerm_Free(term->cluster_map); term->cluster_map = NULL; }
     if (term->atlas_to_codepoint) { KTerm_Free(term->atlas_to_codepoint); term->atlas_to_codepoint = NULL; }
     if (term->font_atlas_pixels) { KTerm_Free(term->font_atlas_pixels); term->font_atlas_pixels = NULL; }
 
@@ -13604,69 +17912,12 @@ void KTerm_Cleanup(KTerm* term) {
     KTerm_CleanupRenderBuffers(term);
 
     // Free session buffers
-    for (int i = 0; i < MAX_SESSIONS; i++) {
-        KTermSession* session = &term->sessions[i];
-        if (session->screen_buffer) {
-            KTerm_Free(session->screen_buffer);
-            session->screen_buffer = NULL;
-        }
-        if (session->alt_buffer) {
-            KTerm_Free(session->alt_buffer);
-            session->alt_buffer = NULL;
-        }
-
-        if (session->tab_stops.stops) {
-            KTerm_Free(session->tab_stops.stops);
-            session->tab_stops.stops = NULL;
-        }
-
-        // Free Kitty Graphics resources per session
-        if (session->kitty.images) {
-            for (int k = 0; k < session->kitty.image_count; k++) {
-                if (session->kitty.images[k].frames) {
-                    for (int f = 0; f < session->kitty.images[k].frame_count; f++) {
-                        if (session->kitty.images[k].frames[f].data) {
-                            KTerm_Free(session->kitty.images[k].frames[f].data);
-                        }
-                        if (session->kitty.images[k].frames[f].texture.id != 0) {
-                            KTerm_DestroyTexture(&session->kitty.images[k].frames[f].texture);
-                        }
-                    }
-                    KTerm_Free(session->kitty.images[k].frames);
-                }
-            }
-            KTerm_Free(session->kitty.images);
-            session->kitty.images = NULL;
-        }
-        session->kitty.current_memory_usage = 0;
-        session->kitty.active_upload = NULL;
-
-        // Free memory for programmable key sequences
-        for (size_t k = 0; k < session->programmable_keys.count; k++) {
-            if (session->programmable_keys.keys[k].sequence) {
-                KTerm_Free(session->programmable_keys.keys[k].sequence);
-                session->programmable_keys.keys[k].sequence = NULL;
-            }
-        }
-        if (session->programmable_keys.keys) {
-            KTerm_Free(session->programmable_keys.keys);
-            session->programmable_keys.keys = NULL;
-        }
-        session->programmable_keys.count = 0;
-        session->programmable_keys.capacity = 0;
-
-        // Free stored macros
-        if (session->stored_macros.macros) {
-            for (size_t m = 0; m < session->stored_macros.count; m++) {
-                if (session->stored_macros.macros[m].content) {
-                    KTerm_Free(session->stored_macros.macros[m].content);
-                }
-            }
-            KTerm_Free(session->stored_macros.macros);
-            session->stored_macros.macros = NULL;
+    for (int i = 0; i < term->session_count; i++) {
+        KTerm_FreeSessionBuffers(term->sessions[i]);
+        if (term->sessions[i]->input_pipeline) {
+            KTerm_Free(term->sessions[i]->input_pipeline);
+            term->sessions[i]->input_pipeline = NULL;
         }
-        session->stored_macros.count = 0;
-        session->stored_macros.capacity = 0;
     }
 
     // Free Vector Engine resources
@@ -13677,19 +17928,6 @@ void KTerm_Cleanup(KTerm* term) {
         term->vector_staging_buffer = NULL;
     }
 
-    // Free Sixel graphics data buffer
-    if (session->sixel.data) {
-        KTerm_Free(session->sixel.data);
-        session->sixel.data = NULL;
-    }
-    // Note: active_upload points to one of the images or is NULL, so no separate free needed unless we support partials differently
-
-    // Free bracketed paste buffer
-    if (GET_SESSION(term)->bracketed_paste.buffer) {
-        KTerm_Free(GET_SESSION(term)->bracketed_paste.buffer);
-        GET_SESSION(term)->bracketed_paste.buffer = NULL;
-    }
-
     // Free ReGIS Macros
     for (int i = 0; i < 26; i++) {
         if (term->regis.macros[i]) {
@@ -13702,13 +17940,25 @@ void KTerm_Cleanup(KTerm* term) {
         term->regis.macro_buffer = NULL;
     }
 
-    KTerm_ClearEvents(term); // Ensure input pipeline is empty and reset
+    if (session) KTerm_ClearEvents(term); // Ensure input pipeline is empty and reset
 
-    // Destroy Locks (Phase 3)
-    for (int i = 0; i < MAX_SESSIONS; i++) {
-        KTERM_MUTEX_DESTROY(term->sessions[i].lock);
+    // Destroy Locks (Phase 3) and the session table
+    for (int i = 0; i < term->session_count; i++) {
+        KTERM_MUTEX_DESTROY(term->sessions[i]->lock);
+        KTerm_Free(term->sessions[i]);
     }
+    for (int i = 0; i < term->retired_session_table_count; i++) KTerm_Free(term->retired_session_tables[i]);
+    if (term->sessions) KTerm_Free(term->sessions);
+    if (term->update_list) KTerm_Free(term->update_list);
+    term->sessions = NULL;
+    term->update_list = NULL;
+    term->session_count = term->session_capacity = term->update_count = term->update_capacity = 0;
+    term->retired_session_table_count = 0;
     KTERM_MUTEX_DESTROY(term->lock);
+    KTERM_MUTEX_DESTROY(term->glyph_raster.lock);
+    KTERM_MUTEX_DESTROY(term->glyph_raster.font_lock);
+    KTERM_COND_DESTROY(term->glyph_raster.wake);
+    KTERM_COND_DESTROY(term->glyph_raster.idle);
 
     if (term->layout) {
         KTermLayout_Destroy(term->layout);
@@ -13796,20 +18046,39 @@ int main(void) {
 // OP QUEUE & FLUSHING
 // =============================================================================
 
+// Resets the ring; the ops array (if any) is kept for reuse
 void KTerm_InitOpQueue(KTermOpQueue* queue) {
     queue->head = 0;
     queue->tail = 0;
     queue->count = 0;
+    queue->stats = NULL;
+}
+
+static bool KTerm_AllocOpQueue(KTermOpQueue* queue) {
+    if (queue->ops) return true;
+    if (queue->capacity <= 0) queue->capacity = KTERM_OP_QUEUE_SIZE;
+    queue->ops = (KTermOp*)KTerm_Malloc((size_t)queue->capacity * sizeof(KTermOp));
+    return queue->ops != NULL;
+}
+
+void KTerm_FreeOpQueue(KTermOpQueue* queue) {
+    if (queue->ops) KTerm_Free(queue->ops);
+    queue->ops = NULL;
+    KTerm_InitOpQueue(queue);
 }
 
 bool KTerm_IsOpQueueFull(KTermOpQueue* queue) {
-    return queue->count >= KTERM_OP_QUEUE_SIZE;
+    return queue->ops && queue->count >= queue->capacity;
 }
 
 bool KTerm_QueueOp(KTermOpQueue* queue, KTermOp op) {
-    if (KTerm_IsOpQueueFull(queue)) return false;
+    if (KTerm_IsOpQueueFull(queue) || !KTerm_AllocOpQueue(queue)) {
+        if (queue->stats) queue->stats->ops_dropped++;
+        return false;
+    }
+    if (queue->stats && op.type < KTERM_OP_INVALID) queue->stats->ops_queued[op.type]++;
     queue->ops[queue->tail] = op;
-    queue->tail = (queue->tail + 1) % KTERM_OP_QUEUE_SIZE;
+    queue->tail = (queue->tail + 1) & (queue->capacity - 1);
     queue->count++;
     return true;
 }
@@ -13922,7 +18191,7 @@ static void KTerm_ApplyResizeOp(KTerm* term, KTermSession* session, KTermOp* op)
     int old_rows = session->rows;
 
     // Calculate new dimensions
-    int new_buffer_height = rows + MAX_SCROLLBACK_LINES;
+    int new_buffer_height = rows + term->session_buffer_sizes.scrollback;
 
     // --- Screen Buffer Resize & Content Preservation (Viewport) ---
     EnhancedTermChar* new_screen_buffer = (EnhancedTermChar*)KTerm_Calloc(new_buffer_height * cols, sizeof(EnhancedTermChar));
@@ -13959,7 +18228,7 @@ static void KTerm_ApplyResizeOp(KTerm* term, KTermSession* session, KTermOp* op)
 
     // Optimize: Only copy populated history
     int start_y = -session->history_rows_populated;
-    if (start_y < -MAX_SCROLLBACK_LINES) start_y = -MAX_SCROLLBACK_LINES;
+    if (start_y < -term->session_buffer_sizes.scrollback) start_y = -term->session_buffer_sizes.scrollback;
 
     // Iterate from oldest history line to bottom of visible viewport
     for (int y = start_y; y < copy_rows; y++) {
@@ -13991,7 +18260,7 @@ static void KTerm_ApplyResizeOp(KTerm* term, KTermSession* session, KTermOp* op)
 
     if (session->row_dirty) KTerm_Free(session->row_dirty);
     session->row_dirty = new_row_dirty;
-    for (int r = 0; r < rows; r++) session->row_dirty[r] = KTERM_DIRTY_FRAMES;
+    for (int r = 0; r < rows; r++) KTerm_MarkRowDirty(session, r);
 
     if (session->alt_buffer) KTerm_Free(session->alt_buffer);
     session->alt_buffer = new_alt_buffer;
@@ -14041,12 +18310,8 @@ static void KTerm_ApplyResizeOp(KTerm* term, KTermSession* session, KTermOp* op)
     // Force full dirty
     session->dirty_rect = (KTermRect){0, 0, cols, rows};
 
-    // Calculate index using pointer arithmetic
-    ptrdiff_t idx = session - term->sessions;
-    if (idx >= 0 && idx < MAX_SESSIONS) {
-        if (term->session_resize_callback) {
-            term->session_resize_callback(term, (int)idx, cols, rows);
-        }
+    if (term->session_resize_callback) {
+        term->session_resize_callback(term, KTerm_SessionHandle(session), cols, rows);
     }
 }
 
@@ -14067,7 +18332,7 @@ static void KTerm_ApplyFillRectOp(KTermSession* session, KTermOp* op) {
                 cell->flags |= KTERM_FLAG_DIRTY;
             }
         }
-        if (y >= 0 && y < session->rows) session->row_dirty[y] = KTERM_DIRTY_FRAMES;
+        if (y >= 0 && y < session->rows) KTerm_MarkRowDirty(session, y);
     }
 
     if (session->dirty_rect.w == 0) {
@@ -14115,7 +18380,7 @@ static void KTerm_ApplyCopyRectOp(KTermSession* session, KTermOp* op) {
             }
         }
         if (dest_y + y >= 0 && dest_y + y < session->rows) {
-            session->row_dirty[dest_y + y] = KTERM_DIRTY_FRAMES;
+            KTerm_MarkRowDirty(session, dest_y + y);
         }
     }
     KTerm_Free(temp);
@@ -14160,7 +18425,7 @@ static void KTerm_ApplySetAttrRectOp(KTermSession* session, KTermOp* op) {
                 cell->flags = new_flags | KTERM_FLAG_DIRTY;
             }
         }
-        if (y >= 0 && y < session->rows) session->row_dirty[y] = KTERM_DIRTY_FRAMES;
+        if (y >= 0 && y < session->rows) KTerm_MarkRowDirty(session, y);
     }
 
     // Update dirty rect
@@ -14200,7 +18465,7 @@ static void KTerm_ApplyVerticalOp(KTermSession *session, KTermOp *op) {
                  *GetActiveScreenCell(session, y, x) = *GetActiveScreenCell(session, y - lines, x);
                  GetActiveScreenCell(session, y, x)->flags |= KTERM_FLAG_DIRTY;
              }
-             if (y < session->rows) session->row_dirty[y] = KTERM_DIRTY_FRAMES;
+             if (y < session->rows) KTerm_MarkRowDirty(session, y);
     }
 
         // Clear inserted lines at top
@@ -14208,7 +18473,7 @@ static void KTerm_ApplyVerticalOp(KTermSession *session, KTermOp *op) {
              for (int x = r.x; x < r.x + r.w; x++) {
                  KTerm_ClearCell_Internal(session, GetActiveScreenCell(session, y, x));
              }
-             if (y < session->rows) session->row_dirty[y] = KTERM_DIRTY_FRAMES;
+             if (y < session->rows) KTerm_MarkRowDirty(session, y);
     }
 
     } else { // DELETE: Shift Up
@@ -14218,7 +18483,7 @@ static void KTerm_ApplyVerticalOp(KTermSession *session, KTermOp *op) {
                  *GetActiveScreenCell(session, y, x) = *GetActiveScreenCell(session, y + lines, x);
                  GetActiveScreenCell(session, y, x)->flags |= KTERM_FLAG_DIRTY;
             }
-             if (y < session->rows) session->row_dirty[y] = KTERM_DIRTY_FRAMES;
+             if (y < session->rows) KTerm_MarkRowDirty(session, y);
     }
 
         // Clear bottom lines
@@ -14226,7 +18491,7 @@ static void KTerm_ApplyVerticalOp(KTermSession *session, KTermOp *op) {
              for (int x = r.x; x < r.x + r.w; x++) {
                  KTerm_ClearCell_Internal(session, GetActiveScreenCell(session, y, x));
              }
-             if (y < session->rows) session->row_dirty[y] = KTERM_DIRTY_FRAMES;
+             if (y < session->rows) KTerm_MarkRowDirty(session, y);
     }
     }
 
@@ -14267,8 +18532,11 @@ static void KTerm_ApplyScrollOp(KTermSession* session, KTermOp* op) {
                     KTerm_ClearCell_Internal(session, &row_ptr[c]);
                 }
                 session->screen_head = (session->screen_head + 1) % session->buffer_height;
+                if (session->history_rows_populated < session->buffer_height - session->rows) session->history_rows_populated++;
                 if (session->view_offset > 0) session->view_offset++;
             }
+            // Every viewport row now shows different data
+            for (int y = 0; y < session->rows; y++) KTerm_MarkRowDirty(session, y);
         } else {
             for (int i = 0; i < lines; i++) {
                 for (int y = top; y < bottom; y++) {
@@ -14276,13 +18544,13 @@ static void KTerm_ApplyScrollOp(KTermSession* session, KTermOp* op) {
                         *GetActiveScreenCell(session, y, x) = *GetActiveScreenCell(session, y + 1, x);
                         GetActiveScreenCell(session, y, x)->flags |= KTERM_FLAG_DIRTY;
                     }
-                     session->row_dirty[y] = KTERM_DIRTY_FRAMES;
+                     KTerm_MarkRowDirty(session, y);
     }
                 for (int x = x_start; x <= x_end; x++) {
                     KTerm_ClearCell_Internal(session, GetActiveScreenCell(session, bottom, x));
                     GetActiveScreenCell(session, bottom, x)->flags |= KTERM_FLAG_DIRTY;
                 }
-                session->row_dirty[bottom] = KTERM_DIRTY_FRAMES;
+                KTerm_MarkRowDirty(session, bottom);
             }
         }
     } else { // Scroll Down
@@ -14292,13 +18560,13 @@ static void KTerm_ApplyScrollOp(KTermSession* session, KTermOp* op) {
                     *GetActiveScreenCell(session, y, x) = *GetActiveScreenCell(session, y - 1, x);
                      GetActiveScreenCell(session, y, x)->flags |= KTERM_FLAG_DIRTY;
                 }
-                session->row_dirty[y] = KTERM_DIRTY_FRAMES;
+                KTerm_MarkRowDirty(session, y);
     }
             for (int x = x_start; x <= x_end; x++) {
                 KTerm_ClearCell_Internal(session, GetActiveScreenCell(session, top, x));
                 GetActiveScreenCell(session, top, x)->flags |= KTERM_FLAG_DIRTY;
             }
-            session->row_dirty[top] = KTERM_DIRTY_FRAMES;
+            KTerm_MarkRowDirty(session, top);
         }
     }
 
@@ -14320,8 +18588,12 @@ static void KTerm_ApplyScrollOp(KTermSession* session, KTermOp* op) {
 
 void KTerm_FlushOps(KTerm* term, KTermSession* session) {
     KTermOpQueue* queue = &session->op_queue;
+    if (queue->count == 0) return;
+    KTERM_TRACE_BEGIN(term, trace_flush);
+    if (queue->stats) term->stats_frame.ops_applied += (uint64_t)queue->count;
     while (queue->count > 0) {
         KTermOp* op = &queue->ops[queue->head];
+        if (queue->stats && op->type < KTERM_OP_INVALID) queue->stats->ops_applied[op->type]++;
 
         switch(op->type) {
             case KTERM_OP_SET_CELL:
@@ -14329,7 +18601,7 @@ void KTerm_FlushOps(KTerm* term, KTermSession* session) {
                     EnhancedTermChar* cell = GetActiveScreenCell(session, op->u.set_cell.y, op->u.set_cell.x);
                     if (cell) {
                         *cell = op->u.set_cell.cell;
-                        if (op->u.set_cell.y < session->rows) session->row_dirty[op->u.set_cell.y] = KTERM_DIRTY_FRAMES;
+                        if (op->u.set_cell.y < session->rows) KTerm_MarkRowDirty(session, op->u.set_cell.y);
 
                         int x = op->u.set_cell.x;
                         int y = op->u.set_cell.y;
@@ -14368,13 +18640,14 @@ void KTerm_FlushOps(KTerm* term, KTermSession* session) {
                 break;
         }
 
-        queue->head = (queue->head + 1) % KTERM_OP_QUEUE_SIZE;
+        queue->head = (queue->head + 1) & (queue->capacity - 1);
         queue->count--;
     }
+    KTERM_TRACE_END(term, trace_flush, "FlushOps");
 }
 
 bool KTerm_InitSession(KTerm* term, int index) {
-    KTermSession* session = &term->sessions[index];
+    KTermSession* session = term->sessions[index];
 
     session->last_cursor_y = -1;
 
@@ -14384,6 +18657,7 @@ bool KTerm_InitSession(KTerm* term, int index) {
 
     // Initialize Op Queue
     KTerm_InitOpQueue(&session->op_queue);
+    if (KTERM_STATS_ENABLED(term)) session->op_queue.stats = &session->stats;
     session->dirty_rect = (KTermRect){0, 0, 0, 0};
 
     // Initialize session defaults
@@ -14396,7 +18670,7 @@ bool KTerm_InitSession(KTerm* term, int index) {
 
     // Initialize Ring Buffer
     // Primary buffer includes scrollback
-    session->buffer_height = session->rows + MAX_SCROLLBACK_LINES;
+    session->buffer_height = session->rows + term->session_buffer_sizes.scrollback;
     session->screen_head = 0;
     session->alt_screen_head = 0;
     session->view_offset = 0;
@@ -14441,7 +18715,7 @@ bool KTerm_InitSession(KTerm* term, int index) {
         return false;
     }
     for (int y = 0; y < session->rows; y++) {
-        session->row_dirty[y] = KTERM_DIRTY_FRAMES;
+        KTerm_MarkRowDirty(session, y);
     }
 
     session->selection.active = false;
@@ -14462,6 +18736,8 @@ bool KTerm_InitSession(KTerm* term, int index) {
     session->mouse.sgr_mode = false;
     session->mouse.cursor_x = -1;
     session->mouse.cursor_y = -1;
+    session->mouse.coalesce_motion = true;
+    session->mouse.pending_motion[0] = '\0';
     session->input.auto_process = true;
 
     session->cursor.visible = true;
@@ -14543,6 +18819,11 @@ bool KTerm_InitSession(KTerm* term, int index) {
     snprintf(session->title.icon_title, sizeof(session->title.icon_title), "Term %d", index + 1);
 
     session->input_pipeline_length = 0; // Fix: was missing, implicitly 0
+    // Buffer sizes take effect when the buffers are (re)allocated; see KTerm_OpenSessionBuffers
+    if (!session->input_pipeline) session->pipeline_mask = (int)term->session_buffer_sizes.input_pipeline - 1;
+    if (!session->input.buffer) session->input.buffer_mask = term->session_buffer_sizes.key_events - 1;
+    if (!session->answerback_buffer) session->response_capacity = term->session_buffer_sizes.responses;
+    if (!session->op_queue.ops) session->op_queue.capacity = term->session_buffer_sizes.op_queue;
     session->pipeline_head = 0;
     session->pipeline_tail = 0;
     session->pipeline_count = 0;
@@ -14589,7 +18870,7 @@ bool KTerm_InitSession(KTerm* term, int index) {
     memset(session->printer_buffer, 0, sizeof(session->printer_buffer));
 
     // Initial answerback (will be updated by SetLevel)
-    session->answerback_buffer[0] = '\0';
+    if (session->answerback_buffer) session->answerback_buffer[0] = '\0';
 
     // Init charsets, tabs, keyboard
     // We can reuse the helper functions if they operate on (*GET_SESSION(term)) and we switch context
@@ -14598,23 +18879,26 @@ bool KTerm_InitSession(KTerm* term, int index) {
 }
 
 void KTerm_SetResponseEnabled(KTerm* term, int session_index, bool enable) {
-    if (session_index >= 0 && session_index < MAX_SESSIONS) {
-        term->sessions[session_index].response_enabled = enable;
-    }
+    KTermSession* session = KTerm_LookupSession(term, session_index);
+    if (session) session->response_enabled = enable;
 }
 
-void KTerm_SetActiveSession(KTerm* term, int index) {
-    if (index >= 0 && index < MAX_SESSIONS) {
+// Index-based switch for internal callers (multiplexer keys, DECSN, panes)
+static void KTerm_SetActiveSessionIndex(KTerm* term, int index) {
+    if (index >= 0 && index < term->session_count) {
         // Only switch if actually changing
         if (term->active_session != index) {
+            // A closed slot comes back as a fresh session
+            if (!term->sessions[index]->screen_buffer && !KTerm_SetupSession(term, index)) return;
             term->active_session = index;
             term->pending_session_switch = index;
 
             // Force redraw of the newly active session
-            KTermSession* new_session = &term->sessions[index];
+            KTermSession* new_session = term->sessions[index];
+            KTerm_OpenSessionBuffers(term, new_session);
             for(int y = 0; y < term->height; y++) {
                 if (y < new_session->rows) {
-                    new_session->row_dirty[y] = KTERM_DIRTY_FRAMES;
+                    KTerm_MarkRowDirty(new_session, y);
     }
             }
 
@@ -14630,32 +18914,102 @@ void KTerm_SetActiveSession(KTerm* term, int index) {
     }
 }
 
+void KTerm_SetActiveSession(KTerm* term, int index) {
+    KTermSession* session = KTerm_LookupSession(term, index);
+    if (session) KTerm_SetActiveSessionIndex(term, session->index);
+}
 
-void KTerm_SetSplitScreen(KTerm* term, bool active, int row, int top_idx, int bot_idx) {
+static void KTerm_SetSplitScreenIndices(KTerm* term, bool active, int row, int top_idx, int bot_idx) {
     term->split_screen_active = active;
     if (active) {
         term->split_row = row;
-        if (top_idx >= 0 && top_idx < MAX_SESSIONS) term->session_top = top_idx;
-        if (bot_idx >= 0 && bot_idx < MAX_SESSIONS) term->session_bottom = bot_idx;
+        if (top_idx >= 0 && top_idx < term->session_count) term->session_top = top_idx;
+        if (bot_idx >= 0 && bot_idx < term->session_count) term->session_bottom = bot_idx;
+        if (!term->sessions[term->session_top]->screen_buffer) KTerm_SetupSession(term, term->session_top);
+        if (!term->sessions[term->session_bottom]->screen_buffer) KTerm_SetupSession(term, term->session_bottom);
 
         // Invalidate both sessions to force redraw
         for(int y=0; y<term->height; y++) {
-            term->sessions[term->session_top].row_dirty[y] = KTERM_DIRTY_FRAMES;
-            term->sessions[term->session_bottom].row_dirty[y] = KTERM_DIRTY_FRAMES;
+            KTerm_MarkRowDirty(term->sessions[term->session_top], y);
+            KTerm_MarkRowDirty(term->sessions[term->session_bottom], y);
         }
     } else {
         // Invalidate active session
          for(int y=0; y<term->height; y++) {
-            term->sessions[term->active_session].row_dirty[y] = KTERM_DIRTY_FRAMES;
+            KTerm_MarkRowDirty(term->sessions[term->active_session], y);
         }
     }
 }
 
+void KTerm_SetSplitScreen(KTerm* term, bool active, int row, int top_idx, int bot_idx) {
+    KTermSession* top = KTerm_LookupSession(term, top_idx);
+    KTermSession* bot = KTerm_LookupSession(term, bot_idx);
+    if (!term) return;
+    KTerm_SetSplitScreenIndices(term, active, row, top ? top->index : -1, bot ? bot->index : -1);
+}
+
 
 void KTerm_WriteCharToSession(KTerm* term, int session_index, unsigned char ch) {
-    if (session_index >= 0 && session_index < MAX_SESSIONS) {
-        KTerm_WriteCharToSessionInternal(term, &term->sessions[session_index], ch);
+    KTermSession* session = KTerm_LookupSession(term, session_index);
+    if (session) KTerm_WriteCharToSessionInternal(term, session, ch);
+}
+
+size_t KTerm_WriteData(KTerm* term, int session_index, const void* data, size_t len) {
+    KTermSession* session = KTerm_LookupSession(term, session_index);
+    if (!session || !data) return 0;
+    return KTerm_WriteDataInternal(term, session, (const unsigned char*)data, len);
+}
+
+size_t KTerm_PipelineReserve(KTerm* term, int session_index, unsigned char** ptr1, size_t* len1,
+                             unsigned char** ptr2, size_t* len2) {
+    unsigned char* p1 = NULL;
+    unsigned char* p2 = NULL;
+    size_t first = 0, second = 0;
+
+    KTermSession* session = KTerm_LookupSession(term, session_index);
+    if (session && KTerm_PipelineReady(term, session)) {
+        // Same ordering as KTerm_PipelineStore: the acquire on tail
+        // guarantees the parser is done with every slot handed out here
+        int head = atomic_load_explicit(&session->pipeline_head, memory_order_relaxed);
+        int tail = atomic_load_explicit(&session->pipeline_tail, memory_order_acquire);
+        size_t free_bytes = (size_t)((tail - head - 1) & session->pipeline_mask); // One slot stays empty
+        size_t to_end = (size_t)(session->pipeline_mask + 1 - head);
+
+        first = (free_bytes < to_end) ? free_bytes : to_end;
+        second = free_bytes - first;
+        if (first > 0) p1 = session->input_pipeline + head;
+        if (second > 0) p2 = session->input_pipeline;
+    }
+
+    if (ptr1) *ptr1 = p1;
+    if (len1) *len1 = first;
+    if (ptr2) *ptr2 = p2;
+    if (len2) *len2 = second;
+    return first + second;
+}
+
+size_t KTerm_PipelineCommit(KTerm* term, int session_index, size_t n) {
+    KTermSession* session = KTerm_LookupSession(term, session_index);
+    if (!session || n == 0 || !session->input_pipeline) return 0;
+
+    int head = atomic_load_explicit(&session->pipeline_head, memory_order_relaxed);
+    int tail = atomic_load_explicit(&session->pipeline_tail, memory_order_acquire);
+    size_t free_bytes = (size_t)((tail - head - 1) & session->pipeline_mask);
+    if (n > free_bytes) {
+        // More than was reserved: only the reserved part can be valid
+        atomic_store_explicit(&session->pipeline_overflow, true, memory_order_relaxed);
+        n = free_bytes;
     }
+
+    if (KTerm_IsRecording(term)) {
+        for (size_t i = 0; i < n; i++) {
+            KTerm_RecordInput(term, session, session->input_pipeline[(head + (int)i) & session->pipeline_mask]);
+        }
+    }
+
+    // Publishes the bytes written through the reserved spans
+    if (n > 0) KTerm_PipelinePublish(term, session, (head + (int)n) & session->pipeline_mask);
+    return n;
 }
 
 // Helper to resize a specific session
@@ -14693,7 +19047,7 @@ static void KTerm_ResizeSession_Internal(KTerm* term, KTermSession* session, int
     int old_rows = session->rows;
 
     // Calculate new dimensions
-    int new_buffer_height = rows + MAX_SCROLLBACK_LINES;
+    int new_buffer_height = rows + term->session_buffer_sizes.scrollback;
 
     // --- Screen Buffer Resize & Content Preservation (Viewport) ---
     EnhancedTermChar* new_screen_buffer = (EnhancedTermChar*)KTerm_Calloc(new_buffer_height * cols, sizeof(EnhancedTermChar));
@@ -14730,7 +19084,7 @@ static void KTerm_ResizeSession_Internal(KTerm* term, KTermSession* session, int
 
     // Optimize: Only copy populated history
     int start_y = -session->history_rows_populated;
-    if (start_y < -MAX_SCROLLBACK_LINES) start_y = -MAX_SCROLLBACK_LINES;
+    if (start_y < -term->session_buffer_sizes.scrollback) start_y = -term->session_buffer_sizes.scrollback;
 
     // Iterate from oldest history line to bottom of visible viewport
     for (int y = start_y; y < copy_rows; y++) {
@@ -14763,7 +19117,7 @@ static void KTerm_ResizeSession_Internal(KTerm* term, KTermSession* session, int
 
     if (session->row_dirty) KTerm_Free(session->row_dirty);
     session->row_dirty = new_row_dirty;
-    for (int r = 0; r < rows; r++) session->row_dirty[r] = KTERM_DIRTY_FRAMES;
+    for (int r = 0; r < rows; r++) KTerm_MarkRowDirty(session, r);
 
     if (session->alt_buffer) KTerm_Free(session->alt_buffer);
     session->alt_buffer = new_alt_buffer;
@@ -14811,8 +19165,9 @@ static void KTerm_ResizeSession_Internal(KTerm* term, KTermSession* session, int
 }
 }
 static void KTerm_ResizeSession(KTerm* term, int session_index, int cols, int rows) {
-    if (session_index < 0 || session_index >= MAX_SESSIONS) return;
-    KTermSession* session = &term->sessions[session_index];
+    if (session_index < 0 || session_index >= term->session_count) return;
+    KTermSession* session = term->sessions[session_index];
+    if (!session->screen_buffer) return; // Closed: a reopen sizes it afresh
 
 #ifdef KTERM_DEBUG_DIRECT
     KTERM_MUTEX_LOCK(session->lock);
@@ -14820,32 +19175,89 @@ static void KTerm_ResizeSession(KTerm* term, int session_index, int cols, int ro
     KTERM_MUTEX_UNLOCK(session->lock);
 #else
     KTerm_QueueResize(session, cols, rows, true);
+    KTerm_WakeSession(term, session); // Applied by the next KTerm_Update even if the session is idle
 #endif
 
-    if (term->session_resize_callback) term->session_resize_callback(term, session_index, cols, rows);
+    if (term->session_resize_callback) term->session_resize_callback(term, KTerm_SessionHandle(session), cols, rows);
 }
 
-KTermPane* KTerm_SplitPane(KTerm* term, KTermPane* target_pane, KTermPaneType split_type, float ratio) {
-    if (!term->layout) return NULL;
+int KTerm_CreateSession(KTerm* term) {
+    if (!term) return -1;
 
-    // Find a free session for the new pane
-    int new_session_idx = -1;
-    for (int i = 0; i < MAX_SESSIONS; i++) {
-        if (!term->sessions[i].session_open) {
-             new_session_idx = i;
-             break;
+    // Reuse a closed slot before growing the table
+    int index = -1;
+    for (int i = 0; i < term->session_count; i++) {
+        if (!term->sessions[i]->session_open && i != term->active_session) {
+            index = i;
+            break;
         }
     }
+    if (index < 0 && (index = KTerm_AddSessionSlot(term)) < 0) return -1;
 
-    if (new_session_idx == -1) return NULL;
-
-    // Initialize the new session
-    if (!KTerm_InitSession(term, new_session_idx)) {
-        return NULL;
+    KTermSession* session = term->sessions[index];
+    // Sized like the terminal; a pane split resizes it to the pane
+    session->cols = term->width;
+    session->rows = term->height;
+    if (!KTerm_SetupSession(term, index) || !KTerm_OpenSessionBuffers(term, session)) {
+        KTerm_FreeSessionBuffers(session); // Leaves the slot closed, as KTerm_LookupSession expects
+        return -1;
     }
-    term->sessions[new_session_idx].session_open = true;
+    session->session_open = true;
+    return KTerm_SessionHandle(session);
+}
+
+static void KTerm_CloseSessionIndex(KTerm* term, int index) {
+    KTermSession* session = term->sessions[index];
+    if (KTerm_IsSessionVisible(term, index)) return; // The active session, and any on screen, stays open
+
+    // Protocol targets pointing here fall back to the sender's session
+    if (term->gateway_target_session == index) term->gateway_target_session = -1;
+    if (term->regis_target_session == index) term->regis_target_session = -1;
+    if (term->tektronix_target_session == index) term->tektronix_target_session = -1;
+    if (term->kitty_target_session == index) term->kitty_target_session = -1;
+    if (term->sixel_target_session == index) term->sixel_target_session = -1;
+
+    KTERM_MUTEX_LOCK(session->lock);
+    KTerm_FreeSessionBuffers(session);
+    session->session_open = false;
+    // Handles stay non-negative: 15 generation bits above the index
+    session->generation = (uint16_t)((session->generation + 1) & 0x7FFF);
+    KTERM_MUTEX_UNLOCK(session->lock);
+}
+
+void KTerm_CloseSession(KTerm* term, int session_index) {
+    KTermSession* session = KTerm_LookupSession(term, session_index);
+    if (session) KTerm_CloseSessionIndex(term, session->index);
+}
+
+int KTerm_GetSessionCount(KTerm* term) {
+    return term ? term->session_count : 0;
+}
+
+int KTerm_GetSessionHandle(KTerm* term, int index) {
+    if (!term || index < 0 || index >= term->session_count || !term->sessions[index]->screen_buffer) return -1;
+    return KTerm_SessionHandle(term->sessions[index]);
+}
+
+void KTerm_SetSessionFastForward(KTerm* term, int session_index, bool enable) {
+    KTermSession* session = KTerm_LookupSession(term, session_index);
+    if (!session) return;
+    session->fast_forward = enable;
+    // The next update settles the state, and resumes animations paused while hidden
+    KTerm_WakeSession(term, session);
+}
+
+KTermPane* KTerm_SplitPane(KTerm* term, KTermPane* target_pane, KTermPaneType split_type, float ratio) {
+    if (!term->layout) return NULL;
 
-    return KTermLayout_Split(term->layout, target_pane, split_type, ratio, new_session_idx, KTerm_LayoutResizeCallback, term);
+    // The new pane shows a new (or reused) session
+    int handle = KTerm_CreateSession(term);
+    if (handle == -1) return NULL;
+    int new_session_idx = KTERM_SESSION_INDEX(handle);
+
+    KTermPane* pane = KTermLayout_Split(term->layout, target_pane, split_type, ratio, new_session_idx, KTerm_LayoutResizeCallback, term);
+    if (!pane) KTerm_CloseSessionIndex(term, new_session_idx);
+    return pane;
 }
 
 void KTerm_ClosePane(KTerm* term, KTermPane* pane) {
@@ -14855,14 +19267,14 @@ void KTerm_ClosePane(KTerm* term, KTermPane* pane) {
 
     KTermLayout_Close(term->layout, pane, KTerm_LayoutResizeCallback, term);
 
-    // Close session
-    if (session_idx >= 0 && session_idx < MAX_SESSIONS) {
-        term->sessions[session_idx].session_open = false;
+    // Update active session if needed, so the pane's session is no longer on screen
+    if (term->layout->focused && term->layout->focused->session_index >= 0) {
+        KTerm_SetActiveSessionIndex(term, term->layout->focused->session_index);
     }
 
-    // Update active session if needed
-    if (term->layout->focused && term->layout->focused->session_index >= 0) {
-        KTerm_SetActiveSession(term, term->layout->focused->session_index);
+    // Close session
+    if (session_idx >= 0 && session_idx < term->session_count) {
+        KTerm_CloseSessionIndex(term, session_idx);
     }
 }
 
@@ -14885,6 +19297,8 @@ void KTerm_Resize(KTerm* term, int cols, int rows) {
         return;
     }
     term->last_resize_time = now;
+    KTERM_TRACE_BEGIN(term, trace_resize);
+    if (KTerm_IsRecording(term)) KTerm_RecordResize(term, cols, rows);
 
     bool global_dim_changed = (cols != term->width || rows != term->height);
 
@@ -14898,7 +19312,7 @@ void KTerm_Resize(KTerm* term, int cols, int rows) {
     } else {
         // Fallback for initialization or if tree is missing (should verify)
         // Resize all active sessions to full size (legacy behavior)
-        for(int i=0; i<MAX_SESSIONS; i++) {
+        for(int i=0; i<term->session_count; i++) {
              KTerm_ResizeSession(term, i, cols, rows);
         }
     }
@@ -14963,8 +19377,8 @@ void KTerm_Resize(KTerm* term, int cols, int rows) {
         }
 
         if (term->vector_layer_texture.generation != 0) KTerm_DestroyTexture(&term->vector_layer_texture);
-        // Note: Vector layer content is lost on resize. Preserving it would require a texture copy,
-        // but the current Situation adapter does not expose a suitable compute layout or blit function for this.
+        // The new layer starts empty: rasterize every staged vector again, in batches
+        KTerm_ResetVectorLayer(term, term->gpu_vector_layer);
         KTermImage vec_img = {0};
         KTerm_CreateImage(win_width, win_height, 4, &vec_img);
         memset(vec_img.data, 0, win_width * win_height * 4);
@@ -14981,6 +19395,7 @@ void KTerm_Resize(KTerm* term, int cols, int rows) {
         term->split_row = rows / 2;
     }
 
+    KTERM_TRACE_END(term, trace_resize, "Resize");
     KTERM_MUTEX_UNLOCK(term->lock);
 }
 
@@ -14989,17 +19404,67 @@ KTermStatus KTerm_GetStatus(KTerm* term) {
     KTermStatus status = {0};
     int head = atomic_load_explicit(&GET_SESSION(term)->pipeline_head, memory_order_relaxed);
     int tail = atomic_load_explicit(&GET_SESSION(term)->pipeline_tail, memory_order_relaxed);
-    status.pipeline_usage = (head - tail + sizeof(GET_SESSION(term)->input_pipeline)) % sizeof(GET_SESSION(term)->input_pipeline);
+    status.pipeline_usage = (size_t)((head - tail) & GET_SESSION(term)->pipeline_mask);
 
     int kb_head = atomic_load_explicit(&session->input.buffer_head, memory_order_relaxed);
     int kb_tail = atomic_load_explicit(&session->input.buffer_tail, memory_order_relaxed);
-    status.key_usage = (kb_head - kb_tail + KEY_EVENT_BUFFER_SIZE) % KEY_EVENT_BUFFER_SIZE;
+    status.key_usage = (size_t)((kb_head - kb_tail) & session->input.buffer_mask);
 
     status.overflow_detected = atomic_load_explicit(&GET_SESSION(term)->pipeline_overflow, memory_order_relaxed);
     status.avg_process_time = GET_SESSION(term)->VTperformance.avg_process_time;
     return status;
 }
 
+void KTerm_SetStatsEnabled(KTerm* term, bool enable) {
+#ifdef KTERM_DISABLE_STATS
+    (void)term; (void)enable;
+#else
+    if (!term) return;
+    term->stats.enabled = enable;
+    for (int i = 0; i < term->session_count; i++) {
+        term->sessions[i]->op_queue.stats = enable ? &term->sessions[i]->stats : NULL;
+    }
+#endif
+}
+
+void KTerm_ResetStats(KTerm* term) {
+    if (!term) return;
+    bool enabled = term->stats.enabled;
+    KTERM_MUTEX_LOCK(term->render_lock); // stats.draw
+    memset(&term->stats, 0, sizeof(term->stats));
+    KTERM_MUTEX_UNLOCK(term->render_lock);
+    memset(&term->stats_frame, 0, sizeof(term->stats_frame));
+    atomic_store_explicit(&term->stats_uploaded, 0, memory_order_relaxed);
+    atomic_store_explicit(&term->stats_frame_uploaded, 0, memory_order_relaxed);
+    atomic_store_explicit(&term->stats_frame_draw_ns, 0, memory_order_relaxed);
+    term->stats.enabled = enabled;
+    for (int i = 0; i < term->session_count; i++) {
+        memset(&term->sessions[i]->stats, 0, sizeof(term->sessions[i]->stats));
+    }
+}
+
+bool KTerm_GetSessionStats(KTerm* term, int session_index, KTermSessionStats* stats) {
+    KTermSession* session = KTerm_LookupSession(term, session_index);
+    if (!session || !stats) return false;
+    *stats = session->stats;
+    return true;
+}
+
+KTermStats KTerm_GetStats(KTerm* term) {
+    KTermStats stats = {0};
+    if (!term) return stats;
+    KTERM_MUTEX_LOCK(term->render_lock); // stats.draw
+    stats = term->stats;
+    KTERM_MUTEX_UNLOCK(term->render_lock);
+    stats.bytes_uploaded = (uint64_t)atomic_load_explicit(&term->stats_uploaded, memory_order_relaxed);
+    stats.atlas_page_evictions = term->atlas_page_evictions;
+    stats.atlas_glyphs_evicted = term->atlas_glyphs_evicted;
+    for (int i = 0; i < MAX_SESSIONS && i < term->session_count; i++) {
+        stats.sessions[i] = term->sessions[i]->stats;
+    }
+    return stats;
+}
+
 void KTerm_SetKeyboardMode(KTerm* term, const char* mode, bool enable) {
     KTermSession* session = GET_SESSION(term);
     if (strcmp(mode, "application_cursor") == 0) {
@@ -15059,7 +19524,7 @@ void KTerm_QueueInputEvent(KTerm* term, KTermEvent event) {
                     KTermPane* new_pane = KTerm_SplitPane(term, current, PANE_SPLIT_VERTICAL, 0.5f);
                     if (new_pane) {
                         term->layout->focused = new_pane;
-                        if (new_pane->session_index >= 0) KTerm_SetActiveSession(term, new_pane->session_index);
+                        if (new_pane->session_index >= 0) KTerm_SetActiveSessionIndex(term, new_pane->session_index);
                     }
                 }
             } else if (event.key_code == '%') {
@@ -15068,7 +19533,7 @@ void KTerm_QueueInputEvent(KTerm* term, KTermEvent event) {
                     KTermPane* new_pane = KTerm_SplitPane(term, current, PANE_SPLIT_HORIZONTAL, 0.5f);
                     if (new_pane) {
                         term->layout->focused = new_pane;
-                        if (new_pane->session_index >= 0) KTerm_SetActiveSession(term, new_pane->session_index);
+                        if (new_pane->session_index >= 0) KTerm_SetActiveSessionIndex(term, new_pane->session_index);
                     }
                 }
             } else if (event.key_code == 'x') {
@@ -15081,34 +19546,12 @@ void KTerm_QueueInputEvent(KTerm* term, KTermEvent event) {
                             event.sequence[2] == 'C' || event.sequence[2] == 'D'
                        ))) {
                 // Cycle focus (Next) - Arrows also map to Next for basic cycling in Phase 5
-                // DFS traversal to find next leaf
-                KTermPane* stack[32];
-                int top = 0;
-                if (term->layout && term->layout->root) stack[top++] = term->layout->root;
-
-                bool found_current = false;
-                KTermPane* next_focus = NULL;
-                KTermPane* first_leaf = NULL;
-
-                while(top > 0) {
-                    KTermPane* p = stack[--top];
-                    if (p->type == PANE_LEAF) {
-                        if (!first_leaf) first_leaf = p;
-                        if (found_current) {
-                            next_focus = p;
-                            break;
-                        }
-                        if (p == current) found_current = true;
-                    } else {
-                        if (p->child_b) stack[top++] = p->child_b; // Push right first so we pop left
-                        if (p->child_a) stack[top++] = p->child_a;
-                    }
-                }
-                if (!next_focus) next_focus = first_leaf; // Wrap around
+                // Next leaf in depth-first order, wrapping around
+                KTermPane* next_focus = KTermLayout_NextLeaf(term->layout, current);
 
                 if (next_focus) {
                     term->layout->focused = next_focus;
-                    if (next_focus->session_index >= 0) KTerm_SetActiveSession(term, next_focus->session_index);
+                    if (next_focus->session_index >= 0) KTerm_SetActiveSessionIndex(term, next_focus->session_index);
                 }
             }
             return; // Consume command (action performed or invalid key in mux mode)
@@ -15117,13 +19560,17 @@ void KTerm_QueueInputEvent(KTerm* term, KTermEvent event) {
 
     // Route input to the focused pane's session if available
     if (term->layout && term->layout->focused && term->layout->focused->type == PANE_LEAF && term->layout->focused->session_index >= 0) {
-        session = &term->sessions[term->layout->focused->session_index];
+        session = term->sessions[term->layout->focused->session_index];
     } else {
         // Fallback to legacy active session
         session = GET_SESSION(term);
     }
 
-    int next_head = (session->input.buffer_head + 1) % KEY_EVENT_BUFFER_SIZE;
+    if (!session->input.buffer && !KTerm_AllocKeyEvents(term, session)) {
+        session->input.dropped_events++;
+        return;
+    }
+    int next_head = (session->input.buffer_head + 1) & session->input.buffer_mask;
 
     if (next_head != session->input.buffer_tail) {
         session->input.buffer[session->input.buffer_head] = event;
@@ -15153,7 +19600,7 @@ bool KTerm_GetKey(KTerm* term, KTermEvent* event) {
 
     *event = session->input.buffer[current_tail];
 
-    current_tail = (current_tail + 1) % KEY_EVENT_BUFFER_SIZE;
+    current_tail = (current_tail + 1) & session->input.buffer_mask;
     atomic_store_explicit(&session->input.buffer_tail, current_tail, memory_order_release);
 
     return true;
@@ -6,11 +6,15 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 // Mock Control Flags
 // Use weak linkage or static to avoid link errors in single-file usage
 typedef int SituationError;
 static bool mock_fail_texture_creation = false;
+static int mock_texture_creations = 0;       // Create/CreateEx calls that produced a texture
+static int mock_texture_region_updates = 0;  // UpdateTextureRegion calls
+static size_t mock_texture_region_pixels = 0; // Total pixels uploaded through region updates
 static char last_clipboard_text[4096]; // Buffer for verification
 
 // Mock Key State
@@ -185,6 +189,12 @@ typedef struct {
 static inline void SituationSetWindowTitle(const char* title) { (void)title; }
 static double mock_current_time = 0.0;
 static inline void MockSetTime(double t) { mock_current_time = t; }
+// Real monotonic seconds, for the benchmarks; the mocked timer only moves when a test sets it
+static inline double MockWallTime(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
 
 static inline double SituationGetFrameTime(void) { return 0.016; }
 static inline bool SituationTimerGetOscillatorState(int ms) { (void)ms; return true; }
@@ -206,6 +216,7 @@ static inline void SituationCreateTexture(SituationImage image, bool genMips, Si
     } else {
         texture->id = 1;
         texture->generation++;
+        mock_texture_creations++;
     }
 }
 static inline void SituationCreateTextureEx(SituationImage image, bool genMips, int usage, SituationTexture* texture) {
@@ -214,9 +225,17 @@ static inline void SituationCreateTextureEx(SituationImage image, bool genMips,
     } else {
         texture->id = 1;
         texture->generation++;
+        mock_texture_creations++;
     }
 }
 static inline void SituationDestroyTexture(SituationTexture* texture) { texture->id = 0; }
+static inline void SituationUpdateTexture(SituationTexture texture, SituationImage image) { (void)texture; (void)image; }
+static inline void SituationUpdateTextureRegion(SituationTexture texture, SituationImage image, int x, int y, int w, int h) {
+    (void)image; (void)x; (void)y;
+    if (texture.id == 0 || w <= 0 || h <= 0) return;
+    mock_texture_region_updates++;
+    mock_texture_region_pixels += (size_t)w * (size_t)h;
+}
 static inline void SituationCreateComputePipelineFromMemory(const char* shaderCode, int layout, SituationComputePipeline* pipeline) { pipeline->id = 1; }
 static inline void SituationDestroyComputePipeline(SituationComputePipeline* pipeline) { pipeline->id = 0; }
 static inline uint64_t SituationGetBufferDeviceAddress(SituationBuffer buffer) { return 1000; }
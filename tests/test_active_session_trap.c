@@ -35,11 +35,11 @@ int main() {
 
     // Open session 1
     KTerm_InitSession(term, 1);
-    term->sessions[1].session_open = true;
+    term->sessions[1]->session_open = true;
 
     // Call KTerm_ResizeSession_Internal directly (simulating internal call)
     // We resize session 1
-    KTermSession* session1 = &term->sessions[1];
+    KTermSession* session1 = term->sessions[1];
 
     printf("Invoking KTerm_ResizeSession_Internal for Session 1...\n");
     KTerm_ResizeSession_Internal(term, session1, 100, 30);
@@ -0,0 +1,120 @@
+#define KTERM_IMPLEMENTATION
+#define KTERM_TESTING
+#include "../kterm.h"
+#include "mock_situation.h"
+#include <assert.h>
+#include <stdio.h>
+#include <unistd.h>
+
+// The built-in fallback draws a box, so pixel (0,0) of a rendered slot is opaque.
+static unsigned char SlotAlpha(KTerm* term, uint32_t idx) {
+    return KTerm_AtlasSlotPixels(term, idx)[3];
+}
+
+static void TestPlaceholderThenFill(KTerm* term) {
+    printf("Testing placeholder-then-fill...\n");
+    assert(KTerm_SetAsyncGlyphRaster(term, true));
+
+    uint32_t idx = KTerm_AllocateGlyph(term, 0x0100);
+    assert(idx >= 256);
+    assert(KTerm_GetGlyphId(term, 0x0100) == idx);
+    // Reserved immediately, but blank until the worker result is committed
+    assert(SlotAlpha(term, idx) == 0);
+
+    KTerm_FlushGlyphRaster(term);
+    assert(SlotAlpha(term, idx) == 255);
+    assert(term->atlas_dirty_count > 0);
+
+    // Normal path: KTerm_Update commits finished glyphs
+    uint32_t idx2 = KTerm_AllocateGlyph(term, 0x0101);
+    for (int i = 0; i < 1000 && SlotAlpha(term, idx2) == 0; i++) {
+        usleep(1000); // One "frame" for the worker
+        KTerm_Update(term);
+    }
+    assert(SlotAlpha(term, idx2) == 255);
+    printf("PASS: Placeholder-then-fill\n");
+}
+
+static void TestStaleResultDropped(KTerm* term) {
+    printf("Testing stale results are dropped...\n");
+    uint32_t idx = KTerm_AllocateGlyph(term, 0x0102);
+
+    // Slot gets reassigned before the worker result lands
+    KTerm_GlyphMapSet(term, 0x0102, 0);
+    term->atlas_to_codepoint[idx] = 0x0103;
+    KTerm_FlushGlyphRaster(term);
+    assert(SlotAlpha(term, idx) == 0);
+    printf("PASS: Stale results dropped\n");
+}
+
+static void TestPrewarm(KTerm* term) {
+    printf("Testing prewarm...\n");
+    int n = KTerm_PrewarmGlyphs(term, 0x4E00, 0x4E3F);
+    assert(n == 64);
+    KTerm_FlushGlyphRaster(term);
+    for (uint32_t cp = 0x4E00; cp <= 0x4E3F; cp++) {
+        assert(KTerm_GetGlyphId(term, cp) != 0);
+        assert(SlotAlpha(term, KTerm_GetGlyphId(term, cp)) == 255);
+    }
+    // Already cached: nothing to do
+    assert(KTerm_PrewarmGlyphs(term, 0x4E00, 0x4E3F) == 0);
+
+    // Prewarm never evicts: cap the atlas at its current pages
+    term->atlas_max_pages = term->atlas_page_count;
+    uint32_t free_slots = term->atlas_slots_per_page - term->atlas_pages[term->atlas_fill_page[0]].used;
+    assert(KTerm_PrewarmGlyphs(term, 0x10000, 0x10000 + free_slots + 100) == (int)free_slots);
+    assert(term->atlas_page_evictions == 0);
+    assert(KTerm_GetGlyphId(term, 0x4E00) != 0);
+    term->atlas_max_pages = KTERM_ATLAS_MAX_PAGES;
+    printf("PASS: Prewarm\n");
+}
+
+static void TestClusterOnWorker(KTerm* term) {
+    printf("Testing clusters on the rasterizer...\n");
+    KTerm_FlushGlyphRaster(term); // Room in the queue
+    uint32_t cluster[2] = { 0x0100, 0x0301 };
+    uint32_t slot = KTerm_AllocateCluster(term, cluster, 2);
+    assert(slot >= 256 && (term->atlas_to_codepoint[slot] & KTERM_CLUSTER_SLOT_FLAG));
+    assert(SlotAlpha(term, slot) == 0);
+    KTerm_FlushGlyphRaster(term);
+    assert(SlotAlpha(term, slot) == 255);
+
+    // The cluster table is reset before the result lands
+    uint32_t other[2] = { 0x0102, 0x0301 };
+    uint32_t slot2 = KTerm_AllocateCluster(term, other, 2);
+    memset(term->cluster_map, 0, KTERM_CLUSTER_TABLE_SIZE * sizeof(KTermClusterEntry));
+    term->cluster_count = 0;
+    KTerm_FlushGlyphRaster(term);
+    assert(SlotAlpha(term, slot2) == 0);
+    printf("PASS: Clusters on the rasterizer\n");
+}
+
+static void TestDisableDrains(KTerm* term) {
+    printf("Testing disable drains the queue...\n");
+    uint32_t idx = KTerm_AllocateGlyph(term, 0x0410);
+    assert(!KTerm_SetAsyncGlyphRaster(term, false));
+    assert(SlotAlpha(term, idx) == 255);
+
+    // Inline again
+    uint32_t idx2 = KTerm_AllocateGlyph(term, 0x0411);
+    assert(SlotAlpha(term, idx2) == 255);
+    printf("PASS: Disable drains\n");
+}
+
+int main(void) {
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+
+    TestPlaceholderThenFill(term);
+    TestStaleResultDropped(term);
+    TestPrewarm(term);
+    TestClusterOnWorker(term);
+    TestDisableDrains(term);
+
+    KTerm_Cleanup(term);
+    printf("All async glyph tests passed.\n");
+    return 0;
+}
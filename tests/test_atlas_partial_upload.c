@@ -0,0 +1,70 @@
+#define KTERM_IMPLEMENTATION
+#define KTERM_TESTING
+#include "../kterm.h"
+#include "mock_situation.h"
+#include <assert.h>
+#include <stdio.h>
+
+static void feed(KTerm* term, const char* data) {
+    for (size_t i = 0; i < strlen(data); i++) {
+        KTerm_ProcessChar(term, GET_SESSION(term), data[i]);
+    }
+}
+
+static void TestPartialUpload(KTerm* term) {
+    printf("Testing partial atlas uploads...\n");
+    GET_SESSION(term)->charset.g0 = CHARSET_UTF8;
+
+    // Settle initial texture creation
+    KTerm_Update(term);
+    KTerm_Update(term);
+    assert(term->font_texture.id != 0);
+    int creations = mock_texture_creations;
+    int updates = mock_texture_region_updates;
+
+    // Four new glyphs, allocated to consecutive slots: one strip
+    feed(term, "\xC4\x80\xC4\x81\xC4\x82\xC4\x83"); // U+0100..U+0103, not in CP437
+    KTerm_Update(term);
+    assert(mock_texture_creations == creations);
+    assert(mock_texture_region_updates == updates + 1);
+    assert(mock_texture_region_pixels == 4 * DEFAULT_CHAR_WIDTH * DEFAULT_CHAR_HEIGHT);
+    assert(term->atlas_dirty_count == 0);
+
+    // Already cached glyphs upload nothing
+    feed(term, "\r\n\xC4\x80\xC4\x81");
+    KTerm_Update(term);
+    assert(mock_texture_region_updates == updates + 1);
+    assert(mock_texture_creations == creations);
+    printf("PASS: Partial atlas uploads\n");
+}
+
+static void TestOverflowFallsBackToFullUpload(KTerm* term) {
+    printf("Testing dirty slot overflow...\n");
+    int creations = mock_texture_creations;
+
+    // More distinct glyphs than KTERM_ATLAS_DIRTY_SLOTS in one frame
+    for (uint32_t i = 0; i < KTERM_ATLAS_DIRTY_SLOTS + 10; i++) {
+        KTerm_AllocateGlyph(term, 0x4E00 + i);
+    }
+    assert(term->font_atlas_dirty);
+    KTerm_Update(term);
+    assert(mock_texture_creations == creations + 1);
+    assert(!term->font_atlas_dirty);
+    assert(term->atlas_dirty_count == 0);
+    printf("PASS: Dirty slot overflow\n");
+}
+
+int main(void) {
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+
+    TestPartialUpload(term);
+    TestOverflowFallsBackToFullUpload(term);
+
+    KTerm_Cleanup(term);
+    printf("All atlas upload tests passed.\n");
+    return 0;
+}
@@ -0,0 +1,97 @@
+#define KTERM_IMPLEMENTATION
+#define KTERM_TESTING
+#include "../kterm.h"
+#include "mock_situation.h"
+#include <assert.h>
+#include <stdio.h>
+
+static void feed(KTerm* term, const char* data) {
+    for (size_t i = 0; i < strlen(data); i++) {
+        KTerm_ProcessChar(term, GET_SESSION(term), (unsigned char)data[i]);
+    }
+}
+
+static uint32_t CellAt(KTerm* term, int x, int y) {
+    KTermRenderBuffer* rb = &term->render_buffers[term->rb_front];
+    return rb->cells[y * term->width + x].char_code;
+}
+
+static void TestVisualOrder(KTerm* term) {
+    printf("Testing BiDi visual order...\n");
+    KTermSession* session = GET_SESSION(term);
+
+    // Logical: "ab " ALEF '(' BET ')' GIMEL " cd"
+    feed(term, "\x1B[?8246h\x1B[H");
+    feed(term, "ab \xD7\x90(\xD7\x91)\xD7\x92 cd");
+    KTerm_Update(term);
+    KTerm_Update(term);
+
+    // Visual: "ab " GIMEL '(' BET ')' ALEF " cd" (brackets mirrored)
+    assert(session->bidi_row_state[0] == KTERM_BIDI_ROW_MAPPED);
+    assert(CellAt(term, 0, 0) == 'a');
+    assert(CellAt(term, 2, 0) == ' ');
+    assert(CellAt(term, 3, 0) == KTerm_GetGlyphId(term, 0x05D2));
+    assert(CellAt(term, 4, 0) == '(');
+    assert(CellAt(term, 5, 0) == KTerm_GetGlyphId(term, 0x05D1));
+    assert(CellAt(term, 6, 0) == ')');
+    assert(CellAt(term, 7, 0) == KTerm_GetGlyphId(term, 0x05D0));
+    assert(CellAt(term, 9, 0) == 'c');
+
+    // The logical screen is untouched
+    assert(GetScreenCell(session, 0, 3)->ch == 0x05D0);
+    assert(GetScreenCell(session, 0, 4)->ch == '(');
+    printf("PASS: Visual order\n");
+}
+
+static void TestMapCache(KTerm* term) {
+    printf("Testing BiDi map cache...\n");
+    KTermSession* session = GET_SESSION(term);
+
+    // Static screen: no rebuilds
+    int builds = session->bidi_map_builds;
+    for (int i = 0; i < 10; i++) KTerm_Update(term);
+    assert(session->bidi_map_builds == builds);
+
+    // Changing one row rebuilds that row only
+    feed(term, "\x1B[3H\xD7\x93\xD7\x94");
+    KTerm_Update(term);
+    KTerm_Update(term);
+    assert(session->bidi_map_builds == builds + 1);
+    assert(session->bidi_row_state[2] == KTERM_BIDI_ROW_MAPPED);
+    assert(session->bidi_row_state[1] == KTERM_BIDI_ROW_LTR);
+    assert(CellAt(term, 0, 2) == KTerm_GetGlyphId(term, 0x05D4));
+    assert(CellAt(term, 1, 2) == KTerm_GetGlyphId(term, 0x05D3));
+
+    // Overwriting the RTL text restores logical order
+    feed(term, "\x1B[3Hxy");
+    KTerm_Update(term);
+    KTerm_Update(term);
+    assert(session->bidi_row_state[2] == KTERM_BIDI_ROW_LTR);
+    assert(CellAt(term, 0, 2) == 'x');
+    assert(CellAt(term, 1, 2) == 'y');
+
+    // Leaving BDSM draws the logical order
+    feed(term, "\x1B[?8246l");
+    KTerm_Update(term);
+    KTerm_Update(term);
+    assert(CellAt(term, 3, 0) == KTerm_GetGlyphId(term, 0x05D0));
+    assert(CellAt(term, 4, 0) == '(');
+    printf("PASS: Map cache\n");
+}
+
+int main(void) {
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    GET_SESSION(term)->charset.g0 = CHARSET_UTF8;
+    GET_SESSION(term)->enable_wide_chars = true;
+
+    TestVisualOrder(term);
+    TestMapCache(term);
+
+    KTerm_Destroy(term);
+    printf("All BiDi cache tests passed.\n");
+    return 0;
+}
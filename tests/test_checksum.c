@@ -0,0 +1,214 @@
+#define KTERM_IMPLEMENTATION
+#define KTERM_TESTING
+#include "../kterm.h"
+#include "mock_situation.h"
+#include <assert.h>
+#include <stdio.h>
+
+static char last_response[256];
+
+static void MockResponseCallback(KTerm* term, const char* response, int length) {
+    (void)term;
+    if (length >= (int)sizeof(last_response)) length = sizeof(last_response) - 1;
+    memcpy(last_response, response, length);
+    last_response[length] = '\0';
+}
+
+static void Run(KTerm* term, const char* data) {
+    KTerm_WriteString(term, data);
+    KTerm_Update(term);
+}
+
+// DECRQCRA computed cell by cell, without the cache
+static unsigned int ReferenceRect(KTermSession* session, int top, int left, int bottom, int right) {
+    unsigned int sum = 0;
+    for (int y = top; y <= bottom; y++) {
+        for (int x = left; x <= right; x++) sum += GetActiveScreenCell(session, y, x)->ch;
+    }
+    return sum;
+}
+
+// Every cached row must match a fresh pass over its cells
+static void VerifyCache(KTerm* term, const char* step) {
+    KTermSession* session = GET_SESSION(term);
+    uint64_t hash = KTerm_GetScreenHash(term);
+    assert(session->row_checksums && session->checksum_rows == session->rows);
+    for (int y = 0; y < session->rows; y++) {
+        KTermRowChecksum fresh;
+        KTerm_SumRow(session, y, &fresh);
+        const KTermRowChecksum* cached = &session->row_checksums[y];
+        if (!cached->valid || cached->hash != fresh.hash || cached->ch_sum != fresh.ch_sum ||
+            cached->dsr_sum != fresh.dsr_sum) {
+            printf("FAIL: stale checksum for row %d after %s\n", y, step);
+            exit(1);
+        }
+    }
+    assert(KTerm_CalculateRectChecksum(session, 0, 0, session->rows - 1, session->cols - 1) ==
+           ReferenceRect(session, 0, 0, session->rows - 1, session->cols - 1));
+
+    // Rebuilding from scratch gives the same hash
+    KTerm_FreeChecksumCache(session);
+    assert(KTerm_GetScreenHash(term) == hash);
+}
+
+static void TestInvalidation(void) {
+    printf("Testing checksum invalidation...\n");
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    config.response_callback = MockResponseCallback;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    GET_SESSION(term)->conformance.features |= KTERM_FEATURE_RECT_OPERATIONS;
+    static const struct { const char* name; const char* seq; } steps[] = {
+        { "text", "hello\r\n\x1B[1;32mworld\x1B[m" },
+        { "ED", "\x1B[5;5H\x1B[J" },
+        { "EL", "\x1B[2;3Habcdef\x1B[2;4H\x1B[K" },
+        { "ICH", "\x1B[1;1H\x1B[3@" },
+        { "DCH", "\x1B[2;1H\x1B[2P" },
+        { "IL", "\x1B[3;1H\x1B[2L" },
+        { "DL", "\x1B[1;1H\x1B[1M" },
+        { "SU", "\x1B[3S" },
+        { "SD", "\x1B[2T" },
+        { "DECSTBM scroll", "\x1B[5;10r\x1B[10;1Hline\n\n\nmore\x1B[r" },
+        { "full scroll", "\x1B[25;1H\n\n\nbottom\x1B[38;2;1;2;3mrgb\x1B[m" },
+        { "alt screen", "\x1B[?1049hALT\x1B[10;10Hscreen" },
+        { "alt screen exit", "\x1B[?1049l" },
+        { "DECFRA", "\x1B[42;2;2;4;20$x" },
+        { "DECCRA", "\x1B[2;2;4;20;1;10;30;1$v" },
+        { "DECERA", "\x1B[3;3;3;10$z" },
+        { "ECH", "\x1B[1;1H\x1B[5X" },
+        { "REP", "\x1B[20;1Hx\x1B[30b" },
+        { "DECALN", "\x1B#8" },
+        { "DECSED", "\x1B[5;5H\x1B[?J" },
+        { "DECSED 1", "\x1B[?1J" },
+        { "DECALN again", "\x1B#8" },
+        { "DECSED 2", "\x1B[?2J" },
+        { "DECALN once more", "\x1B#8" },
+        { "DECSEL", "\x1B[3;3H\x1B[?K" },
+        { "RIS", "\x1B" "c" },
+    };
+    for (size_t i = 0; i < sizeof(steps) / sizeof(steps[0]); i++) {
+        Run(term, steps[i].seq);
+        VerifyCache(term, steps[i].name);
+    }
+
+    // A resize rebuilds the cache at the new size
+    KTerm_Resize(term, 100, 30);
+    Run(term, "\x1B[30;1Hresized");
+    VerifyCache(term, "resize");
+    assert(GET_SESSION(term)->checksum_cols == 100);
+    KTerm_Destroy(term);
+    printf("PASS: Invalidation\n");
+}
+
+static void TestIncremental(void) {
+    printf("Testing incremental recomputation...\n");
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    config.response_callback = MockResponseCallback;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    GET_SESSION(term)->conformance.features |= KTERM_FEATURE_RECT_OPERATIONS;
+    KTermSession* session = GET_SESSION(term);
+    Run(term, "some text\r\nmore text");
+    KTerm_GetScreenHash(term);
+    int builds = session->checksum_row_builds;
+    assert(builds >= 25);
+
+    // Polling an unchanged screen sums nothing
+    KTerm_GetScreenHash(term);
+    Run(term, "\x1B[1;1;1;1;25;80*y");
+    assert(session->checksum_row_builds == builds);
+
+    // One changed row sums one row
+    Run(term, "\x1B[12;1Hx");
+    KTerm_GetScreenHash(term);
+    assert(session->checksum_row_builds == builds + 1);
+    KTerm_Destroy(term);
+    printf("PASS: Incremental\n");
+}
+
+static void TestResponses(void) {
+    printf("Testing DECRQCRA and DSR 63 responses...\n");
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    config.response_callback = MockResponseCallback;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    GET_SESSION(term)->conformance.features |= KTERM_FEATURE_RECT_OPERATIONS;
+    KTermSession* session = GET_SESSION(term);
+    Run(term, "AB\r\nC");
+
+    // Full screen: the cached path
+    char expected[64];
+    snprintf(expected, sizeof(expected), "\x1BP7!~%04X\x1B\\", ReferenceRect(session, 0, 0, 24, 79) & 0xFFFF);
+    Run(term, "\x1B[7;1;1;1;25;80*y");
+    assert(strcmp(last_response, expected) == 0);
+
+    // A partial rectangle walks the cells: 'B' + blanks
+    snprintf(expected, sizeof(expected), "\x1BP8!~%04X\x1B\\", ReferenceRect(session, 0, 1, 1, 2) & 0xFFFF);
+    Run(term, "\x1B[8;1;1;2;2;3*y");
+    assert(strcmp(last_response, expected) == 0);
+
+    // DSR 63: end-around-carry sum of codepoints and colors
+    uint64_t sum = 0;
+    for (int y = 0; y < session->rows; y++) {
+        for (int x = 0; x < session->cols; x++) {
+            EnhancedTermChar* cell = GetActiveScreenCell(session, y, x);
+            sum += cell->ch + KTerm_ChecksumColor(&cell->fg_color) + KTerm_ChecksumColor(&cell->bg_color);
+        }
+    }
+    while (sum >> 16) sum = (sum >> 16) + (sum & 0xFFFF);
+    snprintf(expected, sizeof(expected), "\x1B[?63;1;%d;%04Xn", session->checksum.algorithm, (unsigned)sum);
+    Run(term, "\x1B[?63;1n");
+    assert(strcmp(last_response, expected) == 0);
+    KTerm_Destroy(term);
+    printf("PASS: Responses\n");
+}
+
+static void BenchPolling(void) {
+    printf("Benchmarking checksum polling...\n");
+    KTermConfig config = {0};
+    config.width = 200;
+    config.height = 60;
+    config.response_callback = MockResponseCallback;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    GET_SESSION(term)->conformance.features |= KTERM_FEATURE_RECT_OPERATIONS;
+    KTermSession* session = GET_SESSION(term);
+    for (int i = 0; i < 60; i++) KTerm_WriteFormat(term, "\x1B[3%dmrow %d of the benchmark screen\x1B[m\r\n", i % 8, i);
+    KTerm_Update(term);
+
+    const int polls = 2000;
+    volatile uint64_t sink = 0;
+    double start = MockWallTime();
+    for (int i = 0; i < polls; i++) {
+        KTerm_FreeChecksumCache(session);
+        sink += KTerm_GetScreenHash(term);
+    }
+    double full = (MockWallTime() - start) / polls;
+
+    start = MockWallTime();
+    for (int i = 0; i < polls; i++) {
+        // A status line changes between polls
+        KTerm_MarkRowDirty(session, 59);
+        sink += KTerm_GetScreenHash(term);
+    }
+    double cached = (MockWallTime() - start) / polls;
+    (void)sink;
+    printf("  200x60: full pass %.1f us, one dirty row %.2f us (%.0fx)\n", full * 1e6, cached * 1e6, full / cached);
+    KTerm_Destroy(term);
+    printf("PASS: Polling benchmark\n");
+}
+
+int main(void) {
+    TestInvalidation();
+    TestIncremental();
+    TestResponses();
+    BenchPolling();
+    printf("All checksum tests passed.\n");
+    return 0;
+}
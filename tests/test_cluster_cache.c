@@ -0,0 +1,122 @@
+#define KTERM_IMPLEMENTATION
+#define KTERM_TESTING
+#include "../kterm.h"
+#include "mock_situation.h"
+#include <assert.h>
+#include <stdio.h>
+
+static void feed(KTerm* term, const char* data) {
+    for (size_t i = 0; i < strlen(data); i++) {
+        KTerm_ProcessChar(term, GET_SESSION(term), data[i]);
+    }
+}
+
+static uint32_t CellGlyph(KTerm* term, int x, int y) {
+    KTermRenderBuffer* rb = &term->render_buffers[term->rb_front];
+    return rb->cells[y * term->width + x].char_code;
+}
+
+static void TestClusterRendersAsOneGlyph(KTerm* term) {
+    printf("Testing cluster glyph lookup...\n");
+    // "e" + COMBINING ACUTE ACCENT, twice on the same row, once on the next
+    feed(term, "e\xCC\x81 e\xCC\x81\r\ne\xCC\x81");
+    KTerm_Update(term);
+
+    uint32_t slot = CellGlyph(term, 0, 0);
+    assert(slot >= 256);
+    assert(term->atlas_to_codepoint[slot] & KTERM_CLUSTER_SLOT_FLAG);
+    assert(term->cluster_count == 1);
+    assert(CellGlyph(term, 2, 0) == slot);
+    assert(CellGlyph(term, 0, 1) == slot);
+
+    // Bitmap font: the composed cell is the base glyph
+    unsigned char* a = KTerm_AtlasSlotPixels(term, slot);
+    unsigned char* b = KTerm_AtlasSlotPixels(term, 'e');
+    for (int y = 0; y < DEFAULT_CHAR_HEIGHT; y++) {
+        assert(memcmp(&a[y * term->atlas_width * 4], &b[y * term->atlas_width * 4], DEFAULT_CHAR_WIDTH * 4) == 0);
+    }
+
+    // A different mark is a different cluster
+    uint32_t grave[2] = { 'e', 0x0300 };
+    uint32_t slot2 = KTerm_AllocateCluster(term, grave, 2);
+    assert(slot2 != slot);
+    assert(term->cluster_count == 2);
+
+    // Single codepoints bypass the cluster table
+    uint32_t single[1] = { 0x0100 };
+    assert(KTerm_AllocateCluster(term, single, 1) == KTerm_AllocateGlyph(term, 0x0100));
+    assert(term->cluster_count == 2);
+    printf("PASS: Cluster glyph lookup\n");
+}
+
+static void TestSharedAcrossSessions(KTerm* term) {
+    printf("Testing cluster reuse across sessions...\n");
+    uint32_t acute[2] = { 'e', 0x0301 };
+    uint32_t slot = KTerm_AllocateCluster(term, acute, 2);
+    int count = term->cluster_count;
+
+    KTerm_SetActiveSession(term, 1);
+    GET_SESSION(term)->charset.g0 = CHARSET_UTF8;
+    GET_SESSION(term)->enable_wide_chars = true;
+    feed(term, "e\xCC\x81");
+    KTerm_Update(term);
+    assert(term->cluster_count == count);
+    assert(KTerm_AllocateCluster(term, acute, 2) == slot);
+    KTerm_SetActiveSession(term, 0);
+    printf("PASS: Cluster reuse across sessions\n");
+}
+
+static void TestEvictedClusterRefills(KTerm* term) {
+    printf("Testing evicted cluster refills...\n");
+    uint32_t acute[2] = { 'e', 0x0301 };
+    uint32_t slot = KTerm_AllocateCluster(term, acute, 2);
+    int count = term->cluster_count;
+    assert(slot >= 256);
+
+    // One page allowed and it is full: the next glyph evicts the whole page
+    term->atlas_max_pages = term->atlas_page_count;
+    term->atlas_pages[0].used = term->atlas_slots_per_page;
+    term->frame_count++;
+    uint32_t taken = KTerm_AllocateGlyph(term, 0x0101);
+    assert(term->atlas_page_evictions == 1);
+    assert(taken == 256); // First dynamic slot of the emptied page
+    assert(KTerm_GetGlyphId(term, 0x0101) == taken);
+    assert(KTerm_GetGlyphId(term, 0x0100) == 0);
+
+    // Same cluster again: same table entry, new slot
+    uint32_t again = KTerm_AllocateCluster(term, acute, 2);
+    assert(again != taken && again >= 256);
+    assert(term->cluster_count == count);
+    assert(term->atlas_to_codepoint[again] & KTERM_CLUSTER_SLOT_FLAG);
+
+    // The next page eviction clears both kinds of owner
+    term->atlas_pages[0].used = term->atlas_slots_per_page;
+    term->frame_count++;
+    KTerm_AllocateGlyph(term, 0x0102);
+    assert(term->atlas_page_evictions == 2);
+    assert(KTerm_GetGlyphId(term, 0x0101) == 0);
+    uint32_t refill = KTerm_AllocateCluster(term, acute, 2);
+    assert(refill != KTerm_GetGlyphId(term, 0x0102));
+    assert(term->atlas_to_codepoint[refill] & KTERM_CLUSTER_SLOT_FLAG);
+    assert(term->cluster_count == count);
+    term->atlas_max_pages = KTERM_ATLAS_MAX_PAGES;
+    printf("PASS: Evicted cluster refills\n");
+}
+
+int main(void) {
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    GET_SESSION(term)->charset.g0 = CHARSET_UTF8;
+    GET_SESSION(term)->enable_wide_chars = true;
+
+    TestClusterRendersAsOneGlyph(term);
+    TestSharedAcrossSessions(term);
+    TestEvictedClusterRefills(term);
+
+    KTerm_Cleanup(term);
+    printf("All cluster cache tests passed.\n");
+    return 0;
+}
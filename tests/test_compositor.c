@@ -15,7 +15,7 @@ void mock_response(KTerm* term, const char* response, int length) {
 
 // Helper to fill session with a char
 void fill_session(KTerm* term, int session_idx, char c) {
-    KTermSession* s = &term->sessions[session_idx];
+    KTermSession* s = term->sessions[session_idx];
     for(int y=0; y<s->rows; y++) {
         for(int x=0; x<s->cols; x++) {
             EnhancedTermChar* cell = GetActiveScreenCell(s, y, x);
@@ -19,7 +19,7 @@ int main() {
     printf("Testing Conceal Character Code...\n");
 
     // 1. Check Default
-    KTermSession* session = &term->sessions[term->active_session];
+    KTermSession* session = term->sessions[term->active_session];
     if (session->conceal_char_code == 0) {
         printf("PASS: Default conceal_char_code is 0\n");
     } else {
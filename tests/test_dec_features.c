@@ -87,32 +87,32 @@ void test_deccolm(void) {
 
     // 2. Enable Mode 40 (Allow 80/132)
     write_sequence(term, "\x1B[?40h");
-    assert(term->sessions[0].dec_modes & KTERM_MODE_ALLOW_80_132);
+    assert(term->sessions[0]->dec_modes & KTERM_MODE_ALLOW_80_132);
 
     // 3. Resize to 132 via DECCOLM
     write_sequence(term, "\x1B[?3h");
-    assert(term->sessions[0].cols == 132);
+    assert(term->sessions[0]->cols == 132);
 
     // Verify cursor reset (side effect)
-    term->sessions[0].cursor.x = 10;
-    term->sessions[0].cursor.y = 10;
+    term->sessions[0]->cursor.x = 10;
+    term->sessions[0]->cursor.y = 10;
 
     // 4. Resize to 80 via DECCOLM
     write_sequence(term, "\x1B[?3l");
-    assert(term->sessions[0].cols == 80);
+    assert(term->sessions[0]->cols == 80);
     // Cursor should be homed
-    assert(term->sessions[0].cursor.x == 0);
-    assert(term->sessions[0].cursor.y == 0);
+    assert(term->sessions[0]->cursor.x == 0);
+    assert(term->sessions[0]->cursor.y == 0);
 
     // 5. Test DECSCPP (CSI 132 $ |)
     write_sequence(term, "\x1B[132$|");
-    assert(term->sessions[0].cols == 132);
-    assert(term->sessions[0].dec_modes & KTERM_MODE_DECCOLM);
+    assert(term->sessions[0]->cols == 132);
+    assert(term->sessions[0]->dec_modes & KTERM_MODE_DECCOLM);
 
     // 6. Test DECSCPP (CSI 80 $ |)
     write_sequence(term, "\x1B[80$|");
-    assert(term->sessions[0].cols == 80);
-    assert(!(term->sessions[0].dec_modes & KTERM_MODE_DECCOLM));
+    assert(term->sessions[0]->cols == 80);
+    assert(!(term->sessions[0]->dec_modes & KTERM_MODE_DECCOLM));
 
     // 7. Test DECNCSM (No Clear Screen)
     // Write some text at 0,0
@@ -120,8 +120,8 @@ void test_deccolm(void) {
     KTerm_ProcessEvents(term);
 
     // Move cursor manually
-    term->sessions[0].cursor.x = 5;
-    term->sessions[0].cursor.y = 5;
+    term->sessions[0]->cursor.x = 5;
+    term->sessions[0]->cursor.y = 5;
 
     // Enable DECNCSM (CSI ? 95 h)
     write_sequence(term, "\x1B[?95h");
@@ -129,10 +129,10 @@ void test_deccolm(void) {
     // Resize to 132
     write_sequence(term, "\x1B[132$|");
 
-    assert(term->sessions[0].cols == 132);
+    assert(term->sessions[0]->cols == 132);
     // Cursor should NOT be homed
-    assert(term->sessions[0].cursor.x == 5);
-    assert(term->sessions[0].cursor.y == 5);
+    assert(term->sessions[0]->cursor.x == 5);
+    assert(term->sessions[0]->cursor.y == 5);
 
     // Check if text persists (cell 0,0 should have 'H')
     check_cell(term, 0, 0, 'H', "DECNCSM Text Persistence");
@@ -222,7 +222,7 @@ void test_decdld(void) {
     };
     KTerm* term = KTerm_Create(config);
     if (!KTerm_Init(term)) { printf("Init failed\n"); exit(1); }
-    KTermSession* session = &term->sessions[term->active_session];
+    KTermSession* session = term->sessions[term->active_session];
 
     // DECDLD Sequence
     const char* decdld = "\x1BP1;33;1{@A/B\x1B\\";
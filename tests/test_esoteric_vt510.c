@@ -56,7 +56,7 @@ void Test_DECARR(KTerm* term) {
     KTerm_WriteString(term, "\x1B[15 r");
     KTerm_Update(term);
 
-    KTermSession* s = &term->sessions[0];
+    KTermSession* s = term->sessions[0];
     // We need to inspect internal state. Since it's a single header included, we can access if struct definition is visible.
     // kterm.h exposes the struct.
     // We expect a new field auto_repeat_rate.
@@ -90,7 +90,7 @@ void Test_DECRQDE(KTerm* term) {
 
 void Test_DECST8C(KTerm* term) {
     printf("Testing DECST8C (CSI ? 5 W)...\n");
-    KTermSession* s = &term->sessions[0];
+    KTermSession* s = term->sessions[0];
 
     // Mess up tabs
     KTerm_ClearAllTabStops(term);
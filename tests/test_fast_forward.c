@@ -0,0 +1,242 @@
+#define KTERM_IMPLEMENTATION
+#define KTERM_TESTING
+#include "../kterm.h"
+#include "mock_situation.h"
+#include <assert.h>
+#include <stdio.h>
+
+// Sessions 1 and 2 are open but not shown; session 1 fast-forwards
+static void OpenHiddenSessions(KTerm* term) {
+    KTerm_CreateSession(term);
+    KTerm_CreateSession(term);
+    for (int i = 1; i <= 2; i++) {
+        // Few enough bytes per frame that the op queue of the normal path never fills
+        term->sessions[i]->VTperformance.chars_per_frame = 4096;
+        term->sessions[i]->VTperformance.time_budget = 1.0;
+    }
+    KTerm_SetSessionFastForward(term, 1, true);
+}
+
+static void Feed(KTerm* term, int index, const char* data, size_t len) {
+    size_t sent = 0;
+    while (sent < len) {
+        unsigned char *p1, *p2;
+        size_t len1, len2;
+        KTerm_PipelineReserve(term, index, &p1, &len1, &p2, &len2);
+        size_t n = (len - sent < len1) ? len - sent : len1;
+        memcpy(p1, data + sent, n);
+        KTerm_PipelineCommit(term, index, n);
+        sent += n;
+        KTerm_Update(term);
+    }
+}
+
+static void Drain(KTerm* term) {
+    for (int i = 1; i <= 2; i++) {
+        KTermSession* s = term->sessions[i];
+        while (s->pipeline_head != s->pipeline_tail || s->op_queue.count > 0) KTerm_Update(term);
+    }
+}
+
+static bool SameColor(ExtendedKTermColor a, ExtendedKTermColor b) {
+    if (a.color_mode != b.color_mode) return false;
+    if (a.color_mode == 0) return a.value.index == b.value.index;
+    return a.value.rgb.r == b.value.rgb.r && a.value.rgb.g == b.value.rgb.g && a.value.rgb.b == b.value.rgb.b;
+}
+
+// Every row of the ring, scrollback included, in logical order. Blank cells are compared by
+// character only: the queued path clears scrolled-in lines with the SGR state of its flush.
+static void AssertSameGrid(KTermSession* a, KTermSession* b) {
+    assert(a->screen_head == b->screen_head && a->buffer_height == b->buffer_height);
+    assert(a->cursor.x == b->cursor.x && a->cursor.y == b->cursor.y);
+    for (int y = -(a->buffer_height - a->rows); y < a->rows; y++) {
+        EnhancedTermChar* ra = GetActiveScreenRow(a, y);
+        EnhancedTermChar* rb = GetActiveScreenRow(b, y);
+        for (int x = 0; x < a->cols; x++) {
+            assert(ra[x].ch == rb[x].ch);
+            if (ra[x].ch == ' ') continue;
+            assert((ra[x].flags & ~KTERM_FLAG_DIRTY) == (rb[x].flags & ~KTERM_FLAG_DIRTY));
+            assert(SameColor(ra[x].fg_color, rb[x].fg_color) && SameColor(ra[x].bg_color, rb[x].bg_color));
+        }
+    }
+}
+
+static size_t BuildLog(char* buf, size_t cap, int lines) {
+    size_t n = 0;
+    for (int i = 0; i < lines && n + 256 < cap; i++) {
+        n += (size_t)snprintf(buf + n, cap - n, "\x1B[3%dm%06d\x1B[m compiling src/module_%04d.c -O2 -Wall\r\n", i % 8, i, i % 1000);
+        // A wrapped line and a progress bar redrawn in place
+        if (i % 17 == 0) {
+            for (int k = 0; k < 130 && n + 1 < cap; k++) buf[n++] = (char)('a' + k % 26);
+            n += (size_t)snprintf(buf + n, cap - n, "\r\n");
+        }
+        if (i % 23 == 0) n += (size_t)snprintf(buf + n, cap - n, "[ 10%%]\r[ 50%%]\r[100%%]\x1B[K\r\n");
+    }
+    return n;
+}
+
+// Plain output, with wrapped lines and a counter redrawn in place
+static size_t BuildPlain(char* buf, size_t cap, int lines) {
+    size_t n = 0;
+    for (int i = 0; i < lines && n + 256 < cap; i++) {
+        n += (size_t)snprintf(buf + n, cap - n, "%06d compiling src/module_%04d.c -O2 -Wall\r\n", i, i % 1000);
+        if (i % 7 == 0) {
+            for (int k = 0; k < 200; k++) buf[n++] = (char)('A' + k % 26);
+            n += (size_t)snprintf(buf + n, cap - n, "\r\n");
+        }
+        if (i % 11 == 0) n += (size_t)snprintf(buf + n, cap - n, "1/3\r2/3\r3/3\r\n");
+    }
+    return n;
+}
+
+static void TestSameResult(void) {
+    printf("Testing fast-forward against the normal path...\n");
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 24;
+    config.scrollback_lines = 200;
+    KTerm* term = KTerm_Create(config);
+    OpenHiddenSessions(term);
+    static char log[1 << 20];
+    size_t len = BuildLog(log, sizeof(log), 2000);
+
+    // Full-screen scrolling into the scrollback
+    Feed(term, 1, log, len);
+    Feed(term, 2, log, len);
+    Drain(term);
+    assert(term->sessions[1]->fast_forwarding && !term->sessions[2]->fast_forwarding);
+    AssertSameGrid(term->sessions[1], term->sessions[2]);
+
+    // Plain text parsed in large runs: lines that scroll out of the history are never written
+    term->sessions[1]->VTperformance.chars_per_frame = term->sessions[1]->pipeline_mask + 1;
+    static char plain[1 << 20];
+    size_t plain_len = BuildPlain(plain, sizeof(plain), 3000);
+    Feed(term, 1, plain, plain_len);
+    Feed(term, 2, plain, plain_len);
+    Drain(term);
+    AssertSameGrid(term->sessions[1], term->sessions[2]);
+
+    // A margin region with a status line below, line drawing, tabs and UTF-8
+    const char* setup = "\x1B[2J\x1B[H\x1B[24;1Hstatus\x1B[3;20r\x1B[20;1H\x1B(0lqqk\x1B(B\tx\t\xC3\xA9t\xC3\xA9\r\n";
+    Feed(term, 1, setup, strlen(setup));
+    Feed(term, 2, setup, strlen(setup));
+    Feed(term, 1, log, len);
+    Feed(term, 2, log, len);
+    Drain(term);
+    AssertSameGrid(term->sessions[1], term->sessions[2]);
+    assert(term->sessions[1]->fast_forward_scroll == 0);
+
+    // A region of one line, then back to the full screen
+    const char* tail = "\x1B[5;5r\x1B[5;1Hone\r\ntwo\r\nthree\x1B[r\x1B[24;1H\r\nend";
+    Feed(term, 1, tail, strlen(tail));
+    Feed(term, 2, tail, strlen(tail));
+    Drain(term);
+    AssertSameGrid(term->sessions[1], term->sessions[2]);
+    assert(GetScreenCell(term->sessions[1], 23, 0)->ch == 'e');
+    KTerm_Destroy(term);
+    printf("PASS: Same result\n");
+}
+
+static void TestDirtyOnReveal(void) {
+    printf("Testing dirty tracking and reveal...\n");
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 24;
+    config.scrollback_lines = 200;
+    KTerm* term = KTerm_Create(config);
+    OpenHiddenSessions(term);
+    KTermSession* hidden = term->sessions[1];
+    KTerm_Update(term);
+    memset(hidden->row_dirty, 0, (size_t)hidden->rows);
+    hidden->dirty_rect = (KTermRect){0, 0, 0, 0};
+
+    const char* text = "hidden output\r\nmore\r\n";
+    Feed(term, 1, text, strlen(text));
+    Drain(term);
+    assert(GetScreenCell(hidden, 0, 0)->ch == 'h' && GetScreenCell(hidden, 1, 3)->ch == 'e');
+    for (int y = 0; y < hidden->rows; y++) assert(hidden->row_dirty[y] == 0);
+    assert(hidden->dirty_rect.w == 0 && hidden->op_queue.count == 0);
+    assert(hidden->fast_forward_stale);
+
+    // Shown in the split: marked dirty once, then parsed normally
+    KTerm_SetSplitScreen(term, true, 12, 0, 1);
+    memset(hidden->row_dirty, 0, (size_t)hidden->rows);
+    KTerm_Update(term);
+    assert(!hidden->fast_forwarding && !hidden->fast_forward_stale);
+    for (int y = 0; y < hidden->rows; y++) assert(hidden->row_dirty[y] == KTERM_DIRTY_FRAMES);
+    assert(hidden->dirty_rect.w == hidden->cols && hidden->dirty_rect.h == hidden->rows);
+
+    // Hidden again: the state is settled when the session next has work
+    KTerm_SetSplitScreen(term, false, 0, 0, 0);
+    Feed(term, 1, "x", 1);
+    assert(hidden->fast_forwarding);
+    // Turning it off wakes the session
+    KTerm_SetSessionFastForward(term, 1, false);
+    KTerm_Update(term);
+    assert(!hidden->fast_forwarding);
+    KTerm_Destroy(term);
+    printf("PASS: Reveal\n");
+}
+
+static double MeasureHidden(int index, const char* data, size_t len, int rounds) {
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 24;
+    config.scrollback_lines = 200;
+    KTerm* term = KTerm_Create(config);
+    OpenHiddenSessions(term);
+    KTermSession* session = term->sessions[index];
+    session->VTperformance.chars_per_frame = session->pipeline_mask + 1;
+    double start = MockWallTime();
+    for (int r = 0; r < rounds; r++) {
+        size_t sent = 0;
+        while (sent < len) {
+            unsigned char *p1, *p2;
+            size_t len1, len2;
+            KTerm_PipelineReserve(term, index, &p1, &len1, &p2, &len2);
+            size_t n = (len - sent < len1) ? len - sent : len1;
+            memcpy(p1, data + sent, n);
+            KTerm_PipelineCommit(term, index, n);
+            sent += n;
+            KTerm_Update(term);
+        }
+        while (session->pipeline_head != session->pipeline_tail) KTerm_Update(term);
+    }
+    double elapsed = MockWallTime() - start;
+    KTerm_Destroy(term);
+    return elapsed;
+}
+
+static void BenchOne(const char* name, const char* log, size_t len) {
+    const int rounds = 8;
+    double mb = (double)len * rounds / (1024.0 * 1024.0);
+    static char copy[1 << 20];
+    double start = MockWallTime();
+    for (int r = 0; r < rounds; r++) {
+        memcpy(copy, log, len);
+        copy[r] ^= 1; // Keep the copies from being folded away
+    }
+    double memcpy_time = MockWallTime() - start;
+    double fast = MeasureHidden(1, log, len, rounds);
+    double normal = MeasureHidden(2, log, len, rounds);
+    printf("  %s, %.1f MB: memcpy %.1f ms, fast-forward %.1f ms (%.0f MB/s), normal %.1f ms (%.0f MB/s)\n", name, mb,
+           memcpy_time * 1e3, fast * 1e3, mb / fast, normal * 1e3, mb / normal);
+    assert(fast < normal);
+}
+
+static void BenchHiddenThroughput(void) {
+    printf("Benchmarking a hidden log tail...\n");
+    static char log[1 << 20];
+    BenchOne("colored", log, BuildLog(log, sizeof(log), 20000));
+    // Plain text collapses the lines that scroll out of the history
+    BenchOne("plain", log, BuildPlain(log, sizeof(log), 20000));
+    printf("PASS: Hidden throughput\n");
+}
+
+int main(void) {
+    TestSameResult();
+    TestDirtyOnReveal();
+    BenchHiddenThroughput();
+    printf("All fast-forward tests passed.\n");
+    return 0;
+}
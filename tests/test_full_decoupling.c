@@ -17,7 +17,7 @@ void test_insert_lines_decoupled(void) {
     config.width = 20;
     config.height = 10;
     KTerm* term = KTerm_Create(config);
-    KTermSession* session = &term->sessions[term->active_session];
+    KTermSession* session = term->sessions[term->active_session];
     
     // 1. Fill screen with 'A'
     for(int i=0; i<term->height * term->width; i++) {
@@ -63,7 +63,7 @@ void test_resize_decoupled(void) {
     config.height = 10;
     KTerm* term = KTerm_Create(config);
     KTerm_SetSessionResizeCallback(term, mock_resize_callback);
-    KTermSession* session = &term->sessions[term->active_session];
+    KTermSession* session = term->sessions[term->active_session];
 
     int old_cols = session->cols;
     assert(old_cols == 20);
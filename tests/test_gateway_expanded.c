@@ -18,7 +18,7 @@ int main() {
     KTerm* term = KTerm_Create(config);
     assert(term != NULL);
 
-    KTermSession* session = &term->sessions[0];
+    KTermSession* session = term->sessions[0];
 
     // 1. Test existing SET LEVEL
     KTerm_WriteString(term, "\x1BPGATE;KTERM;0;SET;LEVEL;100\x1B\\");
@@ -18,21 +18,21 @@ int main() {
     term = KTerm_Create(config);
 
     // Initialize Session 1 (Session 0 is default active)
-    if (!term->sessions[1].session_open) {
+    if (!term->sessions[1]->session_open) {
         KTerm_InitSession(term, 1);
-        term->sessions[1].session_open = true;
+        term->sessions[1]->session_open = true;
     }
 
     // Set level to XTERM for Sixel support
-    KTerm_SetLevel(term, &term->sessions[0], VT_LEVEL_XTERM);
-    KTerm_SetLevel(term, &term->sessions[1], VT_LEVEL_XTERM);
+    KTerm_SetLevel(term, term->sessions[0], VT_LEVEL_XTERM);
+    KTerm_SetLevel(term, term->sessions[1], VT_LEVEL_XTERM);
 
     printf("Testing Gateway Sixel Integration...\n");
 
     // 1. Verify Default State
     assert(term->sixel_target_session == -1);
-    assert(!term->sessions[0].sixel.active);
-    assert(!term->sessions[1].sixel.active);
+    assert(!term->sessions[0]->sixel.active);
+    assert(!term->sessions[1]->sixel.active);
 
     // 2. Set Sixel Target to Session 1 via Gateway
     const char* set_target_seq = "\x1BPGATE;KTERM;0;SET;SIXEL_SESSION;1\x1B\\";
@@ -51,15 +51,15 @@ int main() {
     ProcessString(sixel_seq);
 
     // 4. Verify Routing
-    if (term->sessions[0].sixel.active) {
+    if (term->sessions[0]->sixel.active) {
         printf("FAIL: Sixel active on Session 0 (Source) - Should be routed\n");
         return 1;
     }
-    if (!term->sessions[1].sixel.active) {
+    if (!term->sessions[1]->sixel.active) {
         printf("FAIL: Sixel NOT active on Session 1 (Target)\n");
         return 1;
     }
-    if (term->sessions[1].sixel.strip_count == 0) {
+    if (term->sessions[1]->sixel.strip_count == 0) {
         printf("FAIL: No Sixel strips on Session 1\n");
         return 1;
     }
@@ -73,7 +73,7 @@ int main() {
     // active flag is usually not cleared by reset directly (it resets parse state/buffers),
     // but KTerm_InitSixelGraphics clears active.
     // KTerm_ResetGraphics calls KTerm_InitSixelGraphics.
-    if (term->sessions[1].sixel.active) {
+    if (term->sessions[1]->sixel.active) {
         printf("FAIL: RESET;SIXEL did not deactivate Sixel on Session 1\n");
         return 1;
     }
@@ -84,7 +84,7 @@ int main() {
     // We expect it to be clean.
     const char* init_sixel_seq = "\x1BPGATE;KTERM;0;INIT;SIXEL_SESSION\x1B\\";
     ProcessString(init_sixel_seq);
-    if (term->sessions[1].sixel.active) {
+    if (term->sessions[1]->sixel.active) {
         printf("FAIL: INIT;SIXEL_SESSION should leave active=false (init state)\n");
         return 1;
     }
@@ -102,7 +102,7 @@ int main() {
 
     // 8. Verify Sixel goes to Session 0 (Active) after target reset
     ProcessString(sixel_seq);
-    if (!term->sessions[0].sixel.active) {
+    if (!term->sessions[0]->sixel.active) {
         printf("FAIL: Sixel should be on Session 0 after target reset\n");
         return 1;
     }
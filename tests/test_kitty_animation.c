@@ -0,0 +1,114 @@
+#define KTERM_IMPLEMENTATION
+#define KTERM_TESTING
+#include "../kterm.h"
+#include "mock_situation.h"
+#include <assert.h>
+#include <stdio.h>
+
+// Mock frame time is fixed at 16ms per KTerm_Update.
+
+static void feed(KTerm* term, const char* data) {
+    for (size_t i = 0; i < strlen(data); i++) {
+        KTerm_ProcessChar(term, GET_SESSION(term), data[i]);
+    }
+}
+
+static void TestScheduler(KTerm* term) {
+    printf("Testing animation scheduler...\n");
+    KTermSession* session = GET_SESSION(term);
+
+    // Many static images: nothing to schedule
+    char buf[128];
+    for (int i = 100; i < 300; i++) {
+        snprintf(buf, sizeof(buf), "\x1B_Ga=T,i=%d,s=1,v=1;AAAAAA==\x1B\\", i);
+        feed(term, buf);
+    }
+    assert(session->kitty.anim_count == 0);
+
+    // Two-frame image: frame 0 uses the default 40ms, frame 1 is 100ms
+    feed(term, "\x1B_Ga=T,i=1,s=1,v=1;AAAAAA==\x1B\\");
+    feed(term, "\x1B_Ga=f,i=1,s=1,v=1,z=100;AAAAAA==\x1B\\");
+    KittyImageBuffer* img = KTerm_KittyFindImage(&session->kitty, 1);
+    assert(img->frame_count == 2);
+    assert(session->kitty.anim_count == 1);
+    assert(img->current_frame == 0);
+
+    // 2 frames = 32ms: not due yet
+    KTerm_Update(term);
+    KTerm_Update(term);
+    assert(img->current_frame == 0);
+
+    // 3 frames = 48ms: frame 1
+    KTerm_Update(term);
+    assert(img->current_frame == 1);
+    assert(session->kitty.anim_count == 1);
+
+    // Frame 1 is due at 140ms (9 updates = 144ms)
+    for (int i = 0; i < 5; i++) KTerm_Update(term);
+    assert(img->current_frame == 1);
+    KTerm_Update(term);
+    assert(img->current_frame == 0);
+
+    // Hidden images stop being scheduled
+    img->visible = false;
+    for (int i = 0; i < 10; i++) KTerm_Update(term);
+    assert(session->kitty.anim_count == 0);
+    int frame_when_hidden = img->current_frame;
+    for (int i = 0; i < 10; i++) KTerm_Update(term);
+    assert(img->current_frame == frame_when_hidden);
+
+    // Re-placing resumes it
+    feed(term, "\x1B_Ga=p,i=1;\x1B\\");
+    assert(session->kitty.anim_count == 1);
+    printf("PASS: Animation scheduler\n");
+}
+
+static void TestRenderOpCache(KTerm* term) {
+    printf("Testing render op cache...\n");
+    KTermSession* session = GET_SESSION(term);
+
+    feed(term, "\x1B_Ga=d,d=a;\x1B\\");
+    feed(term, "\x1B_Ga=T,i=1,s=1,v=1;AAAAAA==\x1B\\");
+    feed(term, "\x1B_Ga=T,i=2,s=1,v=1;AAAAAA==\x1B\\");
+
+    KTerm_Update(term);
+    int rebuilds = session->kitty.render_op_rebuilds;
+    assert(term->render_buffers[term->rb_front].kitty_count == 2);
+
+    // Nothing changed: ops are reused
+    for (int i = 0; i < 10; i++) KTerm_Update(term);
+    assert(session->kitty.render_op_rebuilds == rebuilds);
+    assert(term->render_buffers[term->rb_front].kitty_count == 2);
+
+    // A placement change rebuilds once
+    feed(term, "\x1B_Ga=p,i=2,p=5,x=8,y=8;\x1B\\");
+    KTerm_Update(term);
+    KTerm_Update(term);
+    assert(session->kitty.render_op_rebuilds == rebuilds + 1);
+    assert(term->render_buffers[term->rb_front].kitty_count == 3);
+
+    // Layout change reindexes the panes and invalidates the op cache
+    unsigned int gen = term->layout->generation;
+    KTerm_Resize(term, 100, 30);
+    assert(term->layout->generation != gen);
+    KTerm_Update(term);
+    assert(KTermLayout_FindSessionPane(term->layout, 0) == term->layout->root);
+    assert(term->layout->indexed_generation == term->layout->generation);
+    assert(session->kitty.render_op_rebuilds == rebuilds + 2);
+    printf("PASS: Render op cache\n");
+}
+
+int main(void) {
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+
+    TestScheduler(term);
+    TestRenderOpCache(term);
+
+    KTerm_Cleanup(term);
+    printf("All Kitty animation tests passed.\n");
+    return 0;
+}
@@ -0,0 +1,130 @@
+#define KTERM_IMPLEMENTATION
+#define KTERM_TESTING
+#include "../kterm.h"
+#include "mock_situation.h"
+#include <assert.h>
+#include <stdio.h>
+
+static void feed(KTerm* term, const char* data) {
+    for (size_t i = 0; i < strlen(data); i++) {
+        KTerm_ProcessChar(term, GET_SESSION(term), data[i]);
+    }
+}
+
+static void TestHashLookup(KTerm* term) {
+    printf("Testing Kitty id lookup with many images...\n");
+    KTermSession* session = GET_SESSION(term);
+    char buf[128];
+
+    for (int i = 1; i <= 300; i++) {
+        snprintf(buf, sizeof(buf), "\x1B_Ga=t,i=%d,s=1,v=1;AAAAAA==\x1B\\", i * 7);
+        feed(term, buf);
+    }
+    assert(session->kitty.image_count == 300);
+    assert(session->kitty.id_table_capacity >= 600);
+
+    for (int i = 1; i <= 300; i++) {
+        KittyImageBuffer* img = KTerm_KittyFindImage(&session->kitty, (uint32_t)(i * 7));
+        assert(img != NULL);
+        assert(img->id == (uint32_t)(i * 7));
+    }
+    assert(KTerm_KittyFindImage(&session->kitty, 5) == NULL);
+
+    // Deleting compacts images[]; lookups must still resolve
+    feed(term, "\x1B_Ga=d,d=i,i=7;\x1B\\");
+    assert(session->kitty.image_count == 299);
+    assert(KTerm_KittyFindImage(&session->kitty, 7) == NULL);
+    assert(KTerm_KittyFindImage(&session->kitty, 2100)->id == 2100);
+
+    feed(term, "\x1B_Ga=d,d=a;\x1B\\");
+    assert(session->kitty.image_count == 0);
+    printf("PASS: Hash lookup\n");
+}
+
+static void TestPlacements(KTerm* term) {
+    printf("Testing Kitty placements...\n");
+    KTermSession* session = GET_SESSION(term);
+
+    // 1x1 RGBA pixel, uploaded once (hidden)
+    feed(term, "\x1B_Ga=t,i=1,s=1,v=1;AAAAAA==\x1B\\");
+    size_t usage_after_upload = session->kitty.current_memory_usage;
+
+    feed(term, "\x1B_Ga=p,i=1,p=1,x=10,y=20;\x1B\\");
+    feed(term, "\x1B_Ga=p,i=1,p=2,x=30,y=40;\x1B\\");
+    feed(term, "\x1B_Ga=p,i=1,p=2,x=50,y=60;\x1B\\"); // Update, not a new placement
+
+    assert(session->kitty.placement_count == 2);
+    assert(session->kitty.images[0].placement_count == 2);
+    assert(session->kitty.images[0].frame_count == 1);
+    assert(session->kitty.current_memory_usage == usage_after_upload);
+    assert(KTerm_KittyFindPlacement(&session->kitty, 1, 2)->x == 50);
+
+    // Both placements render, the implicit one stays hidden
+    KTerm_Update(term);
+    KTermRenderBuffer* rb = &term->render_buffers[term->rb_front];
+    assert(rb->kitty_count == 2);
+
+    // Delete a single placement
+    feed(term, "\x1B_Ga=d,d=i,i=1,p=1;\x1B\\");
+    assert(session->kitty.placement_count == 1);
+    assert(session->kitty.image_count == 1);
+
+    // Deleting the image drops its placements
+    feed(term, "\x1B_Ga=d,d=i,i=1;\x1B\\");
+    assert(session->kitty.placement_count == 0);
+    assert(session->kitty.image_count == 0);
+    printf("PASS: Placements\n");
+}
+
+static void TestLRUEviction(KTerm* term) {
+    printf("Testing Kitty LRU eviction...\n");
+    KTermSession* session = GET_SESSION(term);
+
+    feed(term, "\x1B_Ga=T,i=1,s=1,v=1;AAAAAA==\x1B\\"); // Visible
+    feed(term, "\x1B_Ga=t,i=2,s=1,v=1;AAAAAA==\x1B\\"); // Hidden
+    feed(term, "\x1B_Ga=T,i=3,s=1,v=1;AAAAAA==\x1B\\"); // Visible
+    assert(session->kitty.image_count == 3);
+
+    // Pretend the session is almost at its cap so the next upload must evict
+    size_t padding = KTERM_KITTY_MEMORY_LIMIT - session->kitty.current_memory_usage - 100;
+    session->kitty.current_memory_usage += padding;
+
+    feed(term, "\x1B_Ga=T,i=4,s=1,v=1;AAAAAA==\x1B\\");
+    assert(session->kitty.evicted_images == 1);
+    assert(KTerm_KittyFindImage(&session->kitty, 2) == NULL); // Hidden image goes first
+    assert(KTerm_KittyFindImage(&session->kitty, 1) != NULL);
+    assert(KTerm_KittyFindImage(&session->kitty, 4) != NULL);
+    assert(KTerm_KittyFindImage(&session->kitty, 4)->complete);
+
+    // Next upload evicts the least recently placed visible image (id 1)
+    feed(term, "\x1B_Ga=p,i=3;\x1B\\");
+    feed(term, "\x1B_Ga=T,i=5,s=1,v=1;AAAAAA==\x1B\\");
+    assert(session->kitty.evicted_images == 2);
+    assert(KTerm_KittyFindImage(&session->kitty, 1) == NULL);
+    assert(KTerm_KittyFindImage(&session->kitty, 3) != NULL);
+    assert(KTerm_KittyFindImage(&session->kitty, 5) != NULL);
+
+    session->kitty.current_memory_usage -= padding;
+    feed(term, "\x1B_Ga=d,d=a;\x1B\\");
+
+    // A reset starts the eviction order and counter over
+    KTerm_KittyFreeAll(&session->kitty);
+    assert(session->kitty.lru_clock == 0 && session->kitty.evicted_images == 0);
+    printf("PASS: LRU eviction\n");
+}
+
+int main(void) {
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+
+    TestHashLookup(term);
+    TestPlacements(term);
+    TestLRUEviction(term);
+
+    KTerm_Cleanup(term);
+    printf("All Kitty cache tests passed.\n");
+    return 0;
+}
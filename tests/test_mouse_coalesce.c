@@ -0,0 +1,147 @@
+#define KTERM_IMPLEMENTATION
+#define KTERM_TESTING
+#include "../kterm.h"
+#include "mock_situation.h"
+#include <assert.h>
+#include <stdio.h>
+
+static char output[1 << 20];
+static size_t output_len;
+
+static size_t CaptureSink(void* ctx, int session_index, const KTermIOVec* iov, int iovcnt) {
+    (void)ctx; (void)session_index;
+    size_t total = 0;
+    for (int i = 0; i < iovcnt; i++) {
+        memcpy(output + output_len, iov[i].iov_base, iov[i].iov_len);
+        output_len += iov[i].iov_len;
+        total += iov[i].iov_len;
+    }
+    return total;
+}
+
+// Captures replies and turns on any-event tracking with SGR reports
+static void StartTracking(KTerm* term) {
+    KTerm_SetSessionSink(term, CaptureSink, NULL);
+    output_len = 0;
+    KTerm_WriteString(term, "\x1B[?1003h\x1B[?1006h");
+    KTerm_Update(term);
+}
+
+static void Send(KTerm* term, const char* seq) {
+    KTermEvent event = {0};
+    strncpy(event.sequence, seq, sizeof(event.sequence) - 1);
+    KTerm_QueueInputEvent(term, event);
+}
+
+static void Motion(KTerm* term, int x, int y) {
+    char seq[32];
+    snprintf(seq, sizeof(seq), "\x1B[<35;%d;%dM", x, y);
+    Send(term, seq);
+}
+
+static int CountReports(const char* data, size_t len) {
+    int count = 0;
+    for (size_t i = 0; i + 1 < len; i++) count += (data[i] == '\x1B' && data[i + 1] == '[');
+    return count;
+}
+
+static void TestBoundedByFrameRate(void) {
+    printf("Testing motion reports per frame...\n");
+    KTermConfig config = {0};
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    StartTracking(term);
+    // An 8 kHz mouse at 60 frames per second: 133 samples per frame
+    const int frames = 60, samples = 133;
+    for (int f = 0; f < frames; f++) {
+        for (int s = 0; s < samples; s++) Motion(term, 1 + (f * samples + s) % 80, 1 + s % 25);
+        KTerm_Update(term);
+    }
+    int reports = CountReports(output, output_len);
+    assert(reports == frames);
+
+    // Each frame reports the position of its last sample
+    char last[32];
+    snprintf(last, sizeof(last), "\x1B[<35;%d;%dM", 1 + (frames * samples - 1) % 80, 1 + (samples - 1) % 25);
+    assert(output_len >= strlen(last) && strcmp(output + output_len - strlen(last), last) == 0);
+    assert(GET_SESSION(term)->mouse.motion_coalesced == (uint64_t)(frames * (samples - 1)));
+    KTerm_Destroy(term);
+    printf("PASS: %d samples, %d reports\n", frames * samples, reports);
+}
+
+static void TestButtonsKeepOrder(void) {
+    printf("Testing press, release and wheel ordering...\n");
+    KTermConfig config = {0};
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    StartTracking(term);
+    Motion(term, 1, 1);
+    Motion(term, 2, 1);
+    Send(term, "\x1B[<0;2;1M");  // Press
+    Motion(term, 3, 1);
+    Motion(term, 4, 1);
+    Send(term, "\x1B[<64;4;1M"); // Wheel up
+    Send(term, "\x1B[<65;4;1M"); // Wheel down
+    Send(term, "x");             // A keystroke in between
+    Motion(term, 5, 1);
+    Send(term, "\x1B[<0;5;1m");  // Release
+    Motion(term, 6, 1);
+    Motion(term, 7, 1);
+    KTerm_Update(term);
+
+    const char* expected =
+        "\x1B[<35;2;1M" "\x1B[<0;2;1M"
+        "\x1B[<35;4;1M" "\x1B[<64;4;1M" "\x1B[<65;4;1M" "x"
+        "\x1B[<35;5;1M" "\x1B[<0;5;1m"
+        "\x1B[<35;7;1M";
+    assert(output_len == strlen(expected) && memcmp(output, expected, output_len) == 0);
+
+    // X10 encoding is recognized as well: Cb 32 + 35
+    output_len = 0;
+    KTerm_WriteString(term, "\x1B[?1006l");
+    KTerm_Update(term);
+    Send(term, "\x1B[M\x43!!");
+    Send(term, "\x1B[M\x43\x22!");
+    KTerm_Update(term);
+    assert(output_len == 6 && memcmp(output, "\x1B[M\x43\x22!", 6) == 0);
+    KTerm_Destroy(term);
+    printf("PASS: Ordering\n");
+}
+
+static void TestPerSessionSetting(void) {
+    printf("Testing per-session configuration...\n");
+    KTermConfig config = {0};
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    StartTracking(term);
+    KTerm_EnableMouseFeature(term, "coalesce", false);
+    for (int s = 0; s < 50; s++) Motion(term, 1 + s, 1);
+    KTerm_Update(term);
+    assert(CountReports(output, output_len) == 50);
+
+    // Other sessions keep their own setting
+    assert(term->sessions[1]->mouse.coalesce_motion);
+    KTerm_SetActiveSession(term, 1);
+    output_len = 0;
+    for (int s = 0; s < 50; s++) KTerm_QueueMouseReport(term, "\x1B[<35;1;1M", true);
+    KTerm_Update(term);
+    assert(CountReports(output, output_len) == 1);
+
+    // Turning coalescing off sends the held report first
+    output_len = 0;
+    KTerm_QueueMouseReport(term, "\x1B[<35;9;9M", true);
+    KTerm_EnableMouseFeature(term, "coalesce", false);
+    assert(GET_SESSION(term)->mouse.pending_motion[0] == '\0');
+    KTerm_FlushOutput(term);
+    assert(output_len == 10 && memcmp(output, "\x1B[<35;9;9M", 10) == 0);
+    KTerm_Destroy(term);
+    printf("PASS: Per-session setting\n");
+}
+
+int main(void) {
+    TestBoundedByFrameRate();
+    TestButtonsKeepOrder();
+    TestPerSessionSetting();
+    printf("All mouse coalescing tests passed.\n");
+    return 0;
+}
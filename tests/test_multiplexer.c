@@ -40,8 +40,8 @@ int main() {
     assert(term->layout->root->session_index == 0);
     assert(term->layout->root->width == 100);
     assert(term->layout->root->height == 50);
-    assert(term->sessions[0].cols == 100);
-    assert(term->sessions[0].rows == 50);
+    assert(term->sessions[0]->cols == 100);
+    assert(term->sessions[0]->rows == 50);
 
     printf("Legacy checks passed.\n");
 
@@ -71,8 +71,8 @@ int main() {
     assert(root->child_b->width == 100);
 
     // Verify Sessions Resized
-    assert(term->sessions[0].rows == 25);
-    assert(term->sessions[new_sess_idx].rows == 25);
+    assert(term->sessions[0]->rows == 25);
+    assert(term->sessions[new_sess_idx]->rows == 25);
 
     printf("Split check passed.\n");
 
@@ -95,10 +95,10 @@ int main() {
     assert(root->child_b->height == 50);
 
     // Verify Sessions Resized
-    assert(term->sessions[0].cols == 200);
-    assert(term->sessions[0].rows == 50);
-    assert(term->sessions[new_sess_idx].cols == 200);
-    assert(term->sessions[new_sess_idx].rows == 50);
+    assert(term->sessions[0]->cols == 200);
+    assert(term->sessions[0]->rows == 50);
+    assert(term->sessions[new_sess_idx]->cols == 200);
+    assert(term->sessions[new_sess_idx]->rows == 50);
 
     printf("Resize check passed.\n");
 
@@ -0,0 +1,168 @@
+#define KTERM_IMPLEMENTATION
+#define KTERM_TESTING
+#include "../kterm.h"
+#include "mock_situation.h"
+#include <assert.h>
+#include <stdio.h>
+#include <time.h>
+
+#define CJK_FIRST 0x4E00
+#define CJK_SPAN 20000
+#define WORKING_SET 4000
+#define WINDOW_STEP 500
+#define CHURN_FRAMES 200
+
+static void feed(KTerm* term, const char* data) {
+    for (size_t i = 0; i < strlen(data); i++) {
+        KTerm_ProcessChar(term, GET_SESSION(term), (unsigned char)data[i]);
+    }
+}
+
+static void TestWideGlyphs(void) {
+    printf("Testing 2-cell glyphs and the sparse glyph map...\n");
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    term->atlas_max_pages = KTERM_ATLAS_MAX_PAGES;
+    GET_SESSION(term)->charset.g0 = CHARSET_UTF8;
+    GET_SESSION(term)->enable_wide_chars = true;
+    assert(term->atlas_page_count == 1);
+    assert(term->atlas_pages[0].cells == 1);
+
+    // U+4E2D is wide: it gets a 2-cell page and two adjacent slots
+    feed(term, "\x1B[H\xE4\xB8\xAD" "A");
+    KTerm_Update(term);
+    KTerm_Update(term);
+    uint32_t id = KTerm_GetGlyphId(term, 0x4E2D);
+    assert(id >= term->atlas_slots_per_page);
+    assert(term->atlas_page_count == 2);
+    assert(term->atlas_pages[1].cells == 2);
+    assert(term->atlas_pages[1].used == 2);
+    assert(term->atlas_to_codepoint[id] == 0x4E2D);
+
+    KTermRenderBuffer* rb = &term->render_buffers[term->rb_front];
+    assert(rb->cells[0].char_code == id);
+    assert(rb->cells[1].char_code == id + 1);
+    assert(rb->cells[2].char_code == 'A');
+
+    // Without wide chars the same character takes one cell and a 1-cell glyph
+    GET_SESSION(term)->enable_wide_chars = false;
+    feed(term, "\x1B[2;1H\xE4\xB8\xAD" "B");
+    KTerm_Update(term);
+    KTerm_Update(term);
+    rb = &term->render_buffers[term->rb_front];
+    uint32_t squeezed = KTerm_GlyphMapGet(term, KTERM_GLYPH_NARROW + 0x4E2D);
+    assert(squeezed != 0 && squeezed != id && KTerm_GlyphCells(term, squeezed) == 1);
+    assert(rb->cells[80].char_code == squeezed);
+    assert(rb->cells[81].char_code == 'B');
+    assert(KTerm_GetGlyphId(term, 0x4E2D) == id);
+    // A character only ever drawn narrow gets no 2-cell glyph
+    feed(term, "\x1B[3;1H\xE6\x96\x87");
+    KTerm_Update(term);
+    KTerm_Update(term);
+    assert(KTerm_GlyphMapGet(term, KTERM_GLYPH_NARROW + 0x6587) != 0 && KTerm_GetGlyphId(term, 0x6587) == 0);
+    GET_SESSION(term)->enable_wide_chars = true;
+
+    // Narrow glyphs stay on page 0
+    uint32_t narrow = KTerm_AllocateGlyph(term, 0x0100);
+    assert(narrow >= 256 && narrow < term->atlas_slots_per_page);
+
+    // Untouched blocks of the map are never allocated
+    assert(KTerm_GetGlyphId(term, 0x1F600) == 0);
+    assert(KTerm_GetGlyphId(term, 0x10FFFF) == 0);
+    assert(KTerm_GetGlyphId(term, 0x110000) == 0);
+    assert(term->glyph_map[0x1F600 >> 8] == NULL);
+
+    // Ids above 16 bits are fine
+    assert(term->atlas_slots_per_page * KTERM_ATLAS_MAX_PAGES > 0xFFFF);
+
+    KTerm_Destroy(term);
+    printf("PASS: Wide glyphs\n");
+}
+
+static void TestPageEviction(void) {
+    printf("Testing page eviction...\n");
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    term->atlas_max_pages = 2;
+    GET_SESSION(term)->charset.g0 = CHARSET_UTF8;
+    GET_SESSION(term)->enable_wide_chars = true;
+    uint32_t per_page = term->atlas_slots_per_page / 2;
+
+    // Fill the only 2-cell page, then one more glyph evicts it whole
+    for (uint32_t i = 0; i < per_page; i++) {
+        assert(KTerm_AllocateGlyph(term, CJK_FIRST + i) != 0);
+    }
+    assert(term->atlas_page_evictions == 0);
+    term->frame_count++;
+    uint32_t id = KTerm_AllocateGlyph(term, CJK_FIRST + per_page);
+    assert(term->atlas_page_evictions == 1);
+    assert(term->atlas_glyphs_evicted == per_page);
+    assert(id == term->atlas_slots_per_page); // First slot of page 1 again
+    assert(KTerm_GetGlyphId(term, CJK_FIRST) == 0);
+
+    // The base font and page 0 glyphs survive
+    uint32_t narrow = KTerm_AllocateGlyph(term, 0x0100);
+    assert(KTerm_GetGlyphId(term, 0x0100) == narrow);
+    assert(term->atlas_pages[0].used >= 257);
+    assert(term->atlas_page_count == 2);
+
+    KTerm_Destroy(term);
+    printf("PASS: Page eviction\n");
+}
+
+static void BenchChurn(int max_pages) {
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    term->atlas_max_pages = max_pages;
+    GET_SESSION(term)->charset.g0 = CHARSET_UTF8;
+    GET_SESSION(term)->enable_wide_chars = true;
+    volatile uint32_t sink = 0;
+    long lookups = 0;
+
+    // A working set that slides across the CJK block, one window per frame
+    clock_t start = clock();
+    for (int f = 0; f < CHURN_FRAMES; f++) {
+        uint32_t base = (uint32_t)(f * WINDOW_STEP) % CJK_SPAN;
+        for (uint32_t i = 0; i < WORKING_SET; i++) {
+            sink += KTerm_AllocateGlyph(term, CJK_FIRST + (base + i) % CJK_SPAN);
+            lookups++;
+        }
+        term->frame_count++;
+    }
+    double elapsed = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    printf("  %d pages: %d pages, %llu page evictions, %llu glyphs evicted, %.1f ns/lookup (sink %u)\n",
+           max_pages, term->atlas_page_count, (unsigned long long)term->atlas_page_evictions,
+           (unsigned long long)term->atlas_glyphs_evicted,
+           elapsed * 1e9 / (double)lookups, (unsigned)sink);
+    if (max_pages == KTERM_ATLAS_MAX_PAGES) {
+        // The whole span fits: every glyph is rasterized once, nothing is evicted
+        assert(term->atlas_page_evictions == 0);
+    } else {
+        assert(term->atlas_page_evictions > 0);
+    }
+    KTerm_Destroy(term);
+}
+
+int main(void) {
+    TestWideGlyphs();
+    TestPageEviction();
+
+    printf("Benchmarking atlas churn (%d glyphs per frame, %d frames)...\n", WORKING_SET, CHURN_FRAMES);
+    BenchChurn(2);
+    BenchChurn(4);
+    BenchChurn(KTERM_ATLAS_MAX_PAGES);
+    printf("PASS: Atlas churn benchmark\n");
+
+    printf("All atlas churn tests passed.\n");
+    return 0;
+}
@@ -0,0 +1,282 @@
+#define KTERM_IMPLEMENTATION
+#define KTERM_TESTING
+#include "../kterm.h"
+#include "mock_situation.h"
+#include <assert.h>
+#include <stdio.h>
+
+#define CORPUS_REPEAT 20000
+
+// Mixed-script line: ASCII, Latin-1, box drawing, combining marks,
+// Hebrew, Arabic, CJK, Hangul, fullwidth forms and an emoji.
+static const uint32_t kCorpus[] = {
+    'H', 'e', 'l', 'l', 'o', ' ', '(', 'w', 'o', 'r', 'l', 'd', ')', ' ', '1', '2', '3',
+    0x00E9, 0x00FC, 0x00A3, 0x00B0, 0x2500, 0x2502, 0x250C, 0x2588, 0x2591,
+    'e', 0x0301, 'a', 0x0308, 0x20DD,
+    0x05E9, 0x05DC, 0x05D5, 0x05DD, ' ', 0x0645, 0x0631, 0x062D, 0x0628, 0x0627,
+    0x4E2D, 0x6587, 0x65E5, 0x672C, 0xAC00, 0xD55C, 0xFF21, 0xFF10, 0x1F600,
+    '[', 'x', ']', '{', '<', '>', '}'
+};
+#define CORPUS_LEN (sizeof(kCorpus) / sizeof(kCorpus[0]))
+
+// Reference copy of the range lookups kt_unicode_props.h replaced, kept to
+// check equivalence and to time the table against.
+
+static const struct KTermInterval kRefCombining[] = {
+    { 0x0300, 0x036F }, { 0x0483, 0x0489 }, { 0x0591, 0x05BD }, { 0x05BF, 0x05BF },
+    { 0x05C1, 0x05C2 }, { 0x05C4, 0x05C5 }, { 0x05C7, 0x05C7 }, { 0x0610, 0x061A },
+    { 0x064B, 0x065F }, { 0x0670, 0x0670 }, { 0x06D6, 0x06DC }, { 0x06DF, 0x06E4 },
+    { 0x06E7, 0x06E8 }, { 0x06EA, 0x06ED }, { 0x0711, 0x0711 }, { 0x0730, 0x074A },
+    { 0x07A6, 0x07B0 }, { 0x07EB, 0x07F3 }, { 0x07FD, 0x07FD }, { 0x0816, 0x0819 },
+    { 0x081B, 0x0823 }, { 0x0825, 0x0827 }, { 0x0829, 0x082D }, { 0x0859, 0x085B },
+    { 0x08D3, 0x08E1 }, { 0x08E3, 0x0903 }, { 0x093A, 0x093C }, { 0x093E, 0x094F },
+    { 0x0951, 0x0957 }, { 0x0962, 0x0963 }, { 0x0981, 0x0983 }, { 0x09BC, 0x09BC },
+    { 0x09BE, 0x09C4 }, { 0x09C7, 0x09C8 }, { 0x09CB, 0x09CD }, { 0x09D7, 0x09D7 },
+    { 0x09E2, 0x09E3 }, { 0x09FE, 0x09FE }, { 0x0A01, 0x0A03 }, { 0x0A3C, 0x0A3C },
+    { 0x0A3E, 0x0A42 }, { 0x0A47, 0x0A48 }, { 0x0A4B, 0x0A4D }, { 0x0A51, 0x0A51 },
+    { 0x0A70, 0x0A71 }, { 0x0A75, 0x0A75 }, { 0x0A81, 0x0A83 }, { 0x0ABC, 0x0ABC },
+    { 0x0ABE, 0x0AC5 }, { 0x0AC7, 0x0AC9 }, { 0x0ACB, 0x0ACD }, { 0x0AE2, 0x0AE3 },
+    { 0x0AFA, 0x0AFF }, { 0x0B01, 0x0B03 }, { 0x0B3C, 0x0B3C }, { 0x0B3E, 0x0B44 },
+    { 0x0B47, 0x0B48 }, { 0x0B4B, 0x0B4D }, { 0x0B56, 0x0B57 }, { 0x0B62, 0x0B63 },
+    { 0x0B82, 0x0B82 }, { 0x0BBE, 0x0BC2 }, { 0x0BC6, 0x0BC8 }, { 0x0BCA, 0x0BCD },
+    { 0x0BD7, 0x0BD7 }, { 0x0C00, 0x0C04 }, { 0x0C3E, 0x0C44 }, { 0x0C46, 0x0C48 },
+    { 0x0C4A, 0x0C4D }, { 0x0C55, 0x0C56 }, { 0x0C62, 0x0C63 }, { 0x0C81, 0x0C83 },
+    { 0x0CBC, 0x0CBC }, { 0x0CBE, 0x0CC4 }, { 0x0CC6, 0x0CC8 }, { 0x0CCA, 0x0CCD },
+    { 0x0CD5, 0x0CD6 }, { 0x0CE2, 0x0CE3 }, { 0x0D00, 0x0D03 }, { 0x0D3B, 0x0D3C },
+    { 0x0D3E, 0x0D44 }, { 0x0D46, 0x0D48 }, { 0x0D4A, 0x0D4D }, { 0x0D57, 0x0D57 },
+    { 0x0D62, 0x0D63 }, { 0x0D82, 0x0D83 }, { 0x0DCA, 0x0DCA }, { 0x0DCF, 0x0DD4 },
+    { 0x0DD6, 0x0DD6 }, { 0x0DD8, 0x0DDF }, { 0x0DF2, 0x0DF3 }, { 0x0E31, 0x0E31 },
+    { 0x0E34, 0x0E3A }, { 0x0E47, 0x0E4E }, { 0x0EB1, 0x0EB1 }, { 0x0EB4, 0x0EBC },
+    { 0x0EC8, 0x0ECD }, { 0x0F18, 0x0F19 }, { 0x0F35, 0x0F35 }, { 0x0F37, 0x0F37 },
+    { 0x0F39, 0x0F39 }, { 0x0F3E, 0x0F3F }, { 0x0F71, 0x0F84 }, { 0x0F86, 0x0F87 },
+    { 0x0F8D, 0x0F97 }, { 0x0F99, 0x0FBC }, { 0x0FC6, 0x0FC6 }, { 0x102B, 0x103E },
+    { 0x1056, 0x1059 }, { 0x105E, 0x1060 }, { 0x1062, 0x1064 }, { 0x1067, 0x106D },
+    { 0x1071, 0x1074 }, { 0x1082, 0x108D }, { 0x108F, 0x108F }, { 0x109A, 0x109D },
+    { 0x135D, 0x135F }, { 0x1712, 0x1714 }, { 0x1732, 0x1734 }, { 0x1752, 0x1753 },
+    { 0x1772, 0x1773 }, { 0x17B4, 0x17D3 }, { 0x17DD, 0x17DD }, { 0x180B, 0x180D },
+    { 0x1885, 0x1886 }, { 0x18A9, 0x18A9 }, { 0x1920, 0x192B }, { 0x1930, 0x193B },
+    { 0x1A17, 0x1A1B }, { 0x1A55, 0x1A5E }, { 0x1A60, 0x1A7C }, { 0x1A7F, 0x1A7F },
+    { 0x1AB0, 0x1ABE }, { 0x1B00, 0x1B04 }, { 0x1B34, 0x1B44 }, { 0x1B6B, 0x1B73 },
+    { 0x1B80, 0x1B82 }, { 0x1BA1, 0x1BAD }, { 0x1BE6, 0x1BF3 }, { 0x1C24, 0x1C37 },
+    { 0x1CD0, 0x1CD2 }, { 0x1CD4, 0x1CE8 }, { 0x1CED, 0x1CED }, { 0x1CF4, 0x1CF4 },
+    { 0x1CF7, 0x1CF9 }, { 0x1DC0, 0x1DF9 }, { 0x1DFB, 0x1DFF }, { 0x20D0, 0x20F0 },
+    { 0x2CEF, 0x2CF1 }, { 0x2D7F, 0x2D7F }, { 0x2DE0, 0x2DFF }, { 0x302A, 0x302F },
+    { 0x3099, 0x309A }, { 0xA66F, 0xA672 }, { 0xA674, 0xA67D }, { 0xA69E, 0xA69F },
+    { 0xA6F0, 0xA6F1 }, { 0xA802, 0xA802 }, { 0xA806, 0xA806 }, { 0xA80B, 0xA80B },
+    { 0xA823, 0xA827 }, { 0xA880, 0xA881 }, { 0xA8B4, 0xA8C5 }, { 0xA8E0, 0xA8F1 },
+    { 0xA8FF, 0xA8FF }, { 0xA926, 0xA92D }, { 0xA947, 0xA953 }, { 0xA980, 0xA983 },
+    { 0xA9B3, 0xA9C0 }, { 0xA9E5, 0xA9E5 }, { 0xAA29, 0xAA36 }, { 0xAA43, 0xAA43 },
+    { 0xAA4C, 0xAA4D }, { 0xAA7B, 0xAA7D }, { 0xAAB0, 0xAAB0 }, { 0xAAB2, 0xAAB4 },
+    { 0xAAB7, 0xAAB8 }, { 0xAABE, 0xAABF }, { 0xAAC1, 0xAAC1 }, { 0xAAEB, 0xAAEF },
+    { 0xAAF5, 0xAAF6 }, { 0xABE3, 0xABEA }, { 0xABEC, 0xABED }, { 0xFB1E, 0xFB1E },
+    { 0xFE00, 0xFE0F }, { 0xFE20, 0xFE2F }, { 0x101FD, 0x101FD }, { 0x102E0, 0x102E0 },
+    { 0x10376, 0x1037A }, { 0x10A01, 0x10A03 }, { 0x10A05, 0x10A06 }, { 0x10A0C, 0x10A0F },
+    { 0x10A38, 0x10A3A }, { 0x10A3F, 0x10A3F }, { 0x10AE5, 0x10AE6 }, { 0x10D24, 0x10D27 },
+    { 0x10F46, 0x10F50 }, { 0x11000, 0x11002 }, { 0x11038, 0x11046 }, { 0x1107F, 0x11082 },
+    { 0x110B0, 0x110BA }, { 0x11100, 0x11102 }, { 0x11127, 0x11134 }, { 0x11145, 0x11146 },
+    { 0x11173, 0x11173 }, { 0x11180, 0x11182 }, { 0x111B3, 0x111C0 }, { 0x111C9, 0x111CC },
+    { 0x1122C, 0x11237 }, { 0x1123E, 0x1123E }, { 0x112DF, 0x112EA }, { 0x11300, 0x11303 },
+    { 0x1133B, 0x1133C }, { 0x1133E, 0x11344 }, { 0x11347, 0x11348 }, { 0x1134B, 0x1134D },
+    { 0x11357, 0x11357 }, { 0x11362, 0x11363 }, { 0x11366, 0x1136C }, { 0x11370, 0x11374 },
+    { 0x11435, 0x11446 }, { 0x1145E, 0x1145E }, { 0x114B0, 0x114C3 }, { 0x115AF, 0x115B5 },
+    { 0x115B8, 0x115C0 }, { 0x115DC, 0x115DD }, { 0x11630, 0x11640 }, { 0x116AB, 0x116B7 },
+    { 0x1171D, 0x1172B }, { 0x1182C, 0x1183A }, { 0x119D1, 0x119D7 }, { 0x119DA, 0x119E0 },
+    { 0x119E4, 0x119E4 }, { 0x11A01, 0x11A0A }, { 0x11A33, 0x11A39 }, { 0x11A3B, 0x11A3E },
+    { 0x11A47, 0x11A47 }, { 0x11A51, 0x11A5B }, { 0x11A8A, 0x11A99 }, { 0x11C2F, 0x11C36 },
+    { 0x11C38, 0x11C3F }, { 0x11C92, 0x11CA7 }, { 0x11CA9, 0x11CB6 }, { 0x11D31, 0x11D36 },
+    { 0x11D3A, 0x11D3A }, { 0x11D3C, 0x11D3D }, { 0x11D3F, 0x11D45 }, { 0x11D47, 0x11D47 },
+    { 0x11D8A, 0x11D8E }, { 0x11D90, 0x11D91 }, { 0x11D93, 0x11D97 }, { 0x11EF3, 0x11EF6 },
+    { 0x16AF0, 0x16AF4 }, { 0x16B30, 0x16B36 }, { 0x16F4F, 0x16F4F }, { 0x16F51, 0x16F87 },
+    { 0x16F8F, 0x16F92 }, { 0x1BC9D, 0x1BC9E }, { 0x1D165, 0x1D169 }, { 0x1D16D, 0x1D172 },
+    { 0x1D17B, 0x1D182 }, { 0x1D185, 0x1D18B }, { 0x1D1AA, 0x1D1AD }, { 0x1D242, 0x1D244 },
+    { 0x1DA00, 0x1DA36 }, { 0x1DA3B, 0x1DA6C }, { 0x1DA75, 0x1DA75 }, { 0x1DA84, 0x1DA84 },
+    { 0x1DA9B, 0x1DA9F }, { 0x1DAA1, 0x1DAAF }, { 0x1E000, 0x1E006 }, { 0x1E008, 0x1E018 },
+    { 0x1E01B, 0x1E021 }, { 0x1E023, 0x1E024 }, { 0x1E026, 0x1E02A }, { 0x1E130, 0x1E136 },
+    { 0x1E2EC, 0x1E2EF }, { 0x1E8D0, 0x1E8D6 }, { 0x1E944, 0x1E94A }, { 0xE0100, 0xE01EF },
+};
+
+static int RefBisearch(uint32_t ucs, const struct KTermInterval* table, int max) {
+    int min = 0;
+    if ((int)ucs < table[0].first || (int)ucs > table[max].last) return 0;
+    while (max >= min) {
+        int mid = (min + max) / 2;
+        if ((int)ucs > table[mid].last) min = mid + 1;
+        else if ((int)ucs < table[mid].first) max = mid - 1;
+        else return 1;
+    }
+    return 0;
+}
+
+static int RefWcwidth(uint32_t ucs) {
+    if (ucs == 0) return 0;
+    if (ucs < 32 || (ucs >= 0x7f && ucs < 0xa0)) return -1;
+    if (RefBisearch(ucs, kRefCombining, (int)(sizeof(kRefCombining) / sizeof(kRefCombining[0])) - 1)) return 0;
+    return 1 +
+        (ucs >= 0x1100 &&
+         (ucs <= 0x115f || ucs == 0x2329 || ucs == 0x232a ||
+          (ucs >= 0x2e80 && ucs <= 0xa4cf && ucs != 0x303f) ||
+          (ucs >= 0xac00 && ucs <= 0xd7a3) || (ucs >= 0xf900 && ucs <= 0xfaff) ||
+          (ucs >= 0xfe10 && ucs <= 0xfe19) || (ucs >= 0xfe30 && ucs <= 0xfe6f) ||
+          (ucs >= 0xff00 && ucs <= 0xff60) || (ucs >= 0xffe0 && ucs <= 0xffe6) ||
+          (ucs >= 0x20000 && ucs <= 0x2fffd) || (ucs >= 0x30000 && ucs <= 0x3fffd)));
+}
+
+static uint8_t RefCP437(uint32_t codepoint) {
+    if (codepoint < 128) return (uint8_t)codepoint;
+    switch (codepoint) {
+        case 0xFFFD: return '?'; case 0x00C7: return 128; case 0x00FC: return 129; case 0x00E9: return 130;
+        case 0x00E2: return 131; case 0x00E4: return 132; case 0x00E0: return 133; case 0x00E5: return 134;
+        case 0x00E7: return 135; case 0x00EA: return 136; case 0x00EB: return 137; case 0x00E8: return 138;
+        case 0x00EF: return 139; case 0x00EE: return 140; case 0x00EC: return 141; case 0x00C4: return 142;
+        case 0x00C5: return 143; case 0x00C9: return 144; case 0x00E6: return 145; case 0x00C6: return 146;
+        case 0x00F4: return 147; case 0x00F6: return 148; case 0x00F2: return 149; case 0x00FB: return 150;
+        case 0x00F9: return 151; case 0x00FF: return 152; case 0x00D6: return 153; case 0x00DC: return 154;
+        case 0x00A2: return 155; case 0x00A3: return 156; case 0x00A5: return 157; case 0x20A7: return 158;
+        case 0x0192: return 159; case 0x00E1: return 160; case 0x00ED: return 161; case 0x00F3: return 162;
+        case 0x00FA: return 163; case 0x00F1: return 164; case 0x00D1: return 165; case 0x00AA: return 166;
+        case 0x00BA: return 167; case 0x00BF: return 168; case 0x2310: return 169; case 0x00AC: return 170;
+        case 0x00BD: return 171; case 0x00BC: return 172; case 0x00A1: return 173; case 0x00AB: return 174;
+        case 0x00BB: return 175; case 0x2591: return 176; case 0x2592: return 177; case 0x2593: return 178;
+        case 0x2502: return 179; case 0x2524: return 180; case 0x2561: return 181; case 0x2562: return 182;
+        case 0x2556: return 183; case 0x2555: return 184; case 0x2563: return 185; case 0x2551: return 186;
+        case 0x2557: return 187; case 0x255D: return 188; case 0x255C: return 189; case 0x255B: return 190;
+        case 0x2510: return 191; case 0x2514: return 192; case 0x2534: return 193; case 0x252C: return 194;
+        case 0x251C: return 195; case 0x2500: return 196; case 0x253C: return 197; case 0x255E: return 198;
+        case 0x255F: return 199; case 0x255A: return 200; case 0x2554: return 201; case 0x2569: return 202;
+        case 0x2566: return 203; case 0x2560: return 204; case 0x2550: return 205; case 0x256C: return 206;
+        case 0x2567: return 207; case 0x2568: return 208; case 0x2564: return 209; case 0x2565: return 210;
+        case 0x2559: return 211; case 0x2558: return 212; case 0x2552: return 213; case 0x2553: return 214;
+        case 0x256B: return 215; case 0x256A: return 216; case 0x2518: return 217; case 0x250C: return 218;
+        case 0x2588: return 219; case 0x2584: return 220; case 0x258C: return 221; case 0x2590: return 222;
+        case 0x2580: return 223; case 0x03B1: return 224; case 0x00DF: return 225; case 0x0393: return 226;
+        case 0x03C0: return 227; case 0x03A3: return 228; case 0x03C3: return 229; case 0x00B5: return 230;
+        case 0x03C4: return 231; case 0x03A6: return 232; case 0x0398: return 233; case 0x03A9: return 234;
+        case 0x03B4: return 235; case 0x221E: return 236; case 0x03C6: return 237; case 0x03B5: return 238;
+        case 0x2229: return 239; case 0x2261: return 240; case 0x00B1: return 241; case 0x2265: return 242;
+        case 0x2264: return 243; case 0x2320: return 244; case 0x2321: return 245; case 0x00F7: return 246;
+        case 0x2248: return 247; case 0x00B0: return 248; case 0x2219: return 249; case 0x00B7: return 250;
+        case 0x221A: return 251; case 0x207F: return 252; case 0x00B2: return 253; case 0x25A0: return 254;
+        case 0x00A0: return 255;
+        default: return '?';
+    }
+}
+
+static int RefBiDiType(uint32_t ch) {
+    if ((ch >= 0x0590 && ch <= 0x05FF) || (ch >= 0x0600 && ch <= 0x06FF) ||
+        (ch >= 0x0750 && ch <= 0x077F) || (ch >= 0x08A0 && ch <= 0x08FF) ||
+        (ch >= 0xFB50 && ch <= 0xFDFF) || (ch >= 0xFE70 && ch <= 0xFEFF)) return BIDI_R;
+    if (ch >= '0' && ch <= '9') return BIDI_L;
+    if (ch < 0x41) return BIDI_N;
+    if ((ch >= 0x5B && ch <= 0x60) || (ch >= 0x7B && ch <= 0x7E)) return BIDI_N;
+    return BIDI_L;
+}
+
+static uint32_t RefMirroredChar(uint32_t ch) {
+    switch (ch) {
+        case '(': return ')'; case ')': return '('; case '[': return ']'; case ']': return '[';
+        case '{': return '}'; case '}': return '{'; case '<': return '>'; case '>': return '<';
+        default: return ch;
+    }
+}
+
+static void TestProperties(void) {
+    printf("Testing codepoint property lookups...\n");
+
+    // Width
+    assert(KTerm_wcwidth(0) == 0);
+    assert(KTerm_wcwidth(0x07) == -1);
+    assert(KTerm_wcwidth(0x9B) == -1);
+    assert(KTerm_wcwidth('A') == 1);
+    assert(KTerm_wcwidth(0x00E9) == 1);
+    assert(KTerm_wcwidth(0x0301) == 0);
+    assert(KTerm_wcwidth(0x20DD) == 0);
+    assert(KTerm_wcwidth(0x1100) == 2);
+    assert(KTerm_wcwidth(0x303F) == 1);
+    assert(KTerm_wcwidth(0x4E2D) == 2);
+    assert(KTerm_wcwidth(0xAC00) == 2);
+    assert(KTerm_wcwidth(0xFF21) == 2);
+    assert(KTerm_wcwidth(0x20000) == 2);
+    assert(KTerm_wcwidth(0xE0100) == 0);
+    assert(KTerm_wcwidth(0x110000) == 1);
+    assert(KT_UPROPS_COMBINING(KTerm_CodepointProps(0x0301)));
+    assert(!KT_UPROPS_COMBINING(KTerm_CodepointProps('a')));
+
+    // CP437 alias
+    assert(MapUnicodeToCP437('A') == 'A');
+    assert(MapUnicodeToCP437(0x00C7) == 128);
+    assert(MapUnicodeToCP437(0x00A3) == 0x9C);
+    assert(MapUnicodeToCP437(0x2500) == 0xC4);
+    assert(MapUnicodeToCP437(0x00A0) == 0xFF);
+    assert(MapUnicodeToCP437(0x4E2D) == '?');
+    assert(MapUnicodeToCP437(0xFFFD) == '?');
+
+    // BiDi class and mirroring
+    assert(GetBiDiType('a') == BIDI_L);
+    assert(GetBiDiType('7') == BIDI_L);
+    assert(GetBiDiType(' ') == BIDI_N);
+    assert(GetBiDiType('[') == BIDI_N);
+    assert(GetBiDiType(0x05D0) == BIDI_R);
+    assert(GetBiDiType(0x0627) == BIDI_R);
+    assert(GetBiDiType(0xFEFC) == BIDI_R);
+    assert(GetBiDiType(0x4E2D) == BIDI_L);
+    assert(GetMirroredChar('(') == ')');
+    assert(GetMirroredChar(']') == '[');
+    assert(GetMirroredChar('<') == '>');
+    assert(GetMirroredChar('}') == '{');
+    assert(GetMirroredChar('a') == 'a');
+    printf("PASS: Codepoint properties\n");
+}
+
+static void TestMatchesReference(void) {
+    printf("Testing table matches the range lookups...\n");
+    for (uint32_t cp = 0; cp <= 0x10FFFF; cp++) {
+        assert(KTerm_wcwidth(cp) == RefWcwidth(cp));
+        assert(MapUnicodeToCP437(cp) == RefCP437(cp));
+        assert(GetBiDiType(cp) == RefBiDiType(cp));
+        assert(GetMirroredChar(cp) == RefMirroredChar(cp));
+    }
+    printf("PASS: Table matches reference\n");
+}
+
+static void BenchLookups(void) {
+    printf("Benchmarking codepoint property lookups...\n");
+    double lookups = (double)CORPUS_REPEAT * CORPUS_LEN;
+
+    // Everything the print and BiDi paths ask per codepoint
+    volatile uint32_t sink = 0;
+    double t0 = MockWallTime();
+    for (int r = 0; r < CORPUS_REPEAT; r++) {
+        for (size_t i = 0; i < CORPUS_LEN; i++) {
+            uint32_t cp = kCorpus[i];
+            sink += (uint32_t)RefWcwidth(cp) + RefCP437(cp) +
+                    (uint32_t)RefBiDiType(cp) + RefMirroredChar(cp);
+        }
+    }
+    double ranges = MockWallTime() - t0;
+    uint32_t ref_sink = sink;
+
+    sink = 0;
+    t0 = MockWallTime();
+    for (int r = 0; r < CORPUS_REPEAT; r++) {
+        for (size_t i = 0; i < CORPUS_LEN; i++) {
+            uint32_t cp = kCorpus[i];
+            sink += (uint32_t)KTerm_wcwidth(cp) + MapUnicodeToCP437(cp) +
+                    (uint32_t)GetBiDiType(cp) + GetMirroredChar(cp);
+        }
+    }
+    double table = MockWallTime() - t0;
+    assert(sink == ref_sink);
+
+    printf("  %.0f codepoints: ranges %.2f ns, table %.2f ns per codepoint (%.1fx)\n",
+           lookups, ranges * 1e9 / lookups, table * 1e9 / lookups,
+           table > 0 ? ranges / table : 0.0);
+    printf("PASS: Lookup benchmark\n");
+}
+
+int main(void) {
+    TestProperties();
+    TestMatchesReference();
+    BenchLookups();
+    printf("All codepoint property tests passed.\n");
+    return 0;
+}
@@ -0,0 +1,127 @@
+#define KTERM_IMPLEMENTATION
+#define KTERM_TESTING
+#include "../kterm.h"
+#include "mock_situation.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define CACHE_PATH "test_glyph_cache.bin"
+#define GLYPH_FIRST 0x4E00
+#define GLYPH_COUNT 4000
+#define STARTUP_RUNS 20
+
+static uint32_t UsedSlots(KTerm* term) {
+    uint32_t used = 0;
+    for (int p = 0; p < term->atlas_page_count; p++) used += term->atlas_pages[p].used;
+    return used;
+}
+
+static void TestRoundTrip(void) {
+    printf("Testing glyph cache round trip...\n");
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    KTerm* warm = KTerm_Create(config);
+    KTerm_Init(warm);
+    assert(KTerm_PrewarmGlyphs(warm, GLYPH_FIRST, GLYPH_FIRST + GLYPH_COUNT - 1) == GLYPH_COUNT);
+    assert(KTerm_SaveGlyphCache(warm, CACHE_PATH));
+
+    KTerm* cold = KTerm_Create(config);
+    KTerm_Init(cold);
+    assert(KTerm_LoadGlyphCache(cold, CACHE_PATH));
+    assert(cold->atlas_page_count == warm->atlas_page_count);
+    assert(cold->atlas_height == warm->atlas_height);
+    for (int p = 0; p < warm->atlas_page_count; p++) {
+        assert(cold->atlas_pages[p].cells == warm->atlas_pages[p].cells);
+        assert(cold->atlas_pages[p].used == warm->atlas_pages[p].used);
+    }
+    assert(cold->font_atlas_dirty);
+    for (uint32_t cp = GLYPH_FIRST; cp < GLYPH_FIRST + GLYPH_COUNT; cp++) {
+        assert(KTerm_GetGlyphId(cold, cp) == KTerm_GetGlyphId(warm, cp));
+    }
+    size_t atlas_bytes = (size_t)warm->atlas_width * warm->atlas_height * 4;
+    assert(memcmp(cold->font_atlas_pixels, warm->font_atlas_pixels, atlas_bytes) == 0);
+
+    // Cached glyphs are hits: no new slot
+    uint32_t used = UsedSlots(cold);
+    assert(KTerm_AllocateGlyph(cold, GLYPH_FIRST + 10) == KTerm_GetGlyphId(warm, GLYPH_FIRST + 10));
+    assert(UsedSlots(cold) == used);
+
+    KTerm_Destroy(warm);
+    KTerm_Destroy(cold);
+    printf("PASS: Round trip\n");
+}
+
+static void TestStaleCacheRejected(void) {
+    printf("Testing stale cache is rejected...\n");
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    KTerm_SetFont(term, "IBM"); // Different font: different key
+    uint32_t used = UsedSlots(term);
+    assert(!KTerm_LoadGlyphCache(term, CACHE_PATH));
+    assert(UsedSlots(term) == used);
+    assert(KTerm_GetGlyphId(term, GLYPH_FIRST) == 0);
+
+    // Truncated file
+    FILE* f = fopen(CACHE_PATH, "r+b");
+    assert(f);
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fclose(f);
+    assert(truncate(CACHE_PATH, size / 2) == 0);
+    KTerm* other = KTerm_Create(config);
+    KTerm_Init(other);
+    assert(!KTerm_LoadGlyphCache(other, CACHE_PATH));
+    assert(!KTerm_LoadGlyphCache(other, "does_not_exist.bin"));
+
+    KTerm_Destroy(term);
+    KTerm_Destroy(other);
+    printf("PASS: Stale cache rejected\n");
+}
+
+static void BenchStartup(void) {
+    printf("Benchmarking startup (%d glyphs, %d runs)...\n", GLYPH_COUNT, STARTUP_RUNS);
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    KTerm* warm = KTerm_Create(config);
+    KTerm_Init(warm);
+    KTerm_PrewarmGlyphs(warm, GLYPH_FIRST, GLYPH_FIRST + GLYPH_COUNT - 1);
+    assert(KTerm_SaveGlyphCache(warm, CACHE_PATH));
+    KTerm_Destroy(warm);
+
+    double t0 = MockWallTime();
+    for (int i = 0; i < STARTUP_RUNS; i++) {
+        KTerm* term = KTerm_Create(config);
+        KTerm_Init(term);
+        KTerm_PrewarmGlyphs(term, GLYPH_FIRST, GLYPH_FIRST + GLYPH_COUNT - 1);
+        KTerm_Destroy(term);
+    }
+    double rasterize = (MockWallTime() - t0) / STARTUP_RUNS;
+
+    t0 = MockWallTime();
+    for (int i = 0; i < STARTUP_RUNS; i++) {
+        KTerm* term = KTerm_Create(config);
+        KTerm_Init(term);
+        bool ok = KTerm_LoadGlyphCache(term, CACHE_PATH);
+        assert(ok);
+        KTerm_Destroy(term);
+    }
+    double cached = (MockWallTime() - t0) / STARTUP_RUNS;
+
+    printf("Startup + %d glyphs: rasterize %.3f ms, cache %.3f ms\n", GLYPH_COUNT, rasterize * 1000.0, cached * 1000.0);
+}
+
+int main(void) {
+    TestRoundTrip();
+    TestStaleCacheRejected();
+    BenchStartup();
+    remove(CACHE_PATH);
+    printf("All glyph cache tests passed.\n");
+    return 0;
+}
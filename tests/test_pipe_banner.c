@@ -32,9 +32,9 @@ void RunTest(const char* seq, const char* name) {
             bool found_ansi = false;
             // Scan for ESC [ 3 8 ; 2
             for (int i = 0; i < count - 5; i++) {
-                int idx = (session->pipeline_tail + i) % 65536;
+                int idx = (session->pipeline_tail + i) & session->pipeline_mask;
                 if (session->input_pipeline[idx] == 0x1B &&
-                    session->input_pipeline[(idx+1)%65536] == '[') {
+                    session->input_pipeline[(idx+1) & session->pipeline_mask] == '[') {
                     found_ansi = true;
                     break;
                 }
@@ -0,0 +1,177 @@
+#define KTERM_IMPLEMENTATION
+#define KTERM_TESTING
+#include "../kterm.h"
+#include "mock_situation.h"
+#include <assert.h>
+#include <pthread.h>
+#include <stdio.h>
+
+// Copy `data` into the reserved spans and commit it
+static size_t Fill(KTerm* term, int index, const char* data, size_t len) {
+    unsigned char *p1, *p2;
+    size_t len1, len2;
+    size_t space = KTerm_PipelineReserve(term, index, &p1, &len1, &p2, &len2);
+    if (len > space) len = space;
+    size_t first = (len < len1) ? len : len1;
+    memcpy(p1, data, first);
+    if (len > first) memcpy(p2, data + first, len - first);
+    return KTerm_PipelineCommit(term, index, len);
+}
+
+static void TestSpans(void) {
+    printf("Testing reserved spans...\n");
+    KTermConfig config = {0};
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    KTermSession* session = term->sessions[0];
+    int size = session->pipeline_mask + 1;
+    assert(size == KTERM_INPUT_PIPELINE_SIZE && (size & session->pipeline_mask) == 0);
+
+    // Empty ring at the start: one span, all but one slot
+    unsigned char *p1, *p2;
+    size_t len1, len2;
+    assert(KTerm_PipelineReserve(term, 0, &p1, &len1, &p2, &len2) == (size_t)size - 1);
+    assert(p1 == session->input_pipeline && len1 == (size_t)size - 1 && p2 == NULL && len2 == 0);
+
+    // Empty ring three bytes before the end: the free space wraps
+    session->pipeline_head = size - 3;
+    session->pipeline_tail = size - 3;
+    assert(KTerm_PipelineReserve(term, 0, &p1, &len1, &p2, &len2) == (size_t)size - 1);
+    assert(p1 == session->input_pipeline + size - 3 && len1 == 3);
+    assert(p2 == session->input_pipeline && len2 == (size_t)size - 4);
+
+    // Bytes committed across the end are parsed in order
+    assert(Fill(term, 0, "Hello", 5) == 5);
+    assert(session->pipeline_head == 2);
+    KTerm_Update(term);
+    assert(session->pipeline_tail == 2);
+    assert(GetScreenCell(session, 0, 0)->ch == 'H' && GetScreenCell(session, 0, 4)->ch == 'o');
+
+    // Full ring: nothing to reserve
+    session->pipeline_head = 5;
+    session->pipeline_tail = 6;
+    assert(KTerm_PipelineReserve(term, 0, &p1, &len1, &p2, &len2) == 0);
+    assert(p1 == NULL && p2 == NULL && len1 == 0 && len2 == 0);
+
+    // Committing more than is free is clamped and flagged
+    session->pipeline_head = 0;
+    session->pipeline_tail = 10;
+    assert(KTerm_PipelineCommit(term, 0, 100) == 9);
+    assert(session->pipeline_head == 9 && session->pipeline_overflow);
+
+    // A bulk write stores what fits and publishes it
+    session->pipeline_overflow = false;
+    session->pipeline_head = 0;
+    session->pipeline_tail = 6;
+    assert(KTerm_WriteData(term, 0, "abcdefgh", 8) == 5);
+    assert(session->pipeline_head == 5 && session->pipeline_overflow);
+    assert(memcmp(session->input_pipeline, "abcde", 5) == 0);
+    assert(KTerm_WriteData(term, -1, "x", 1) == 0);
+
+    // Invalid sessions reserve nothing
+    assert(KTerm_PipelineReserve(term, MAX_SESSIONS, &p1, &len1, &p2, &len2) == 0 && p1 == NULL);
+    assert(KTerm_PipelineCommit(term, -1, 1) == 0);
+    KTerm_Destroy(term);
+    printf("PASS: Spans\n");
+}
+
+typedef struct {
+    KTerm* term;
+    size_t total;
+} Producer;
+
+static void* ProducerThread(void* arg) {
+    Producer* producer = (Producer*)arg;
+    size_t sent = 0;
+    while (sent < producer->total) {
+        unsigned char *p1, *p2;
+        size_t len1, len2;
+        if (KTerm_PipelineReserve(producer->term, 1, &p1, &len1, &p2, &len2) == 0) continue;
+        size_t n = 0;
+        for (size_t i = 0; i < len1 && sent + n < producer->total; i++, n++) p1[i] = (unsigned char)((sent + n) % 251);
+        for (size_t i = 0; i < len2 && sent + n < producer->total; i++, n++) p2[i] = (unsigned char)((sent + n) % 251);
+        KTerm_PipelineCommit(producer->term, 1, n);
+        sent += n;
+    }
+    return NULL;
+}
+
+static void TestConcurrentProducer(void) {
+    printf("Testing a producer thread against a consumer...\n");
+    KTermConfig config = {0};
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    KTermSession* session = term->sessions[1];
+    Producer producer = { term, 64u << 20 };
+    pthread_t thread;
+    pthread_create(&thread, NULL, ProducerThread, &producer);
+
+    // Consume with the same ordering as KTerm_ProcessEventsInternal
+    size_t received = 0;
+    while (received < producer.total) {
+        int tail = atomic_load_explicit(&session->pipeline_tail, memory_order_relaxed);
+        int head = atomic_load_explicit(&session->pipeline_head, memory_order_acquire);
+        while (tail != head) {
+            assert(session->input_pipeline[tail] == (unsigned char)(received % 251));
+            received++;
+            tail = (tail + 1) & session->pipeline_mask;
+        }
+        atomic_store_explicit(&session->pipeline_tail, tail, memory_order_release);
+    }
+    pthread_join(thread, NULL);
+    assert(!session->pipeline_overflow);
+    KTerm_Destroy(term);
+    printf("PASS: %zu bytes in order\n", received);
+}
+
+static void BenchCopyVersusReserve(void) {
+    printf("Benchmarking per-byte and bulk writes against reserve/commit...\n");
+    const size_t total = 256u << 20;
+    static char chunk[65536];
+    memset(chunk, 'x', sizeof(chunk));
+    KTermConfig config = {0};
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    KTermSession* session = term->sessions[0];
+
+    // Both paths discard the data once the ring is half full, standing in for the parser
+    double start = MockWallTime();
+    for (size_t done = 0; done < total; done += sizeof(chunk)) {
+        for (size_t i = 0; i < sizeof(chunk); i++) KTerm_WriteCharToSession(term, 0, (unsigned char)chunk[i]);
+        if (((session->pipeline_head - session->pipeline_tail) & session->pipeline_mask) > session->pipeline_mask / 2) {
+            session->pipeline_tail = session->pipeline_head;
+        }
+    }
+    double per_byte = MockWallTime() - start;
+
+    start = MockWallTime();
+    for (size_t done = 0; done < total; done += sizeof(chunk)) {
+        assert(KTerm_WriteData(term, 0, chunk, sizeof(chunk)) == sizeof(chunk));
+        if (((session->pipeline_head - session->pipeline_tail) & session->pipeline_mask) > session->pipeline_mask / 2) {
+            session->pipeline_tail = session->pipeline_head;
+        }
+    }
+    double bulk = MockWallTime() - start;
+
+    start = MockWallTime();
+    for (size_t done = 0; done < total; done += sizeof(chunk)) {
+        assert(Fill(term, 0, chunk, sizeof(chunk)) == sizeof(chunk));
+        if (((session->pipeline_head - session->pipeline_tail) & session->pipeline_mask) > session->pipeline_mask / 2) {
+            session->pipeline_tail = session->pipeline_head;
+        }
+    }
+    double reserved = MockWallTime() - start;
+    assert(!session->pipeline_overflow);
+    KTerm_Destroy(term);
+    printf("  %zu MB: per byte %.1f ms, KTerm_WriteData %.1f ms, reserve/commit %.1f ms\n", total >> 20,
+           per_byte * 1e3, bulk * 1e3, reserved * 1e3);
+    printf("PASS: Reserve benchmark\n");
+}
+
+int main(void) {
+    TestSpans();
+    TestConcurrentProducer();
+    BenchCopyVersusReserve();
+    printf("All pipeline reserve tests passed.\n");
+    return 0;
+}
@@ -0,0 +1,247 @@
+#define KTERM_IMPLEMENTATION
+#define KTERM_PTY_IMPLEMENTATION
+#define KTERM_TESTING
+#include "../kt_pty.h"
+#include "mock_situation.h"
+#include <assert.h>
+#include <stdio.h>
+
+#define CAT_PATH "test_pty_input.txt"
+
+// Poll and update until the child has exited and its output is parsed
+static void RunUntilExit(KTermPty* pty, KTerm* term, int session_index, double timeout) {
+    KTermSession* session = term->sessions[session_index];
+    double deadline = MockWallTime() + timeout;
+    while (MockWallTime() < deadline) {
+        // Only wait for the child when there is nothing left to parse
+        KTermPty_Poll(pty, session->pipeline_head == session->pipeline_tail ? 10 : 0);
+        KTerm_Update(term);
+        if (!KTermPty_IsAlive(pty, session_index) && session->pipeline_head == session->pipeline_tail) break;
+    }
+    KTerm_Update(term);
+}
+
+// Poll and update until the screen shows `text` somewhere
+static bool WaitForText(KTermPty* pty, KTerm* term, const char* text, double timeout) {
+    KTermSession* session = GET_SESSION(term);
+    size_t len = strlen(text);
+    double deadline = MockWallTime() + timeout;
+    while (MockWallTime() < deadline) {
+        KTermPty_Poll(pty, 10);
+        KTerm_Update(term);
+        for (int y = 0; y < session->rows; y++) {
+            char line[512];
+            int n = 0;
+            for (int x = 0; x < session->cols && n < (int)sizeof(line) - 1; x++) {
+                line[n++] = (char)GetScreenCell(session, y, x)->ch;
+            }
+            line[n] = '\0';
+            for (int x = 0; x + (int)len <= n; x++) {
+                if (memcmp(line + x, text, len) == 0) return true;
+            }
+        }
+    }
+    return false;
+}
+
+static void TestCatThroughput(void) {
+    printf("Testing cat through a real pty...\n");
+    // 16 MB of log lines with some color
+    const size_t target = 16u << 20;
+    FILE* f = fopen(CAT_PATH, "wb");
+    assert(f);
+    size_t written = 0;
+    for (int i = 0; written < target; i++) {
+        written += (size_t)fprintf(f, "\x1B[3%dm%08d\x1B[m compiling src/module_%04d.c -O2 -Wall\n", i % 8, i, i % 1000);
+    }
+    fclose(f);
+
+    KTermConfig config = {0};
+    config.width = 132;
+    config.height = 50;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    // Parse as much as arrives each frame, as a throughput-bound host would
+    term->sessions[0]->VTperformance.chars_per_frame = KTERM_INPUT_PIPELINE_SIZE;
+    term->sessions[0]->VTperformance.time_budget = 1.0;
+    KTermPty pty;
+    assert(KTermPty_Init(&pty, term));
+    char* argv[] = { "cat", CAT_PATH, NULL };
+    double start = MockWallTime();
+    assert(KTermPty_Spawn(&pty, 0, "cat", argv, NULL));
+    RunUntilExit(&pty, term, 0, 60.0);
+    double elapsed = MockWallTime() - start;
+
+    KTermPtyChild* child = &pty.children[0];
+    assert(!KTermPty_IsAlive(&pty, 0));
+    // The line discipline turns each \n into \r\n
+    int lines = 0;
+    f = fopen(CAT_PATH, "rb");
+    for (int c; (c = fgetc(f)) != EOF;) lines += (c == '\n');
+    fclose(f);
+    assert(child->bytes_read == (uint64_t)written + (uint64_t)lines);
+    assert(child->reads < child->bytes_read / 64); // Batched, not byte by byte
+    printf("  %.1f MB in %.3f s (%.1f MB/s), %llu reads\n", child->bytes_read / (1024.0 * 1024.0), elapsed,
+           child->bytes_read / elapsed / (1024.0 * 1024.0), (unsigned long long)child->reads);
+    // The child is reaped by a later poll
+    for (double deadline = MockWallTime() + 10.0; child->alive && MockWallTime() < deadline;) KTermPty_Poll(&pty, 10);
+    assert(!child->alive && WIFEXITED(child->exit_status) && WEXITSTATUS(child->exit_status) == 0);
+    KTermPty_Destroy(&pty);
+    KTerm_Destroy(term);
+    remove(CAT_PATH);
+    printf("PASS: Cat throughput\n");
+}
+
+static void TestReplies(void) {
+    printf("Testing replies written back to the child...\n");
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    KTermPty pty;
+    assert(KTermPty_Init(&pty, term));
+    // The child asks for the device status and prints the reply in hex
+    char* argv[] = { "sh", "-c", "stty raw -echo; printf '\\033[5n'; head -c 4 | od -An -tx1; stty sane", NULL };
+    assert(KTermPty_Spawn(&pty, 0, "sh", argv, NULL));
+    assert(WaitForText(&pty, term, "1b 5b 30 6e", 10.0));
+    assert(pty.children[0].bytes_written >= 4);
+    KTermPty_Destroy(&pty);
+    KTerm_Destroy(term);
+    printf("PASS: Replies\n");
+}
+
+static void TestResize(void) {
+    printf("Testing window size propagation...\n");
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    KTermPty pty;
+    assert(KTermPty_Init(&pty, term));
+    char* argv[] = { "sh", "-c", "stty size; read line; stty size; sleep 5", NULL };
+    assert(KTermPty_Spawn(&pty, 0, "sh", argv, NULL));
+    assert(WaitForText(&pty, term, "25 80", 10.0));
+
+    KTerm_Resize(term, 100, 30);
+    KTerm_QueueResponse(term, "\r");
+    assert(WaitForText(&pty, term, "30 100", 10.0));
+    KTermPty_Destroy(&pty);
+    assert(term->session_resize_callback == NULL);
+    KTerm_Destroy(term);
+    printf("PASS: Resize\n");
+}
+
+static void TestEnvironment(void) {
+    printf("Testing the child environment...\n");
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    KTermPty pty;
+    assert(KTermPty_Init(&pty, term));
+    // The inherited environment gets TERM replaced, an explicit one is used as is
+    setenv("TERM", "dumb", 1);
+    char* argv[] = { "sh", "-c", "echo \"term=$TERM\"; sleep 5", NULL };
+    assert(KTermPty_Spawn(&pty, 0, "sh", argv, NULL));
+    assert(WaitForText(&pty, term, "term=xterm-256color", 10.0));
+    char* envp[] = { "TERM=vt100", NULL };
+    int second = KTerm_CreateSession(term);
+    assert(KTermPty_Spawn(&pty, second, "sh", argv, envp));
+    KTerm_SetActiveSession(term, second);
+    assert(WaitForText(&pty, term, "term=vt100", 10.0));
+    assert(!KTermPty_Spawn(&pty, KTerm_CreateSession(term), "kterm-no-such-program", argv, NULL));
+    KTermPty_Destroy(&pty);
+    KTerm_Destroy(term);
+    printf("PASS: Environment\n");
+}
+
+static void TestThrottledHangup(void) {
+    printf("Testing a child that exits while throttled...\n");
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    config.input_pipeline_size = 1024;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    KTermPty pty;
+    assert(KTermPty_Init(&pty, term));
+    // More than the pipeline holds, little enough for the kernel to take it all
+    char* argv[] = { "sh", "-c", "head -c 3000 /dev/zero | tr '\\0' x", NULL };
+    assert(KTermPty_Spawn(&pty, 0, "sh", argv, NULL));
+    KTermPtyChild* child = &pty.children[0];
+    for (double deadline = MockWallTime() + 10.0; !child->throttled && MockWallTime() < deadline;) KTermPty_Poll(&pty, 10);
+    assert(child->throttled);
+    while (waitpid(child->pid, &child->exit_status, WNOHANG) == 0) KTermPty_Poll(&pty, 10);
+
+    // The hangup waits with the rest of the output instead of waking every poll
+    double start = MockWallTime();
+    assert(KTermPty_Poll(&pty, 100) == 0);
+    assert(MockWallTime() - start >= 0.09);
+    assert(child->fd >= 0);
+
+    // Once the pipeline drains, the rest is read and the pty closed
+    for (double deadline = MockWallTime() + 10.0; child->fd >= 0 && MockWallTime() < deadline;) {
+        KTerm_Update(term);
+        KTermPty_Poll(&pty, 10);
+    }
+    assert(child->fd < 0 && child->bytes_read == 3000);
+    child->alive = false; // Reaped above
+    KTermPty_Destroy(&pty);
+    KTerm_Destroy(term);
+    printf("PASS: Throttled hangup\n");
+}
+
+static size_t fallback_bytes = 0;
+static size_t CountingSink(void* ctx, int session_index, const KTermIOVec* iov, int iovcnt) {
+    (void)ctx;
+    (void)session_index;
+    size_t total = 0;
+    for (int i = 0; i < iovcnt; i++) total += iov[i].iov_len;
+    fallback_bytes += total;
+    return total;
+}
+
+static void TestNoChild(void) {
+    printf("Testing output of a session without a child...\n");
+    // Goes to the sink that was installed before
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    KTerm_SetSessionSink(term, CountingSink, NULL);
+    KTermPty pty;
+    assert(KTermPty_Init(&pty, term));
+    KTerm_QueueResponse(term, "\x1B[0n");
+    KTerm_FlushOutput(term);
+    assert(fallback_bytes == 4);
+    KTermPty_Destroy(&pty);
+    assert(term->session_sink == CountingSink);
+    KTerm_Destroy(term);
+
+    // With nowhere to go it stays queued instead of being counted as written
+    term = KTerm_Create(config);
+    KTerm_Init(term);
+    assert(KTermPty_Init(&pty, term));
+    KTerm_QueueResponse(term, "\x1B[0n");
+    KTerm_FlushOutput(term);
+    KTermOutputStatus status;
+    assert(KTerm_GetOutputStatus(term, 0, &status) && status.pending == 4 && status.bytes_delivered == 0);
+    KTermPty_Destroy(&pty);
+    KTerm_Destroy(term);
+    printf("PASS: No child\n");
+}
+
+int main(void) {
+    TestCatThroughput();
+    TestReplies();
+    TestResize();
+    TestEnvironment();
+    TestThrottledHangup();
+    TestNoChild();
+    printf("All pty tests passed.\n");
+    return 0;
+}
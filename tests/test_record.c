@@ -0,0 +1,328 @@
+#define KTERM_IMPLEMENTATION
+#define KTERM_TESTING
+#include "../kterm.h"
+#include "mock_situation.h"
+#include <assert.h>
+#include <stdio.h>
+
+#define BIN_PATH "test_record.ktrc"
+#define CAST_PATH "test_record.cast"
+
+// Update until every session has parsed its input
+static void Drain(KTerm* term) {
+    for (int guard = 0; guard < 100000; guard++) {
+        bool pending = false;
+        for (int i = 0; i < MAX_SESSIONS; i++) {
+            if (term->sessions[i]->pipeline_head != term->sessions[i]->pipeline_tail) pending = true;
+        }
+        if (!pending) break;
+        KTerm_Update(term);
+    }
+    KTerm_Update(term);
+}
+
+static char* ReadFile(const char* path, long* size) {
+    FILE* f = fopen(path, "rb");
+    assert(f);
+    fseek(f, 0, SEEK_END);
+    *size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char* data = malloc((size_t)*size + 1);
+    assert(fread(data, 1, (size_t)*size, f) == (size_t)*size);
+    data[*size] = '\0';
+    fclose(f);
+    return data;
+}
+
+// The recorded session: colors, a scroll region, UTF-8 and a second session
+static void WriteWorkload(KTerm* term) {
+    KTerm_WriteString(term, "\x1B%G\x1B[1;31mred\x1B[m plain \xE2\x82\xAC\r\n");
+    for (int i = 0; i < 40; i++) KTerm_WriteFormat(term, "\x1B[38;2;%d;80;200mline %d\x1B[m\r\n", i * 5, i);
+    KTerm_Update(term);
+    MockSetTime(0.5);
+    KTerm_WriteString(term, "\x1B[5;10r\x1B[10H\n\n\x1B[r\x1B[HTOP");
+    const char* other = "session one\r\n";
+    for (const char* p = other; *p; p++) KTerm_WriteCharToSession(term, 1, (unsigned char)*p);
+    KTerm_Update(term);
+}
+
+static void TestBinaryRoundTrip(void) {
+    printf("Testing binary record and replay...\n");
+    MockSetTime(0.0);
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    assert(KTerm_RecordStart(term, BIN_PATH, KTERM_RECORD_BINARY));
+    WriteWorkload(term);
+    Drain(term);
+    MockSetTime(1.0);
+    KTerm_Resize(term, 100, 30);
+    KTerm_WriteString(term, "\x1B[30;1Hafter resize");
+    Drain(term);
+    uint64_t hash = KTerm_GetScreenHash(term);
+    KTerm_RecordStop(term);
+    assert(!KTerm_IsRecording(term));
+    KTerm_Destroy(term);
+
+    long size;
+    char* data = ReadFile(BIN_PATH, &size);
+    assert(memcmp(data, "KTRC", 4) == 0);
+    free(data);
+
+    KTerm* replay = KTerm_Create(config);
+    KTerm_Init(replay);
+    KTermReplayResult r;
+    assert(KTerm_Replay(replay, BIN_PATH, 0, &r));
+    assert(replay->width == 100 && replay->height == 30);
+    assert(r.resizes == 1);
+    assert(r.chunks >= 4);
+    assert(r.has_expected_hash && r.expected_hash == hash);
+    assert(r.hash_match && r.screen_hash == hash);
+    assert(r.recorded_seconds >= 1.0);
+    assert(replay->sessions[1]->screen_buffer[0].ch == 's');
+    KTerm_Destroy(replay);
+    printf("PASS: Binary round trip (%ld bytes, %d chunks)\n", size, r.chunks);
+}
+
+static void TestAsciicastRoundTrip(void) {
+    printf("Testing asciicast record and replay...\n");
+    MockSetTime(0.0);
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    assert(KTerm_RecordStart(term, CAST_PATH, KTERM_RECORD_ASCIICAST));
+    WriteWorkload(term);
+    // A UTF-8 sequence split across two frames stays intact
+    KTerm_WriteString(term, "\xE2\x82");
+    KTerm_Update(term);
+    KTerm_WriteString(term, "\xAC");
+    Drain(term);
+    uint64_t hash = KTerm_GetScreenHash(term);
+    KTerm_RecordStop(term);
+    KTerm_Destroy(term);
+
+    long size;
+    char* data = ReadFile(CAST_PATH, &size);
+    assert(strncmp(data, "{\"version\": 2, \"width\": 80, \"height\": 25", 40) == 0);
+    assert(strstr(data, "[0.000000, \"o\", \"\\u001b%G\\u001b[1;31mred") != NULL);
+    assert(strstr(data, "[0.500000, \"o\", ") != NULL);
+    assert(strstr(data, "session one") == NULL); // Only the active session
+    assert(strstr(data, "\\ufffd") == NULL);
+    assert(strstr(data, "\"m\", \"kterm-hash:") != NULL);
+    free(data);
+
+    KTerm* replay = KTerm_Create(config);
+    KTerm_Init(replay);
+    KTermReplayResult r;
+    assert(KTerm_Replay(replay, CAST_PATH, 0, &r));
+    assert(r.has_expected_hash && r.hash_match && r.screen_hash == hash);
+    KTerm_Destroy(replay);
+    printf("PASS: Asciicast round trip\n");
+}
+
+static void TestForeignAsciicast(void) {
+    printf("Testing replay of an asciinema capture...\n");
+    FILE* f = fopen(CAST_PATH, "wb");
+    fputs("{\"version\": 2, \"width\": 40, \"height\": 10, \"timestamp\": 1700000000, \"env\": {\"TERM\": \"xterm\"}}\n", f);
+    fputs("[0.1, \"o\", \"\\u001b[1mbold\\u001b[0m \\\"q\\\" caf\\u00e9 \\ud83d\\ude00\\r\\n\"]\n", f);
+    fputs("[0.2, \"i\", \"ignored\"]\n", f);
+    fputs("[0.3, \"o\", \"tab\\there\"]\n", f);
+    fclose(f);
+
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    KTerm* replay = KTerm_Create(config);
+    KTerm_Init(replay);
+    GET_SESSION(replay)->charset.g0 = CHARSET_UTF8;
+    KTermReplayResult r;
+    assert(KTerm_Replay(replay, CAST_PATH, 0, &r));
+    assert(replay->width == 40 && replay->height == 10);
+    assert(!r.has_expected_hash && r.hash_match);
+    assert(r.chunks == 2);
+
+    // Same bytes fed directly give the same screen
+    config.width = 40;
+    config.height = 10;
+    KTerm* direct = KTerm_Create(config);
+    KTerm_Init(direct);
+    GET_SESSION(direct)->charset.g0 = CHARSET_UTF8;
+    KTerm_WriteString(direct, "\x1B[1mbold\x1B[0m \"q\" caf\xC3\xA9 \xF0\x9F\x98\x80\r\ntab\there");
+    Drain(direct);
+    assert(KTerm_GetScreenHash(direct) == r.screen_hash);
+    KTerm_Destroy(direct);
+    KTerm_Destroy(replay);
+    printf("PASS: Foreign asciicast\n");
+}
+
+static void TestHashMismatch(void) {
+    printf("Testing hash mismatch detection...\n");
+    MockSetTime(0.0);
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    assert(KTerm_RecordStart(term, BIN_PATH, KTERM_RECORD_BINARY));
+    KTerm_WriteString(term, "expected text");
+    Drain(term);
+    KTerm_RecordStop(term);
+    KTerm_Destroy(term);
+
+    // Corrupt one recorded byte
+    long size;
+    char* data = ReadFile(BIN_PATH, &size);
+    char* hit = NULL;
+    for (long i = 16; i + 4 <= size && !hit; i++) {
+        if (memcmp(data + i, "text", 4) == 0) hit = data + i;
+    }
+    assert(hit);
+    hit[0] = 'T';
+    FILE* f = fopen(BIN_PATH, "wb");
+    fwrite(data, 1, (size_t)size, f);
+    fclose(f);
+    free(data);
+
+    KTerm* replay = KTerm_Create(config);
+    KTerm_Init(replay);
+    KTermReplayResult r;
+    assert(KTerm_Replay(replay, BIN_PATH, 0, &r));
+    assert(r.has_expected_hash && !r.hash_match);
+    KTerm_Destroy(replay);
+
+    // Truncated files are rejected
+    f = fopen(BIN_PATH, "wb");
+    fwrite("KTRC\x01\x00\x50\x00\x19\x00\x04\x00\x00\x00\x00\x00\x01\x05", 1, 18, f);
+    fclose(f);
+    replay = KTerm_Create(config);
+    KTerm_Init(replay);
+    assert(!KTerm_Replay(replay, BIN_PATH, 0, &r));
+    assert(!KTerm_Replay(replay, "does_not_exist.ktrc", 0, &r));
+    KTerm_Destroy(replay);
+    printf("PASS: Hash mismatch\n");
+}
+
+static atomic_bool producer_stop;
+
+static kterm_thread_result_t Producer(void* arg) {
+    KTerm* term = (KTerm*)arg;
+    while (!atomic_load(&producer_stop)) {
+        KTerm_WriteCharToSession(term, 0, 'x');
+    }
+    return KTERM_THREAD_RESULT_OK;
+}
+
+static void TestStopWithProducer(void) {
+    printf("Testing start/stop with a producer thread...\n");
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    atomic_store(&producer_stop, false);
+    kterm_thread_t thread;
+    assert(KTERM_THREAD_CREATE(thread, Producer, term));
+
+    // Stopping must not free anything the producer may still be writing through
+    for (int i = 0; i < 200; i++) {
+        assert(KTerm_RecordStart(term, BIN_PATH, KTERM_RECORD_BINARY));
+        KTerm_Update(term);
+        KTerm_RecordStop(term);
+        assert(!KTerm_IsRecording(term));
+        KTerm_Update(term);
+    }
+    atomic_store(&producer_stop, true);
+    KTERM_THREAD_JOIN(thread);
+
+    long size;
+    char* data = ReadFile(BIN_PATH, &size);
+    assert(size >= 14 && memcmp(data, "KTRC", 4) == 0);
+    free(data);
+    KTerm_Destroy(term);
+    printf("PASS: Start/stop with a producer\n");
+}
+
+static void TestTimedReplay(void) {
+    printf("Testing replay at recorded speed...\n");
+    MockSetTime(0.0);
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    assert(KTerm_RecordStart(term, BIN_PATH, KTERM_RECORD_BINARY));
+    KTerm_WriteString(term, "first");
+    KTerm_Update(term);
+    MockSetTime(0.2);
+    KTerm_WriteString(term, " second");
+    Drain(term);
+    KTerm_RecordStop(term);
+    KTerm_Destroy(term);
+
+    KTerm* replay = KTerm_Create(config);
+    KTerm_Init(replay);
+    KTermReplayResult r;
+    double start = MockWallTime();
+    assert(KTerm_Replay(replay, BIN_PATH, 1.0, &r));
+    double elapsed = MockWallTime() - start;
+    assert(r.hash_match);
+    assert(elapsed >= 0.19 && r.elapsed_seconds >= 0.19);
+
+    // Double speed takes half as long; speed 0 does not wait at all
+    start = MockWallTime();
+    assert(KTerm_Replay(replay, BIN_PATH, 2.0, &r));
+    assert(MockWallTime() - start >= 0.09);
+    start = MockWallTime();
+    assert(KTerm_Replay(replay, BIN_PATH, 0, &r));
+    assert(MockWallTime() - start < 0.09);
+    KTerm_Destroy(replay);
+    printf("PASS: Timed replay (%.3f s for 0.2 s recorded)\n", elapsed);
+}
+
+static void BenchReplay(void) {
+    printf("Benchmarking replay of a recorded capture...\n");
+    MockSetTime(0.0);
+    KTermConfig config = {0};
+    config.width = 132;
+    config.height = 50;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    assert(KTerm_RecordStart(term, BIN_PATH, KTERM_RECORD_BINARY));
+    for (int f = 0; f < 200; f++) {
+        for (int l = 0; l < 20; l++) {
+            KTerm_WriteFormat(term, "\x1B[%dm%05d\x1B[m build/obj/file_%04d.o linking\r\n", 31 + l % 7, f, l);
+        }
+        KTerm_Update(term);
+    }
+    Drain(term);
+    KTerm_RecordStop(term);
+    KTerm_Destroy(term);
+
+    KTerm* replay = KTerm_Create(config);
+    KTerm_Init(replay);
+    KTermReplayResult r;
+    assert(KTerm_Replay(replay, BIN_PATH, 0, &r));
+    assert(r.hash_match && r.has_expected_hash);
+    printf("  %llu bytes in %d chunks: %.3f s (%.1f MB/s)\n", (unsigned long long)r.bytes, r.chunks,
+           r.elapsed_seconds, (double)r.bytes / r.elapsed_seconds / (1024.0 * 1024.0));
+    KTerm_Destroy(replay);
+    printf("PASS: Replay benchmark\n");
+}
+
+int main(void) {
+    TestBinaryRoundTrip();
+    TestAsciicastRoundTrip();
+    TestForeignAsciicast();
+    TestHashMismatch();
+    TestTimedReplay();
+    TestStopWithProducer();
+    BenchReplay();
+    remove(BIN_PATH);
+    remove(CAST_PATH);
+    printf("All record/replay tests passed.\n");
+    return 0;
+}
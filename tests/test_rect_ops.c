@@ -11,7 +11,7 @@ void test_fill_rect_op(void) {
     config.width = 20;
     config.height = 10;
     KTerm* term = KTerm_Create(config);
-    KTermSession* session = &term->sessions[term->active_session];
+    KTermSession* session = term->sessions[term->active_session];
 
     // 1. Fill screen with 'A'
     for(int i=0; i<term->height * term->width; i++) {
@@ -52,7 +52,7 @@ void test_copy_rect_op(void) {
     config.width = 20;
     config.height = 10;
     KTerm* term = KTerm_Create(config);
-    KTermSession* session = &term->sessions[term->active_session];
+    KTermSession* session = term->sessions[term->active_session];
 
     // 1. Write "SOURCE" at (1,1)
     KTerm_WriteString(term, "\x1B[1;1HSOURCE");
@@ -86,7 +86,7 @@ void test_set_attr_rect_op(void) {
     config.width = 20;
     config.height = 10;
     KTerm* term = KTerm_Create(config);
-    KTermSession* session = &term->sessions[term->active_session];
+    KTermSession* session = term->sessions[term->active_session];
 
     // 1. Write "TEXT" at (1,1)
     KTerm_WriteString(term, "\x1B[1;1HTEXT");
@@ -125,7 +125,7 @@ void test_reverse_attr_rect_op(void) {
     config.width = 20;
     config.height = 10;
     KTerm* term = KTerm_Create(config);
-    KTermSession* session = &term->sessions[term->active_session];
+    KTermSession* session = term->sessions[term->active_session];
 
     // 1. Write "BOLD" at (1,1) with BOLD attribute
     KTerm_WriteString(term, "\x1B[1mBOLD");
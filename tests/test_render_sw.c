@@ -0,0 +1,271 @@
+#define KTERM_IMPLEMENTATION
+#define KTERM_RENDER_SW_IMPLEMENTATION
+#define KTERM_TESTING
+#include "../kt_render_sw.h"
+#include "mock_situation.h"
+#include <assert.h>
+#include <stdio.h>
+
+static void feed(KTerm* term, const char* data) {
+    for (size_t i = 0; i < strlen(data); i++) {
+        KTerm_ProcessChar(term, GET_SESSION(term), (unsigned char)data[i]);
+    }
+}
+
+static uint32_t PixelAt(KTermSoftRenderer* sw, int x, int y) {
+    uint32_t c;
+    memcpy(&c, &sw->pixels[((size_t)y * sw->width + x) * 4], 4);
+    return c;
+}
+
+// First pixel of `glyph` fully covered in the atlas, as an offset inside the cell
+static bool CoveredPixel(KTerm* term, uint32_t glyph, int* ox, int* oy) {
+    int gx = (int)(glyph % term->atlas_cols) * term->char_width;
+    int gy = (int)(glyph / term->atlas_cols) * term->char_height;
+    for (int y = 0; y < term->char_height; y++) {
+        for (int x = 0; x < term->char_width; x++) {
+            if (term->font_atlas_pixels[((size_t)(gy + y) * term->atlas_width + gx + x) * 4] == 255) {
+                *ox = x; *oy = y;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static uint32_t PaletteColor(KTerm* term, int index) {
+    RGB_KTermColor c = term->color_palette[index];
+    return (uint32_t)c.r | ((uint32_t)c.g << 8) | ((uint32_t)c.b << 16) | 0xFF000000u;
+}
+
+static void TestText(KTerm* term, KTermSoftRenderer* sw) {
+    printf("Testing text shading...\n");
+    feed(term, "\x1B[?25l\x1B[H\x1B[2JH\x1B[7mR\x1B[m");
+    KTerm_Update(term);
+    assert(KTermSW_Render(sw));
+    assert(sw->width == term->width * term->char_width);
+    assert(sw->height == term->height * term->char_height);
+    assert(sw->full_redraw);
+    assert(sw->cells_shaded == term->width * term->height);
+
+    int ox, oy;
+    assert(CoveredPixel(term, 'H', &ox, &oy));
+    uint32_t fg = PaletteColor(term, 7);
+    assert(PixelAt(sw, ox, oy) == fg);
+
+    // Blank cells show the opaque clear color
+    assert(PixelAt(sw, 10 * term->char_width, 5 * term->char_height) == 0xFF000000u);
+
+    // Reverse video: the background of 'R' takes the foreground color
+    int rx = term->char_width, ry = 0;
+    int gx, gy;
+    assert(CoveredPixel(term, 'R', &gx, &gy));
+    bool found_bg = false;
+    for (int y = 0; y < term->char_height && !found_bg; y++) {
+        for (int x = 0; x < term->char_width; x++) {
+            if (PixelAt(sw, rx + x, ry + y) == fg) { found_bg = true; break; }
+        }
+    }
+    assert(found_bg);
+    printf("PASS: Text shading\n");
+}
+
+static void TestDirtyCells(KTerm* term, KTermSoftRenderer* sw) {
+    printf("Testing dirty cell tracking...\n");
+
+    // Nothing changed: nothing shaded
+    KTerm_Update(term);
+    assert(KTermSW_Render(sw));
+    assert(!sw->full_redraw);
+    assert(sw->cells_shaded == 0);
+
+    // One character: only cells of the rewritten row
+    feed(term, "\x1B[10;20HX");
+    KTerm_Update(term);
+    assert(KTermSW_Render(sw));
+    assert(!sw->full_redraw);
+    assert(sw->cells_shaded > 0 && sw->cells_shaded <= term->width);
+    assert(sw->tiles_shaded <= (term->width + KTERM_SW_TILE_COLS - 1) / KTERM_SW_TILE_COLS);
+
+    // The same change reaches the other render buffer, then everything is clean
+    KTerm_Update(term);
+    assert(KTermSW_Render(sw));
+    KTerm_Update(term);
+    assert(KTermSW_Render(sw));
+    assert(sw->cells_shaded == 0);
+
+    int ox, oy;
+    assert(CoveredPixel(term, 'X', &ox, &oy));
+    assert(PixelAt(sw, 19 * term->char_width + ox, 9 * term->char_height + oy) == PaletteColor(term, 7));
+
+    // A full invalidation shades everything again
+    KTermSW_Invalidate(sw);
+    assert(KTermSW_Render(sw));
+    assert(sw->full_redraw && sw->cells_shaded == term->width * term->height);
+    printf("PASS: Dirty cells\n");
+}
+
+static void TestThreadsMatch(KTerm* term, KTermSoftRenderer* sw) {
+    printf("Testing threaded and single-threaded output match...\n");
+    feed(term, "\x1B[H\x1B[1;4;31mbold red underline\x1B[m \x1B[9mstrike\x1B[m \x1B[53mover\x1B[m");
+    feed(term, "\x1B[3H\x1B#6wide line");
+    KTerm_Update(term);
+    assert(KTermSW_Render(sw));
+
+    KTermSoftRenderer single;
+    assert(KTermSW_Init(&single, term, 1));
+    assert(single.threads == 1);
+    assert(KTermSW_Render(&single));
+    assert(single.width == sw->width && single.height == sw->height);
+    assert(memcmp(single.pixels, sw->pixels, (size_t)sw->width * sw->height * 4) == 0);
+    KTermSW_Destroy(&single);
+    printf("PASS: Threads match\n");
+}
+
+// Damaged tiles leave the same pixels as a full redraw
+static void AssertMatchesFresh(KTerm* term, KTermSoftRenderer* sw) {
+    KTermSoftRenderer fresh;
+    assert(KTermSW_Init(&fresh, term, 1));
+    assert(KTermSW_Render(&fresh));
+    assert(memcmp(fresh.pixels, sw->pixels, (size_t)sw->width * sw->height * 4) == 0);
+    KTermSW_Destroy(&fresh);
+}
+
+static void TestKittyLayers(KTerm* term, KTermSoftRenderer* sw) {
+    printf("Testing Kitty image layers...\n");
+    // 1x1 opaque red, in front of the text
+    feed(term, "\x1B[20;1H\x1B_Ga=T,i=9,f=32,s=1,v=1;/wAA/w==\x1B\\");
+    KTerm_Update(term);
+    assert(KTermSW_Render(sw));
+    // A new overlay only redraws the tile under it
+    assert(!sw->full_redraw && sw->tiles_shaded == 1);
+    KTermRenderBuffer* rb = &term->render_buffers[term->rb_front];
+    assert(rb->kitty_count == 1);
+    KittyRenderOp* op = &rb->kitty_ops[0];
+    assert(op->pixels != NULL);
+    assert(PixelAt(sw, op->x, op->y) == 0xFF0000FFu);
+    AssertMatchesFresh(term, sw);
+
+    // Unchanged overlay: back to dirty cells only
+    KTerm_Update(term);
+    assert(KTermSW_Render(sw));
+    assert(!sw->full_redraw);
+
+    // Behind the text (z < 0) it shows through the transparent default background
+    feed(term, "\x1B_Ga=d,d=a;\x1B\\");
+    feed(term, "\x1B[20;1H\x1B_Ga=T,i=10,f=32,s=1,v=1,z=-1;/wAA/w==\x1B\\");
+    KTerm_Update(term);
+    assert(KTermSW_Render(sw));
+    rb = &term->render_buffers[term->rb_front];
+    assert(rb->kitty_count == 1 && rb->kitty_ops[0].z_index < 0);
+    assert(PixelAt(sw, rb->kitty_ops[0].x, rb->kitty_ops[0].y) == 0xFF0000FFu);
+    feed(term, "\x1B_Ga=d,d=a;\x1B\\");
+    KTerm_Update(term);
+    printf("PASS: Kitty layers\n");
+}
+
+static void TestKittyReplace(KTerm* term, KTermSoftRenderer* sw) {
+    printf("Testing Kitty replacement across frames...\n");
+    feed(term, "\x1B[20;1H\x1B_Ga=T,i=11,f=32,s=1,v=1;/wAA/w==\x1B\\");
+    KTerm_Update(term);
+    assert(KTermSW_Render(sw));
+    KTermRenderBuffer* rb = &term->render_buffers[term->rb_front];
+    assert(rb->kitty_count == 1);
+    int x = rb->kitty_ops[0].x, y = rb->kitty_ops[0].y;
+    assert(PixelAt(sw, x, y) == 0xFF0000FFu);
+
+    // The header frees the old frames; the rest of the payload arrives a frame later
+    feed(term, "\x1B[20;1H\x1B_Ga=T,i=11,f=32,s=1,v=1;AP8A");
+    KTerm_Update(term);
+    assert(KTermSW_Render(sw));
+    rb = &term->render_buffers[term->rb_front];
+    assert(rb->kitty_count == 0);
+    assert(PixelAt(sw, x, y) != 0xFF0000FFu);
+
+    feed(term, "/w==\x1B\\");
+    KTerm_Update(term);
+    assert(KTermSW_Render(sw));
+    rb = &term->render_buffers[term->rb_front];
+    assert(rb->kitty_count == 1);
+    assert(PixelAt(sw, rb->kitty_ops[0].x, rb->kitty_ops[0].y) == 0xFF00FF00u);
+    feed(term, "\x1B_Ga=d,d=a;\x1B\\");
+    KTerm_Update(term);
+    printf("PASS: Kitty replacement\n");
+}
+
+static void TestSixelDamage(KTerm* term, KTermSoftRenderer* sw) {
+    printf("Testing sixel damage...\n");
+    // A 16x6 red block; the sixel layer is stretched over the screen
+    feed(term, "\x1B[1;1H\x1BPq#1;2;100;0;0#1!16~\x1B\\");
+    KTerm_Update(term);
+    assert(KTermSW_Render(sw));
+    KTermRenderBuffer* rb = &term->render_buffers[term->rb_front];
+    assert(rb->sixel_active && rb->sixel_count == 16);
+    assert(!sw->full_redraw);
+    AssertMatchesFresh(term, sw);
+
+    // Only the last column changes: one column of tiles is shaded
+    feed(term, "\x1B[1;1H\x1BPq#1;2;100;0;0#1!15~@\x1B\\");
+    KTerm_Update(term);
+    assert(KTermSW_Render(sw));
+    assert(!sw->full_redraw && sw->tiles_shaded > 0 && sw->tiles_shaded <= sw->tile_rows);
+    AssertMatchesFresh(term, sw);
+    printf("PASS: Sixel damage\n");
+}
+
+static void BenchRender(KTerm* term) {
+    printf("Benchmarking software rendering...\n");
+    char line[128];
+    for (int threads = 1; threads <= 4; threads *= 4) {
+        KTermSoftRenderer sw;
+        KTermSW_Init(&sw, term, threads);
+        KTermSW_Render(&sw);
+
+        double start = MockWallTime();
+        const int frames = 50;
+        for (int f = 0; f < frames; f++) KTermSW_Invalidate(&sw), KTermSW_Render(&sw);
+        double full_ms = (MockWallTime() - start) / frames;
+
+        // One status line changing per frame
+        start = MockWallTime();
+        long shaded = 0;
+        for (int f = 0; f < frames; f++) {
+            snprintf(line, sizeof(line), "\x1B[25;1Hframe %d", f);
+            feed(term, line);
+            KTerm_Update(term);
+            KTermSW_Render(&sw);
+            shaded += sw.cells_shaded;
+        }
+        double dirty_ms = (MockWallTime() - start) / frames;
+        printf("  %d thread(s): full frame %.2f ms, status line %.3f ms (%.1f cells/frame)\n",
+               sw.threads, full_ms, dirty_ms, (double)shaded / frames);
+        KTermSW_Destroy(&sw);
+    }
+    printf("PASS: Render benchmark\n");
+}
+
+int main(void) {
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+
+    KTermSoftRenderer sw;
+    assert(KTermSW_Init(&sw, term, 4));
+    assert(term->software_renderers == 1);
+
+    TestText(term, &sw);
+    TestDirtyCells(term, &sw);
+    TestThreadsMatch(term, &sw);
+    TestKittyLayers(term, &sw);
+    TestKittyReplace(term, &sw);
+    TestSixelDamage(term, &sw);
+    KTermSW_Destroy(&sw);
+
+    BenchRender(term);
+
+    KTerm_Cleanup(term);
+    printf("All software renderer tests passed.\n");
+    return 0;
+}
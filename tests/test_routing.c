@@ -21,10 +21,10 @@ void test_gateway_routing() {
 
     // Initialize 2 sessions
     KTerm_InitSession(term, 1);
-    term->sessions[1].session_open = true;
+    term->sessions[1]->session_open = true;
 
-    KTermSession* session0 = &term->sessions[0];
-    KTermSession* session1 = &term->sessions[1];
+    KTermSession* session0 = term->sessions[0];
+    KTermSession* session1 = term->sessions[1];
 
     printf("Testing ReGIS Routing...\n");
     // Send Gateway Command to route ReGIS to Session 1
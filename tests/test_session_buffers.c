@@ -0,0 +1,130 @@
+#define KTERM_IMPLEMENTATION
+#define KTERM_TESTING
+#include "../kterm.h"
+#include "mock_situation.h"
+#include <assert.h>
+#include <stdio.h>
+
+static char replies[256];
+static size_t replies_len;
+
+static void Capture(KTerm* term, const char* data, int len) {
+    (void)term;
+    memcpy(replies + replies_len, data, (size_t)len);
+    replies_len += (size_t)len;
+}
+
+static size_t Footprint(KTerm* term, int index, KTermSessionFootprint* fp) {
+    assert(KTerm_GetSessionFootprint(term, index, fp));
+    return fp->input_pipeline + fp->key_events + fp->op_queue + fp->responses;
+}
+
+static void TestDefaults(void) {
+    printf("Testing default sizes...\n");
+    KTermConfig config = {0};
+    KTerm* term = KTerm_Create(config);
+    // Nothing big is embedded in the terminal any more
+    assert(sizeof(KTerm) < 256 * 1024);
+
+    KTermSessionFootprint fp;
+    Footprint(term, 0, &fp);
+    assert(fp.input_pipeline == KTERM_INPUT_PIPELINE_SIZE);
+    assert(fp.key_events == KEY_EVENT_BUFFER_SIZE * sizeof(KTermEvent));
+    assert(fp.op_queue == KTERM_OP_QUEUE_SIZE * sizeof(KTermOp));
+    assert(fp.responses == KTERM_OUTPUT_PIPELINE_SIZE);
+    assert(fp.screen > 0 && fp.total > fp.screen);
+
+    // Sessions that were never opened hold none of these buffers
+    for (int i = 1; i < MAX_SESSIONS; i++) assert(Footprint(term, i, &fp) == 0);
+    assert(!KTerm_GetSessionFootprint(term, MAX_SESSIONS, &fp));
+    KTerm_Destroy(term);
+    printf("PASS: Defaults\n");
+}
+
+static void TestConfiguredSizes(void) {
+    printf("Testing configured sizes...\n");
+    KTermConfig config = {0};
+    config.input_pipeline_size = 5000;
+    config.key_event_buffer_size = 100;
+    config.op_queue_size = 1000;
+    config.response_buffer_size = 1024;
+    config.response_callback = Capture;
+    KTerm* term = KTerm_Create(config);
+
+    // Rings round up to a power of two
+    KTermSessionFootprint fp;
+    Footprint(term, 0, &fp);
+    assert(fp.input_pipeline == 8192 && term->sessions[0]->pipeline_mask == 8191);
+    assert(fp.key_events == 128 * sizeof(KTermEvent));
+    assert(fp.op_queue == 1024 * sizeof(KTermOp));
+    assert(fp.responses == 1024);
+    KTermOutputStatus status;
+    assert(KTerm_GetOutputStatus(term, 0, &status) && status.capacity == 1024);
+
+    // Feeding a closed session allocates what it uses
+    const char* query = "\x1B[5n";
+    for (const char* p = query; *p; p++) KTerm_WriteCharToSession(term, 1, (unsigned char)*p);
+    Footprint(term, 1, &fp);
+    assert(fp.input_pipeline == 8192 && fp.key_events == 0 && fp.responses == 0);
+    replies_len = 0;
+    KTerm_Update(term);
+    assert(replies_len == 4 && memcmp(replies, "\x1B[0n", 4) == 0);
+    Footprint(term, 1, &fp);
+    assert(fp.responses == 1024 && fp.key_events == 0);
+
+    // Text fills the small ring in several frames without loss
+    char line[8000];
+    memset(line, 'a', sizeof(line));
+    for (size_t i = 0; i < sizeof(line); i++) KTerm_WriteCharToSession(term, 0, (unsigned char)line[i]);
+    assert(!term->sessions[0]->pipeline_overflow);
+    for (size_t i = 0; i < sizeof(line); i++) KTerm_WriteCharToSession(term, 0, 'b');
+    assert(term->sessions[0]->pipeline_overflow); // 8191 usable bytes
+
+    // Activating a session opens it completely
+    KTerm_SetActiveSession(term, 2);
+    Footprint(term, 2, &fp);
+    assert(fp.input_pipeline == 8192 && fp.key_events == 128 * sizeof(KTermEvent) && fp.op_queue == 1024 * sizeof(KTermOp));
+    assert(Footprint(term, 3, &fp) == 0);
+    KTerm_Destroy(term);
+    printf("PASS: Configured sizes\n");
+}
+
+static void TestManyTerminals(void) {
+    printf("Testing many small terminals...\n");
+    enum { COUNT = 16 };
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 24;
+    config.input_pipeline_size = 16 * 1024;
+    config.key_event_buffer_size = 256;
+    config.op_queue_size = 1024;
+    config.response_buffer_size = 1024;
+    KTerm* terms[COUNT];
+    size_t total = 0, screens = 0, buffers = 0;
+    for (int t = 0; t < COUNT; t++) {
+        terms[t] = KTerm_Create(config);
+        assert(terms[t]);
+        KTerm_WriteString(terms[t], "\x1B[1mhello\x1B[m\r\n");
+        KTerm_Update(terms[t]);
+        total += sizeof(KTerm);
+        for (int i = 0; i < MAX_SESSIONS; i++) {
+            KTermSessionFootprint fp;
+            buffers += Footprint(terms[t], i, &fp);
+            screens += fp.screen;
+            total += fp.total - fp.session_struct;
+        }
+    }
+    assert(GetScreenCell(GET_SESSION(terms[COUNT - 1]), 0, 0)->ch == 'h');
+    printf("  %d terminals: %.1f MB in total, %.1f MB of screens, %.1f MB of session buffers\n", COUNT,
+           total / (1024.0 * 1024.0), screens / (1024.0 * 1024.0), buffers / (1024.0 * 1024.0));
+    for (int t = 0; t < COUNT; t++) KTerm_Destroy(terms[t]);
+    printf("PASS: Many terminals\n");
+}
+
+int main(void) {
+    TestDefaults();
+    TestConfiguredSizes();
+    TestManyTerminals();
+    printf("All session buffer tests passed.\n");
+    return 0;
+}
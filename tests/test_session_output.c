@@ -0,0 +1,239 @@
+#define KTERM_IMPLEMENTATION
+#define KTERM_TESTING
+#include "../kterm.h"
+#include "mock_situation.h"
+#include <assert.h>
+#include <stdio.h>
+
+typedef struct {
+    char data[MAX_SESSIONS][200000];
+    size_t len[MAX_SESSIONS];
+    int calls[MAX_SESSIONS];
+    int max_iovcnt;
+    size_t budget; // Bytes accepted per call, (size_t)-1 for all
+} Host;
+
+static size_t HostSink(void* ctx, int session_index, const KTermIOVec* iov, int iovcnt) {
+    Host* host = (Host*)ctx;
+    size_t accepted = 0;
+    host->calls[session_index]++;
+    if (iovcnt > host->max_iovcnt) host->max_iovcnt = iovcnt;
+    for (int i = 0; i < iovcnt; i++) {
+        size_t n = iov[i].iov_len;
+        if (n > host->budget - accepted) n = host->budget - accepted;
+        memcpy(host->data[session_index] + host->len[session_index], iov[i].iov_base, n);
+        host->len[session_index] += n;
+        accepted += n;
+    }
+    return accepted;
+}
+
+static int warnings;
+
+static void CountWarnings(KTerm* term, KTermErrorLevel level, KTermErrorSource source, const char* msg, void* user_data) {
+    (void)term; (void)source; (void)msg; (void)user_data;
+    if (level == KTERM_LOG_WARNING) warnings++;
+}
+
+static void AttachHost(KTerm* term, Host* host) {
+    memset(host, 0, sizeof(*host));
+    host->budget = (size_t)-1;
+    KTerm_SetSessionSink(term, HostSink, host);
+}
+
+static void WriteToSession(KTerm* term, int index, const char* data) {
+    for (const char* p = data; *p; p++) KTerm_WriteCharToSession(term, index, (unsigned char)*p);
+}
+
+static void TestRouting(void) {
+    printf("Testing per-session reply routing...\n");
+    static Host host;
+    KTermConfig config = {0};
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    AttachHost(term, &host);
+
+    // Session 1 is in the background; its reply must not land in session 0
+    WriteToSession(term, 1, "\x1B[5n");
+    WriteToSession(term, 0, "\x1B[6n");
+    KTerm_Update(term);
+    assert(host.len[1] == 4 && memcmp(host.data[1], "\x1B[0n", 4) == 0);
+    assert(host.len[0] == 6 && memcmp(host.data[0], "\x1B[1;1R", 6) == 0);
+    assert(host.calls[0] == 1 && host.calls[1] == 1 && host.calls[2] == 0);
+
+    // Muted sessions queue nothing
+    KTerm_SetResponseEnabled(term, 1, false);
+    WriteToSession(term, 1, "\x1B[5n");
+    KTerm_Update(term);
+    assert(host.len[1] == 4);
+    KTerm_Destroy(term);
+
+    // The legacy buffer is per session as well
+    term = KTerm_Create(config);
+    WriteToSession(term, 1, "\x1B[5n");
+    for (int i = 0; i < MAX_SESSIONS; i++) {
+        term->output_session = i;
+        KTerm_ProcessEventsInternal(term, term->sessions[i]);
+    }
+    term->output_session = -1;
+    assert(term->sessions[0]->response_length == 0);
+    assert(term->sessions[1]->response_length == 4);
+
+    // Switching to a session sink moves buffered replies over
+    KTerm_SetSessionSink(term, HostSink, &host);
+    memset(&host, 0, sizeof(host));
+    host.budget = (size_t)-1;
+    KTerm_Update(term);
+    assert(term->sessions[1]->response_length == 0);
+    assert(host.len[1] == 4 && memcmp(host.data[1], "\x1B[0n", 4) == 0);
+    KTerm_Destroy(term);
+    printf("PASS: Routing\n");
+}
+
+static void TestBatching(void) {
+    printf("Testing per-frame batching...\n");
+    static Host host;
+    KTermConfig config = {0};
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    AttachHost(term, &host);
+
+    // A flood of queries is one delivery per frame that parsed some of it
+    for (int i = 0; i < 1000; i++) WriteToSession(term, 0, "\x1B[5n");
+    int frames = 0;
+    do {
+        KTerm_Update(term);
+        frames++;
+    } while (term->sessions[0]->pipeline_head != term->sessions[0]->pipeline_tail);
+    assert(host.len[0] == 4000);
+    assert(host.calls[0] == frames && frames < 1000);
+    KTermOutputStatus status;
+    assert(KTerm_GetOutputStatus(term, 0, &status));
+    assert(status.writes == 1000 && status.bytes_delivered == 4000 && status.pending == 0);
+
+    // Nothing queued, nothing delivered
+    int calls = host.calls[0];
+    KTerm_Update(term);
+    assert(host.calls[0] == calls);
+
+    // Data across the end of the ring arrives as two pieces, in order
+    host.len[0] = 0;
+    char reply[1000];
+    memset(reply, 'x', sizeof(reply) - 1);
+    reply[sizeof(reply) - 1] = '\0';
+    while ((term->sessions[0]->output_head & (KTERM_OUTPUT_RING_SIZE - 1)) < KTERM_OUTPUT_RING_SIZE - 500) {
+        KTerm_QueueResponse(term, reply);
+        KTerm_FlushOutput(term);
+    }
+    host.len[0] = 0;
+    host.max_iovcnt = 0;
+    KTerm_QueueResponse(term, "head");
+    KTerm_QueueResponse(term, reply);
+    KTerm_FlushOutput(term);
+    assert(host.max_iovcnt == 2);
+    assert(host.len[0] == 4 + 999 && memcmp(host.data[0], "headxxx", 7) == 0);
+    KTerm_Destroy(term);
+    printf("PASS: Batching\n");
+}
+
+static void TestBackpressure(void) {
+    printf("Testing backpressure...\n");
+    static Host host;
+    KTermConfig config = {0};
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    AttachHost(term, &host);
+    KTerm_SetErrorCallback(term, CountWarnings, NULL);
+
+    // The host takes 3 bytes per frame; the rest waits, in order
+    host.budget = 3;
+    KTerm_QueueResponse(term, "ABCDEFGH");
+    KTerm_Update(term);
+    KTermOutputStatus status;
+    KTerm_GetOutputStatus(term, 0, &status);
+    assert(host.len[0] == 3 && status.pending == 5 && status.backpressure && status.stalls == 1);
+    KTerm_Update(term);
+    KTerm_Update(term);
+    KTerm_GetOutputStatus(term, 0, &status);
+    assert(host.len[0] == 8 && memcmp(host.data[0], "ABCDEFGH", 8) == 0);
+    assert(status.pending == 0 && !status.backpressure);
+
+    // A host that accepts nothing: whole replies are dropped and reported once
+    host.budget = 0;
+    warnings = 0;
+    char reply[1001];
+    memset(reply, 'y', 1000);
+    reply[1000] = '\0';
+    for (int i = 0; i < 70; i++) KTerm_QueueResponse(term, reply);
+    KTerm_GetOutputStatus(term, 0, &status);
+    assert(status.pending == 65000 && status.bytes_dropped == 5000);
+    assert(status.backpressure && warnings == 1);
+
+    // Once the host drains the ring, new replies fit again
+    host.budget = (size_t)-1;
+    KTerm_FlushOutput(term);
+    KTerm_QueueResponse(term, reply);
+    KTerm_GetOutputStatus(term, 0, &status);
+    assert(status.pending == 1000 && status.bytes_dropped == 5000 && !status.backpressure);
+    KTerm_Destroy(term);
+
+    // The legacy buffer reports its drops too
+    term = KTerm_Create(config);
+    KTerm_SetErrorCallback(term, CountWarnings, NULL);
+    warnings = 0;
+    for (int i = 0; i < 20; i++) KTerm_QueueResponse(term, reply);
+    KTerm_GetOutputStatus(term, 0, &status);
+    assert(status.bytes_dropped > 0 && warnings == 1);
+    assert(status.pending == (size_t)term->sessions[0]->response_length);
+    KTerm_Destroy(term);
+    printf("PASS: Backpressure\n");
+}
+
+static int direct_calls;
+
+static void DirectSink(void* ctx, const char* data, size_t len) {
+    (void)ctx; (void)data; (void)len;
+    direct_calls++;
+}
+
+static void BenchReportFlood(void) {
+    printf("Benchmarking a report flood...\n");
+    // Mouse motion and status polling: 20 frames of 500 short reports each
+    static Host host;
+    const int frames = 20, per_frame = 500;
+    KTermConfig config = {0};
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    AttachHost(term, &host);
+    double start = MockWallTime();
+    for (int f = 0; f < frames; f++) {
+        for (int i = 0; i < per_frame; i++) KTerm_QueueResponse(term, "\x1B[<35;40;12M");
+        KTerm_Update(term);
+    }
+    double batched = MockWallTime() - start;
+    assert(host.calls[0] == frames);
+    KTerm_Destroy(term);
+
+    term = KTerm_Create(config);
+    KTerm_SetOutputSink(term, DirectSink, NULL);
+    start = MockWallTime();
+    for (int f = 0; f < frames; f++) {
+        for (int i = 0; i < per_frame; i++) KTerm_QueueResponse(term, "\x1B[<35;40;12M");
+        KTerm_Update(term);
+    }
+    double direct = MockWallTime() - start;
+    assert(direct_calls == frames * per_frame);
+    KTerm_Destroy(term);
+    printf("  %d reports: %d sink calls (%.2f ms) vs %d direct calls (%.2f ms)\n", frames * per_frame,
+           host.calls[0], batched * 1e3, direct_calls, direct * 1e3);
+    printf("PASS: Report flood benchmark\n");
+}
+
+int main(void) {
+    TestRouting();
+    TestBatching();
+    TestBackpressure();
+    BenchReportFlood();
+    printf("All session output tests passed.\n");
+    return 0;
+}
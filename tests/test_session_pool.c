@@ -0,0 +1,347 @@
+#define KTERM_IMPLEMENTATION
+#define KTERM_TESTING
+#include "../kterm.h"
+#include "mock_situation.h"
+#include <assert.h>
+#include <pthread.h>
+#include <stdio.h>
+
+static void Feed(KTerm* term, int index, const char* text) {
+    for (const char* p = text; *p; p++) KTerm_WriteCharToSession(term, index, (unsigned char)*p);
+}
+
+static void TestHandles(void) {
+    printf("Testing session handles...\n");
+    // Small per-session buffers so hundreds of sessions fit comfortably
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 24;
+    config.input_pipeline_size = 16 * 1024;
+    config.key_event_buffer_size = 256;
+    config.op_queue_size = 1024;
+    config.response_buffer_size = 1024;
+    config.scrollback_lines = 50;
+    KTerm* term = KTerm_Create(config);
+    assert(KTerm_GetSessionCount(term) == MAX_SESSIONS);
+    assert(term->sessions[0]->session_open && !term->sessions[1]->session_open);
+    assert(term->sessions[0]->buffer_height == 24 + 50);
+
+    // The closed sessions made by KTerm_Init are handed out first
+    assert(KTerm_CreateSession(term) == 1);
+    KTermSession* first = term->sessions[1];
+    Feed(term, 1, "kept");
+    KTerm_Update(term);
+
+    // Growing the table moves no session
+    int handles[300];
+    for (int i = 0; i < 300; i++) {
+        handles[i] = KTerm_CreateSession(term);
+        assert(handles[i] >= 0 && term->sessions[handles[i]]->session_open);
+        assert(term->sessions[handles[i]]->index == handles[i]);
+    }
+    assert(KTerm_GetSessionCount(term) == 302);
+    assert(term->sessions[1] == first && GetScreenCell(first, 0, 0)->ch == 'k');
+
+    // Closing frees the session's buffers but the input ring; the active session cannot be closed
+    KTermSession* closed = term->sessions[handles[100]];
+    Feed(term, handles[100], "gone");
+    KTerm_CloseSession(term, handles[100]);
+    KTerm_CloseSession(term, 0);
+    assert(term->sessions[0]->session_open);
+    assert(!closed->session_open && !closed->screen_buffer && !closed->op_queue.ops);
+    unsigned char* ring = closed->input_pipeline;
+    assert(ring);
+    KTermOutputStatus status;
+    assert(!KTerm_GetOutputStatus(term, handles[100], &status));
+    assert(KTerm_GetSessionHandle(term, handles[100]) == -1);
+
+    // The slot is reused under a new handle; the old one does not reach the new session
+    int reused = KTerm_CreateSession(term);
+    assert(KTERM_SESSION_INDEX(reused) == handles[100] && reused != handles[100]);
+    assert(KTerm_GetSessionCount(term) == 302 && KTerm_GetSessionHandle(term, handles[100]) == reused);
+    assert(closed->input_pipeline == ring);
+    Feed(term, handles[100], "stale");
+    assert(closed->pipeline_head == closed->pipeline_tail);
+    Feed(term, reused, "new");
+    KTerm_Update(term);
+    assert(GetScreenCell(closed, 0, 0)->ch == 'n' && GetScreenCell(closed, 0, 3)->ch == ' ');
+    assert(KTerm_GetOutputStatus(term, reused, &status));
+
+    // Sessions beyond the first MAX_SESSIONS are reachable everywhere
+    int last = handles[299];
+    Feed(term, last, "\x1B[5n");
+    KTerm_Update(term);
+    assert(KTerm_GetOutputStatus(term, last, &status) && status.writes == 1);
+    KTermSessionStats stats;
+    assert(KTerm_GetSessionStats(term, last, &stats));
+    assert(!KTerm_GetSessionStats(term, 302, &stats));
+    KTerm_SetActiveSession(term, last);
+    assert(term->active_session == last);
+    KTerm_Destroy(term);
+    printf("PASS: Handles\n");
+}
+
+static void TestOnlyBusySessionsVisited(void) {
+    printf("Testing the update list...\n");
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 24;
+    config.input_pipeline_size = 16 * 1024;
+    config.key_event_buffer_size = 256;
+    config.op_queue_size = 1024;
+    config.response_buffer_size = 1024;
+    config.scrollback_lines = 50;
+    KTerm* term = KTerm_Create(config);
+    for (int i = 0; i < 60; i++) assert(KTerm_CreateSession(term) >= 0);
+
+    // Only the active session is on screen
+    KTerm_Update(term);
+    assert(term->update_count == 0);
+
+    // A background session is visited while it has input, then dropped
+    Feed(term, 40, "\x1B[31mbackground\x1B[m");
+    KTerm_ListWokenSessions(term);
+    assert(term->update_count == 1 && term->update_list[0] == 40);
+    KTerm_Update(term);
+    assert(GetScreenCell(term->sessions[40], 0, 0)->ch == 'b');
+    assert(term->update_count == 0 && !term->sessions[40]->update_listed);
+
+    // More input than one frame parses keeps the session listed
+    term->sessions[41]->VTperformance.chars_per_frame = 100;
+    term->sessions[41]->VTperformance.time_budget = 1.0;
+    for (int i = 0; i < 1000; i++) Feed(term, 41, "x");
+    KTerm_Update(term);
+    assert(term->update_count == 1 && term->update_list[0] == 41);
+    int frames = 1;
+    while (term->update_count > 0) {
+        KTerm_Update(term);
+        frames++;
+    }
+    assert(frames >= 10 && GetScreenCell(term->sessions[41], 12, 39)->ch == 'x');
+
+    // Visible panes are visited every frame, idle or not
+    KTermPane* pane = KTerm_SplitPane(term, term->layout->root, PANE_SPLIT_HORIZONTAL, 0.5f);
+    assert(pane);
+    KTerm_SetStatsEnabled(term, true);
+    for (int f = 0; f < 3; f++) KTerm_Update(term);
+    KTermSessionStats shown, hidden;
+    assert(KTerm_GetSessionStats(term, pane->session_index, &shown) && shown.flush.count == 3);
+    assert(KTerm_GetSessionStats(term, 30, &hidden) && hidden.flush.count == 0);
+    KTerm_Destroy(term);
+    printf("PASS: Update list\n");
+}
+
+typedef struct {
+    KTerm* term;
+    int first, count, rounds;
+} Writer;
+
+static void* WriterThread(void* arg) {
+    Writer* w = (Writer*)arg;
+    for (int r = 0; r < w->rounds; r++) {
+        for (int i = 0; i < w->count; i++) {
+            unsigned char *p1, *p2;
+            size_t len1, len2;
+            while (KTerm_PipelineReserve(w->term, w->first + i, &p1, &len1, &p2, &len2) == 0) {}
+            p1[0] = 'z';
+            KTerm_PipelineCommit(w->term, w->first + i, 1);
+        }
+    }
+    return NULL;
+}
+
+static void TestWakeFromThread(void) {
+    printf("Testing wakes from another thread...\n");
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 24;
+    config.input_pipeline_size = 16 * 1024;
+    config.key_event_buffer_size = 256;
+    config.op_queue_size = 1024;
+    config.response_buffer_size = 1024;
+    config.scrollback_lines = 50;
+    KTerm* term = KTerm_Create(config);
+    for (int i = 0; i < 64; i++) assert(KTerm_CreateSession(term) >= 0);
+    Writer w = { term, 4, 60, 50 };
+    pthread_t thread;
+    pthread_create(&thread, NULL, WriterThread, &w);
+    for (int f = 0; f < 2000; f++) KTerm_Update(term);
+    pthread_join(thread, NULL);
+    // Whatever arrived after the last frame is picked up by the next ones
+    for (int f = 0; f < 4; f++) KTerm_Update(term);
+    for (int i = 0; i < w.count; i++) {
+        KTermSession* session = term->sessions[w.first + i];
+        assert(session->pipeline_head == session->pipeline_tail);
+        assert(GetScreenCell(session, 0, w.rounds - 1)->ch == 'z');
+    }
+    KTerm_Destroy(term);
+    printf("PASS: Wakes\n");
+}
+
+typedef struct {
+    KTerm* term;
+    atomic_int handle;
+    atomic_int reserved; // Spans handed out so far
+    atomic_bool stop;
+} Churn;
+
+// Writes through every span it reserves a byte at a time, so a ring freed under it is written after free
+static void* ChurnWriter(void* arg) {
+    Churn* c = (Churn*)arg;
+    while (!atomic_load(&c->stop)) {
+        int handle = atomic_load(&c->handle);
+        unsigned char *p1, *p2;
+        size_t len1, len2;
+        if (KTerm_PipelineReserve(c->term, handle, &p1, &len1, &p2, &len2) > 0) {
+            atomic_fetch_add(&c->reserved, 1);
+            for (size_t i = 0; i < len1; i++) ((volatile unsigned char*)p1)[i] = 'x';
+            for (size_t i = 0; i < len2; i++) ((volatile unsigned char*)p2)[i] = 'y';
+            KTerm_PipelineCommit(c->term, handle, len1 + len2);
+        }
+        KTerm_WriteData(c->term, handle, "data", 4);
+        KTerm_WriteCharToSession(c->term, handle, '.');
+    }
+    return NULL;
+}
+
+static void TestCloseWhileWriting(void) {
+    printf("Testing close while another thread writes...\n");
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 24;
+    config.input_pipeline_size = 16 * 1024;
+    config.scrollback_lines = 50;
+    KTerm* term = KTerm_Create(config);
+    int handle = KTerm_CreateSession(term);
+    assert(handle >= 0);
+    int index = KTERM_SESSION_INDEX(handle);
+    Churn c = { .term = term };
+    atomic_store(&c.handle, handle);
+    atomic_store(&c.reserved, 0);
+    atomic_store(&c.stop, false);
+    int reserved = 0;
+    pthread_t thread;
+    pthread_create(&thread, NULL, ChurnWriter, &c);
+    for (int round = 0; round < 2000; round++) {
+        if (round % 16 == 0) KTerm_Update(term);
+        // Close right after the writer got a span of this session, while it is still writing through it
+        while (atomic_load(&c.reserved) == reserved) {}
+        KTerm_CloseSession(term, handle);
+        assert(!term->sessions[index]->session_open && term->sessions[index]->input_pipeline);
+        // The writer may still hold the old handle's lookup; the ring it writes is still there
+        handle = KTerm_CreateSession(term);
+        assert(KTERM_SESSION_INDEX(handle) == index);
+        // Taken before the writer can see the new handle; it reserves nothing through the old one
+        reserved = atomic_load(&c.reserved);
+        atomic_store(&c.handle, handle);
+    }
+    atomic_store(&c.stop, true);
+    pthread_join(thread, NULL);
+    KTerm_Destroy(term);
+    printf("PASS: Close while writing\n");
+}
+
+static void TestLayoutMap(void) {
+    printf("Testing the pane map...\n");
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 24;
+    config.input_pipeline_size = 16 * 1024;
+    config.key_event_buffer_size = 256;
+    config.op_queue_size = 1024;
+    config.response_buffer_size = 1024;
+    config.scrollback_lines = 50;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Resize(term, 240, 120);
+
+    // 48 panes: keep splitting the newest pane
+    KTermPane* pane = term->layout->root;
+    for (int i = 1; i < 48; i++) {
+        pane = KTerm_SplitPane(term, pane, (i & 1) ? PANE_SPLIT_HORIZONTAL : PANE_SPLIT_VERTICAL, 0.9f);
+        assert(pane);
+    }
+    assert(KTermLayout_GetLeafCount(term->layout) == 48);
+    assert(KTerm_GetSessionCount(term) == 48);
+    for (int s = 0; s < 48; s++) {
+        KTermPane* leaf = KTermLayout_FindSessionPane(term->layout, s);
+        assert(leaf && leaf->type == PANE_LEAF && leaf->session_index == s);
+    }
+    assert(KTermLayout_FindSessionPane(term->layout, 48) == NULL);
+
+    // Focus cycling visits every pane once, then wraps
+    KTermPane* start = KTermLayout_GetLeaf(term->layout, 0);
+    KTermPane* p = start;
+    int steps = 0;
+    do {
+        p = KTermLayout_NextLeaf(term->layout, p);
+        steps++;
+    } while (p != start && steps < 100);
+    assert(steps == 48);
+
+    // Closing a pane reindexes
+    KTerm_ClosePane(term, KTermLayout_FindSessionPane(term->layout, 20));
+    assert(KTermLayout_GetLeafCount(term->layout) == 47);
+    assert(KTermLayout_FindSessionPane(term->layout, 20) == NULL);
+    assert(KTermLayout_FindSessionPane(term->layout, 21)->session_index == 21);
+
+    // A split the layout refuses closes the session it opened
+    assert(!KTerm_SplitPane(term, term->layout->root, PANE_LEAF, 0.5f));
+    assert(KTerm_GetSessionCount(term) == 48 && !term->sessions[20]->session_open);
+    assert(!term->sessions[20]->screen_buffer && KTerm_GetSessionHandle(term, 20) == -1);
+    KTerm_Destroy(term);
+    printf("PASS: Pane map\n");
+}
+
+// Average KTerm_Update time with `busy` background sessions printing a line each frame.
+// visit_all lists every session each frame, as the fixed-array loop used to.
+static double MeasureUpdate(int sessions, int busy, int frames, bool visit_all) {
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 24;
+    config.input_pipeline_size = 16 * 1024;
+    config.key_event_buffer_size = 256;
+    config.op_queue_size = 1024;
+    config.response_buffer_size = 1024;
+    config.scrollback_lines = 50;
+    KTerm* term = KTerm_Create(config);
+    while (KTerm_GetSessionCount(term) < sessions) assert(KTerm_CreateSession(term) >= 0);
+    for (int i = 1; i < MAX_SESSIONS; i++) KTerm_CreateSession(term);
+    for (int f = 0; f < 10; f++) KTerm_Update(term);
+
+    double start = MockWallTime();
+    for (int f = 0; f < frames; f++) {
+        for (int b = 0; b < busy; b++) Feed(term, 1 + b, "build: ok\r\n");
+        if (visit_all) {
+            for (int i = 0; i < sessions; i++) KTerm_ListSession(term, term->sessions[i]);
+        }
+        KTerm_Update(term);
+    }
+    double per_frame = (MockWallTime() - start) / frames;
+    KTerm_Destroy(term);
+    return per_frame;
+}
+
+static void BenchIdleSessions(void) {
+    printf("Benchmarking KTerm_Update with mostly idle sessions...\n");
+    const int frames = 2000, busy = 3;
+    double small = MeasureUpdate(MAX_SESSIONS, busy, frames, false);
+    double large = MeasureUpdate(256, busy, frames, false);
+    double every = MeasureUpdate(256, busy, frames, true);
+    printf("  %d sessions: %.1f us per update\n", MAX_SESSIONS, small * 1e6);
+    printf("  256 sessions, %d busy: %.1f us per update\n", busy, large * 1e6);
+    printf("  256 sessions, all visited: %.1f us per update\n", every * 1e6);
+    // Idle sessions are not visited, so the cost follows the busy ones
+    assert(large < small * 2 + 20e-6);
+    printf("PASS: Idle sessions benchmark\n");
+}
+
+int main(void) {
+    TestHandles();
+    TestOnlyBusySessionsVisited();
+    TestWakeFromThread();
+    TestCloseWhileWriting();
+    TestLayoutMap();
+    BenchIdleSessions();
+    printf("All session pool tests passed.\n");
+    return 0;
+}
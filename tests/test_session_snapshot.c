@@ -0,0 +1,543 @@
+#define KTERM_IMPLEMENTATION
+#define KTERM_TESTING
+#include "../kterm.h"
+#include "mock_situation.h"
+#include <assert.h>
+#include <stdio.h>
+
+#define SNAPSHOT_PATH "test_session_snapshot.bin"
+
+// Few enough bytes per frame that the op queue never fills
+static void LimitFrameInput(KTerm* term) {
+    term->sessions[0]->VTperformance.chars_per_frame = 4096;
+    term->sessions[0]->VTperformance.time_budget = 1.0;
+}
+
+static void Drain(KTerm* term, int index) {
+    KTermSession* s = term->sessions[index];
+    while (s->pipeline_head != s->pipeline_tail || s->op_queue.count > 0) KTerm_Update(term);
+}
+
+static void Feed(KTerm* term, int index, const char* data, size_t len) {
+    size_t sent = 0;
+    while (sent < len) {
+        unsigned char *p1, *p2;
+        size_t len1, len2;
+        KTerm_PipelineReserve(term, index, &p1, &len1, &p2, &len2);
+        size_t n = (len - sent < len1) ? len - sent : len1;
+        memcpy(p1, data + sent, n);
+        KTerm_PipelineCommit(term, index, n);
+        sent += n;
+        KTerm_Update(term);
+    }
+    Drain(term, index);
+}
+
+static void Run(KTerm* term, const char* text) {
+    Feed(term, 0, text, strlen(text));
+}
+
+static bool SameColor(ExtendedKTermColor a, ExtendedKTermColor b) {
+    if (a.color_mode != b.color_mode) return false;
+    if (a.color_mode == 2) return true;
+    if (a.color_mode == 0) return a.value.index == b.value.index;
+    return a.value.rgb.r == b.value.rgb.r && a.value.rgb.g == b.value.rgb.g && a.value.rgb.b == b.value.rgb.b;
+}
+
+static void AssertSameCell(const EnhancedTermChar* a, const EnhancedTermChar* b) {
+    assert(a->ch == b->ch);
+    assert((a->flags & ~KTERM_FLAG_DIRTY) == (b->flags & ~KTERM_FLAG_DIRTY));
+    assert(SameColor(a->fg_color, b->fg_color) && SameColor(a->bg_color, b->bg_color));
+    assert(SameColor(a->ul_color, b->ul_color) && SameColor(a->st_color, b->st_color));
+}
+
+static int CharsetSlot(const CharsetState* cs, const CharacterSet* p) {
+    if (p == &cs->g0) return 0;
+    if (p == &cs->g1) return 1;
+    if (p == &cs->g2) return 2;
+    if (p == &cs->g3) return 3;
+    return -1;
+}
+
+static void AssertSameCharset(const CharsetState* a, const CharsetState* home_a, const CharsetState* b, const CharsetState* home_b) {
+    assert(a->g0 == b->g0 && a->g1 == b->g1 && a->g2 == b->g2 && a->g3 == b->g3);
+    assert(CharsetSlot(home_a, a->gl) == CharsetSlot(home_b, b->gl) && CharsetSlot(home_b, b->gl) >= 0);
+    assert(CharsetSlot(home_a, a->gr) == CharsetSlot(home_b, b->gr) && CharsetSlot(home_b, b->gr) >= 0);
+    assert(a->single_shift_2 == b->single_shift_2 && a->single_shift_3 == b->single_shift_3);
+}
+
+// Everything a snapshot carries, compared in logical order (the restored ring starts at row 0)
+static void AssertSameSession(KTerm* ta, KTermSession* a, KTerm* tb, KTermSession* b) {
+    assert(a->cols == b->cols && a->rows == b->rows);
+    assert(a->dec_modes == b->dec_modes);
+    assert(a->history_rows_populated == b->history_rows_populated && a->view_offset == b->view_offset);
+    int history = (a->dec_modes & KTERM_MODE_ALTSCREEN) ? 0 : a->history_rows_populated;
+    for (int y = -history; y < a->rows; y++) {
+        EnhancedTermChar* ra = GetActiveScreenRow(a, y);
+        EnhancedTermChar* rb = GetActiveScreenRow(b, y);
+        for (int x = 0; x < a->cols; x++) AssertSameCell(&ra[x], &rb[x]);
+    }
+    if (ta->active_session == a->index && tb->active_session == b->index) {
+        assert(KTerm_GetScreenHash(ta) == KTerm_GetScreenHash(tb));
+    }
+
+    assert(a->cursor.x == b->cursor.x && a->cursor.y == b->cursor.y);
+    assert(a->cursor.visible == b->cursor.visible && a->cursor.shape == b->cursor.shape);
+    assert(a->saved_cursor_valid == b->saved_cursor_valid);
+    if (a->saved_cursor_valid) {
+        assert(a->saved_cursor.x == b->saved_cursor.x && a->saved_cursor.y == b->saved_cursor.y);
+        assert(a->saved_cursor.attributes == b->saved_cursor.attributes);
+        assert(SameColor(a->saved_cursor.fg_color, b->saved_cursor.fg_color));
+        AssertSameCharset(&a->saved_cursor.charset, &a->charset, &b->saved_cursor.charset, &b->charset);
+    }
+    assert(a->current_attributes == b->current_attributes);
+    assert(SameColor(a->current_fg, b->current_fg) && SameColor(a->current_bg, b->current_bg));
+    assert(SameColor(a->current_ul_color, b->current_ul_color));
+    assert(a->sgr_stack_depth == b->sgr_stack_depth);
+    for (int i = 0; i < a->sgr_stack_depth; i++) {
+        assert(a->sgr_stack[i].attributes == b->sgr_stack[i].attributes);
+        assert(SameColor(a->sgr_stack[i].fg_color, b->sgr_stack[i].fg_color));
+    }
+    assert(a->ansi_modes.insert_replace == b->ansi_modes.insert_replace);
+    assert(a->ansi_modes.line_feed_new_line == b->ansi_modes.line_feed_new_line);
+    assert(a->scroll_top == b->scroll_top && a->scroll_bottom == b->scroll_bottom);
+    assert(a->left_margin == b->left_margin && a->right_margin == b->right_margin);
+    AssertSameCharset(&a->charset, &a->charset, &b->charset, &b->charset);
+    for (int x = 0; x < a->cols; x++) assert(a->tab_stops.stops[x] == b->tab_stops.stops[x]);
+    assert(a->input.keypad_application_mode == b->input.keypad_application_mode);
+    assert(a->mouse.mode == b->mouse.mode && a->mouse.sgr_mode == b->mouse.sgr_mode);
+    assert(a->bracketed_paste.enabled == b->bracketed_paste.enabled);
+    assert(a->conformance.level == b->conformance.level && a->conformance.features == b->conformance.features);
+    assert(strcmp(a->title.window_title, b->title.window_title) == 0);
+    assert(strcmp(a->title.icon_title, b->title.icon_title) == 0);
+
+    assert(a->soft_font.active == b->soft_font.active && strcmp(a->soft_font.name, b->soft_font.name) == 0);
+    for (int i = 0; i < 256; i++) {
+        assert(a->soft_font.loaded[i] == b->soft_font.loaded[i]);
+        if (a->soft_font.loaded[i]) assert(memcmp(a->soft_font.font_data[i], b->soft_font.font_data[i], 32) == 0);
+    }
+
+    assert(a->kitty.image_count == b->kitty.image_count && a->kitty.placement_count == b->kitty.placement_count);
+    for (int i = 0; i < a->kitty.image_count; i++) {
+        KittyImageBuffer* ia = &a->kitty.images[i];
+        KittyImageBuffer* ib = KTerm_KittyFindImage(&b->kitty, ia->id);
+        assert(ib && ia->frame_count == ib->frame_count && ia->visible == ib->visible);
+        assert(ia->x == ib->x && ia->y == ib->y && ia->placement_count == ib->placement_count);
+        assert(KTerm_SnapshotScrolled(a, ia->start_row) == KTerm_SnapshotScrolled(b, ib->start_row));
+        for (int f = 0; f < ia->frame_count; f++) {
+            assert(ia->frames[f].size == ib->frames[f].size);
+            assert(memcmp(ia->frames[f].data, ib->frames[f].data, ia->frames[f].size) == 0);
+        }
+    }
+    // Frames come back sized to their data
+    assert(b->kitty.current_memory_usage <= a->kitty.current_memory_usage);
+    assert(a->sixel.strip_count == b->sixel.strip_count);
+    if (a->sixel.strip_count > 0) {
+        assert(memcmp(a->sixel.strips, b->sixel.strips, a->sixel.strip_count * sizeof(GPUSixelStrip)) == 0);
+    }
+
+    assert(a->parse_state == b->parse_state && a->escape_pos == b->escape_pos);
+    assert(memcmp(a->escape_buffer, b->escape_buffer, (size_t)a->escape_pos) == 0);
+    assert(a->utf8.bytes_remaining == b->utf8.bytes_remaining && a->utf8.codepoint == b->utf8.codepoint);
+    assert(a->last_char == b->last_char);
+    assert(((a->pipeline_head - a->pipeline_tail) & a->pipeline_mask) == ((b->pipeline_head - b->pipeline_tail) & b->pipeline_mask));
+}
+
+// A fresh terminal with session 0 restored from `src`'s session 0
+static KTerm* RoundTrip(KTerm* src, int scrollback, unsigned int flags) {
+    unsigned char* data;
+    size_t size;
+    assert(KTerm_SerializeSession(src, 0, flags, &data, &size));
+    assert(size > 12 && memcmp(data, "KTSS", 4) == 0);
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 24;
+    config.scrollback_lines = scrollback;
+    KTerm* dst = KTerm_Create(config);
+    LimitFrameInput(dst);
+    assert(KTerm_RestoreSession(dst, 0, data, size));
+    KTerm_Free(data);
+    return dst;
+}
+
+typedef struct {
+    const char* name;
+    const char* setup;        // Brings the session to the state to capture
+    const char* continuation; // Fed to both sessions after the restore
+} Scenario;
+
+static const Scenario scenarios[] = {
+    { "SGR and the SGR stack",
+      "\x1B[1;3;4:3;58:2::255:0:0;38;2;10;20;30;48;5;200mstyled\x1B[#{\x1B[7;9mpushed\x1B[#}\x1B[53mover\r\n\x1B[#{\x1B[31m",
+      "after\x1B[#}plain\x1B[m" },
+    { "Margins and origin mode",
+      "\x1B[?69h\x1B[5;40s\x1B[3;10r\x1B[?6h\x1B[Hin the region\r\n",
+      "1\r\n2\r\n3\r\n4\r\n5\r\n6\r\n7\r\n8\r\n9\r\n10\r\n11\x1B[2;3Hx" },
+    { "Tab stops",
+      "\x1B[3g\x1B[5G\x1BH\x1B[20G\x1BH\x1B[33G\x1BH\r\tA\tB",
+      "\r\n\tX\tY\tZ" },
+    { "Charsets and shifts",
+      "\x1B)0\x1B*A\x1B+0\x0Eqqq\x1Bn#",
+      "#lqk\x0F ascii\x1BN#\x1B}" },
+    { "Saved cursor",
+      "\x1B[5;10H\x1B[32;1m\x1B(0\x1B" "7\x1B(B\x1B[m\x1B[HXX",
+      "\x1B" "8qqq" },
+    { "Alternate screen",
+      "main text\r\n\x1B[?1049h\x1B[2J\x1B[Halt text",
+      "\x1B[?1049lback" },
+    { "Protected cells",
+      "\x1B[1\"qKEEP\x1B[0\"q erase me\r\n",
+      "\x1B[?2J\x1B[Hx" },
+    { "Soft font",
+      "\x1BP1;33;1{@A/B\x1B\\\x1B( @!\"",
+      "!!\x1B(B!" },
+    { "Kitty images",
+      "\x1B_Ga=T,i=20,s=1,v=1,x=50,y=50;AAAA/w==\x1B\\\x1B_Ga=p,i=20,p=3,x=5,y=5\x1B\\line\r\nline\r\n",
+      "\x1B_Ga=p,i=20,p=4\x1B\\\x1B_Ga=d,d=i,i=20,p=3\x1B\\" },
+    { "Sixel",
+      "\x1BPq#1;2;100;0;0#1~~~~$-~~\x1B\\",
+      "text" },
+    { "Title",
+      "\x1B]2;build server\x07\x1B]1;icon\x07",
+      "\x1B]2;renamed\x07" },
+    { "Input and terminal modes",
+      "\x1B[?1h\x1B=\x1B[?2004h\x1B[?1000h\x1B[?1006h\x1B[?1004h\x1B[4h\x1B[20h\x1B[?7l\x1B[3 q\x1B[?25l",
+      "insert\rX\nlf" },
+    { "Pending wrap",
+      "\x1B[24;1Hxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx",
+      "y" },
+    { "Repeat",
+      "a\x1B[5b",
+      "\x1B[3b" },
+    { "Inside a CSI sequence",
+      "abc\x1B[3",
+      "1mred\x1B[0m" },
+    { "Inside a UTF-8 sequence",
+      "caf\xC3",
+      "\xA9!" },
+    { "VT52 mode",
+      "\x1B[?2l\x1BY((x",
+      "\x1BH\x1BJhi\x1B<\x1B[2;2Hansi" },
+};
+
+static void TestRoundTrip(void) {
+    printf("Testing round trips of feature states...\n");
+    for (size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++) {
+        const Scenario* s = &scenarios[i];
+        for (int compress = 0; compress <= 1; compress++) {
+            KTermConfig config = {0};
+            config.width = 80;
+            config.height = 24;
+            config.scrollback_lines = 200;
+            KTerm* a = KTerm_Create(config);
+            LimitFrameInput(a);
+            Run(a, s->setup);
+            KTerm* b = RoundTrip(a, 200, compress ? KTERM_SNAPSHOT_COMPRESS : 0);
+            AssertSameSession(a, a->sessions[0], b, b->sessions[0]);
+            // The restored session goes on exactly as the original
+            Run(a, s->continuation);
+            Run(b, s->continuation);
+            AssertSameSession(a, a->sessions[0], b, b->sessions[0]);
+            KTerm_Destroy(a);
+            KTerm_Destroy(b);
+        }
+        printf("  %s\n", s->name);
+    }
+    printf("PASS: Round trips\n");
+}
+
+static size_t BuildLog(char* buf, size_t cap, int lines) {
+    size_t n = 0;
+    for (int i = 0; i < lines && n + 256 < cap; i++) {
+        n += (size_t)snprintf(buf + n, cap - n, "\x1B[3%dm%06d\x1B[m compiling src/module_%04d.c -O2 -Wall\r\n", i % 8, i, i % 1000);
+        if (i % 17 == 0) {
+            for (int k = 0; k < 130; k++) buf[n++] = (char)('a' + k % 26);
+            n += (size_t)snprintf(buf + n, cap - n, "\r\n");
+        }
+    }
+    return n;
+}
+
+static void TestPendingInputAndTargets(void) {
+    printf("Testing unparsed input and restore targets...\n");
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 24;
+    config.scrollback_lines = 200;
+    KTerm* a = KTerm_Create(config);
+    LimitFrameInput(a);
+    Run(a, "\x1B[1mbold");
+    // Queued but not parsed: carried in the snapshot
+    const char* pending = "\x1B[31m pending\r\nsecond line";
+    KTerm_WriteString(a, pending);
+    unsigned char* data;
+    size_t size;
+    assert(KTerm_SerializeSession(a, 0, 0, &data, &size));
+
+    // Into a background session, and into one that was never opened
+    KTerm* b = KTerm_Create(config);
+    LimitFrameInput(b);
+    assert(KTerm_CreateSession(b) == 1);
+    assert(!b->sessions[3]->session_open);
+    assert(KTerm_RestoreSession(b, 1, data, size));
+    assert(KTerm_RestoreSession(b, 3, data, size));
+    assert(b->sessions[3]->session_open);
+    assert(!KTerm_RestoreSession(b, b->session_count, data, size));
+    // A closed slot that cannot get its buffers is left closed
+    assert(!b->sessions[2]->session_open);
+    size_t responses = b->session_buffer_sizes.responses;
+    b->session_buffer_sizes.responses = 0; // KTerm_Calloc refuses zero bytes
+    assert(!KTerm_RestoreSession(b, 2, data, size));
+    assert(!b->sessions[2]->session_open && !b->sessions[2]->screen_buffer);
+    b->session_buffer_sizes.responses = responses;
+    assert(KTerm_CreateSession(b) == 2);
+    KTerm_Free(data);
+    Drain(a, 0);
+    Drain(b, 1);
+    Drain(b, 3);
+    AssertSameSession(a, a->sessions[0], b, b->sessions[1]);
+    AssertSameSession(a, a->sessions[0], b, b->sessions[3]);
+    assert(GetScreenCell(b->sessions[3], 1, 0)->ch == 's');
+    KTerm_Destroy(a);
+    KTerm_Destroy(b);
+    printf("PASS: Unparsed input\n");
+}
+
+static void TestScrollbackSizes(void) {
+    printf("Testing restores into other scrollback sizes...\n");
+    static char log[1 << 20];
+    size_t len = BuildLog(log, sizeof(log), 600);
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 24;
+    config.scrollback_lines = 500;
+    KTerm* a = KTerm_Create(config);
+    LimitFrameInput(a);
+    Feed(a, 0, log, len);
+    KTermSession* sa = a->sessions[0];
+    assert(sa->history_rows_populated == 500);
+
+    // Larger: everything is kept
+    KTerm* big = RoundTrip(a, 1000, KTERM_SNAPSHOT_COMPRESS);
+    AssertSameSession(a, sa, big, big->sessions[0]);
+    assert(big->sessions[0]->buffer_height == 24 + 1000);
+
+    // Smaller: the newest history is kept
+    KTerm* small = RoundTrip(a, 100, 0);
+    KTermSession* ss = small->sessions[0];
+    assert(ss->history_rows_populated == 100 && ss->buffer_height == 24 + 100);
+    for (int y = -100; y < sa->rows; y++) {
+        for (int x = 0; x < sa->cols; x++) AssertSameCell(&GetActiveScreenRow(sa, y)[x], &GetActiveScreenRow(ss, y)[x]);
+    }
+    assert(KTerm_GetScreenHash(a) == KTerm_GetScreenHash(small));
+    KTerm_Destroy(a);
+    KTerm_Destroy(big);
+    KTerm_Destroy(small);
+    printf("PASS: Scrollback sizes\n");
+}
+
+static int errors_reported = 0;
+
+static void CountError(KTerm* term, KTermErrorLevel level, KTermErrorSource source, const char* msg, void* user_data) {
+    (void)term; (void)level; (void)source; (void)msg; (void)user_data;
+    errors_reported++;
+}
+
+static void TestMalformed(void) {
+    printf("Testing malformed snapshots...\n");
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 24;
+    config.scrollback_lines = 200;
+    KTerm* a = KTerm_Create(config);
+    LimitFrameInput(a);
+    static char log[1 << 16];
+    Run(a, "\x1B_Ga=T,i=7,s=1,v=1;AAAA/w==\x1B\\\x1B]2;title\x07");
+    Feed(a, 0, log, BuildLog(log, sizeof(log), 300));
+    KTerm* b = KTerm_Create(config);
+    LimitFrameInput(b);
+    Run(b, "untouched");
+    KTerm_SetErrorCallback(b, CountError, NULL);
+    uint64_t hash = KTerm_GetScreenHash(b);
+
+    for (int compress = 0; compress <= 1; compress++) {
+        unsigned char* data;
+        size_t size;
+        assert(KTerm_SerializeSession(a, 0, compress ? KTERM_SNAPSHOT_COMPRESS : 0, &data, &size));
+        assert(((data[6] & 1) != 0) == (compress != 0));
+        // Every cut is rejected and leaves the session as it was
+        size_t step = size / 400 + 1;
+        for (size_t cut = 0; cut < size; cut += step) {
+            assert(!KTerm_RestoreSession(b, 0, data, cut));
+            assert(KTerm_GetScreenHash(b) == hash);
+        }
+        // Corrupted bytes must not crash; whatever is accepted is a usable session
+        unsigned char* copy = (unsigned char*)malloc(size);
+        for (size_t pos = 12; pos < size; pos += step) {
+            memcpy(copy, data, size);
+            copy[pos] ^= 0x5A;
+            if (KTerm_RestoreSession(b, 1, copy, size)) {
+                KTerm_WriteCharToSession(b, 1, 'z');
+                Drain(b, 1);
+            }
+        }
+        // A newer version is refused
+        memcpy(copy, data, size);
+        copy[4] = KTERM_SNAPSHOT_VERSION + 1;
+        assert(!KTerm_RestoreSession(b, 0, copy, size));
+        free(copy);
+        KTerm_Free(data);
+    }
+    assert(KTerm_GetScreenHash(b) == hash && errors_reported > 0);
+
+    // A Kitty frame's pixels must cover its width x height
+    unsigned char* data;
+    size_t size;
+    assert(KTerm_SerializeSession(a, 0, 0, &data, &size));
+    // width 1, height 1, delay 0, 4 bytes of opaque black
+    static const unsigned char frame[] = { 0x01, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFF };
+    size_t pos = 12;
+    while (pos + sizeof(frame) <= size && memcmp(data + pos, frame, sizeof(frame)) != 0) pos++;
+    assert(pos + sizeof(frame) <= size);
+    data[pos] = 0x7F; data[pos + 1] = 0x7F; // 127x127 over 4 bytes
+    assert(!KTerm_RestoreSession(b, 0, data, size));
+    data[pos] = 0x00; data[pos + 1] = 0x01; // zero width
+    assert(!KTerm_RestoreSession(b, 0, data, size));
+    assert(KTerm_GetScreenHash(b) == hash);
+    data[pos] = 0x01;
+    assert(KTerm_RestoreSession(b, 0, data, size));
+    assert(b->sessions[0]->kitty.image_count == 1);
+    KTerm_Free(data);
+
+    KTerm_Destroy(a);
+    KTerm_Destroy(b);
+    printf("PASS: Malformed snapshots\n");
+}
+
+static void TestPaletteIndex(void) {
+    printf("Testing out-of-range palette indices...\n");
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 24;
+    KTerm* a = KTerm_Create(config);
+    LimitFrameInput(a);
+    Run(a, "\x1B[38;5;201mX");
+    unsigned char* data;
+    size_t size;
+    assert(KTerm_SerializeSession(a, 0, 0, &data, &size));
+
+    // Indexed mode (0) followed by the zigzag varint of 201
+    size_t pos = 12;
+    while (pos + 3 <= size && !(data[pos] == 0 && data[pos + 1] == 0x92 && data[pos + 2] == 0x03)) pos++;
+    assert(pos + 3 <= size);
+
+    // A valid index in the same spot restores, so this is the cell's color
+    KTerm* b = KTerm_Create(config);
+    LimitFrameInput(b);
+    KTerm_SetErrorCallback(b, CountError, NULL);
+    data[pos + 1] = 0x94; // 202
+    assert(KTerm_RestoreSession(b, 0, data, size));
+    assert(GetActiveScreenRow(b->sessions[0], 0)[0].fg_color.value.index == 202);
+
+    // Past the palette, on either side, the snapshot is refused
+    uint64_t hash = KTerm_GetScreenHash(b);
+    data[pos + 1] = 0xFE; data[pos + 2] = 0x7F; // 8191
+    assert(!KTerm_RestoreSession(b, 0, data, size));
+    data[pos + 1] = 0xC9; data[pos + 2] = 0x01; // -101
+    assert(!KTerm_RestoreSession(b, 0, data, size));
+    assert(KTerm_GetScreenHash(b) == hash);
+    KTerm_Free(data);
+    KTerm_Destroy(a);
+
+    // Sixel strips index the sixel palette the same way
+    a = KTerm_Create(config);
+    LimitFrameInput(a);
+    Run(a, "\x1BPq#200;2;100;0;0~\x1B\\");
+    assert(a->sessions[0]->sixel.strip_count == 1);
+    assert(KTerm_SerializeSession(a, 0, 0, &data, &size));
+    // x 0, y 0, pattern 63, then the varint of color 200
+    static const unsigned char strip[] = { 0x00, 0x00, 0x3F, 0xC8, 0x01 };
+    pos = 12;
+    while (pos + sizeof(strip) <= size && memcmp(data + pos, strip, sizeof(strip)) != 0) pos++;
+    assert(pos + sizeof(strip) <= size);
+    data[pos + 3] = 0xC9; // 201
+    assert(KTerm_RestoreSession(b, 0, data, size));
+    assert(b->sessions[0]->sixel.strip_count == 1 && b->sessions[0]->sixel.strips[0].color_index == 201);
+    hash = KTerm_GetScreenHash(b);
+    data[pos + 3] = 0x80; data[pos + 4] = 0x02; // 256
+    assert(!KTerm_RestoreSession(b, 0, data, size));
+    assert(b->sessions[0]->sixel.strips[0].color_index == 201 && KTerm_GetScreenHash(b) == hash);
+
+    KTerm_Free(data);
+    KTerm_Destroy(a);
+    KTerm_Destroy(b);
+    printf("PASS: Palette indices\n");
+}
+
+static void BenchReattach(void) {
+    printf("Benchmarking reattach against replay...\n");
+    static char log[8 << 20];
+    size_t len = BuildLog(log, sizeof(log), 100000);
+    const int scrollback = 5000;
+
+    // Replaying the session's output is what a reattach costs without snapshots
+    double start = MockWallTime();
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 24;
+    config.scrollback_lines = scrollback;
+    KTerm* a = KTerm_Create(config);
+    LimitFrameInput(a);
+    Feed(a, 0, log, len);
+    double replay = MockWallTime() - start;
+
+    unsigned char *plain, *packed;
+    size_t plain_size, packed_size;
+    start = MockWallTime();
+    assert(KTerm_SerializeSession(a, 0, 0, &plain, &plain_size));
+    double serialize = MockWallTime() - start;
+    start = MockWallTime();
+    assert(KTerm_SerializeSession(a, 0, KTERM_SNAPSHOT_COMPRESS, &packed, &packed_size));
+    double serialize_packed = MockWallTime() - start;
+    assert(packed_size < plain_size);
+
+    // Through a file, as a detached session would be kept
+    FILE* f = fopen(SNAPSHOT_PATH, "wb");
+    assert(f && fwrite(packed, 1, packed_size, f) == packed_size);
+    fclose(f);
+    unsigned char* loaded = (unsigned char*)malloc(packed_size);
+    start = MockWallTime();
+    f = fopen(SNAPSHOT_PATH, "rb");
+    assert(f && fread(loaded, 1, packed_size, f) == packed_size);
+    fclose(f);
+    KTerm* b = KTerm_Create(config);
+    LimitFrameInput(b);
+    assert(KTerm_RestoreSession(b, 0, loaded, packed_size));
+    double restore = MockWallTime() - start;
+    AssertSameSession(a, a->sessions[0], b, b->sessions[0]);
+    remove(SNAPSHOT_PATH);
+
+    size_t ring = (size_t)a->sessions[0]->buffer_height * a->sessions[0]->cols * sizeof(EnhancedTermChar);
+    printf("  %.1f MB of output, %d history rows: replay %.1f ms\n", len / (1024.0 * 1024.0),
+           a->sessions[0]->history_rows_populated, replay * 1e3);
+    printf("  snapshot %.0f KB (%.0f KB compressed) of a %.1f MB ring: serialize %.1f ms (%.1f ms compressed), restore %.1f ms\n",
+           plain_size / 1024.0, packed_size / 1024.0, ring / (1024.0 * 1024.0), serialize * 1e3, serialize_packed * 1e3, restore * 1e3);
+    assert(restore < replay);
+    free(loaded);
+    KTerm_Free(plain);
+    KTerm_Free(packed);
+    KTerm_Destroy(a);
+    KTerm_Destroy(b);
+    printf("PASS: Reattach benchmark\n");
+}
+
+int main(void) {
+    TestRoundTrip();
+    TestPendingInputAndTargets();
+    TestScrollbackSizes();
+    TestMalformed();
+    TestPaletteIndex();
+    BenchReattach();
+    printf("All session snapshot tests passed.\n");
+    return 0;
+}
@@ -0,0 +1,238 @@
+#define KTERM_IMPLEMENTATION
+#define KTERM_TESTING
+#include "../kterm.h"
+#include "mock_situation.h"
+#include <assert.h>
+#include <stdio.h>
+#include <time.h>
+
+static char last_response[4096];
+
+static void MockResponseCallback(KTerm* term, const char* response, int length) {
+    (void)term;
+    if (length >= (int)sizeof(last_response)) length = sizeof(last_response) - 1;
+    memcpy(last_response, response, length);
+    last_response[length] = '\0';
+}
+
+static void TestDisabled(void) {
+    printf("Testing disabled stats...\n");
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    config.response_callback = MockResponseCallback;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    KTerm_WriteString(term, "hello\r\n\x1B[1mworld\x1B[m");
+    KTerm_Update(term);
+    KTerm_Draw(term);
+
+    KTermStats stats = KTerm_GetStats(term);
+    assert(!stats.enabled);
+    assert(stats.frames == 0);
+    assert(stats.rows_converted == 0);
+    assert(stats.bytes_uploaded == 0);
+    assert(stats.sessions[0].bytes_parsed == 0);
+    assert(stats.sessions[0].ops_queued[KTERM_OP_SET_CELL] == 0);
+    assert(stats.prepare.count == 0);
+    KTerm_Destroy(term);
+    printf("PASS: Disabled stats\n");
+}
+
+static void TestCounters(void) {
+    printf("Testing counters...\n");
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    config.response_callback = MockResponseCallback;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    KTerm_SetStatsEnabled(term, true);
+
+    // 2 C0, 2 CSI, 1 OSC, 1 ESC, 9 printable characters
+    const char* input = "hello\r\n\x1B[1mwor\x1B[mld\x1B]0;title\x1B\\\x1B" "7";
+    KTerm_WriteString(term, input);
+    term->font_atlas_dirty = true; // Also re-upload the whole atlas
+    KTerm_Update(term);
+    KTerm_Draw(term);
+
+    KTermStats stats = KTerm_GetStats(term);
+    const KTermSessionStats* s = &stats.sessions[0];
+    assert(stats.enabled);
+    assert(stats.frames == 1);
+    assert(s->bytes_parsed == strlen(input));
+    assert(s->sequences[KTERM_STAT_SEQ_C0] == 2);
+    assert(s->sequences[KTERM_STAT_SEQ_CSI] == 2);
+    assert(s->sequences[KTERM_STAT_SEQ_OSC] == 1);
+    assert(s->sequences[KTERM_STAT_SEQ_ESC] == 1);
+    assert(s->sequences[KTERM_STAT_SEQ_DCS] == 0);
+
+    // Every printed character is one queued and applied cell write
+    assert(s->ops_queued[KTERM_OP_SET_CELL] == 10);
+    assert(s->ops_applied[KTERM_OP_SET_CELL] == 10);
+    assert(s->ops_dropped == 0);
+
+    assert(s->parse.count == 1);
+    assert(s->flush.count == 1);
+    assert(stats.prepare.count == 1);
+    assert(stats.draw.count == 1);
+    assert(stats.rows_converted > 0);
+    assert(stats.bytes_uploaded == (uint64_t)term->atlas_width * term->atlas_height * 4); // The mock draws nothing
+    assert(stats.atlas_misses == 0); // ASCII lives in the base font
+
+    uint32_t hist_total = 0;
+    for (int b = 0; b < KTERM_STATS_HIST_BUCKETS; b++) hist_total += stats.prepare.buckets[b];
+    assert(hist_total == stats.prepare.count);
+    assert(stats.prepare.max_ns <= stats.prepare.total_ns);
+
+    // The next update closes the frame
+    KTerm_Update(term);
+    stats = KTerm_GetStats(term);
+    assert(stats.frames == 2);
+    assert(stats.last_frame.bytes_parsed == strlen(input));
+    assert(stats.last_frame.sequences == 6);
+    assert(stats.last_frame.ops_applied == 10);
+    assert(stats.last_frame.rows_converted > 0);
+    assert(stats.last_frame.bytes_uploaded > 0);
+
+    // A new glyph is an atlas miss, a repeated one is not
+    GET_SESSION(term)->charset.g0 = CHARSET_UTF8;
+    KTerm_WriteString(term, "\xE2\x82\xAC\xE2\x82\xAC");
+    KTerm_Update(term);
+    stats = KTerm_GetStats(term);
+    assert(stats.atlas_misses == 1);
+
+    // Reset keeps collection enabled
+    KTerm_ResetStats(term);
+    stats = KTerm_GetStats(term);
+    assert(stats.enabled);
+    assert(stats.frames == 0 && stats.sessions[0].bytes_parsed == 0);
+
+    // Disabled again: counters stay put
+    KTerm_SetStatsEnabled(term, false);
+    KTerm_WriteString(term, "more text");
+    KTerm_Update(term);
+    stats = KTerm_GetStats(term);
+    assert(stats.frames == 0 && stats.sessions[0].bytes_parsed == 0);
+    assert(stats.sessions[0].ops_queued[KTERM_OP_SET_CELL] == 0);
+
+    KTerm_Destroy(term);
+    printf("PASS: Counters\n");
+}
+
+#define DRAW_THREAD_FRAMES 200
+
+static kterm_thread_result_t DrawThread(void* arg) {
+    KTerm* term = (KTerm*)arg;
+    for (int i = 0; i < DRAW_THREAD_FRAMES; i++) KTerm_Draw(term);
+    return KTERM_THREAD_RESULT_OK;
+}
+
+static void TestRenderThread(void) {
+    printf("Testing counters with a render thread...\n");
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    config.response_callback = MockResponseCallback;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    KTerm_SetStatsEnabled(term, true);
+
+    // Draws on their own thread while the logic thread updates and rolls frames over
+    kterm_thread_t thread;
+    assert(KTERM_THREAD_CREATE(thread, DrawThread, term));
+    for (int i = 0; i < DRAW_THREAD_FRAMES; i++) {
+        KTerm_WriteString(term, "tick\r\n");
+        term->font_atlas_dirty = true; // A logic thread upload every frame
+        KTerm_Update(term);
+        (void)KTerm_GetStats(term);
+    }
+    KTERM_THREAD_JOIN(thread);
+
+    KTermStats stats = KTerm_GetStats(term);
+    assert(stats.draw.count == DRAW_THREAD_FRAMES);
+    assert(stats.frames == DRAW_THREAD_FRAMES);
+    assert(stats.bytes_uploaded >= (uint64_t)DRAW_THREAD_FRAMES * term->atlas_width * term->atlas_height * 4);
+
+    KTerm_ResetStats(term);
+    stats = KTerm_GetStats(term);
+    assert(stats.draw.count == 0 && stats.bytes_uploaded == 0);
+    KTerm_Destroy(term);
+    printf("PASS: Render thread\n");
+}
+
+static void TestGateway(void) {
+    printf("Testing gateway stats query...\n");
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    config.response_callback = MockResponseCallback;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+
+    KTerm_WriteString(term, "\x1BPGATE;KTERM;1;SET;STATS;1\x1B\\");
+    KTerm_Update(term);
+    assert(term->stats.enabled);
+
+    KTerm_WriteString(term, "abc\x1B[2J");
+    KTerm_Update(term);
+    last_response[0] = '\0';
+    KTerm_WriteString(term, "\x1BPGATE;KTERM;7;GET;STATS\x1B\\");
+    KTerm_Update(term);
+    assert(strncmp(last_response, "\x1BPGATE;KTERM;7;REPORT;STATS=ENABLED:1,FRAMES:3,", 45) == 0);
+    assert(strstr(last_response, ",CSI:1,") != NULL);
+    assert(strstr(last_response, ",DCS:1,") != NULL); // This GET; the SET ran before collection started
+    assert(strstr(last_response, "PREPARE_US:") != NULL);
+
+    KTerm_WriteString(term, "\x1BPGATE;KTERM;8;RESET;STATS\x1B\\");
+    KTerm_Update(term);
+    KTerm_WriteString(term, "\x1BPGATE;KTERM;9;SET;STATS;0\x1B\\");
+    KTerm_Update(term);
+    assert(!term->stats.enabled);
+    KTermStats stats = KTerm_GetStats(term);
+    assert(stats.sessions[0].sequences[KTERM_STAT_SEQ_CSI] == 0);
+    assert(stats.sessions[0].sequences[KTERM_STAT_SEQ_DCS] == 1); // Only the SET that disabled it
+
+    KTerm_Destroy(term);
+    printf("PASS: Gateway stats\n");
+}
+
+static double ParseTime(bool enabled) {
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    config.response_callback = MockResponseCallback;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    KTerm_SetStatsEnabled(term, enabled);
+    KTermSession* session = GET_SESSION(term);
+    const char* line = "\x1B[32mok\x1B[m  build/obj/file_%04d.o  \x1B[1m[ 42%%]\x1B[m linking\r\n";
+    char buf[128];
+    clock_t start = clock();
+    for (int i = 0; i < 20000; i++) {
+        int n = snprintf(buf, sizeof(buf), line, i);
+        for (int c = 0; c < n; c++) KTerm_ProcessChar(term, session, (unsigned char)buf[c]);
+        KTerm_FlushOps(term, session);
+    }
+    double elapsed = (double)(clock() - start) / CLOCKS_PER_SEC;
+    KTerm_Destroy(term);
+    return elapsed;
+}
+
+static void BenchOverhead(void) {
+    printf("Benchmarking collection overhead...\n");
+    double off = ParseTime(false);
+    double on = ParseTime(true);
+    printf("  disabled %.3f s, enabled %.3f s (%+.1f%%)\n", off, on, (on - off) * 100.0 / off);
+    printf("PASS: Overhead benchmark\n");
+}
+
+int main(void) {
+    TestDisabled();
+    TestCounters();
+    TestRenderThread();
+    TestGateway();
+    BenchOverhead();
+    printf("All stats tests passed.\n");
+    return 0;
+}
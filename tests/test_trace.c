@@ -0,0 +1,134 @@
+#define KTERM_IMPLEMENTATION
+#define KTERM_TESTING
+#define KTERM_ENABLE_TRACE
+#include "../kterm.h"
+#include "mock_situation.h"
+#include <assert.h>
+#include <stdio.h>
+#include <time.h>
+
+#define TRACE_PATH "test_trace.json"
+
+static char* ReadFile(const char* path) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return NULL;
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char* data = (char*)malloc(size + 1);
+    size_t n = fread(data, 1, size, f);
+    data[n] = '\0';
+    fclose(f);
+    return data;
+}
+
+static int CountOf(const char* haystack, const char* needle) {
+    int n = 0;
+    for (const char* p = strstr(haystack, needle); p; p = strstr(p + 1, needle)) n++;
+    return n;
+}
+
+static kterm_thread_result_t DrawThread(void* arg) {
+    KTerm* term = (KTerm*)arg;
+    for (int i = 0; i < 3; i++) KTerm_Draw(term);
+    return KTERM_THREAD_RESULT_OK;
+}
+
+static void TestTraceFile(void) {
+    printf("Testing trace output...\n");
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+
+    // Nothing is recorded before the trace starts
+    KTerm_WriteString(term, "before");
+    KTerm_Update(term);
+    assert(KTerm_TraceClock(term) == 0);
+
+    assert(KTerm_TraceStart(term, TRACE_PATH));
+    for (int f = 0; f < 5; f++) {
+        KTerm_WriteString(term, "\x1B[31mframe\x1B[m\r\n");
+        KTerm_Update(term);
+        KTerm_Draw(term);
+    }
+    KTerm_Resize(term, 100, 30);
+    KTerm_WriteString(term, "\x1BPq#1~~~~\x1B\\");
+    term->font_atlas_dirty = true;
+    KTerm_Update(term);
+
+    // A second thread gets its own ring
+    kterm_thread_t thread;
+    assert(KTERM_THREAD_CREATE(thread, DrawThread, term));
+    KTERM_THREAD_JOIN(thread);
+    KTerm_TraceStop(term);
+
+    // Stopped: spans are ignored
+    KTerm_Update(term);
+
+    char* json = ReadFile(TRACE_PATH);
+    assert(json);
+    assert(strncmp(json, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 39) == 0);
+    assert(strstr(json, "\n]}\n") != NULL);
+    assert(CountOf(json, "\"name\":\"KTerm_Update\"") == 6);
+    assert(CountOf(json, "\"name\":\"ProcessEvents\"") == 6);
+    assert(CountOf(json, "\"name\":\"FlushOps\"") == 6);
+    assert(CountOf(json, "\"name\":\"PrepareRenderBuffer\"") == 6);
+    assert(CountOf(json, "\"name\":\"KTerm_Draw\"") == 8);
+    assert(CountOf(json, "\"name\":\"Resize\"") == 1);
+    assert(CountOf(json, "\"name\":\"SixelDecode\"") == 1);
+    assert(CountOf(json, "\"name\":\"AtlasRebuild\"") == 1);
+    assert(CountOf(json, "\"ph\":\"X\"") == 6 * 4 + 8 + 3);
+
+    // Two named threads; draws from the second thread carry its tid
+    assert(CountOf(json, "\"name\":\"thread_name\"") == 2);
+    assert(strstr(json, "\"name\":\"KTerm_Draw\",\"cat\":\"kterm\",\"ph\":\"X\",\"pid\":1,\"tid\":1,") != NULL);
+    assert(strstr(json, "\"dropped\":0") != NULL);
+    free(json);
+    remove(TRACE_PATH);
+
+    KTerm_Destroy(term);
+    printf("PASS: Trace output\n");
+}
+
+static double UpdateTime(KTerm* term, int frames) {
+    clock_t start = clock();
+    for (int f = 0; f < frames; f++) {
+        for (int l = 0; l < 10; l++) KTerm_WriteString(term, "\x1B[32mok\x1B[m  build/obj/file.o  \x1B[1m[ 42%]\x1B[m linking\r\n");
+        KTerm_Update(term);
+        KTerm_Draw(term);
+    }
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+static void BenchOverhead(void) {
+    printf("Benchmarking tracing overhead...\n");
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    const int frames = 1000;
+    UpdateTime(term, 100);
+    // Alternate to even out drift
+    double off = 0, on = 0;
+    for (int round = 0; round < 4; round++) {
+        off += UpdateTime(term, frames);
+        assert(KTerm_TraceStart(term, TRACE_PATH));
+        on += UpdateTime(term, frames);
+        KTerm_TraceStop(term);
+    }
+    remove(TRACE_PATH);
+    printf("  %d frames: off %.3f s, tracing %.3f s (%+.1f%%, %.2f us/frame)\n", frames * 4, off, on,
+           (on - off) * 100.0 / off, (on - off) * 1e6 / (frames * 4));
+    KTerm_Destroy(term);
+    printf("PASS: Overhead benchmark\n");
+}
+
+int main(void) {
+    TestTraceFile();
+    BenchOverhead();
+    printf("All trace tests passed.\n");
+    return 0;
+}
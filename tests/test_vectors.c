@@ -0,0 +1,335 @@
+#define KTERM_IMPLEMENTATION
+#define KTERM_RENDER_SW_IMPLEMENTATION
+#define KTERM_TESTING
+#include "../kt_render_sw.h"
+#include "mock_situation.h"
+#include <assert.h>
+#include <stdio.h>
+
+static void Feed(KTerm* term, const char* data, size_t len) {
+    for (size_t i = 0; i < len; i++) KTerm_ProcessChar(term, GET_SESSION(term), (unsigned char)data[i]);
+}
+
+// Tektronix 4014 address: HiY, LoY, HiX, LoX (12-bit coordinates)
+static size_t TekPoint(char* out, int x, int y) {
+    out[0] = (char)(0x20 | ((y >> 7) & 0x1F));
+    out[1] = (char)(0x60 | ((y >> 2) & 0x1F));
+    out[2] = (char)(0x20 | ((x >> 7) & 0x1F));
+    out[3] = (char)(0x40 | ((x >> 2) & 0x1F));
+    return 4;
+}
+
+// A polyline of `lines` vectors starting with a dark move
+static void TekPlot(KTerm* term, int lines, int seed) {
+    size_t size = (size_t)(lines + 1) * 4 + 1;
+    char* buf = malloc(size);
+    size_t n = 0;
+    buf[n++] = 0x1D; // GS: graph mode
+    for (int i = 0; i <= lines; i++) {
+        int x = (i * 37 + seed * 101) % 4000;
+        int y = (i * 91 + seed * 53) % 3000;
+        n += TekPoint(buf + n, x, y);
+    }
+    Feed(term, buf, n);
+    free(buf);
+}
+
+static const KTermRenderBuffer* Front(KTerm* term) {
+    return &term->render_buffers[term->rb_front];
+}
+
+// Rasterize the front buffer the way KTerm_Draw does
+static size_t DrawVectors(KTerm* term) {
+    size_t start;
+    bool cleared;
+    const KTermRenderBuffer* rb = Front(term);
+    if (term->gpu_vector_layer < 0) term->gpu_vector_layer = KTerm_AddVectorLayer(term);
+    if (!KTerm_BeginVectors(term, term->gpu_vector_layer, rb, &start, &cleared)) return 0;
+    KTerm_EndVectors(term, term->gpu_vector_layer, rb);
+    return rb->vector_count - start;
+}
+
+static void TestIncremental(void) {
+    printf("Testing incremental vector upload...\n");
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    Feed(term, "\x1B[?38h", 6); // DECTEK
+    TekPlot(term, 100, 1);
+    KTerm_Update(term);
+    assert(term->vector_count == 100);
+    assert(Front(term)->vector_count == 100 && Front(term)->vector_first == 0);
+    assert(DrawVectors(term) == 100);
+
+    // Only the new vectors reach the next frame
+    TekPlot(term, 20, 2);
+    KTerm_Update(term);
+    assert(term->vector_count == 120);
+    assert(Front(term)->vector_first == 100 && Front(term)->vector_count == 20);
+    assert(DrawVectors(term) == 20);
+
+    // Nothing new: nothing uploaded; drawing the same frame twice draws nothing twice
+    KTerm_Update(term);
+    assert(Front(term)->vector_count == 0);
+    assert(DrawVectors(term) == 0);
+
+    // Frames the renderer skipped are sent again
+    TekPlot(term, 5, 3);
+    KTerm_Update(term);
+    TekPlot(term, 7, 4);
+    KTerm_Update(term);
+    assert(Front(term)->vector_first == 120 && Front(term)->vector_count == 12);
+    assert(DrawVectors(term) == 12);
+
+    // FF clears the plot and the layer
+    Feed(term, "\x0C", 1);
+    TekPlot(term, 3, 5);
+    KTerm_Update(term);
+    size_t start;
+    bool cleared;
+    assert(KTerm_BeginVectors(term, term->gpu_vector_layer, Front(term), &start, &cleared));
+    assert(cleared && start == 0 && Front(term)->vector_count == 3);
+    KTerm_EndVectors(term, term->gpu_vector_layer, Front(term));
+    KTerm_Destroy(term);
+    printf("PASS: Incremental\n");
+}
+
+static void TestGrowth(void) {
+    printf("Testing vector buffer growth...\n");
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    Feed(term, "\x1B[?38h", 6); // DECTEK
+    const int lines = KTERM_VECTOR_BATCH + 34464;
+    TekPlot(term, lines, 6);
+    assert(term->vector_count == (uint32_t)lines); // Nothing dropped
+    assert(term->vector_capacity >= (size_t)lines);
+
+    // The backlog drains in batches
+    KTerm_Update(term);
+    assert(Front(term)->vector_count == KTERM_VECTOR_BATCH);
+    assert(DrawVectors(term) == KTERM_VECTOR_BATCH);
+    KTerm_Update(term);
+    assert(Front(term)->vector_first == KTERM_VECTOR_BATCH && Front(term)->vector_count == 34464);
+    assert(DrawVectors(term) == 34464);
+    KTerm_Destroy(term);
+    printf("PASS: Growth (%d vectors)\n", lines);
+}
+
+static void TestSoftwareLayer(void) {
+    printf("Testing retained software vector layer...\n");
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    Feed(term, "\x1B[?38h", 6); // DECTEK
+    KTermSoftRenderer sw;
+    assert(KTermSW_Init(&sw, term, 1));
+
+    // Built frame by frame
+    for (int f = 0; f < 10; f++) {
+        TekPlot(term, 50, 10 + f);
+        KTerm_Update(term);
+        assert(KTermSW_Render(&sw));
+    }
+    assert(sw.has_vectors);
+    assert(term->vector_drawn == 500);
+
+    // A new renderer starts with an empty layer: the current frame only holds the
+    // last 50 vectors, so it waits for the next frame, which resends the whole plot
+    KTermSoftRenderer fresh;
+    assert(KTermSW_Init(&fresh, term, 1));
+    assert(KTermSW_Render(&fresh));
+    assert(!fresh.has_vectors && term->vector_drawn == 0);
+    KTerm_Update(term);
+    assert(Front(term)->vector_first == 0 && Front(term)->vector_count == 500);
+    assert(KTermSW_Render(&fresh));
+    assert(memcmp(fresh.vectors, sw.vectors, (size_t)sw.width * sw.height * 4) == 0);
+    assert(memcmp(fresh.pixels, sw.pixels, (size_t)sw.width * sw.height * 4) == 0);
+
+    // Each renderer keeps its own mark: both draw the next frame's vectors
+    TekPlot(term, 50, 30);
+    KTerm_Update(term);
+    assert(Front(term)->vector_first == 500 && Front(term)->vector_count == 50);
+    assert(KTermSW_Render(&sw));
+    assert(KTermSW_Render(&fresh));
+    assert(memcmp(fresh.vectors, sw.vectors, (size_t)sw.width * sw.height * 4) == 0);
+    // Only the tiles under the new vectors were shaded, to the same pixels
+    assert(!sw.full_redraw && !fresh.full_redraw && sw.tiles_shaded > 0);
+    assert(memcmp(fresh.pixels, sw.pixels, (size_t)sw.width * sw.height * 4) == 0);
+    assert(term->vector_drawn == 550);
+    KTermSW_Destroy(&fresh);
+    assert(term->software_renderers == 1 && !term->vector_layers[1].active);
+
+    // Clearing empties the layer
+    Feed(term, "\x0C", 1);
+    KTerm_Update(term);
+    assert(KTermSW_Render(&sw));
+    assert(!sw.has_vectors);
+    KTermSW_Destroy(&sw);
+    KTerm_Cleanup(term);
+    printf("PASS: Software layer\n");
+}
+
+static void ReGIS(KTerm* term, const char* commands) {
+    Feed(term, "\x1BPp", 3);
+    Feed(term, commands, strlen(commands));
+    Feed(term, "\x1B\\", 2);
+}
+
+// The layer is stored top-down; ReGIS pixel rows count from the bottom
+static bool LayerPixel(KTermSoftRenderer* sw, float x, float y) {
+    int row = sw->height - 1 - (int)y;
+    return sw->vectors[((size_t)row * sw->width + (size_t)x) * 4 + 3] != 0;
+}
+
+static void TestReGISFill(void) {
+    printf("Testing ReGIS trapezoid fill...\n");
+    // 200x60 cells: 1.25 pixels per logical row, so one span per logical row left gaps
+    KTermConfig config = {0};
+    config.width = 200;
+    config.height = 60;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    KTermSoftRenderer sw;
+    assert(KTermSW_Init(&sw, term, 1));
+    ReGIS(term, "S(E)P[100,100]F(V[300,100][300,300][100,300])");
+    KTerm_Update(term);
+    assert(KTermSW_Render(&sw));
+
+    // One trapezoid: a left and a right edge over all covered pixel rows
+    ReGISPoint top = ReGIS_ToPixels(term, 100, 100), bottom = ReGIS_ToPixels(term, 300, 300);
+    assert(term->vector_count == 2);
+    assert(term->vector_staging_buffer[0].mode & KTERM_VECTOR_FILL);
+    assert(term->vector_staging_buffer[1].mode & KTERM_VECTOR_FILL_RIGHT);
+
+    // The pixels of one span per row: rows whose centers lie in [top, bottom),
+    // columns from the left edge through the right edge
+    assert(sw.width == (int)term->regis.xform.screen_w && sw.height == (int)term->regis.xform.screen_h);
+    for (int r = 0; r < sw.height; r++) {
+        bool row_in = (r + 0.5f >= top.y && r + 0.5f < bottom.y);
+        for (int x = 0; x < sw.width; x++) {
+            assert(LayerPixel(&sw, (float)x, (float)r) == (row_in && x >= (int)top.x && x <= (int)bottom.x));
+        }
+    }
+
+    // Even-odd: the notch of a U stays empty
+    ReGIS(term, "S(E)P[100,100]F(V[160,100][160,250][240,250][240,100][300,100][300,300][100,300])");
+    KTerm_Update(term);
+    assert(KTermSW_Render(&sw));
+    ReGISPoint notch = ReGIS_ToPixels(term, 200, 150), leg = ReGIS_ToPixels(term, 130, 150);
+    assert(!LayerPixel(&sw, notch.x, notch.y));
+    assert(LayerPixel(&sw, leg.x, leg.y));
+    // Two legs above the notch, one band below it
+    assert(term->vector_count == 3 * 2);
+    KTermSW_Destroy(&sw);
+    KTerm_Cleanup(term);
+
+    // A triangle over the whole screen is still one pair
+    config.width = 80;
+    config.height = 25;
+    term = KTerm_Create(config);
+    KTerm_Init(term);
+    ReGIS(term, "S(E)P[0,0]F(V[799,0][799,479][0,479])");
+    assert(term->vector_count == 2);
+    KTerm_Destroy(term);
+    printf("PASS: ReGIS fill\n");
+}
+
+static void TestReGISCurves(void) {
+    printf("Testing ReGIS curve tessellation...\n");
+    KTermConfig config = {0};
+    config.width = 132;
+    config.height = 50;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    ReGIS(term, "S(E)P[400,240]C[+10]");
+    uint32_t small = term->vector_count;
+    ReGIS(term, "S(E)P[400,240]C[+200]");
+    uint32_t large = term->vector_count;
+    assert(small >= 4 && small < large);
+
+    // Chords stay within half a pixel of the circle
+    float r_px = 200 * term->regis.xform.scale;
+    float sagitta = r_px * (1.0f - cosf(3.14159265f / (float)large));
+    assert(sagitta <= 0.5f);
+
+    // Arcs end where the last segment ends
+    ReGIS(term, "S(E)P[500,240]C(A)[400,240,90]");
+    assert(term->regis.x >= 399 && term->regis.x <= 401 && term->regis.y >= 339 && term->regis.y <= 341);
+    GPUVectorLine* last = &term->vector_staging_buffer[term->vector_count - 1];
+    ReGISPoint end = ReGIS_ToPixels(term, 400, 340);
+    assert(fabsf(last->x1 * term->regis.xform.screen_w - end.x) < 1.0f);
+    KTerm_Destroy(term);
+    printf("PASS: ReGIS curves (%u and %u segments)\n", small, large);
+}
+
+static void BenchReGIS(void) {
+    printf("Benchmarking ReGIS dashboards...\n");
+    KTermConfig config = {0};
+    config.width = 132;
+    config.height = 50;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    char frame[4096];
+    int frames = 500;
+    double start = MockWallTime();
+    for (int f = 0; f < frames; f++) {
+        int n = snprintf(frame, sizeof(frame), "S(E)");
+        for (int bar = 0; bar < 12; bar++) {
+            int x = 40 + bar * 60, h = 20 + (f * 37 + bar * 91) % 380;
+            n += snprintf(frame + n, sizeof(frame) - n, "P[%d,460]F(V[%d,460][%d,%d][%d,%d])", x, x + 40, x + 40, 460 - h, x, 460 - h);
+        }
+        n += snprintf(frame + n, sizeof(frame) - n, "P[400,240]C[+%d]", 50 + f % 100);
+        ReGIS(term, frame);
+        KTerm_Update(term);
+        DrawVectors(term);
+    }
+    double elapsed = MockWallTime() - start;
+    printf("  %.3f ms/frame, %u vectors in the last frame\n", elapsed * 1e3 / frames, (unsigned)term->vector_count);
+    KTerm_Destroy(term);
+    printf("PASS: ReGIS benchmark\n");
+}
+
+static void BenchLongPlot(void) {
+    printf("Benchmarking a long Tektronix plot...\n");
+    KTermConfig config = {0};
+    config.width = 80;
+    config.height = 25;
+    KTerm* term = KTerm_Create(config);
+    KTerm_Init(term);
+    Feed(term, "\x1B[?38h", 6); // DECTEK
+    const int frames = 400, per_frame = 500;
+    double first = 0, last = 0;
+    for (int f = 0; f < frames; f++) {
+        double start = MockWallTime();
+        TekPlot(term, per_frame, f);
+        KTerm_Update(term);
+        DrawVectors(term);
+        double elapsed = MockWallTime() - start;
+        if (f < 50) first += elapsed;
+        if (f >= frames - 50) last += elapsed;
+    }
+    printf("  %u vectors: first 50 frames %.3f ms/frame, last 50 frames %.3f ms/frame\n",
+           (unsigned)term->vector_count, first * 1e3 / 50, last * 1e3 / 50);
+    assert(Front(term)->vector_count == (size_t)per_frame);
+    KTerm_Destroy(term);
+    printf("PASS: Long plot benchmark\n");
+}
+
+int main(void) {
+    TestIncremental();
+    TestGrowth();
+    TestSoftwareLayer();
+    TestReGISFill();
+    TestReGISCurves();
+    BenchLongPlot();
+    BenchReGIS();
+    printf("All vector layer tests passed.\n");
+    return 0;
+}
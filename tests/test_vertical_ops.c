@@ -11,7 +11,7 @@ void test_insert_lines_op(void) {
     config.width = 20;
     config.height = 10;
     KTerm* term = KTerm_Create(config);
-    KTermSession* session = &term->sessions[term->active_session];
+    KTermSession* session = term->sessions[term->active_session];
     session->use_op_queue = true;
 
     // 1. Fill screen with line numbers
@@ -63,7 +63,7 @@ void test_delete_lines_op(void) {
     config.width = 20;
     config.height = 10;
     KTerm* term = KTerm_Create(config);
-    KTermSession* session = &term->sessions[term->active_session];
+    KTermSession* session = term->sessions[term->active_session];
     session->use_op_queue = true;
 
     // 1. Fill screen with line numbers
@@ -109,7 +109,7 @@ void test_protected_lines_op(void) {
     config.width = 20;
     config.height = 10;
     KTerm* term = KTerm_Create(config);
-    KTermSession* session = &term->sessions[term->active_session];
+    KTermSession* session = term->sessions[term->active_session];
     session->use_op_queue = true;
 
     // 1. Fill with A
@@ -147,7 +147,7 @@ void test_insert_lines_overflow(void) {
     config.width = 10;
     config.height = 5;
     KTerm* term = KTerm_Create(config);
-    KTermSession* session = &term->sessions[term->active_session];
+    KTermSession* session = term->sessions[term->active_session];
     session->use_op_queue = true;
 
     // Fill with 'A'
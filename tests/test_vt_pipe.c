@@ -17,7 +17,7 @@ void VerifyPipelineContent(KTerm* term, const char* expected) {
     int head = atomic_load_explicit(&session->pipeline_head, memory_order_relaxed);
     int tail = atomic_load_explicit(&session->pipeline_tail, memory_order_relaxed);
 
-    int count = (head - tail + sizeof(session->input_pipeline)) % sizeof(session->input_pipeline);
+    int count = (head - tail) & session->pipeline_mask;
 
     if (count != strlen(expected)) {
         printf("FAIL: Pipeline count mismatch. Expected %lu, Got %d\n", strlen(expected), count);
@@ -26,7 +26,7 @@ void VerifyPipelineContent(KTerm* term, const char* expected) {
 
     char buffer[1024];
     for (int i = 0; i < count; i++) {
-        buffer[i] = session->input_pipeline[(tail + i) % sizeof(session->input_pipeline)];
+        buffer[i] = session->input_pipeline[(tail + i) & session->pipeline_mask];
     }
     buffer[count] = '\0';
 
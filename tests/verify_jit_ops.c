@@ -8,7 +8,7 @@
 void test_op_queue_integration(void) {
     KTermConfig config = {0};
     KTerm* term = KTerm_Create(config);
-    KTermSession* session = &term->sessions[term->active_session];
+    KTermSession* session = term->sessions[term->active_session];
 
     session->use_op_queue = true;
 
@@ -29,7 +29,7 @@ void test_scroll_op(void) {
     KTermConfig config = {0};
     config.height = 10;
     KTerm* term = KTerm_Create(config);
-    KTermSession* session = &term->sessions[term->active_session];
+    KTermSession* session = term->sessions[term->active_session];
 
     session->use_op_queue = true;
 
@@ -8,7 +8,7 @@
 void test_combining_char_storage(void) {
     KTermConfig config = {0};
     KTerm* term = KTerm_Create(config);
-    KTermSession* session = &term->sessions[term->active_session];
+    KTermSession* session = term->sessions[term->active_session];
 
     // Enable Wide Chars / Unicode Width logic
     // This is required for KTerm_wcwidth to return 0 for combining chars
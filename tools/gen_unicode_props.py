@@ -0,0 +1,247 @@
+#!/usr/bin/env python3
+"""Generate kt_unicode_props.h, the K-Term codepoint property table.
+
+Every codepoint maps to one 16-bit word holding its display width, CP437 alias,
+simplified BiDi class, mirror offset and combining flag. The table is two-stage:
+kt_uprops_stage1[cp >> 8] selects a 256-entry block in kt_uprops_stage2, and
+identical blocks are stored once.
+
+Usage: python3 tools/gen_unicode_props.py > kt_unicode_props.h
+"""
+
+# Non-spacing (combining) characters, width 0. Taken from Vim's table.
+COMBINING = [
+    (0x0300, 0x036F), (0x0483, 0x0489), (0x0591, 0x05BD), (0x05BF, 0x05BF),
+    (0x05C1, 0x05C2), (0x05C4, 0x05C5), (0x05C7, 0x05C7), (0x0610, 0x061A),
+    (0x064B, 0x065F), (0x0670, 0x0670), (0x06D6, 0x06DC), (0x06DF, 0x06E4),
+    (0x06E7, 0x06E8), (0x06EA, 0x06ED), (0x0711, 0x0711), (0x0730, 0x074A),
+    (0x07A6, 0x07B0), (0x07EB, 0x07F3), (0x07FD, 0x07FD), (0x0816, 0x0819),
+    (0x081B, 0x0823), (0x0825, 0x0827), (0x0829, 0x082D), (0x0859, 0x085B),
+    (0x08D3, 0x08E1), (0x08E3, 0x0903), (0x093A, 0x093C), (0x093E, 0x094F),
+    (0x0951, 0x0957), (0x0962, 0x0963), (0x0981, 0x0983), (0x09BC, 0x09BC),
+    (0x09BE, 0x09C4), (0x09C7, 0x09C8), (0x09CB, 0x09CD), (0x09D7, 0x09D7),
+    (0x09E2, 0x09E3), (0x09FE, 0x09FE), (0x0A01, 0x0A03), (0x0A3C, 0x0A3C),
+    (0x0A3E, 0x0A42), (0x0A47, 0x0A48), (0x0A4B, 0x0A4D), (0x0A51, 0x0A51),
+    (0x0A70, 0x0A71), (0x0A75, 0x0A75), (0x0A81, 0x0A83), (0x0ABC, 0x0ABC),
+    (0x0ABE, 0x0AC5), (0x0AC7, 0x0AC9), (0x0ACB, 0x0ACD), (0x0AE2, 0x0AE3),
+    (0x0AFA, 0x0AFF), (0x0B01, 0x0B03), (0x0B3C, 0x0B3C), (0x0B3E, 0x0B44),
+    (0x0B47, 0x0B48), (0x0B4B, 0x0B4D), (0x0B56, 0x0B57), (0x0B62, 0x0B63),
+    (0x0B82, 0x0B82), (0x0BBE, 0x0BC2), (0x0BC6, 0x0BC8), (0x0BCA, 0x0BCD),
+    (0x0BD7, 0x0BD7), (0x0C00, 0x0C04), (0x0C3E, 0x0C44), (0x0C46, 0x0C48),
+    (0x0C4A, 0x0C4D), (0x0C55, 0x0C56), (0x0C62, 0x0C63), (0x0C81, 0x0C83),
+    (0x0CBC, 0x0CBC), (0x0CBE, 0x0CC4), (0x0CC6, 0x0CC8), (0x0CCA, 0x0CCD),
+    (0x0CD5, 0x0CD6), (0x0CE2, 0x0CE3), (0x0D00, 0x0D03), (0x0D3B, 0x0D3C),
+    (0x0D3E, 0x0D44), (0x0D46, 0x0D48), (0x0D4A, 0x0D4D), (0x0D57, 0x0D57),
+    (0x0D62, 0x0D63), (0x0D82, 0x0D83), (0x0DCA, 0x0DCA), (0x0DCF, 0x0DD4),
+    (0x0DD6, 0x0DD6), (0x0DD8, 0x0DDF), (0x0DF2, 0x0DF3), (0x0E31, 0x0E31),
+    (0x0E34, 0x0E3A), (0x0E47, 0x0E4E), (0x0EB1, 0x0EB1), (0x0EB4, 0x0EBC),
+    (0x0EC8, 0x0ECD), (0x0F18, 0x0F19), (0x0F35, 0x0F35), (0x0F37, 0x0F37),
+    (0x0F39, 0x0F39), (0x0F3E, 0x0F3F), (0x0F71, 0x0F84), (0x0F86, 0x0F87),
+    (0x0F8D, 0x0F97), (0x0F99, 0x0FBC), (0x0FC6, 0x0FC6), (0x102B, 0x103E),
+    (0x1056, 0x1059), (0x105E, 0x1060), (0x1062, 0x1064), (0x1067, 0x106D),
+    (0x1071, 0x1074), (0x1082, 0x108D), (0x108F, 0x108F), (0x109A, 0x109D),
+    (0x135D, 0x135F), (0x1712, 0x1714), (0x1732, 0x1734), (0x1752, 0x1753),
+    (0x1772, 0x1773), (0x17B4, 0x17D3), (0x17DD, 0x17DD), (0x180B, 0x180D),
+    (0x1885, 0x1886), (0x18A9, 0x18A9), (0x1920, 0x192B), (0x1930, 0x193B),
+    (0x1A17, 0x1A1B), (0x1A55, 0x1A5E), (0x1A60, 0x1A7C), (0x1A7F, 0x1A7F),
+    (0x1AB0, 0x1ABE), (0x1B00, 0x1B04), (0x1B34, 0x1B44), (0x1B6B, 0x1B73),
+    (0x1B80, 0x1B82), (0x1BA1, 0x1BAD), (0x1BE6, 0x1BF3), (0x1C24, 0x1C37),
+    (0x1CD0, 0x1CD2), (0x1CD4, 0x1CE8), (0x1CED, 0x1CED), (0x1CF4, 0x1CF4),
+    (0x1CF7, 0x1CF9), (0x1DC0, 0x1DF9), (0x1DFB, 0x1DFF), (0x20D0, 0x20F0),
+    (0x2CEF, 0x2CF1), (0x2D7F, 0x2D7F), (0x2DE0, 0x2DFF), (0x302A, 0x302F),
+    (0x3099, 0x309A), (0xA66F, 0xA672), (0xA674, 0xA67D), (0xA69E, 0xA69F),
+    (0xA6F0, 0xA6F1), (0xA802, 0xA802), (0xA806, 0xA806), (0xA80B, 0xA80B),
+    (0xA823, 0xA827), (0xA880, 0xA881), (0xA8B4, 0xA8C5), (0xA8E0, 0xA8F1),
+    (0xA8FF, 0xA8FF), (0xA926, 0xA92D), (0xA947, 0xA953), (0xA980, 0xA983),
+    (0xA9B3, 0xA9C0), (0xA9E5, 0xA9E5), (0xAA29, 0xAA36), (0xAA43, 0xAA43),
+    (0xAA4C, 0xAA4D), (0xAA7B, 0xAA7D), (0xAAB0, 0xAAB0), (0xAAB2, 0xAAB4),
+    (0xAAB7, 0xAAB8), (0xAABE, 0xAABF), (0xAAC1, 0xAAC1), (0xAAEB, 0xAAEF),
+    (0xAAF5, 0xAAF6), (0xABE3, 0xABEA), (0xABEC, 0xABED), (0xFB1E, 0xFB1E),
+    (0xFE00, 0xFE0F), (0xFE20, 0xFE2F), (0x101FD, 0x101FD), (0x102E0, 0x102E0),
+    (0x10376, 0x1037A), (0x10A01, 0x10A03), (0x10A05, 0x10A06), (0x10A0C, 0x10A0F),
+    (0x10A38, 0x10A3A), (0x10A3F, 0x10A3F), (0x10AE5, 0x10AE6), (0x10D24, 0x10D27),
+    (0x10F46, 0x10F50), (0x11000, 0x11002), (0x11038, 0x11046), (0x1107F, 0x11082),
+    (0x110B0, 0x110BA), (0x11100, 0x11102), (0x11127, 0x11134), (0x11145, 0x11146),
+    (0x11173, 0x11173), (0x11180, 0x11182), (0x111B3, 0x111C0), (0x111C9, 0x111CC),
+    (0x1122C, 0x11237), (0x1123E, 0x1123E), (0x112DF, 0x112EA), (0x11300, 0x11303),
+    (0x1133B, 0x1133C), (0x1133E, 0x11344), (0x11347, 0x11348), (0x1134B, 0x1134D),
+    (0x11357, 0x11357), (0x11362, 0x11363), (0x11366, 0x1136C), (0x11370, 0x11374),
+    (0x11435, 0x11446), (0x1145E, 0x1145E), (0x114B0, 0x114C3), (0x115AF, 0x115B5),
+    (0x115B8, 0x115C0), (0x115DC, 0x115DD), (0x11630, 0x11640), (0x116AB, 0x116B7),
+    (0x1171D, 0x1172B), (0x1182C, 0x1183A), (0x119D1, 0x119D7), (0x119DA, 0x119E0),
+    (0x119E4, 0x119E4), (0x11A01, 0x11A0A), (0x11A33, 0x11A39), (0x11A3B, 0x11A3E),
+    (0x11A47, 0x11A47), (0x11A51, 0x11A5B), (0x11A8A, 0x11A99), (0x11C2F, 0x11C36),
+    (0x11C38, 0x11C3F), (0x11C92, 0x11CA7), (0x11CA9, 0x11CB6), (0x11D31, 0x11D36),
+    (0x11D3A, 0x11D3A), (0x11D3C, 0x11D3D), (0x11D3F, 0x11D45), (0x11D47, 0x11D47),
+    (0x11D8A, 0x11D8E), (0x11D90, 0x11D91), (0x11D93, 0x11D97), (0x11EF3, 0x11EF6),
+    (0x16AF0, 0x16AF4), (0x16B30, 0x16B36), (0x16F4F, 0x16F4F), (0x16F51, 0x16F87),
+    (0x16F8F, 0x16F92), (0x1BC9D, 0x1BC9E), (0x1D165, 0x1D169), (0x1D16D, 0x1D172),
+    (0x1D17B, 0x1D182), (0x1D185, 0x1D18B), (0x1D1AA, 0x1D1AD), (0x1D242, 0x1D244),
+    (0x1DA00, 0x1DA36), (0x1DA3B, 0x1DA6C), (0x1DA75, 0x1DA75), (0x1DA84, 0x1DA84),
+    (0x1DA9B, 0x1DA9F), (0x1DAA1, 0x1DAAF), (0x1E000, 0x1E006), (0x1E008, 0x1E018),
+    (0x1E01B, 0x1E021), (0x1E023, 0x1E024), (0x1E026, 0x1E02A), (0x1E130, 0x1E136),
+    (0x1E2EC, 0x1E2EF), (0x1E8D0, 0x1E8D6), (0x1E944, 0x1E94A), (0xE0100, 0xE01EF),
+]
+
+# East Asian wide ranges (Markus Kuhn's wcwidth), width 2.
+WIDE = [
+    (0x1100, 0x115F), (0x2329, 0x232A), (0x2E80, 0x303E), (0x3040, 0xA4CF),
+    (0xAC00, 0xD7A3), (0xF900, 0xFAFF), (0xFE10, 0xFE19), (0xFE30, 0xFE6F),
+    (0xFF00, 0xFF60), (0xFFE0, 0xFFE6), (0x20000, 0x2FFFD), (0x30000, 0x3FFFD),
+]
+
+# Unicode codepoints of CP437 0x80-0xFF (the same table as kCp437ToUnicode).
+CP437_UPPER = [
+    0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x00E0, 0x00E5, 0x00E7,
+    0x00EA, 0x00EB, 0x00E8, 0x00EF, 0x00EE, 0x00EC, 0x00C4, 0x00C5,
+    0x00C9, 0x00E6, 0x00C6, 0x00F4, 0x00F6, 0x00F2, 0x00FB, 0x00F9,
+    0x00FF, 0x00D6, 0x00DC, 0x00A2, 0x00A3, 0x00A5, 0x20A7, 0x0192,
+    0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x00AA, 0x00BA,
+    0x00BF, 0x2310, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB,
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556,
+    0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510,
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F,
+    0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567,
+    0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B,
+    0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580,
+    0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4,
+    0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229,
+    0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248,
+    0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0,
+]
+
+# Hebrew and Arabic blocks, BiDi class R.
+RTL = [
+    (0x0590, 0x05FF), (0x0600, 0x06FF), (0x0750, 0x077F),
+    (0x08A0, 0x08FF), (0xFB50, 0xFDFF), (0xFE70, 0xFEFF),
+]
+
+# Mirrored pairs applied inside RTL runs.
+MIRROR = {'(': ')', ')': '(', '[': ']', ']': '[', '{': '}', '}': '{', '<': '>', '>': '<'}
+
+BIDI_L, BIDI_R, BIDI_N = 0, 1, 2
+MAX_CP = 0x110000
+
+
+def in_ranges(cp, ranges):
+    return any(lo <= cp <= hi for lo, hi in ranges)
+
+
+def build():
+    width = [1] * MAX_CP
+    combining = [0] * MAX_CP
+    for lo, hi in WIDE:
+        for cp in range(lo, hi + 1):
+            width[cp] = 2
+    for lo, hi in COMBINING:
+        for cp in range(lo, hi + 1):
+            width[cp] = 0
+            combining[cp] = 1
+    width[0] = 0
+    for cp in list(range(1, 32)) + list(range(0x7F, 0xA0)):
+        width[cp] = -1
+        combining[cp] = 0
+
+    cp437 = [ord('?')] * MAX_CP
+    for cp in range(128):
+        cp437[cp] = cp
+    for i, u in enumerate(CP437_UPPER):
+        cp437[u] = 0x80 + i
+
+    props = [0] * MAX_CP
+    for cp in range(MAX_CP):
+        if in_ranges(cp, RTL):
+            bidi = BIDI_R
+        elif ord('0') <= cp <= ord('9'):
+            bidi = BIDI_L
+        elif cp < 0x41 or 0x5B <= cp <= 0x60 or 0x7B <= cp <= 0x7E:
+            bidi = BIDI_N
+        else:
+            bidi = BIDI_L
+        mirror = 0
+        if cp < 128 and chr(cp) in MIRROR:
+            mirror = ord(MIRROR[chr(cp)]) - cp + 4
+        w = 3 if width[cp] < 0 else width[cp]
+        props[cp] = cp437[cp] | (w << 8) | (combining[cp] << 10) | (bidi << 11) | (mirror << 13)
+    return props
+
+
+def main():
+    props = build()
+    blocks = {}
+    block_list = []
+    stage1 = []
+    for b in range(MAX_CP >> 8):
+        block = tuple(props[b << 8:(b + 1) << 8])
+        if block not in blocks:
+            blocks[block] = len(block_list)
+            block_list.append(block)
+        stage1.append(blocks[block])
+    stage1_type = 'uint8_t' if len(block_list) <= 256 else 'uint16_t'
+
+    out = []
+    out.append('#ifndef KT_UNICODE_PROPS_H')
+    out.append('#define KT_UNICODE_PROPS_H')
+    out.append('')
+    out.append('// Generated by tools/gen_unicode_props.py -- do not edit by hand.')
+    out.append('')
+    out.append('#include <stdint.h>')
+    out.append('')
+    out.append('#ifdef __cplusplus')
+    out.append('extern "C" {')
+    out.append('#endif')
+    out.append('')
+    out.append('/**')
+    out.append(' * Codepoint Property Table')
+    out.append(' * ========================')
+    out.append(' * One 16-bit word per codepoint, found with two indexed loads:')
+    out.append(' *')
+    out.append(' *   uint16_t p = kt_uprops_stage2[kt_uprops_stage1[cp >> 8]][cp & 0xFF];')
+    out.append(' *')
+    out.append(' * Layout:')
+    out.append(" *   [0-7]   CP437 alias ('?' when the codepoint has none)")
+    out.append(' *   [8-9]   Width: 0, 1, 2, or 3 for C0/C1 controls (wcwidth -1)')
+    out.append(' *   [10]    Combining mark')
+    out.append(' *   [11-12] Simplified BiDi class (0 = L, 1 = R, 2 = N)')
+    out.append(' *   [13-15] Mirror: 0 = none, otherwise mirrored codepoint = cp + value - 4')
+    out.append(' */')
+    out.append('#define KT_UPROPS_BLOCKS %d' % len(block_list))
+    out.append('')
+    out.append('static const %s kt_uprops_stage1[0x1100] = {' % stage1_type)
+    for i in range(0, len(stage1), 16):
+        out.append('    ' + ' '.join('%d,' % v for v in stage1[i:i + 16]))
+    out.append('};')
+    out.append('')
+    out.append('static const uint16_t kt_uprops_stage2[KT_UPROPS_BLOCKS][256] = {')
+    for n, block in enumerate(block_list):
+        out.append('    // Block %d' % n)
+        out.append('    {')
+        for i in range(0, 256, 16):
+            out.append('        ' + ' '.join('0x%04X,' % v for v in block[i:i + 16]))
+        out.append('    },')
+    out.append('};')
+    out.append('')
+    out.append('// Properties of codepoints beyond U+10FFFF: width 1, no alias, L.')
+    out.append("#define KT_UPROPS_OUT_OF_RANGE 0x%04X" % (ord('?') | (1 << 8)))
+    out.append('')
+    out.append('static inline uint16_t KTerm_CodepointProps(uint32_t cp) {')
+    out.append('    if (cp >= 0x110000) return KT_UPROPS_OUT_OF_RANGE;')
+    out.append('    return kt_uprops_stage2[kt_uprops_stage1[cp >> 8]][cp & 0xFF];')
+    out.append('}')
+    out.append('')
+    out.append('#define KT_UPROPS_CP437(p)     ((uint8_t)((p) & 0xFF))')
+    out.append('#define KT_UPROPS_WIDTH(p)     ((((p) >> 8) & 3) == 3 ? -1 : (int)(((p) >> 8) & 3))')
+    out.append('#define KT_UPROPS_COMBINING(p) (((p) >> 10) & 1)')
+    out.append('#define KT_UPROPS_BIDI(p)      ((int)(((p) >> 11) & 3))')
+    out.append('#define KT_UPROPS_MIRROR(p, cp) ((((p) >> 13) & 7) ? (uint32_t)((cp) + (((p) >> 13) & 7) - 4) : (cp))')
+    out.append('')
+    out.append('#ifdef __cplusplus')
+    out.append('}')
+    out.append('#endif')
+    out.append('')
+    out.append('#endif // KT_UNICODE_PROPS_H')
+    print('\n'.join(out))
+
+
+if __name__ == '__main__':
+    main()